@@ -674,6 +674,76 @@ HYPRE_IJMatrixAddToValues2( HYPRE_IJMatrix       matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixAddToValuesCOO( HYPRE_IJMatrix       matrix,
+                              HYPRE_Int            nelms,
+                              const HYPRE_BigInt  *rows,
+                              const HYPRE_BigInt  *cols,
+                              const HYPRE_Complex *values )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (nelms == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (nelms < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   if (!rows)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   if (!cols)
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   if (!values)
+   {
+      hypre_error_in_arg(5);
+      return hypre_error_flag;
+   }
+
+   if ( hypre_IJMatrixObjectType(ijmatrix) != HYPRE_PARCSR )
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+   HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1( hypre_IJMatrixMemoryLocation(matrix) );
+
+   if (exec == HYPRE_EXEC_DEVICE)
+   {
+      /* the device path already assembles from a sorted stack of triples */
+      hypre_IJMatrixSetAddValuesParCSRDevice(ijmatrix, nelms, NULL, rows, NULL, cols, values, "add");
+   }
+   else
+#endif
+   {
+      hypre_IJMatrixAddToValuesCOOParCSR(ijmatrix, nelms, rows, cols, values);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -1115,6 +1185,76 @@ HYPRE_IJMatrixPrint( HYPRE_IJMatrix  matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_IJMatrixReadBinary
+ * create IJMatrix on host memory
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixReadBinary( const char     *filename,
+                          MPI_Comm        comm,
+                          HYPRE_Int       type,
+                          HYPRE_IJMatrix *matrix_ptr )
+{
+   HYPRE_IJMatrix       matrix;
+   hypre_ParCSRMatrix  *par_csr;
+   HYPRE_BigInt        *row_starts, *col_starts;
+
+   if (type != HYPRE_PARCSR)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   hypre_ParCSRMatrixReadBinary(comm, filename, &par_csr);
+   if (!par_csr)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_ParCSRMatrixSetNumNonzeros(par_csr);
+   hypre_ParCSRMatrixSetDNumNonzeros(par_csr);
+   hypre_MatvecCommPkgCreate(par_csr);
+
+   row_starts = hypre_ParCSRMatrixRowStarts(par_csr);
+   col_starts = hypre_ParCSRMatrixColStarts(par_csr);
+   HYPRE_IJMatrixCreate(comm, row_starts[0], row_starts[1] - 1,
+                        col_starts[0], col_starts[1] - 1, &matrix);
+   HYPRE_IJMatrixSetObjectType(matrix, type);
+
+   hypre_IJMatrixObject(matrix)       = (void *) par_csr;
+   hypre_IJMatrixAssembleFlag(matrix) = 1;
+
+   *matrix_ptr = matrix;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_IJMatrixPrintBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixPrintBinary( HYPRE_IJMatrix  matrix,
+                           const char     *filename )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if ( (hypre_IJMatrixObjectType(matrix) != HYPRE_PARCSR) )
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_ParCSRMatrixPrintBinary((hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix), filename);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_IJMatrixSetOMPFlag
  *--------------------------------------------------------------------------*/
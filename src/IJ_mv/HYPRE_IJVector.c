@@ -646,3 +646,66 @@ HYPRE_IJVectorPrint( HYPRE_IJVector  vector,
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * HYPRE_IJVectorReadBinary
+ * create IJVector on host memory
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJVectorReadBinary( const char     *filename,
+                          MPI_Comm        comm,
+                          HYPRE_Int       type,
+                          HYPRE_IJVector *vector_ptr )
+{
+   HYPRE_IJVector    vector;
+   hypre_ParVector  *par_vector;
+   HYPRE_BigInt     *partitioning;
+
+   if (type != HYPRE_PARCSR)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   hypre_ParVectorReadBinary(comm, filename, &par_vector);
+   if (!par_vector)
+   {
+      return hypre_error_flag;
+   }
+
+   partitioning = hypre_ParVectorPartitioning(par_vector);
+   HYPRE_IJVectorCreate(comm, partitioning[0], partitioning[1] - 1, &vector);
+   HYPRE_IJVectorSetObjectType(vector, type);
+
+   hypre_IJVectorObject(vector) = (void *) par_vector;
+
+   *vector_ptr = vector;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_IJVectorPrintBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJVectorPrintBinary( HYPRE_IJVector  vector,
+                           const char     *filename )
+{
+   if (!vector)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if ( (hypre_IJVectorObjectType(vector) != HYPRE_PARCSR) )
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_ParVectorPrintBinary((hypre_ParVector *) hypre_IJVectorObject(vector), filename);
+
+   return hypre_error_flag;
+}
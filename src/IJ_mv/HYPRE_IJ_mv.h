@@ -194,6 +194,28 @@ HYPRE_Int HYPRE_IJMatrixAddToValues2(HYPRE_IJMatrix       matrix,
                                      const HYPRE_BigInt  *cols,
                                      const HYPRE_Complex *values);
 
+/**
+ * Adds \e nelms coefficients given as unsorted (row, column, value)
+ * triples, i.e., the value \e values[k] is added to the entry in row
+ * \e rows[k] and column \e cols[k].  The same entry may appear any number
+ * of times, and rows may belong to other processors.
+ *
+ * The triples are only stored by this call.  At assembly, they are sorted,
+ * duplicates are summed, and off-processor triples are sent to their owners
+ * in one exchange.  If no values were given through the row-wise interface,
+ * the matrix is built directly from the sorted triples, which is much faster
+ * than \ref HYPRE_IJMatrixAddToValues for large finite element assemblies.
+ * Requires \ref HYPRE_IJMatrixInitialize to have been called.
+ *
+ * Not collective.
+ *
+ **/
+HYPRE_Int HYPRE_IJMatrixAddToValuesCOO(HYPRE_IJMatrix       matrix,
+                                       HYPRE_Int            nelms,
+                                       const HYPRE_BigInt  *rows,
+                                       const HYPRE_BigInt  *cols,
+                                       const HYPRE_Complex *values);
+
 /**
  * Finalize the construction of the matrix before using.
  **/
@@ -337,6 +359,23 @@ HYPRE_Int HYPRE_IJMatrixRead(const char     *filename,
 HYPRE_Int HYPRE_IJMatrixPrint(HYPRE_IJMatrix  matrix,
                               const char     *filename);
 
+/**
+ * Read the matrix from the binary files written by HYPRE_IJMatrixPrintBinary.
+ * The files may have been written with a different number of processes, in
+ * which case the rows are distributed evenly over the processes of \e comm.
+ **/
+HYPRE_Int HYPRE_IJMatrixReadBinary(const char     *filename,
+                                   MPI_Comm        comm,
+                                   HYPRE_Int       type,
+                                   HYPRE_IJMatrix *matrix);
+
+/**
+ * Print the matrix in binary form, one file per process.  The files can only
+ * be read by a build of hypre with the same integer and scalar sizes.
+ **/
+HYPRE_Int HYPRE_IJMatrixPrintBinary(HYPRE_IJMatrix  matrix,
+                                    const char     *filename);
+
 /**@}*/
 
 /*--------------------------------------------------------------------------
@@ -510,6 +549,21 @@ HYPRE_Int HYPRE_IJVectorRead(const char     *filename,
 HYPRE_Int HYPRE_IJVectorPrint(HYPRE_IJVector  vector,
                               const char     *filename);
 
+/**
+ * Read the vector from the binary files written by HYPRE_IJVectorPrintBinary.
+ * The files may have been written with a different number of processes.
+ **/
+HYPRE_Int HYPRE_IJVectorReadBinary(const char     *filename,
+                                   MPI_Comm        comm,
+                                   HYPRE_Int       type,
+                                   HYPRE_IJVector *vector);
+
+/**
+ * Print the vector in binary form, one file per process.
+ **/
+HYPRE_Int HYPRE_IJVectorPrintBinary(HYPRE_IJVector  vector,
+                                    const char     *filename);
+
 /**@}*/
 /**@}*/
 
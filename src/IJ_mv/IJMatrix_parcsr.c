@@ -675,6 +675,11 @@ hypre_IJMatrixSetValuesParCSR( hypre_IJMatrix       *matrix,
       HYPRE_BigInt *col_map_offd;
       HYPRE_Int num_cols_offd;
       HYPRE_Int j_offd;
+
+      /* values change in place, invalidate the copies used by the host matvec */
+      hypre_CSRMatrixInvalidateCopies(hypre_ParCSRMatrixDiag(par_matrix));
+      hypre_CSRMatrixInvalidateCopies(hypre_ParCSRMatrixOffd(par_matrix));
+
       for (ii = 0; ii < nrows; ii++)
       {
          row = rows[ii];
@@ -1028,12 +1033,17 @@ hypre_IJMatrixSetConstantValuesParCSRHost( hypre_IJMatrix *matrix,
    hypre_ParCSRMatrix *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject( matrix );
    hypre_CSRMatrix    *diag       = hypre_ParCSRMatrixDiag(par_matrix);
    hypre_CSRMatrix    *offd       = hypre_ParCSRMatrixOffd(par_matrix);
-   HYPRE_Complex      *diag_data  = hypre_CSRMatrixData(diag);
-   HYPRE_Complex      *offd_data  = hypre_CSRMatrixData(offd);
+   HYPRE_Complex      *diag_data;
+   HYPRE_Complex      *offd_data;
    HYPRE_Int           nnz_diag   = hypre_CSRMatrixNumNonzeros(diag);
    HYPRE_Int           nnz_offd   = hypre_CSRMatrixNumNonzeros(offd);
    HYPRE_Int           ii;
 
+   hypre_CSRMatrixInvalidateCopies(diag);
+   hypre_CSRMatrixInvalidateCopies(offd);
+   diag_data = hypre_CSRMatrixData(diag);
+   offd_data = hypre_CSRMatrixData(offd);
+
 #ifdef HYPRE_USING_OPENMP
    #pragma omp parallel for private(ii) HYPRE_SMP_SCHEDULE
 #endif
@@ -1148,6 +1158,10 @@ hypre_IJMatrixAddToValuesParCSR( hypre_IJMatrix       *matrix,
       HYPRE_BigInt *col_map_offd;
       HYPRE_Int j_offd;
 
+      /* values change in place, invalidate the copies used by the host matvec */
+      hypre_CSRMatrixInvalidateCopies(hypre_ParCSRMatrixDiag(par_matrix));
+      hypre_CSRMatrixInvalidateCopies(hypre_ParCSRMatrixOffd(par_matrix));
+
       /* AB - 4/06 - need to get this object*/
       aux_matrix = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
 
@@ -2549,6 +2563,8 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
    //HYPRE_Int row_len;
    HYPRE_Int max_num_threads;
    HYPRE_Int aux_flag, aux_flag_global;
+   HYPRE_Int coo_elmts, coo_elmts_global;
+   HYPRE_Int coo_built = 0;
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
@@ -2633,6 +2649,15 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
             HYPRE_MEMORY_HOST,
             off_proc_i, off_proc_j, off_proc_data);
       }
+
+      /* triples from the bulk COO interface */
+      coo_elmts = hypre_AuxParCSRMatrixCurrentCOOElmts(aux_matrix);
+      hypre_MPI_Allreduce(&coo_elmts, &coo_elmts_global, 1, HYPRE_MPI_INT,
+                          hypre_MPI_MAX, comm);
+      if (coo_elmts_global)
+      {
+         hypre_IJMatrixAssembleCOOParCSR(matrix, &coo_built);
+      }
    }
 
    if (hypre_IJMatrixAssembleFlag(matrix) == 0)
@@ -2643,7 +2668,13 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
       col_0 = col_partitioning[0];
       col_n = col_partitioning[1] - 1;
       /* move data into ParCSRMatrix if not there already */
-      if (hypre_AuxParCSRMatrixNeedAux(aux_matrix))
+      if (coo_built)
+      {
+         /* diag and offd were built from the sorted COO triples */
+         offd_j     = hypre_CSRMatrixJ(offd);
+         big_offd_j = hypre_CSRMatrixBigJ(offd);
+      }
+      else if (hypre_AuxParCSRMatrixNeedAux(aux_matrix))
       {
          HYPRE_Int  *diag_array;
          HYPRE_Int  *offd_array;
@@ -2916,6 +2947,10 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
       hypre_CSRMatrixSetRownnz(offd);
    }
 
+   /* values may have changed, invalidate the copies used by the host matvec */
+   hypre_CSRMatrixInvalidateCopies(diag);
+   hypre_CSRMatrixInvalidateCopies(offd);
+
    /* Free memory */
    hypre_AuxParCSRMatrixDestroy(aux_matrix);
    hypre_IJMatrixTranslator(matrix) = NULL;
@@ -3015,6 +3050,10 @@ hypre_IJMatrixSetValuesOMPParCSR( hypre_IJMatrix       *matrix,
       HYPRE_BigInt *col_map_offd;
       HYPRE_Int num_cols_offd;
 
+      /* values change in place, invalidate the copies used by the host matvec */
+      hypre_CSRMatrixInvalidateCopies(hypre_ParCSRMatrixDiag(par_matrix));
+      hypre_CSRMatrixInvalidateCopies(hypre_ParCSRMatrixOffd(par_matrix));
+
       diag = hypre_ParCSRMatrixDiag(par_matrix);
       diag_i = hypre_CSRMatrixI(diag);
       diag_j = hypre_CSRMatrixJ(diag);
@@ -3644,6 +3683,10 @@ hypre_IJMatrixAddToValuesOMPParCSR( hypre_IJMatrix       *matrix,
       HYPRE_Int num_cols_offd;
       HYPRE_BigInt *col_map_offd;
 
+      /* values change in place, invalidate the copies used by the host matvec */
+      hypre_CSRMatrixInvalidateCopies(hypre_ParCSRMatrixDiag(par_matrix));
+      hypre_CSRMatrixInvalidateCopies(hypre_ParCSRMatrixOffd(par_matrix));
+
       diag = hypre_ParCSRMatrixDiag(par_matrix);
       diag_i = hypre_CSRMatrixI(diag);
       diag_j = hypre_CSRMatrixJ(diag);
@@ -0,0 +1,952 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * IJMatrix_ParCSR bulk COO assembly (host)
+ *
+ * Triples (row, col, value) given to HYPRE_IJMatrixAddToValuesCOO are only
+ * appended to a stash in the auxiliary matrix.  At assembly the stash is
+ * split into local and off-processor triples; both parts are sorted by
+ * (row, col) with a threaded LSD radix sort and duplicates are summed with a
+ * segmented reduction.  The off-processor triples are sent to their owners in
+ * a single data exchange, merged with the local ones, and diag/offd are built
+ * directly from the sorted stream when no other values were set.
+ *
+ *****************************************************************************/
+
+#include "_hypre_IJ_mv.h"
+
+#define HYPRE_COO_RADIX_BITS 8
+#define HYPRE_COO_RADIX      (1 << HYPRE_COO_RADIX_BITS)
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixAddToValuesCOOParCSR
+ *
+ * Appends nelms triples to the COO stash of the auxiliary matrix.  Rows may
+ * belong to any processor, and the same (row, col) pair may occur any number
+ * of times; contributions are summed at assembly.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixAddToValuesCOOParCSR( hypre_IJMatrix      *matrix,
+                                    HYPRE_Int            nelms,
+                                    const HYPRE_BigInt  *rows,
+                                    const HYPRE_BigInt  *cols,
+                                    const HYPRE_Complex *values )
+{
+   hypre_AuxParCSRMatrix *aux_matrix = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+   HYPRE_BigInt           first_row  = hypre_IJMatrixGlobalFirstRow(matrix);
+   HYPRE_BigInt           last_row   = first_row + hypre_IJMatrixGlobalNumRows(matrix) - 1;
+   HYPRE_BigInt           first_col  = hypre_IJMatrixGlobalFirstCol(matrix);
+   HYPRE_BigInt           last_col   = first_col + hypre_IJMatrixGlobalNumCols(matrix) - 1;
+   HYPRE_Int              max_elmts, cur_elmts, new_max;
+   HYPRE_Int              i, num_bad_rows = 0, num_bad_cols = 0;
+
+   if (!aux_matrix)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "HYPRE_IJMatrixInitialize must be called before adding COO values\n");
+      return hypre_error_flag;
+   }
+
+   /* the radix keys of the assembly assume indices inside the global ranges */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) reduction(+:num_bad_rows,num_bad_cols) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < nelms; i++)
+   {
+      num_bad_rows += (rows[i] < first_row || rows[i] > last_row);
+      num_bad_cols += (cols[i] < first_col || cols[i] > last_col);
+   }
+
+   if (num_bad_rows)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   if (num_bad_cols)
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   max_elmts = hypre_AuxParCSRMatrixMaxCOOElmts(aux_matrix);
+   cur_elmts = hypre_AuxParCSRMatrixCurrentCOOElmts(aux_matrix);
+
+   if (cur_elmts + nelms > max_elmts)
+   {
+      new_max = hypre_max(2 * max_elmts, cur_elmts + nelms);
+
+      hypre_AuxParCSRMatrixCOOI(aux_matrix) =
+         hypre_TReAlloc(hypre_AuxParCSRMatrixCOOI(aux_matrix), HYPRE_BigInt, new_max,
+                        HYPRE_MEMORY_HOST);
+      hypre_AuxParCSRMatrixCOOJ(aux_matrix) =
+         hypre_TReAlloc(hypre_AuxParCSRMatrixCOOJ(aux_matrix), HYPRE_BigInt, new_max,
+                        HYPRE_MEMORY_HOST);
+      hypre_AuxParCSRMatrixCOOData(aux_matrix) =
+         hypre_TReAlloc(hypre_AuxParCSRMatrixCOOData(aux_matrix), HYPRE_Complex, new_max,
+                        HYPRE_MEMORY_HOST);
+      hypre_AuxParCSRMatrixMaxCOOElmts(aux_matrix) = new_max;
+   }
+
+   hypre_TMemcpy(hypre_AuxParCSRMatrixCOOI(aux_matrix) + cur_elmts, rows,
+                 HYPRE_BigInt, nelms, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(hypre_AuxParCSRMatrixCOOJ(aux_matrix) + cur_elmts, cols,
+                 HYPRE_BigInt, nelms, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(hypre_AuxParCSRMatrixCOOData(aux_matrix) + cur_elmts, values,
+                 HYPRE_Complex, nelms, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+   hypre_AuxParCSRMatrixCurrentCOOElmts(aux_matrix) = cur_elmts + nelms;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixCOORadixPass
+ *
+ * One stable counting-sort pass of (I, J, A) on the digit of K (which is
+ * either I or J) selected by shift.  Each thread counts the digits of its
+ * contiguous chunk; the bucket offsets are ordered first by digit and then
+ * by thread, which keeps the pass stable.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_IJMatrixCOORadixPass( HYPRE_Int       n,
+                            HYPRE_Int       shift,
+                            HYPRE_BigInt    base,
+                            HYPRE_BigInt   *K,
+                            HYPRE_BigInt   *I,
+                            HYPRE_BigInt   *J,
+                            HYPRE_Complex  *A,
+                            HYPRE_BigInt   *I_out,
+                            HYPRE_BigInt   *J_out,
+                            HYPRE_Complex  *A_out,
+                            HYPRE_Int      *counts )
+{
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel
+#endif
+   {
+      HYPRE_Int  num_threads   = hypre_NumActiveThreads();
+      HYPRE_Int  my_thread_num = hypre_GetThreadNum();
+      HYPRE_Int *my_counts     = counts + my_thread_num * HYPRE_COO_RADIX;
+      HYPRE_Int  ns, ne, k, b, t, d, pos, tmp;
+
+      hypre_partition1D(n, num_threads, my_thread_num, &ns, &ne);
+
+      for (b = 0; b < HYPRE_COO_RADIX; b++)
+      {
+         my_counts[b] = 0;
+      }
+      for (k = ns; k < ne; k++)
+      {
+         d = (HYPRE_Int) (((K[k] - base) >> shift) & (HYPRE_COO_RADIX - 1));
+         my_counts[d]++;
+      }
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+#endif
+      if (my_thread_num == 0)
+      {
+         pos = 0;
+         for (b = 0; b < HYPRE_COO_RADIX; b++)
+         {
+            for (t = 0; t < num_threads; t++)
+            {
+               tmp = counts[t * HYPRE_COO_RADIX + b];
+               counts[t * HYPRE_COO_RADIX + b] = pos;
+               pos += tmp;
+            }
+         }
+      }
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+#endif
+
+      for (k = ns; k < ne; k++)
+      {
+         d = (HYPRE_Int) (((K[k] - base) >> shift) & (HYPRE_COO_RADIX - 1));
+         pos = my_counts[d]++;
+         I_out[pos] = I[k];
+         J_out[pos] = J[k];
+         A_out[pos] = A[k];
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixCOONumRadixPasses
+ *
+ * Number of radix digits needed for keys in [0, range)
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJMatrixCOONumRadixPasses( HYPRE_BigInt range )
+{
+   HYPRE_Int num_passes = 0;
+
+   range = range - 1;
+   while (range > 0)
+   {
+      num_passes++;
+      range >>= HYPRE_COO_RADIX_BITS;
+   }
+
+   return num_passes;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixCOOSortAndReduce
+ *
+ * Sorts the n triples in (*I_ptr, *J_ptr, *A_ptr) by (row, col) and sums the
+ * values of duplicate entries.  Rows are in [row_base, row_base + row_range),
+ * columns in [col_base, col_base + col_range).  The input arrays are consumed;
+ * on return the pointers refer to newly arranged arrays holding *n_ptr
+ * distinct entries.  The sort is stable, so duplicates are summed in input
+ * order and the result does not depend on the number of threads.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixCOOSortAndReduce( HYPRE_Int       *n_ptr,
+                                HYPRE_BigInt   **I_ptr,
+                                HYPRE_BigInt   **J_ptr,
+                                HYPRE_Complex  **A_ptr,
+                                HYPRE_BigInt     row_base,
+                                HYPRE_BigInt     row_range,
+                                HYPRE_BigInt     col_base,
+                                HYPRE_BigInt     col_range )
+{
+   HYPRE_Int       n = *n_ptr;
+   HYPRE_BigInt   *I = *I_ptr;
+   HYPRE_BigInt   *J = *J_ptr;
+   HYPRE_Complex  *A = *A_ptr;
+   HYPRE_BigInt   *I_tmp, *J_tmp, *swap_big;
+   HYPRE_Complex  *A_tmp, *swap_complex;
+   HYPRE_Int      *counts, *seg_counts;
+   HYPRE_Int       max_num_threads = hypre_NumThreads();
+   HYPRE_Int       num_col_passes, num_row_passes, pass;
+   HYPRE_Int       num_segments = 0;
+
+   if (n == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   I_tmp  = hypre_TAlloc(HYPRE_BigInt,  n, HYPRE_MEMORY_HOST);
+   J_tmp  = hypre_TAlloc(HYPRE_BigInt,  n, HYPRE_MEMORY_HOST);
+   A_tmp  = hypre_TAlloc(HYPRE_Complex, n, HYPRE_MEMORY_HOST);
+   counts = hypre_TAlloc(HYPRE_Int, max_num_threads * HYPRE_COO_RADIX, HYPRE_MEMORY_HOST);
+
+   num_col_passes = hypre_IJMatrixCOONumRadixPasses(col_range);
+   num_row_passes = hypre_IJMatrixCOONumRadixPasses(row_range);
+
+   /* least significant key (column) first */
+   for (pass = 0; pass < num_col_passes + num_row_passes; pass++)
+   {
+      if (pass < num_col_passes)
+      {
+         hypre_IJMatrixCOORadixPass(n, pass * HYPRE_COO_RADIX_BITS, col_base, J,
+                                    I, J, A, I_tmp, J_tmp, A_tmp, counts);
+      }
+      else
+      {
+         hypre_IJMatrixCOORadixPass(n, (pass - num_col_passes) * HYPRE_COO_RADIX_BITS, row_base, I,
+                                    I, J, A, I_tmp, J_tmp, A_tmp, counts);
+      }
+
+      swap_big = I; I = I_tmp; I_tmp = swap_big;
+      swap_big = J; J = J_tmp; J_tmp = swap_big;
+      swap_complex = A; A = A_tmp; A_tmp = swap_complex;
+   }
+
+   hypre_TFree(counts, HYPRE_MEMORY_HOST);
+
+   /* segmented reduction into the spare arrays */
+   seg_counts = hypre_CTAlloc(HYPRE_Int, max_num_threads + 1, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel
+#endif
+   {
+      HYPRE_Int      num_threads   = hypre_NumActiveThreads();
+      HYPRE_Int      my_thread_num = hypre_GetThreadNum();
+      HYPRE_Int      ns, ne, k, kk, t, pos;
+      HYPRE_Complex  sum;
+
+      hypre_partition1D(n, num_threads, my_thread_num, &ns, &ne);
+
+      /* count segments starting in this chunk */
+      pos = 0;
+      for (k = ns; k < ne; k++)
+      {
+         if (k == 0 || I[k] != I[k - 1] || J[k] != J[k - 1])
+         {
+            pos++;
+         }
+      }
+      seg_counts[my_thread_num + 1] = pos;
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+#endif
+      if (my_thread_num == 0)
+      {
+         for (t = 0; t < num_threads; t++)
+         {
+            seg_counts[t + 1] += seg_counts[t];
+         }
+         num_segments = seg_counts[num_threads];
+      }
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+#endif
+
+      /* each segment is reduced by the thread owning its first entry */
+      pos = seg_counts[my_thread_num];
+      for (k = ns; k < ne; k++)
+      {
+         if (k == 0 || I[k] != I[k - 1] || J[k] != J[k - 1])
+         {
+            sum = A[k];
+            for (kk = k + 1; kk < n && I[kk] == I[k] && J[kk] == J[k]; kk++)
+            {
+               sum += A[kk];
+            }
+            I_tmp[pos] = I[k];
+            J_tmp[pos] = J[k];
+            A_tmp[pos] = sum;
+            pos++;
+         }
+      }
+   }
+
+   hypre_TFree(seg_counts, HYPRE_MEMORY_HOST);
+
+   hypre_TFree(I, HYPRE_MEMORY_HOST);
+   hypre_TFree(J, HYPRE_MEMORY_HOST);
+   hypre_TFree(A, HYPRE_MEMORY_HOST);
+
+   *n_ptr = num_segments;
+   *I_ptr = I_tmp;
+   *J_ptr = J_tmp;
+   *A_ptr = A_tmp;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixCOOExchangeOffProc
+ *
+ * Sends the off-processor triples, sorted by row, to the owners of their
+ * rows and returns the triples received from other processors, ordered by
+ * sender rank.  The owners are located through the assumed partition; the
+ * values themselves are moved in a single data exchange.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJMatrixCOOExchangeOffProc( hypre_IJMatrix   *matrix,
+                                  HYPRE_Int         num_send,
+                                  HYPRE_BigInt     *send_i,
+                                  HYPRE_BigInt     *send_j,
+                                  HYPRE_Complex    *send_data,
+                                  HYPRE_Int        *num_recv_ptr,
+                                  HYPRE_BigInt    **recv_i_ptr,
+                                  HYPRE_BigInt    **recv_j_ptr,
+                                  HYPRE_Complex   **recv_data_ptr )
+{
+   MPI_Comm                    comm             = hypre_IJMatrixComm(matrix);
+   HYPRE_BigInt                global_first_row = hypre_IJMatrixGlobalFirstRow(matrix);
+   HYPRE_BigInt                global_num_rows  = hypre_IJMatrixGlobalNumRows(matrix);
+   hypre_IJAssumedPart        *apart;
+   hypre_DataExchangeResponse  response_obj1, response_obj2;
+   hypre_ProcListElements      send_proc_obj;
+
+   HYPRE_Int                   num_procs, max_contacts, num_contacts, num_ranges;
+   HYPRE_Int                  *contact_procs, *contact_vec_starts;
+   HYPRE_BigInt               *contact_buf;
+   HYPRE_BigInt               *response_buf = NULL;
+   HYPRE_Int                  *response_buf_starts = NULL;
+   HYPRE_BigInt                range_start, range_end;
+
+   HYPRE_Int                   num_send_procs, num_recvs, num_recv;
+   HYPRE_Int                  *owner, *send_procs, *send_counts, *send_vec_starts, *send_pos;
+   HYPRE_Int                  *order;
+   HYPRE_Int                   obj_size_bytes, storage, count;
+   char                       *send_buf, *recv_buf;
+   HYPRE_BigInt               *recv_i;
+   HYPRE_BigInt               *recv_j;
+   HYPRE_Complex              *recv_data;
+
+   HYPRE_Int                   i, k, kk, p, proc_id, pos;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   if (hypre_IJMatrixAssumedPart(matrix) == NULL)
+   {
+      hypre_IJMatrixCreateAssumedPartition(matrix);
+   }
+   apart = (hypre_IJAssumedPart *) hypre_IJMatrixAssumedPart(matrix);
+
+   /* contact the assumed owners with the ranges of rows we hold */
+   max_contacts       = hypre_min(num_send, num_procs);
+   contact_procs      = hypre_CTAlloc(HYPRE_Int,    max_contacts,     HYPRE_MEMORY_HOST);
+   contact_vec_starts = hypre_CTAlloc(HYPRE_Int,    max_contacts + 1, HYPRE_MEMORY_HOST);
+   contact_buf        = hypre_CTAlloc(HYPRE_BigInt, 2 * max_contacts, HYPRE_MEMORY_HOST);
+
+   num_contacts = 0;
+   range_end    = global_first_row - 1;
+   for (k = 0; k < num_send; k++)
+   {
+      if (send_i[k] > range_end)
+      {
+         hypre_GetAssumedPartitionProcFromRow(comm, send_i[k], global_first_row,
+                                              global_num_rows, &proc_id);
+         hypre_GetAssumedPartitionRowRange(comm, proc_id, global_first_row,
+                                           global_num_rows, &range_start, &range_end);
+         if (num_contacts > 0)
+         {
+            contact_buf[2 * num_contacts - 1] = send_i[k - 1];
+         }
+         contact_procs[num_contacts]      = proc_id;
+         contact_vec_starts[num_contacts] = 2 * num_contacts;
+         contact_buf[2 * num_contacts]    = send_i[k];
+         num_contacts++;
+      }
+   }
+   if (num_contacts > 0)
+   {
+      contact_buf[2 * num_contacts - 1] = send_i[num_send - 1];
+   }
+   contact_vec_starts[num_contacts] = 2 * num_contacts;
+
+   response_obj1.fill_response = hypre_RangeFillResponseIJDetermineRecvProcs;
+   response_obj1.data1 = apart;
+   response_obj1.data2 = NULL;
+
+   hypre_DataExchangeList(num_contacts, contact_procs, contact_buf, contact_vec_starts,
+                          sizeof(HYPRE_BigInt), sizeof(HYPRE_BigInt), &response_obj1, 6, 1,
+                          comm, (void**) &response_buf, &response_buf_starts);
+
+   hypre_TFree(contact_procs, HYPRE_MEMORY_HOST);
+   hypre_TFree(contact_vec_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(contact_buf, HYPRE_MEMORY_HOST);
+
+   /* response_buf holds (owner, upper row bound) pairs in increasing row order */
+   num_ranges = response_buf_starts[num_contacts] / 2;
+   owner      = hypre_TAlloc(HYPRE_Int, num_send, HYPRE_MEMORY_HOST);
+   k = 0;
+   for (i = 0; i < num_ranges; i++)
+   {
+      while (k < num_send && send_i[k] <= response_buf[2 * i + 1])
+      {
+         owner[k++] = (HYPRE_Int) response_buf[2 * i];
+      }
+   }
+   hypre_assert(k == num_send);
+
+   hypre_TFree(response_buf, HYPRE_MEMORY_HOST);
+   hypre_TFree(response_buf_starts, HYPRE_MEMORY_HOST);
+
+   /* distinct owners, in increasing rank */
+   send_procs     = hypre_TAlloc(HYPRE_Int, hypre_min(num_send, num_procs), HYPRE_MEMORY_HOST);
+   num_send_procs = 0;
+   for (k = 0; k < num_send; k++)
+   {
+      if (k == 0 || owner[k] != owner[k - 1])
+      {
+         send_procs[num_send_procs++] = owner[k];
+      }
+   }
+   hypre_qsort0(send_procs, 0, num_send_procs - 1);
+   p = 0;
+   for (i = 0; i < num_send_procs; i++)
+   {
+      if (i == 0 || send_procs[i] != send_procs[i - 1])
+      {
+         send_procs[p++] = send_procs[i];
+      }
+   }
+   num_send_procs = p;
+
+   /* replace owners by their position in send_procs and count */
+   send_counts = hypre_CTAlloc(HYPRE_Int, num_send_procs, HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_send; k = kk)
+   {
+      p = hypre_BinarySearch(send_procs, owner[k], num_send_procs);
+      for (kk = k; kk < num_send && owner[kk] == send_procs[p]; kk++)
+      {
+         owner[kk] = p;
+      }
+      send_counts[p] += kk - k;
+   }
+
+   /* pack: for each owner, count followed by rows, columns and values */
+   obj_size_bytes  = hypre_max(sizeof(HYPRE_BigInt), sizeof(HYPRE_Complex));
+   send_vec_starts = hypre_TAlloc(HYPRE_Int, num_send_procs + 1, HYPRE_MEMORY_HOST);
+   send_pos        = hypre_TAlloc(HYPRE_Int, num_send_procs, HYPRE_MEMORY_HOST);
+   storage = 0;
+   for (p = 0; p < num_send_procs; p++)
+   {
+      send_vec_starts[p] = storage;
+      send_pos[p]        = storage + 1;
+      storage           += 1 + 3 * send_counts[p];
+   }
+   send_vec_starts[num_send_procs] = storage;
+
+   send_buf = hypre_CTAlloc(char, storage * obj_size_bytes, HYPRE_MEMORY_HOST);
+   for (p = 0; p < num_send_procs; p++)
+   {
+      *((HYPRE_Int *) (send_buf + send_vec_starts[p] * obj_size_bytes)) = send_counts[p];
+   }
+   for (k = 0; k < num_send; k++)
+   {
+      p     = owner[k];
+      count = send_counts[p];
+      pos   = send_pos[p]++;
+      *((HYPRE_BigInt *)  (send_buf + pos * obj_size_bytes))                 = send_i[k];
+      *((HYPRE_BigInt *)  (send_buf + (pos + count) * obj_size_bytes))       = send_j[k];
+      *((HYPRE_Complex *) (send_buf + (pos + 2 * count) * obj_size_bytes))   = send_data[k];
+   }
+
+   hypre_TFree(owner, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_pos, HYPRE_MEMORY_HOST);
+
+   /* the only exchange of matrix values */
+   send_proc_obj.length                 = 0;
+   send_proc_obj.storage_length         = num_send_procs + 5;
+   send_proc_obj.id                     = hypre_CTAlloc(HYPRE_Int, send_proc_obj.storage_length + 1,
+                                                        HYPRE_MEMORY_HOST);
+   send_proc_obj.vec_starts             = hypre_CTAlloc(HYPRE_Int, send_proc_obj.storage_length + 1,
+                                                        HYPRE_MEMORY_HOST);
+   send_proc_obj.vec_starts[0]          = 0;
+   send_proc_obj.element_storage_length = storage + 20;
+   send_proc_obj.v_elements             = hypre_TAlloc(char, obj_size_bytes *
+                                                       send_proc_obj.element_storage_length,
+                                                       HYPRE_MEMORY_HOST);
+
+   response_obj2.fill_response = hypre_FillResponseIJOffProcVals;
+   response_obj2.data1 = NULL;
+   response_obj2.data2 = &send_proc_obj;
+
+   hypre_DataExchangeList(num_send_procs, send_procs, send_buf, send_vec_starts, obj_size_bytes,
+                          0, &response_obj2, 0, 2, comm, (void **) &response_buf,
+                          &response_buf_starts);
+
+   hypre_TFree(response_buf, HYPRE_MEMORY_HOST);
+   hypre_TFree(response_buf_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_procs, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_vec_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_buf, HYPRE_MEMORY_HOST);
+
+   /* unpack in order of sender rank so that the result is deterministic */
+   num_recvs = send_proc_obj.length;
+   order     = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+   num_recv  = 0;
+   for (i = 0; i < num_recvs; i++)
+   {
+      order[i] = i;
+      num_recv += *((HYPRE_Int *) (send_proc_obj.v_elements +
+                                   send_proc_obj.vec_starts[i] * obj_size_bytes));
+   }
+   hypre_qsort2i(send_proc_obj.id, order, 0, num_recvs - 1);
+
+   recv_i    = hypre_TAlloc(HYPRE_BigInt,  num_recv, HYPRE_MEMORY_HOST);
+   recv_j    = hypre_TAlloc(HYPRE_BigInt,  num_recv, HYPRE_MEMORY_HOST);
+   recv_data = hypre_TAlloc(HYPRE_Complex, num_recv, HYPRE_MEMORY_HOST);
+
+   pos = 0;
+   for (i = 0; i < num_recvs; i++)
+   {
+      recv_buf = send_proc_obj.v_elements + send_proc_obj.vec_starts[order[i]] * obj_size_bytes;
+      count    = *((HYPRE_Int *) recv_buf);
+      recv_buf += obj_size_bytes;
+      for (k = 0; k < count; k++)
+      {
+         recv_i[pos + k]    = *((HYPRE_BigInt *)  (recv_buf + k * obj_size_bytes));
+         recv_j[pos + k]    = *((HYPRE_BigInt *)  (recv_buf + (k + count) * obj_size_bytes));
+         recv_data[pos + k] = *((HYPRE_Complex *) (recv_buf + (k + 2 * count) * obj_size_bytes));
+      }
+      pos += count;
+   }
+
+   hypre_TFree(order, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_proc_obj.v_elements, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_proc_obj.vec_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_proc_obj.id, HYPRE_MEMORY_HOST);
+
+   *num_recv_ptr  = num_recv;
+   *recv_i_ptr    = recv_i;
+   *recv_j_ptr    = recv_j;
+   *recv_data_ptr = recv_data;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixCOOBuildParCSR
+ *
+ * Builds diag and offd of the (not yet assembled) ParCSR matrix from n local
+ * triples sorted by (row, col) without duplicates.  The diagonal entry is
+ * placed first in each row of diag.  Offd column indices are left global in
+ * the BigJ array; the assemble routine compresses them into col_map_offd.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJMatrixCOOBuildParCSR( hypre_IJMatrix  *matrix,
+                              HYPRE_Int        n,
+                              HYPRE_BigInt    *I,
+                              HYPRE_BigInt    *J,
+                              HYPRE_Complex   *A )
+{
+   hypre_ParCSRMatrix   *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_CSRMatrix      *diag       = hypre_ParCSRMatrixDiag(par_matrix);
+   hypre_CSRMatrix      *offd       = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_MemoryLocation  memory_diag = hypre_CSRMatrixMemoryLocation(diag);
+   HYPRE_MemoryLocation  memory_offd = hypre_CSRMatrixMemoryLocation(offd);
+   HYPRE_Int            *diag_i     = hypre_CSRMatrixI(diag);
+   HYPRE_Int            *offd_i     = hypre_CSRMatrixI(offd);
+   HYPRE_BigInt          row_0      = hypre_IJMatrixRowPartitioning(matrix)[0];
+   HYPRE_BigInt          col_0      = hypre_IJMatrixColPartitioning(matrix)[0];
+   HYPRE_BigInt          col_n      = hypre_IJMatrixColPartitioning(matrix)[1] - 1;
+   HYPRE_Int             num_rows   = hypre_CSRMatrixNumRows(diag);
+
+   HYPRE_Int            *row_ptr;
+   HYPRE_Int            *diag_j, *offd_j;
+   HYPRE_BigInt         *big_offd_j;
+   HYPRE_Complex        *diag_data, *offd_data;
+   HYPRE_Int             i, k, r, r_prev;
+
+   /* row pointers of the sorted stream */
+   row_ptr = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, k, r, r_prev) HYPRE_SMP_SCHEDULE
+#endif
+   for (k = 0; k < n; k++)
+   {
+      r      = (HYPRE_Int) (I[k] - row_0);
+      r_prev = k ? (HYPRE_Int) (I[k - 1] - row_0) : -1;
+      for (i = r_prev + 1; i <= r; i++)
+      {
+         row_ptr[i] = k;
+      }
+   }
+   for (i = n ? (HYPRE_Int) (I[n - 1] - row_0) + 1 : 0; i <= num_rows; i++)
+   {
+      row_ptr[i] = n;
+   }
+
+   /* row sizes of diag and offd */
+   diag_i[0] = 0;
+   offd_i[0] = 0;
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, k) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      HYPRE_Int num_diag = 0;
+
+      for (k = row_ptr[i]; k < row_ptr[i + 1]; k++)
+      {
+         if (J[k] >= col_0 && J[k] <= col_n)
+         {
+            num_diag++;
+         }
+      }
+      diag_i[i + 1] = num_diag;
+      offd_i[i + 1] = row_ptr[i + 1] - row_ptr[i] - num_diag;
+   }
+   for (i = 0; i < num_rows; i++)
+   {
+      diag_i[i + 1] += diag_i[i];
+      offd_i[i + 1] += offd_i[i];
+   }
+
+   /* the arrays are replaced, the copies used by the host matvec are stale */
+   hypre_CSRMatrixInvalidateCopies(diag);
+   hypre_CSRMatrixInvalidateCopies(offd);
+
+   hypre_TFree(hypre_CSRMatrixJ(diag),    memory_diag);
+   hypre_TFree(hypre_CSRMatrixData(diag), memory_diag);
+   hypre_TFree(hypre_CSRMatrixJ(offd),    memory_offd);
+   hypre_TFree(hypre_CSRMatrixData(offd), memory_offd);
+   hypre_TFree(hypre_CSRMatrixBigJ(offd), memory_offd);
+
+   diag_j     = hypre_TAlloc(HYPRE_Int,     diag_i[num_rows], memory_diag);
+   diag_data  = hypre_TAlloc(HYPRE_Complex, diag_i[num_rows], memory_diag);
+   offd_j     = hypre_TAlloc(HYPRE_Int,     offd_i[num_rows], memory_offd);
+   offd_data  = hypre_TAlloc(HYPRE_Complex, offd_i[num_rows], memory_offd);
+   big_offd_j = hypre_TAlloc(HYPRE_BigInt,  offd_i[num_rows], memory_offd);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, k) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      HYPRE_Int pos_diag = diag_i[i];
+      HYPRE_Int pos_offd = offd_i[i];
+      HYPRE_Int diag_pos = -1;
+
+      for (k = row_ptr[i]; k < row_ptr[i + 1]; k++)
+      {
+         if (J[k] >= col_0 && J[k] <= col_n && (HYPRE_Int) (J[k] - col_0) == i)
+         {
+            diag_pos = k;
+            diag_j[pos_diag]      = i;
+            diag_data[pos_diag++] = A[k];
+            break;
+         }
+      }
+
+      for (k = row_ptr[i]; k < row_ptr[i + 1]; k++)
+      {
+         if (J[k] < col_0 || J[k] > col_n)
+         {
+            big_offd_j[pos_offd] = J[k];
+            offd_data[pos_offd++] = A[k];
+         }
+         else if (k != diag_pos)
+         {
+            diag_j[pos_diag]      = (HYPRE_Int) (J[k] - col_0);
+            diag_data[pos_diag++] = A[k];
+         }
+      }
+   }
+
+   hypre_TFree(row_ptr, HYPRE_MEMORY_HOST);
+
+   hypre_CSRMatrixJ(diag)           = diag_j;
+   hypre_CSRMatrixData(diag)        = diag_data;
+   hypre_CSRMatrixNumNonzeros(diag) = diag_i[num_rows];
+   hypre_CSRMatrixJ(offd)           = offd_j;
+   hypre_CSRMatrixBigJ(offd)        = big_offd_j;
+   hypre_CSRMatrixData(offd)        = offd_data;
+   hypre_CSRMatrixNumNonzeros(offd) = offd_i[num_rows];
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixAssembleCOOParCSR
+ *
+ * Processes the COO stash; called from hypre_IJMatrixAssembleParCSR on all
+ * processors if any processor holds COO triples.  If the matrix has not been
+ * assembled before and no values were set through the row-wise interface,
+ * diag and offd are built directly and *built_ptr is set to 1.  Otherwise the
+ * reduced local triples are added with hypre_IJMatrixAddToValuesParCSR.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixAssembleCOOParCSR( hypre_IJMatrix *matrix,
+                                 HYPRE_Int      *built_ptr )
+{
+   hypre_AuxParCSRMatrix *aux_matrix = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+   HYPRE_BigInt           row_0      = hypre_IJMatrixRowPartitioning(matrix)[0];
+   HYPRE_BigInt           row_n      = hypre_IJMatrixRowPartitioning(matrix)[1];
+   HYPRE_BigInt           global_first_row = hypre_IJMatrixGlobalFirstRow(matrix);
+   HYPRE_BigInt           global_first_col = hypre_IJMatrixGlobalFirstCol(matrix);
+   HYPRE_BigInt           global_num_rows  = hypre_IJMatrixGlobalNumRows(matrix);
+   HYPRE_BigInt           global_num_cols  = hypre_IJMatrixGlobalNumCols(matrix);
+   HYPRE_Int              num_rows   = (HYPRE_Int) (row_n - row_0);
+   HYPRE_Int              max_num_threads = hypre_NumThreads();
+
+   HYPRE_Int              n          = hypre_AuxParCSRMatrixCurrentCOOElmts(aux_matrix);
+   HYPRE_BigInt          *coo_i      = hypre_AuxParCSRMatrixCOOI(aux_matrix);
+   HYPRE_BigInt          *coo_j      = hypre_AuxParCSRMatrixCOOJ(aux_matrix);
+   HYPRE_Complex         *coo_data   = hypre_AuxParCSRMatrixCOOData(aux_matrix);
+   HYPRE_Int             *row_length = hypre_AuxParCSRMatrixRowLength(aux_matrix);
+
+   HYPRE_Int             *loc_counts;
+   HYPRE_Int              n_loc, n_off, n_recv, build_direct, i;
+   HYPRE_BigInt          *loc_i = NULL, *loc_j = NULL, *off_i = NULL, *off_j = NULL;
+   HYPRE_BigInt          *recv_i, *recv_j;
+   HYPRE_Complex         *loc_data = NULL, *off_data = NULL, *recv_data;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   *built_ptr = 0;
+
+   /* stable split into local and off-processor triples */
+   loc_counts = hypre_CTAlloc(HYPRE_Int, max_num_threads + 1, HYPRE_MEMORY_HOST);
+   n_loc = 0;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel
+#endif
+   {
+      HYPRE_Int num_threads   = hypre_NumActiveThreads();
+      HYPRE_Int my_thread_num = hypre_GetThreadNum();
+      HYPRE_Int ns, ne, k, t, pos_loc, pos_off;
+
+      hypre_partition1D(n, num_threads, my_thread_num, &ns, &ne);
+
+      pos_loc = 0;
+      for (k = ns; k < ne; k++)
+      {
+         if (coo_i[k] >= row_0 && coo_i[k] < row_n)
+         {
+            pos_loc++;
+         }
+      }
+      loc_counts[my_thread_num + 1] = pos_loc;
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+#endif
+      if (my_thread_num == 0)
+      {
+         for (t = 0; t < num_threads; t++)
+         {
+            loc_counts[t + 1] += loc_counts[t];
+         }
+         n_loc = loc_counts[num_threads];
+
+         loc_i    = hypre_TAlloc(HYPRE_BigInt,  n_loc,     HYPRE_MEMORY_HOST);
+         loc_j    = hypre_TAlloc(HYPRE_BigInt,  n_loc,     HYPRE_MEMORY_HOST);
+         loc_data = hypre_TAlloc(HYPRE_Complex, n_loc,     HYPRE_MEMORY_HOST);
+         off_i    = hypre_TAlloc(HYPRE_BigInt,  n - n_loc, HYPRE_MEMORY_HOST);
+         off_j    = hypre_TAlloc(HYPRE_BigInt,  n - n_loc, HYPRE_MEMORY_HOST);
+         off_data = hypre_TAlloc(HYPRE_Complex, n - n_loc, HYPRE_MEMORY_HOST);
+      }
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+#endif
+
+      pos_loc = loc_counts[my_thread_num];
+      pos_off = ns - pos_loc;
+      for (k = ns; k < ne; k++)
+      {
+         if (coo_i[k] >= row_0 && coo_i[k] < row_n)
+         {
+            loc_i[pos_loc]      = coo_i[k];
+            loc_j[pos_loc]      = coo_j[k];
+            loc_data[pos_loc++] = coo_data[k];
+         }
+         else
+         {
+            off_i[pos_off]      = coo_i[k];
+            off_j[pos_off]      = coo_j[k];
+            off_data[pos_off++] = coo_data[k];
+         }
+      }
+   }
+   n_off = n - n_loc;
+
+   hypre_TFree(loc_counts, HYPRE_MEMORY_HOST);
+
+   /* the stash is consumed */
+   hypre_TFree(coo_i,    HYPRE_MEMORY_HOST);
+   hypre_TFree(coo_j,    HYPRE_MEMORY_HOST);
+   hypre_TFree(coo_data, HYPRE_MEMORY_HOST);
+   hypre_AuxParCSRMatrixCOOI(aux_matrix)              = NULL;
+   hypre_AuxParCSRMatrixCOOJ(aux_matrix)              = NULL;
+   hypre_AuxParCSRMatrixCOOData(aux_matrix)           = NULL;
+   hypre_AuxParCSRMatrixMaxCOOElmts(aux_matrix)       = 0;
+   hypre_AuxParCSRMatrixCurrentCOOElmts(aux_matrix)   = 0;
+
+   /* reduce the off-processor triples before sending them */
+   hypre_IJMatrixCOOSortAndReduce(&n_off, &off_i, &off_j, &off_data,
+                                  global_first_row, global_num_rows,
+                                  global_first_col, global_num_cols);
+
+   hypre_IJMatrixCOOExchangeOffProc(matrix, n_off, off_i, off_j, off_data,
+                                    &n_recv, &recv_i, &recv_j, &recv_data);
+
+   hypre_TFree(off_i,    HYPRE_MEMORY_HOST);
+   hypre_TFree(off_j,    HYPRE_MEMORY_HOST);
+   hypre_TFree(off_data, HYPRE_MEMORY_HOST);
+
+   if (n_recv)
+   {
+      loc_i    = hypre_TReAlloc_v2(loc_i,    HYPRE_BigInt,  n_loc, HYPRE_BigInt,  n_loc + n_recv,
+                                   HYPRE_MEMORY_HOST);
+      loc_j    = hypre_TReAlloc_v2(loc_j,    HYPRE_BigInt,  n_loc, HYPRE_BigInt,  n_loc + n_recv,
+                                   HYPRE_MEMORY_HOST);
+      loc_data = hypre_TReAlloc_v2(loc_data, HYPRE_Complex, n_loc, HYPRE_Complex, n_loc + n_recv,
+                                   HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(loc_i + n_loc,    recv_i,    HYPRE_BigInt,  n_recv,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(loc_j + n_loc,    recv_j,    HYPRE_BigInt,  n_recv,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(loc_data + n_loc, recv_data, HYPRE_Complex, n_recv,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      n_loc += n_recv;
+   }
+   hypre_TFree(recv_i,    HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_j,    HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_data, HYPRE_MEMORY_HOST);
+
+   hypre_IJMatrixCOOSortAndReduce(&n_loc, &loc_i, &loc_j, &loc_data,
+                                  row_0, (HYPRE_BigInt) num_rows,
+                                  global_first_col, global_num_cols);
+
+   /* build directly unless the row-wise interface already holds values */
+   build_direct = !hypre_IJMatrixAssembleFlag(matrix) && hypre_AuxParCSRMatrixNeedAux(aux_matrix);
+   if (build_direct && row_length)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) reduction(&&:build_direct) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         build_direct = build_direct && (row_length[i] == 0);
+      }
+   }
+
+   if (build_direct)
+   {
+      hypre_IJMatrixCOOBuildParCSR(matrix, n_loc, loc_i, loc_j, loc_data);
+      *built_ptr = 1;
+   }
+   else if (n_loc)
+   {
+      HYPRE_Int     nrows_nz = 0;
+      HYPRE_Int    *ncols, *row_indexes;
+      HYPRE_BigInt *rows;
+
+      for (i = 0; i < n_loc; i++)
+      {
+         if (i == 0 || loc_i[i] != loc_i[i - 1])
+         {
+            nrows_nz++;
+         }
+      }
+      ncols       = hypre_CTAlloc(HYPRE_Int,    nrows_nz, HYPRE_MEMORY_HOST);
+      row_indexes = hypre_TAlloc(HYPRE_Int,     nrows_nz, HYPRE_MEMORY_HOST);
+      rows        = hypre_TAlloc(HYPRE_BigInt,  nrows_nz, HYPRE_MEMORY_HOST);
+      nrows_nz = 0;
+      for (i = 0; i < n_loc; i++)
+      {
+         if (i == 0 || loc_i[i] != loc_i[i - 1])
+         {
+            rows[nrows_nz]        = loc_i[i];
+            row_indexes[nrows_nz] = i;
+            nrows_nz++;
+         }
+         ncols[nrows_nz - 1]++;
+      }
+
+      hypre_IJMatrixAddToValuesParCSR(matrix, nrows_nz, ncols, rows, row_indexes,
+                                      loc_j, loc_data);
+
+      hypre_TFree(ncols, HYPRE_MEMORY_HOST);
+      hypre_TFree(row_indexes, HYPRE_MEMORY_HOST);
+      hypre_TFree(rows, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_TFree(loc_i,    HYPRE_MEMORY_HOST);
+   hypre_TFree(loc_j,    HYPRE_MEMORY_HOST);
+   hypre_TFree(loc_data, HYPRE_MEMORY_HOST);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
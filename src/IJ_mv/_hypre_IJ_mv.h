@@ -80,6 +80,13 @@ typedef struct
 
    HYPRE_MemoryLocation memory_location;
 
+   HYPRE_Int            max_coo_elmts;           /* length of the host COO stash filled by
+                                                    HYPRE_IJMatrixAddToValuesCOO */
+   HYPRE_Int            current_coo_elmts;       /* current no. of triples in the COO stash */
+   HYPRE_BigInt        *coo_i;                   /* global row indices of the triples */
+   HYPRE_BigInt        *coo_j;                   /* global column indices of the triples */
+   HYPRE_Complex       *coo_data;                /* values of the triples (summed at assembly) */
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
    HYPRE_Int            max_stack_elmts;
    HYPRE_Int            current_stack_elmts;
@@ -124,6 +131,12 @@ typedef struct
 
 #define hypre_AuxParCSRMatrixMemoryLocation(matrix)       ((matrix) -> memory_location)
 
+#define hypre_AuxParCSRMatrixMaxCOOElmts(matrix)          ((matrix) -> max_coo_elmts)
+#define hypre_AuxParCSRMatrixCurrentCOOElmts(matrix)      ((matrix) -> current_coo_elmts)
+#define hypre_AuxParCSRMatrixCOOI(matrix)                 ((matrix) -> coo_i)
+#define hypre_AuxParCSRMatrixCOOJ(matrix)                 ((matrix) -> coo_j)
+#define hypre_AuxParCSRMatrixCOOData(matrix)              ((matrix) -> coo_data)
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
 #define hypre_AuxParCSRMatrixMaxStackElmts(matrix)        ((matrix) -> max_stack_elmts)
 #define hypre_AuxParCSRMatrixCurrentStackElmts(matrix)    ((matrix) -> current_stack_elmts)
@@ -478,6 +491,14 @@ HYPRE_Int hypre_IJMatrixInitializeParCSR_v2(hypre_IJMatrix *matrix,
 HYPRE_Int hypre_IJMatrixSetConstantValuesParCSRDevice( hypre_IJMatrix *matrix,
                                                        HYPRE_Complex value );
 
+/* IJMatrix_parcsr_coo.c */
+HYPRE_Int hypre_IJMatrixAddToValuesCOOParCSR ( hypre_IJMatrix *matrix, HYPRE_Int nelms,
+                                               const HYPRE_BigInt *rows, const HYPRE_BigInt *cols, const HYPRE_Complex *values );
+HYPRE_Int hypre_IJMatrixCOOSortAndReduce ( HYPRE_Int *n_ptr, HYPRE_BigInt **I_ptr,
+                                           HYPRE_BigInt **J_ptr, HYPRE_Complex **A_ptr, HYPRE_BigInt row_base, HYPRE_BigInt row_range,
+                                           HYPRE_BigInt col_base, HYPRE_BigInt col_range );
+HYPRE_Int hypre_IJMatrixAssembleCOOParCSR ( hypre_IJMatrix *matrix, HYPRE_Int *built_ptr );
+
 /* IJMatrix_petsc.c */
 HYPRE_Int hypre_IJMatrixSetLocalSizePETSc ( hypre_IJMatrix *matrix, HYPRE_Int local_m,
                                             HYPRE_Int local_n );
@@ -541,6 +562,8 @@ HYPRE_Int HYPRE_IJMatrixSetValues ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPR
 HYPRE_Int HYPRE_IJMatrixSetConstantValues ( HYPRE_IJMatrix matrix, HYPRE_Complex value );
 HYPRE_Int HYPRE_IJMatrixAddToValues ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPRE_Int *ncols,
                                       const HYPRE_BigInt *rows, const HYPRE_BigInt *cols, const HYPRE_Complex *values );
+HYPRE_Int HYPRE_IJMatrixAddToValuesCOO ( HYPRE_IJMatrix matrix, HYPRE_Int nelms,
+                                         const HYPRE_BigInt *rows, const HYPRE_BigInt *cols, const HYPRE_Complex *values );
 HYPRE_Int HYPRE_IJMatrixAssemble ( HYPRE_IJMatrix matrix );
 HYPRE_Int HYPRE_IJMatrixGetRowCounts ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPRE_BigInt *rows,
                                        HYPRE_Int *ncols );
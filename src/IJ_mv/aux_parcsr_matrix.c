@@ -52,6 +52,12 @@ hypre_AuxParCSRMatrixCreate( hypre_AuxParCSRMatrix **aux_matrix,
    hypre_AuxParCSRMatrixOffProcJ(matrix) = NULL;
    hypre_AuxParCSRMatrixOffProcData(matrix) = NULL;
    hypre_AuxParCSRMatrixMemoryLocation(matrix) = HYPRE_MEMORY_HOST;
+   /* host COO stash for bulk assembly */
+   hypre_AuxParCSRMatrixMaxCOOElmts(matrix) = 0;
+   hypre_AuxParCSRMatrixCurrentCOOElmts(matrix) = 0;
+   hypre_AuxParCSRMatrixCOOI(matrix) = NULL;
+   hypre_AuxParCSRMatrixCOOJ(matrix) = NULL;
+   hypre_AuxParCSRMatrixCOOData(matrix) = NULL;
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
    hypre_AuxParCSRMatrixMaxStackElmts(matrix) = 0;
    hypre_AuxParCSRMatrixCurrentStackElmts(matrix) = 0;
@@ -142,6 +148,10 @@ hypre_AuxParCSRMatrixDestroy( hypre_AuxParCSRMatrix *matrix )
       hypre_TFree(hypre_AuxParCSRMatrixOffProcJ(matrix),    HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_AuxParCSRMatrixOffProcData(matrix), HYPRE_MEMORY_HOST);
 
+      hypre_TFree(hypre_AuxParCSRMatrixCOOI(matrix),    HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AuxParCSRMatrixCOOJ(matrix),    HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AuxParCSRMatrixCOOData(matrix), HYPRE_MEMORY_HOST);
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
       hypre_TFree(hypre_AuxParCSRMatrixStackI(matrix),    hypre_AuxParCSRMatrixMemoryLocation(matrix));
       hypre_TFree(hypre_AuxParCSRMatrixStackJ(matrix),    hypre_AuxParCSRMatrixMemoryLocation(matrix));
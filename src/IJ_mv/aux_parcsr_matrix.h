@@ -65,6 +65,13 @@ typedef struct
 
    HYPRE_MemoryLocation memory_location;
 
+   HYPRE_Int            max_coo_elmts;           /* length of the host COO stash filled by
+                                                    HYPRE_IJMatrixAddToValuesCOO */
+   HYPRE_Int            current_coo_elmts;       /* current no. of triples in the COO stash */
+   HYPRE_BigInt        *coo_i;                   /* global row indices of the triples */
+   HYPRE_BigInt        *coo_j;                   /* global column indices of the triples */
+   HYPRE_Complex       *coo_data;                /* values of the triples (summed at assembly) */
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
    HYPRE_Int            max_stack_elmts;
    HYPRE_Int            current_stack_elmts;
@@ -109,6 +116,12 @@ typedef struct
 
 #define hypre_AuxParCSRMatrixMemoryLocation(matrix)       ((matrix) -> memory_location)
 
+#define hypre_AuxParCSRMatrixMaxCOOElmts(matrix)          ((matrix) -> max_coo_elmts)
+#define hypre_AuxParCSRMatrixCurrentCOOElmts(matrix)      ((matrix) -> current_coo_elmts)
+#define hypre_AuxParCSRMatrixCOOI(matrix)                 ((matrix) -> coo_i)
+#define hypre_AuxParCSRMatrixCOOJ(matrix)                 ((matrix) -> coo_j)
+#define hypre_AuxParCSRMatrixCOOData(matrix)              ((matrix) -> coo_data)
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
 #define hypre_AuxParCSRMatrixMaxStackElmts(matrix)        ((matrix) -> max_stack_elmts)
 #define hypre_AuxParCSRMatrixCurrentStackElmts(matrix)    ((matrix) -> current_stack_elmts)
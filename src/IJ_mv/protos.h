@@ -104,6 +104,14 @@ HYPRE_Int hypre_IJMatrixInitializeParCSR_v2(hypre_IJMatrix *matrix,
 HYPRE_Int hypre_IJMatrixSetConstantValuesParCSRDevice( hypre_IJMatrix *matrix,
                                                        HYPRE_Complex value );
 
+/* IJMatrix_parcsr_coo.c */
+HYPRE_Int hypre_IJMatrixAddToValuesCOOParCSR ( hypre_IJMatrix *matrix, HYPRE_Int nelms,
+                                               const HYPRE_BigInt *rows, const HYPRE_BigInt *cols, const HYPRE_Complex *values );
+HYPRE_Int hypre_IJMatrixCOOSortAndReduce ( HYPRE_Int *n_ptr, HYPRE_BigInt **I_ptr,
+                                           HYPRE_BigInt **J_ptr, HYPRE_Complex **A_ptr, HYPRE_BigInt row_base, HYPRE_BigInt row_range,
+                                           HYPRE_BigInt col_base, HYPRE_BigInt col_range );
+HYPRE_Int hypre_IJMatrixAssembleCOOParCSR ( hypre_IJMatrix *matrix, HYPRE_Int *built_ptr );
+
 /* IJMatrix_petsc.c */
 HYPRE_Int hypre_IJMatrixSetLocalSizePETSc ( hypre_IJMatrix *matrix, HYPRE_Int local_m,
                                             HYPRE_Int local_n );
@@ -167,6 +175,8 @@ HYPRE_Int HYPRE_IJMatrixSetValues ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPR
 HYPRE_Int HYPRE_IJMatrixSetConstantValues ( HYPRE_IJMatrix matrix, HYPRE_Complex value );
 HYPRE_Int HYPRE_IJMatrixAddToValues ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPRE_Int *ncols,
                                       const HYPRE_BigInt *rows, const HYPRE_BigInt *cols, const HYPRE_Complex *values );
+HYPRE_Int HYPRE_IJMatrixAddToValuesCOO ( HYPRE_IJMatrix matrix, HYPRE_Int nelms,
+                                         const HYPRE_BigInt *rows, const HYPRE_BigInt *cols, const HYPRE_Complex *values );
 HYPRE_Int HYPRE_IJMatrixAssemble ( HYPRE_IJMatrix matrix );
 HYPRE_Int HYPRE_IJMatrixGetRowCounts ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPRE_BigInt *rows,
                                        HYPRE_Int *ncols );
@@ -13,6 +13,178 @@ extern "C" {
 #include "f2c.h"
 #include "hypre_blas.h"
 
+/*--------------------------------------------------------------------------
+ * Cache-blocked DGEMM
+ *
+ * The reference loops below stream the whole of A through the cache for
+ * every column of C. For larger products, op(A) and op(B) are instead packed
+ * into KC-deep panels (MC x KC blocks of op(A) in MR-row slivers, KC x NC
+ * blocks of op(B) in NR-column slivers) and multiplied by an MR x NR register
+ * tile that the compiler can keep in vector registers. All transpose
+ * combinations share the same kernel; only the packing differs.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_DGEMM_MR 4
+#define HYPRE_DGEMM_NR 4
+#define HYPRE_DGEMM_MC 96
+#define HYPRE_DGEMM_KC 256
+#define HYPRE_DGEMM_NC 2048
+
+/* products below this many multiply-adds use the reference loops */
+#define HYPRE_DGEMM_BLOCKED_MIN_WORK 32768.0
+
+static void
+hypre_dgemm_pack_a( logical nota, integer mc, integer kc, doublereal *a, integer lda,
+                    doublereal *ap )
+{
+   integer i, l, ir, mr;
+
+   for (ir = 0; ir < mc; ir += HYPRE_DGEMM_MR)
+   {
+      mr = min(HYPRE_DGEMM_MR, mc - ir);
+      for (l = 0; l < kc; l++)
+      {
+         for (i = 0; i < mr; i++)
+         {
+            ap[i] = nota ? a[(ir + i) + l * lda] : a[l + (ir + i) * lda];
+         }
+         for (; i < HYPRE_DGEMM_MR; i++)
+         {
+            ap[i] = 0.;
+         }
+         ap += HYPRE_DGEMM_MR;
+      }
+   }
+}
+
+static void
+hypre_dgemm_pack_b( logical notb, integer kc, integer nc, doublereal *b, integer ldb,
+                    doublereal *bp )
+{
+   integer j, l, jr, nr;
+
+   for (jr = 0; jr < nc; jr += HYPRE_DGEMM_NR)
+   {
+      nr = min(HYPRE_DGEMM_NR, nc - jr);
+      for (l = 0; l < kc; l++)
+      {
+         for (j = 0; j < nr; j++)
+         {
+            bp[j] = notb ? b[l + (jr + j) * ldb] : b[(jr + j) + l * ldb];
+         }
+         for (; j < HYPRE_DGEMM_NR; j++)
+         {
+            bp[j] = 0.;
+         }
+         bp += HYPRE_DGEMM_NR;
+      }
+   }
+}
+
+/* C(0:mr,0:nr) += alpha * ap * bp, with ap and bp packed slivers */
+static void
+hypre_dgemm_micro_kernel( integer kc, doublereal alpha, doublereal *ap, doublereal *bp,
+                          integer mr, integer nr, doublereal *c, integer ldc )
+{
+   doublereal ab[HYPRE_DGEMM_NR][HYPRE_DGEMM_MR];
+   doublereal bj;
+   integer    i, j, l;
+
+   for (j = 0; j < HYPRE_DGEMM_NR; j++)
+   {
+      for (i = 0; i < HYPRE_DGEMM_MR; i++)
+      {
+         ab[j][i] = 0.;
+      }
+   }
+
+   for (l = 0; l < kc; l++)
+   {
+      for (j = 0; j < HYPRE_DGEMM_NR; j++)
+      {
+         bj = bp[j];
+         for (i = 0; i < HYPRE_DGEMM_MR; i++)
+         {
+            ab[j][i] += ap[i] * bj;
+         }
+      }
+      ap += HYPRE_DGEMM_MR;
+      bp += HYPRE_DGEMM_NR;
+   }
+
+   for (j = 0; j < nr; j++)
+   {
+      for (i = 0; i < mr; i++)
+      {
+         c[i + j * ldc] += alpha * ab[j][i];
+      }
+   }
+}
+
+static integer
+hypre_dgemm_blocked( logical nota, logical notb, integer m, integer n, integer k,
+                     doublereal alpha, doublereal *a, integer lda, doublereal *b,
+                     integer ldb, doublereal beta, doublereal *c, integer ldc )
+{
+   doublereal *ap, *bp;
+   integer     i, j, ic, jc, pc, ir, jr, mc, nc, kc;
+
+   /* C := beta*C */
+   if (beta != 1.)
+   {
+      for (j = 0; j < n; j++)
+      {
+         for (i = 0; i < m; i++)
+         {
+            c[i + j * ldc] = (beta == 0.) ? 0. : beta * c[i + j * ldc];
+         }
+      }
+   }
+
+   /* size the panels for this product; slivers are padded to MR and NR */
+   mc = min(HYPRE_DGEMM_MC, m);
+   nc = min(HYPRE_DGEMM_NC, n);
+   kc = min(HYPRE_DGEMM_KC, k);
+   mc = (mc + HYPRE_DGEMM_MR - 1) / HYPRE_DGEMM_MR * HYPRE_DGEMM_MR;
+   nc = (nc + HYPRE_DGEMM_NR - 1) / HYPRE_DGEMM_NR * HYPRE_DGEMM_NR;
+   ap = hypre_TAlloc(doublereal, mc * kc, HYPRE_MEMORY_HOST);
+   bp = hypre_TAlloc(doublereal, kc * nc, HYPRE_MEMORY_HOST);
+
+   for (jc = 0; jc < n; jc += HYPRE_DGEMM_NC)
+   {
+      nc = min(HYPRE_DGEMM_NC, n - jc);
+      for (pc = 0; pc < k; pc += HYPRE_DGEMM_KC)
+      {
+         kc = min(HYPRE_DGEMM_KC, k - pc);
+         hypre_dgemm_pack_b(notb, kc, nc,
+                            notb ? &b[pc + jc * ldb] : &b[jc + pc * ldb], ldb, bp);
+
+         for (ic = 0; ic < m; ic += HYPRE_DGEMM_MC)
+         {
+            mc = min(HYPRE_DGEMM_MC, m - ic);
+            hypre_dgemm_pack_a(nota, mc, kc,
+                               nota ? &a[ic + pc * lda] : &a[pc + ic * lda], lda, ap);
+
+            for (jr = 0; jr < nc; jr += HYPRE_DGEMM_NR)
+            {
+               for (ir = 0; ir < mc; ir += HYPRE_DGEMM_MR)
+               {
+                  hypre_dgemm_micro_kernel(kc, alpha, &ap[ir * kc], &bp[jr * kc],
+                                           min(HYPRE_DGEMM_MR, mc - ir),
+                                           min(HYPRE_DGEMM_NR, nc - jr),
+                                           &c[(ic + ir) + (jc + jr) * ldc], ldc);
+               }
+            }
+         }
+      }
+   }
+
+   hypre_TFree(ap, HYPRE_MEMORY_HOST);
+   hypre_TFree(bp, HYPRE_MEMORY_HOST);
+
+   return 0;
+}
+
 /* Subroutine */ integer dgemm_(const char *transa,const char *transb, integer *m, integer *
 	n, integer *k, doublereal *alpha, doublereal *a, integer *lda,
 	doublereal *b, integer *ldb, doublereal *beta, doublereal *c, integer
@@ -266,6 +438,14 @@ extern "C" {
 	return 0;
     }
 
+/*     Use the cache-blocked kernel for the larger products. */
+
+    if ((doublereal) (*m) * (doublereal) (*n) * (doublereal) (*k) >=
+	    HYPRE_DGEMM_BLOCKED_MIN_WORK) {
+	return hypre_dgemm_blocked(nota, notb, *m, *n, *k, *alpha, a, *lda,
+		b, *ldb, *beta, c, *ldc);
+    }
+
 /*     Start the operations. */
 
     if (notb) {
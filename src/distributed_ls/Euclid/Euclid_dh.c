@@ -218,6 +218,28 @@ void Euclid_dhSetup(Euclid_dh ctx)
   }
   if (! strcmp(ctx->algo_par, "bj")) bj = false;
 
+  /*------------------------------------------------------------------------
+   * Split the interior rows into thread subdomains, so that ILU(k) and
+   * the triangular solves can use OpenMP threads within each mpi task.
+   * As for the SubdomainGraph, this is only done once per context.
+   * The partition changes the ordering, and with it the factor, so it is
+   * only used on request ("-tblocks <n>", e.g. the number of threads).
+   *------------------------------------------------------------------------*/
+  if (ctx->sg->tblocks == 0) {
+    HYPRE_Int tblocks = 1;
+    Parser_dhReadInt(parser_dh, "-tblocks", &tblocks); CHECK_V_ERROR;
+    if (tblocks > 1 &&
+        ! strcmp(ctx->algo_ilu, "iluk") &&
+        ! Parser_dhHasSwitch(parser_dh, "-bj") &&
+        ! Parser_dhHasSwitch(parser_dh, "-mpi") &&
+        ((np_dh == 1 && ctx->sg->blocks == 1) ||
+         (np_dh > 1 && ! strcmp(ctx->algo_par, "pilu")))) {
+      t1 = hypre_MPI_Wtime();
+      SubdomainGraph_dhPartitionThreads(ctx->sg, tblocks, ctx->A); CHECK_V_ERROR;
+      ctx->timing[SUB_GRAPH_T] += (hypre_MPI_Wtime() - t1);
+    }
+  }
+
   /*---------------------------------------------------------
    * allocate and initialize storage for row-scaling
    * (ctx->isScaled is set in get_runtime_params_private(); )
@@ -476,6 +498,11 @@ void factor_private(Euclid_dh ctx)
         iluk_mpi_pilu(ctx); CHECK_V_ERROR;
       }
 
+      /* thread subdomains; iluk_seq() factors their interior rows concurrently */
+      else if (ctx->sg != NULL && ctx->sg->tblocks > 1) {
+        iluk_seq(ctx); CHECK_V_ERROR;
+      }
+
       /* "normal" operation */
       else  {
         iluk_seq_block(ctx); CHECK_V_ERROR;
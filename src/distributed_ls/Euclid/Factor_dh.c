@@ -604,6 +604,14 @@ static void backward_solve_private(HYPRE_Int m, HYPRE_Int from, HYPRE_Int to,
                        HYPRE_Int *rp, HYPRE_Int *cval, HYPRE_Int *diag, HYPRE_Real *aval, 
                        HYPRE_Real *work_y, HYPRE_Real *work_x, bool debug);
 
+static void forward_solve_threads_private(HYPRE_Int m, HYPRE_Int to, SubdomainGraph_dh sg,
+                            HYPRE_Int *rp, HYPRE_Int *cval, HYPRE_Int *diag, HYPRE_Real *aval, 
+                            HYPRE_Real *rhs, HYPRE_Real *work_y);
+
+static void backward_solve_threads_private(HYPRE_Int m, HYPRE_Int from, SubdomainGraph_dh sg,
+                       HYPRE_Int *rp, HYPRE_Int *cval, HYPRE_Int *diag, HYPRE_Real *aval, 
+                       HYPRE_Real *work_y, HYPRE_Real *work_x);
+
 static HYPRE_Int beg_rowG;
 
 
@@ -657,8 +665,13 @@ for (i=0; i<m+offsetLo+offsetHi; ++i) {
   from = 0;
   to = first_bdry;
   if (from != to) {
-    forward_solve_private(m, from, to, rp, cval, diag, aval, 
-                          rhs, work_y, debug); CHECK_V_ERROR;
+    if (ctx->sg->tblocks > 1 && ! debug) {
+      forward_solve_threads_private(m, to, ctx->sg, rp, cval, diag, aval,
+                                    rhs, work_y); CHECK_V_ERROR;
+    } else {
+      forward_solve_private(m, from, to, rp, cval, diag, aval, 
+                            rhs, work_y, debug); CHECK_V_ERROR;
+    }
   }
 
   /* wait for receives from lower ordered subdomains, then
@@ -755,8 +768,13 @@ for (i=0; i<m+offsetLo+offsetHi; ++i) {
   from = first_bdry;
   to = 0;
   if (from != to) {
-    backward_solve_private(m, from, to, rp, cval, diag, aval, 
-                           work_y, work_x, debug); CHECK_V_ERROR;
+    if (ctx->sg->tblocks > 1 && ! debug) {
+      backward_solve_threads_private(m, from, ctx->sg, rp, cval, diag, aval,
+                                     work_y, work_x); CHECK_V_ERROR;
+    } else {
+      backward_solve_private(m, from, to, rp, cval, diag, aval, 
+                             work_y, work_x, debug); CHECK_V_ERROR;
+    }
   }
 
   /* copy solution from work vector lhs vector */
@@ -789,7 +807,7 @@ void forward_solve_private(HYPRE_Int m, HYPRE_Int from, HYPRE_Int to, HYPRE_Int
                            HYPRE_Int *cval, HYPRE_Int *diag, HYPRE_Real *aval, 
                            HYPRE_Real *rhs, HYPRE_Real *work_y, bool debug)
 {
-  START_FUNC_DH
+  START_FUNC_DH_2
   HYPRE_Int i, j, idx;
 
   if (debug) {  
@@ -845,7 +863,7 @@ void forward_solve_private(HYPRE_Int m, HYPRE_Int from, HYPRE_Int to, HYPRE_Int
     work_y[i] = sum;
   }
  }
-  END_FUNC_DH
+  END_FUNC_DH_2
 }
 
 #undef __FUNC__
@@ -854,7 +872,7 @@ void backward_solve_private(HYPRE_Int m, HYPRE_Int from, HYPRE_Int to, HYPRE_Int
                             HYPRE_Int *cval, HYPRE_Int *diag, HYPRE_Real *aval, 
                             HYPRE_Real *work_y, HYPRE_Real *work_x, bool debug)
 {
-  START_FUNC_DH
+  START_FUNC_DH_2
   HYPRE_Int i, j, idx;
 
  if (debug) {  
@@ -892,6 +910,53 @@ void backward_solve_private(HYPRE_Int m, HYPRE_Int from, HYPRE_Int to, HYPRE_Int
     work_x[i] = sum*aval[diag[i]];
   }
  }
+  END_FUNC_DH_2
+}
+
+/* Triangular solves over the interior rows when they were partitioned
+   by SubdomainGraph_dhPartitionThreads: rows of different thread
+   subdomains are independent, so the subdomains are solved concurrently,
+   and the thread boundary rows [tbeg_row[tblocks], to) sequentially.
+*/
+#undef __FUNC__
+#define __FUNC__ "forward_solve_threads_private"
+void forward_solve_threads_private(HYPRE_Int m, HYPRE_Int to, SubdomainGraph_dh sg,
+                           HYPRE_Int *rp, HYPRE_Int *cval, HYPRE_Int *diag, HYPRE_Real *aval, 
+                           HYPRE_Real *rhs, HYPRE_Real *work_y)
+{
+  START_FUNC_DH
+  HYPRE_Int p, T = sg->tblocks, *tbeg = sg->tbeg_row;
+
+#ifdef USING_OPENMP_TBLOCKS_DH
+#pragma omp parallel for private(p) schedule(static)
+#endif
+  for (p=0; p<T; ++p) {
+    forward_solve_private(m, tbeg[p], tbeg[p+1], rp, cval, diag, aval,
+                          rhs, work_y, false);
+  }
+  forward_solve_private(m, tbeg[T], to, rp, cval, diag, aval,
+                        rhs, work_y, false); CHECK_V_ERROR;
+  END_FUNC_DH
+}
+
+#undef __FUNC__
+#define __FUNC__ "backward_solve_threads_private"
+void backward_solve_threads_private(HYPRE_Int m, HYPRE_Int from, SubdomainGraph_dh sg,
+                            HYPRE_Int *rp, HYPRE_Int *cval, HYPRE_Int *diag, HYPRE_Real *aval, 
+                            HYPRE_Real *work_y, HYPRE_Real *work_x)
+{
+  START_FUNC_DH
+  HYPRE_Int p, T = sg->tblocks, *tbeg = sg->tbeg_row;
+
+  backward_solve_private(m, from, tbeg[T], rp, cval, diag, aval,
+                         work_y, work_x, false); CHECK_V_ERROR;
+#ifdef USING_OPENMP_TBLOCKS_DH
+#pragma omp parallel for private(p) schedule(static)
+#endif
+  for (p=0; p<T; ++p) {
+    backward_solve_private(m, tbeg[p+1], tbeg[p], rp, cval, diag, aval,
+                           work_y, work_x, false);
+  }
   END_FUNC_DH
 }
 
@@ -1056,6 +1121,16 @@ void Factor_dhSolveSeq(HYPRE_Real *rhs, HYPRE_Real *lhs, Euclid_dh ctx)
   hypre_fprintf(logFile, "\n");
 
 
+ } else if (ctx->sg != NULL && ctx->sg->tblocks > 1) {
+  /* interior rows were partitioned for threads; the backward solve
+     overwrites work[] in place, since row i only reads work[j], j > i.
+   */
+  forward_solve_threads_private(m, m, ctx->sg, rp, cval, diag, aval,
+                                rhs, work); CHECK_V_ERROR;
+  backward_solve_threads_private(m, m, ctx->sg, rp, cval, diag, aval,
+                                 work, work); CHECK_V_ERROR;
+  hypre_TMemcpy(lhs, work, HYPRE_Real, m, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
  } else {
   /* forward solve lower triangle */
   work[0] = rhs[0];
@@ -68,6 +68,8 @@ void SubdomainGraph_dhCreate(SubdomainGraph_dh *s)
   tmp->m = 0;
   tmp->n2o_row = tmp->o2n_col = NULL;
   tmp->o2n_ext = tmp->n2o_ext = NULL;
+  tmp->tblocks = 0;
+  tmp->tbeg_row = NULL;
 
   tmp->doNotColor = Parser_dhHasSwitch(parser_dh, "-doNotColor");
   tmp->debug = Parser_dhHasSwitch(parser_dh, "-debug_SubGraph");
@@ -100,6 +102,7 @@ void SubdomainGraph_dhDestroy(SubdomainGraph_dh s)
   if (s->o2n_col != NULL) { FREE_DH(s->o2n_col); CHECK_V_ERROR; }
   if (s->o2n_ext != NULL) { Hash_i_dhDestroy(s->o2n_ext); CHECK_V_ERROR; }
   if (s->n2o_ext != NULL) { Hash_i_dhDestroy(s->n2o_ext); CHECK_V_ERROR; }
+  if (s->tbeg_row != NULL) { FREE_DH(s->tbeg_row); CHECK_V_ERROR; }
   FREE_DH(s); CHECK_V_ERROR;
   END_FUNC_DH
 }
@@ -755,6 +758,108 @@ void SubdomainGraph_dhExchangePerms(SubdomainGraph_dh s)
 
 
 
+/* Rows are first dealt out in contiguous chunks of the current ordering,
+   one chunk per thread subdomain.  A row becomes a thread boundary row if
+   it couples to a row of a higher chunk, or to an interior row of a lower
+   chunk; all remaining rows are interior to their chunk.
+*/
+#undef __FUNC__
+#define __FUNC__ "SubdomainGraph_dhPartitionThreads"
+void SubdomainGraph_dhPartitionThreads(SubdomainGraph_dh s, HYPRE_Int tblocks, void *A)
+{
+  START_FUNC_DH
+  HYPRE_Int m = s->row_count[myid_dh];
+  HYPRE_Int n = m - s->bdry_count[myid_dh];  /* locally owned interior rows */
+  HYPRE_Int beg_row = s->beg_row[myid_dh];
+  HYPRE_Int *n2o_row = s->n2o_row, *o2n_col = s->o2n_col;
+  HYPRE_Int *owner, *bdry, *n2o_tmp, *tbeg_row;
+  HYPRE_Int i, j, p, k, col, len, *CVAL, rpp, sweep, bdryCount = 0;
+  HYPRE_Real *AVAL;
+
+  if (s->tbeg_row != NULL) { FREE_DH(s->tbeg_row); CHECK_V_ERROR; }
+  s->tbeg_row = NULL;
+  s->tblocks = 0;
+
+  if (tblocks < 2 || n < tblocks) goto END_OF_FUNCTION;
+
+  owner = (HYPRE_Int*)MALLOC_DH(n*sizeof(HYPRE_Int)); CHECK_V_ERROR;
+  bdry = (HYPRE_Int*)MALLOC_DH(n*sizeof(HYPRE_Int)); CHECK_V_ERROR;
+  n2o_tmp = (HYPRE_Int*)MALLOC_DH(n*sizeof(HYPRE_Int)); CHECK_V_ERROR;
+  tbeg_row = (HYPRE_Int*)MALLOC_DH((tblocks+1)*sizeof(HYPRE_Int)); CHECK_V_ERROR;
+
+  /* deal out the interior rows */
+  rpp = n/tblocks;
+  if (rpp*tblocks < n) ++rpp;
+  for (i=0; i<n; ++i) {
+    owner[i] = i/rpp;
+    bdry[i] = 0;
+  }
+
+  /* sweep 0 marks rows coupled to higher chunks, sweep 1 marks
+     rows coupled to interior rows of lower chunks.
+   */
+  for (sweep=0; sweep<2; ++sweep) {
+    for (i=0; i<n; ++i) {
+      if (bdry[i]) continue;
+      EuclidGetRow(A, n2o_row[i]+beg_row, &len, &CVAL, &AVAL); CHECK_V_ERROR;
+      for (j=0; j<len; ++j) {
+        col = CVAL[j] - beg_row;
+        if (col < 0 || col >= m) {  /* should not happen for interior rows */
+          bdry[i] = 1;
+          break;
+        }
+        col = o2n_col[col];
+        if (col >= n) continue;    /* boundary rows are ordered last */
+        if ((sweep == 0 && owner[col] > owner[i]) ||
+            (sweep == 1 && owner[col] < owner[i] && ! bdry[col])) {
+          bdry[i] = 1;
+          break;
+        }
+      }
+      EuclidRestoreRow(A, n2o_row[i]+beg_row, &len, &CVAL, &AVAL); CHECK_V_ERROR;
+    }
+  }
+
+  /* order the interior rows of each chunk first, then all thread
+     boundary rows; the relative order within each group is kept.
+   */
+  k = 0;
+  for (p=0; p<tblocks; ++p) {
+    tbeg_row[p] = k;
+    for (i=p*rpp; i<n && i<(p+1)*rpp; ++i) {
+      if (! bdry[i]) n2o_tmp[k++] = n2o_row[i];
+    }
+  }
+  tbeg_row[tblocks] = k;
+  for (i=0; i<n; ++i) {
+    if (bdry[i]) {
+      n2o_tmp[k++] = n2o_row[i];
+      ++bdryCount;
+    }
+  }
+
+  for (i=0; i<n; ++i) {
+    n2o_row[i] = n2o_tmp[i];
+    o2n_col[n2o_row[i]] = i;
+  }
+
+  s->tblocks = tblocks;
+  s->tbeg_row = tbeg_row;
+
+  hypre_sprintf(msgBuf_dh, "thread subdomains= %i;  interior rows= %i;  thread boundary rows= %i",
+                                      tblocks, n, bdryCount);
+  SET_INFO(msgBuf_dh);
+
+  FREE_DH(owner); CHECK_V_ERROR;
+  FREE_DH(bdry); CHECK_V_ERROR;
+  FREE_DH(n2o_tmp); CHECK_V_ERROR;
+
+END_OF_FUNCTION: ;
+
+  END_FUNC_DH
+}
+
+
 #undef __FUNC__
 #define __FUNC__ "form_subdomaingraph_mpi_private"
 void form_subdomaingraph_mpi_private(SubdomainGraph_dh s)
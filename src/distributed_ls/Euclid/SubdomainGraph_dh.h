@@ -58,6 +58,14 @@ struct _subdomain_dh {
   Hash_i_dh o2n_ext;   /* permutation for external columns */
   Hash_i_dh n2o_ext;   /* inverse permutation for external columns */
 
+  /* thread subdomains; see SubdomainGraph_dhPartitionThreads() */
+  HYPRE_Int tblocks;   /* number of thread subdomains; 0 if not partitioned */
+  HYPRE_Int *tbeg_row; /* interior rows of thread subdomain p are the local
+                          rows tbeg_row[p] .. tbeg_row[p+1]-1; the rows from
+                          tbeg_row[tblocks] on are the thread boundary rows,
+                          followed by this subdomain's boundary rows
+                        */
+
   HYPRE_Real timing[TIMING_BINS_SG];
   bool debug;
 };
@@ -99,6 +107,16 @@ extern void SubdomainGraph_dhExchangePerms(SubdomainGraph_dh s);
      caller must ensure SubdomainGraph_dhInit() has completed before calling.
   */
 
+extern void SubdomainGraph_dhPartitionThreads(SubdomainGraph_dh s, HYPRE_Int tblocks, void *A);
+  /* Splits the locally owned interior rows into "tblocks" thread subdomains,
+     and reorders them so that the interior rows of each thread subdomain
+     come first, followed by all rows coupled to another thread subdomain.
+     The interior rows of different thread subdomains are not coupled, so
+     they can be factored and solved concurrently.  Alters n2o_row[] and
+     o2n_col[] for the locally owned interior rows only; caller must ensure
+     SubdomainGraph_dhInit() has completed before calling.
+  */
+
 extern void SubdomainGraph_dhPrintSubdomainGraph(SubdomainGraph_dh s, FILE *fp);
 
 extern void SubdomainGraph_dhPrintStatsLong(SubdomainGraph_dh s, FILE *fp);
@@ -19,21 +19,32 @@
 
 static bool check_constraint_private(Euclid_dh ctx, HYPRE_Int b, HYPRE_Int j);
 
+/* The row kernels read previously factored rows from the arrays passed
+   in; row i occupies [rbeg[i], rend[i]) of cval[], fill[] and aval[].
+   For the usual compressed row storage, rbeg = rp and rend = rp+1.
+   They use the _2 tracing macros, since they are called by OpenMP threads.
+*/
 static HYPRE_Int symbolic_row_private(HYPRE_Int localRow, 
                  HYPRE_Int *list, HYPRE_Int *marker, HYPRE_Int *tmpFill,
                  HYPRE_Int len, HYPRE_Int *CVAL, HYPRE_Real *AVAL,
-                 HYPRE_Int *o2n_col, Euclid_dh ctx, bool debug);
+                 HYPRE_Int *o2n_col, Euclid_dh ctx, bool debug,
+                 HYPRE_Int *rbeg, HYPRE_Int *rend, HYPRE_Int *cval,
+                 HYPRE_Int *fill, HYPRE_Int *diag, HYPRE_Real *stats);
 
 static HYPRE_Int numeric_row_private(HYPRE_Int localRow, 
                         HYPRE_Int len, HYPRE_Int *CVAL, HYPRE_Real *AVAL,
-                        REAL_DH *work, HYPRE_Int *o2n_col, Euclid_dh ctx, bool debug);
+                        REAL_DH *work, HYPRE_Int *o2n_col, Euclid_dh ctx, bool debug,
+                        HYPRE_Int *rbeg, HYPRE_Int *rend, HYPRE_Int *cval,
+                        HYPRE_Int *diag, REAL_DH *aval);
+
+static HYPRE_Int iluk_threads_private(Euclid_dh ctx);
 
 
 #undef __FUNC__
 #define __FUNC__ "compute_scaling_private"
 void compute_scaling_private(HYPRE_Int row, HYPRE_Int len, HYPRE_Real *AVAL, Euclid_dh ctx)
 {
-  START_FUNC_DH
+  START_FUNC_DH_2
   HYPRE_Real tmp = 0.0;
   HYPRE_Int j;
 
@@ -41,7 +52,7 @@ void compute_scaling_private(HYPRE_Int row, HYPRE_Int len, HYPRE_Real *AVAL, Euc
   if (tmp) {
     ctx->scale[row] = 1.0/tmp;
   }
-  END_FUNC_DH
+  END_FUNC_DH_2
 }
 
 #if 0
@@ -77,7 +88,7 @@ void iluk_seq(Euclid_dh ctx)
   HYPRE_Int      *CVAL;
   HYPRE_Int      i, j, len, count, col, idx = 0;
   HYPRE_Int      *list, *marker, *fill, *tmpFill;
-  HYPRE_Int      temp, m, from = ctx->from, to = ctx->to;
+  HYPRE_Int      temp, m, from = ctx->from, to = ctx->to, first = ctx->from;
   HYPRE_Int      *n2o_row, *o2n_col, beg_row, beg_rowP;
   HYPRE_Real   *AVAL;
   REAL_DH  *work, *aval;
@@ -87,6 +98,18 @@ void iluk_seq(Euclid_dh ctx)
 
   if (logFile != NULL  &&  Parser_dhHasSwitch(parser_dh, "-debug_ilu")) debug = true;
 
+  if (sg == NULL) {
+    SET_V_ERROR("subdomain graph is NULL");
+  }
+
+  /* factor the interior rows of the thread subdomains concurrently;
+     the loop below then continues with the thread boundary rows.
+   */
+  if (sg->tblocks > 1 && from == 0 && ! debug) {
+    idx = iluk_threads_private(ctx); CHECK_V_ERROR;
+    first = sg->tbeg_row[sg->tblocks];
+  }
+
   m = F->m;
   rp = F->rp;
   cval = F->cval;
@@ -96,10 +119,6 @@ void iluk_seq(Euclid_dh ctx)
   work = ctx->work;
   count = rp[from];
 
-  if (sg == NULL) {
-    SET_V_ERROR("subdomain graph is NULL");
-  }
-
   n2o_row = ctx->sg->n2o_row;
   o2n_col = ctx->sg->o2n_col;
   beg_row  = ctx->sg->beg_row[myid_dh];
@@ -120,7 +139,7 @@ void iluk_seq(Euclid_dh ctx)
 
   /*---------- main loop ----------*/
 
-  for (i=from; i<to; ++i) {
+  for (i=first; i<to; ++i) {
     HYPRE_Int row = n2o_row[i];             /* local row number */
     HYPRE_Int globalRow = row+beg_row;      /* global row number */
 
@@ -143,7 +162,8 @@ void iluk_seq(Euclid_dh ctx)
      */
     count = symbolic_row_private(i, list, marker, tmpFill, 
                                  len, CVAL, AVAL,
-                                 o2n_col, ctx, debug); CHECK_V_ERROR;
+                                 o2n_col, ctx, debug,
+                                 rp, rp+1, cval, fill, diag, ctx->stats); CHECK_V_ERROR;
 
     /* Ensure adequate storage; reallocate, if necessary. */
     if (idx + count > F->alloc) {
@@ -178,7 +198,8 @@ void iluk_seq(Euclid_dh ctx)
 
     /* compute numeric factor for current row */
      numeric_row_private(i, len, CVAL, AVAL, 
-                          work, o2n_col, ctx, debug); CHECK_V_ERROR
+                          work, o2n_col, ctx, debug,
+                          rp, rp+1, cval, diag, aval); CHECK_V_ERROR
     EuclidRestoreRow(ctx->A, globalRow, &len, &CVAL, &AVAL); CHECK_V_ERROR;
 
     /* Copy factored numeric row to permanent storage,
@@ -229,6 +250,184 @@ void iluk_seq(Euclid_dh ctx)
 }
 
 
+/* Factors the interior rows [tbeg_row[p], tbeg_row[p+1]) of the thread
+   subdomains set up by SubdomainGraph_dhPartitionThreads; the parts are
+   independent, so each is factored by one thread into private storage,
+   which is afterwards concatenated into F.  Rows of A are extracted up
+   front, since EuclidGetRow may not be called by more than one thread.
+   Returns the number of nonzeros stored in F.
+*/
+#undef __FUNC__
+#define __FUNC__ "iluk_threads_private"
+HYPRE_Int iluk_threads_private(Euclid_dh ctx)
+{
+  START_FUNC_DH
+  Factor_dh F = ctx->F;
+  SubdomainGraph_dh sg = ctx->sg;
+  HYPRE_Int T = sg->tblocks, *tbeg = sg->tbeg_row;
+  HYPRE_Int m = F->m, n = tbeg[T];
+  HYPRE_Int *rp = F->rp, *diag = F->diag, *rend;
+  HYPRE_Int *n2o_row = sg->n2o_row, *o2n_col = sg->o2n_col;
+  HYPRE_Int beg_row = sg->beg_row[myid_dh];
+  HYPRE_Int i, j, p, len, offset, total = 0, nthreads = hypre_NumThreads();
+  HYPRE_Int *CVAL, *arp, *acval, *pnz, *bad;
+  HYPRE_Real *AVAL, *aaval, *stats;
+  HYPRE_Int **pcval, **pfill, *list, *marker, *tmpFill;
+  REAL_DH **paval, *work;
+
+  /* extract the rows of A for the interior rows, in permuted order */
+  arp = (HYPRE_Int*)MALLOC_DH((n+1)*sizeof(HYPRE_Int)); CHECK_ERROR(-1);
+  arp[0] = 0;
+  for (i=0; i<n; ++i) {
+    HYPRE_Int globalRow = n2o_row[i]+beg_row;
+    EuclidGetRow(ctx->A, globalRow, &len, &CVAL, &AVAL); CHECK_ERROR(-1);
+    arp[i+1] = arp[i]+len;
+    EuclidRestoreRow(ctx->A, globalRow, &len, &CVAL, &AVAL); CHECK_ERROR(-1);
+  }
+  acval = (HYPRE_Int*)MALLOC_DH(arp[n]*sizeof(HYPRE_Int)); CHECK_ERROR(-1);
+  aaval = (HYPRE_Real*)MALLOC_DH(arp[n]*sizeof(HYPRE_Real)); CHECK_ERROR(-1);
+  for (i=0; i<n; ++i) {
+    HYPRE_Int globalRow = n2o_row[i]+beg_row;
+    EuclidGetRow(ctx->A, globalRow, &len, &CVAL, &AVAL); CHECK_ERROR(-1);
+    hypre_TMemcpy(acval+arp[i], CVAL, HYPRE_Int, len, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+    hypre_TMemcpy(aaval+arp[i], AVAL, HYPRE_Real, len, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+    EuclidRestoreRow(ctx->A, globalRow, &len, &CVAL, &AVAL); CHECK_ERROR(-1);
+  }
+
+  /* per-part results, and per-thread working space */
+  rend = (HYPRE_Int*)MALLOC_DH(n*sizeof(HYPRE_Int)); CHECK_ERROR(-1);
+  pnz = (HYPRE_Int*)MALLOC_DH(T*sizeof(HYPRE_Int)); CHECK_ERROR(-1);
+  bad = (HYPRE_Int*)MALLOC_DH(T*sizeof(HYPRE_Int)); CHECK_ERROR(-1);
+  pcval = (HYPRE_Int**)MALLOC_DH(T*sizeof(HYPRE_Int*)); CHECK_ERROR(-1);
+  pfill = (HYPRE_Int**)MALLOC_DH(T*sizeof(HYPRE_Int*)); CHECK_ERROR(-1);
+  paval = (REAL_DH**)MALLOC_DH(T*sizeof(REAL_DH*)); CHECK_ERROR(-1);
+  for (p=0; p<T; ++p) bad[p] = -1;
+
+  list = (HYPRE_Int*)MALLOC_DH(nthreads*(m+1)*sizeof(HYPRE_Int)); CHECK_ERROR(-1);
+  marker = (HYPRE_Int*)MALLOC_DH(nthreads*m*sizeof(HYPRE_Int)); CHECK_ERROR(-1);
+  tmpFill = (HYPRE_Int*)MALLOC_DH(nthreads*m*sizeof(HYPRE_Int)); CHECK_ERROR(-1);
+  work = (REAL_DH*)MALLOC_DH(nthreads*m*sizeof(REAL_DH)); CHECK_ERROR(-1);
+  stats = (HYPRE_Real*)MALLOC_DH(nthreads*STATS_BINS*sizeof(HYPRE_Real)); CHECK_ERROR(-1);
+  for (i=0; i<nthreads*m; ++i) { marker[i] = -1; work[i] = 0.0; }
+  for (i=0; i<nthreads*STATS_BINS; ++i) stats[i] = 0.0;
+
+  /* static scheduling hands each thread its parts in increasing order,
+     which the marker[] test in symbolic_row_private relies upon.
+   */
+#ifdef USING_OPENMP_TBLOCKS_DH
+#pragma omp parallel for private(p, i, j) schedule(static)
+#endif
+  for (p=0; p<T; ++p) {
+    HYPRE_Int tid = hypre_GetThreadNum();
+    HYPRE_Int *lst = list+tid*(m+1), *mrk = marker+tid*m, *tf = tmpFill+tid*m;
+    REAL_DH *wk = work+tid*m;
+    HYPRE_Int alloc = 2*(arp[tbeg[p+1]]-arp[tbeg[p]]) + 1;
+    HYPRE_Int idx = 0, col, count, temp;
+    HYPRE_Int *cv = hypre_TAlloc(HYPRE_Int, alloc, HYPRE_MEMORY_HOST);
+    HYPRE_Int *fl = hypre_TAlloc(HYPRE_Int, alloc, HYPRE_MEMORY_HOST);
+    REAL_DH *av = hypre_TAlloc(REAL_DH, alloc, HYPRE_MEMORY_HOST);
+
+    for (i=tbeg[p]; i<tbeg[p+1]; ++i) {
+      HYPRE_Int plen = arp[i+1]-arp[i];
+
+      if (ctx->isScaled) {
+        compute_scaling_private(i, plen, aaval+arp[i], ctx);
+      }
+
+      count = symbolic_row_private(i, lst, mrk, tf, plen,
+                                   acval+arp[i], aaval+arp[i],
+                                   o2n_col, ctx, false,
+                                   rp, rend, cv, fl, diag, stats+tid*STATS_BINS);
+
+      if (idx + count > alloc) {
+        HYPRE_Int newAlloc = 2*alloc + count;
+        cv = hypre_TReAlloc(cv, HYPRE_Int, newAlloc, HYPRE_MEMORY_HOST);
+        fl = hypre_TReAlloc(fl, HYPRE_Int, newAlloc, HYPRE_MEMORY_HOST);
+        av = hypre_TReAlloc(av, REAL_DH, newAlloc, HYPRE_MEMORY_HOST);
+        alloc = newAlloc;
+      }
+
+      /* rows are stored part-locally; rp[] and diag[] are shifted below */
+      rp[i] = idx;
+      col = lst[m];
+      while (count--) {
+        cv[idx] = col;
+        fl[idx] = tf[col];
+        ++idx;
+        col = lst[col];
+      }
+      rend[i] = idx;
+
+      temp = rp[i];
+      while (cv[temp] != i) ++temp;
+      diag[i] = temp;
+
+      numeric_row_private(i, plen, acval+arp[i], aaval+arp[i],
+                          wk, o2n_col, ctx, false,
+                          rp, rend, cv, diag, av);
+
+      for (j=rp[i]; j<rend[i]; ++j) {
+        col = cv[j];
+        av[j] = wk[col];
+        wk[col] = 0.0;
+      }
+
+      if (! av[diag[i]] && bad[p] < 0) bad[p] = i;
+    }
+
+    pcval[p] = cv;
+    pfill[p] = fl;
+    paval[p] = av;
+    pnz[p] = idx;
+  }
+
+  for (p=0; p<T; ++p) {
+    if (bad[p] >= 0) {
+      hypre_sprintf(msgBuf_dh, "zero diagonal in local row %i", bad[p]+1);
+      SET_ERROR(-1, msgBuf_dh);
+    }
+    total += pnz[p];
+  }
+  for (i=0; i<nthreads; ++i) {
+    for (j=0; j<STATS_BINS; ++j) ctx->stats[j] += stats[i*STATS_BINS+j];
+  }
+
+  /* concatenate the parts into F */
+  Factor_dhReallocate(F, 0, total); CHECK_ERROR(-1);
+  offset = 0;
+  for (p=0; p<T; ++p) {
+    hypre_TMemcpy(F->cval+offset, pcval[p], HYPRE_Int, pnz[p], HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+    hypre_TMemcpy(F->fill+offset, pfill[p], HYPRE_Int, pnz[p], HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+    hypre_TMemcpy(F->aval+offset, paval[p], REAL_DH, pnz[p], HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+    for (i=tbeg[p]; i<tbeg[p+1]; ++i) {
+      rp[i] += offset;
+      diag[i] += offset;
+    }
+    offset += pnz[p];
+    hypre_TFree(pcval[p], HYPRE_MEMORY_HOST);
+    hypre_TFree(pfill[p], HYPRE_MEMORY_HOST);
+    hypre_TFree(paval[p], HYPRE_MEMORY_HOST);
+  }
+  rp[n] = total;
+
+  FREE_DH(arp); CHECK_ERROR(-1);
+  FREE_DH(acval); CHECK_ERROR(-1);
+  FREE_DH(aaval); CHECK_ERROR(-1);
+  FREE_DH(rend); CHECK_ERROR(-1);
+  FREE_DH(pnz); CHECK_ERROR(-1);
+  FREE_DH(bad); CHECK_ERROR(-1);
+  FREE_DH(pcval); CHECK_ERROR(-1);
+  FREE_DH(pfill); CHECK_ERROR(-1);
+  FREE_DH(paval); CHECK_ERROR(-1);
+  FREE_DH(list); CHECK_ERROR(-1);
+  FREE_DH(marker); CHECK_ERROR(-1);
+  FREE_DH(tmpFill); CHECK_ERROR(-1);
+  FREE_DH(work); CHECK_ERROR(-1);
+  FREE_DH(stats); CHECK_ERROR(-1);
+  END_FUNC_VAL(total)
+}
+
+
 #undef __FUNC__
 #define __FUNC__ "iluk_seq_block"
 void iluk_seq_block(Euclid_dh ctx)
@@ -332,7 +531,8 @@ void iluk_seq_block(Euclid_dh ctx)
      */
     count = symbolic_row_private(i, list, marker, tmpFill, 
                                  len, CVAL, AVAL,
-                                 o2n_col, ctx, debug); CHECK_V_ERROR;
+                                 o2n_col, ctx, debug,
+                                 rp, rp+1, cval, fill, diag, ctx->stats); CHECK_V_ERROR;
 
     /* Ensure adequate storage; reallocate, if necessary. */
     if (idx + count > F->alloc) {
@@ -396,7 +596,8 @@ void iluk_seq_block(Euclid_dh ctx)
 
     /* compute numeric factor for current row */
     numeric_row_private(i, len, CVAL, AVAL, 
-                          work, o2n_col, ctx, debug); CHECK_V_ERROR
+                          work, o2n_col, ctx, debug,
+                          rp, rp+1, cval, diag, aval); CHECK_V_ERROR
     EuclidRestoreRow(ctx->A, row, &len, &CVAL, &AVAL); CHECK_V_ERROR;
 
     /* Copy factored numeric row to permanent storage,
@@ -452,12 +653,12 @@ void iluk_seq_block(Euclid_dh ctx)
 HYPRE_Int symbolic_row_private(HYPRE_Int localRow, 
                  HYPRE_Int *list, HYPRE_Int *marker, HYPRE_Int *tmpFill,
                  HYPRE_Int len, HYPRE_Int *CVAL, HYPRE_Real *AVAL,
-                 HYPRE_Int *o2n_col, Euclid_dh ctx, bool debug)
+                 HYPRE_Int *o2n_col, Euclid_dh ctx, bool debug,
+                 HYPRE_Int *rbeg, HYPRE_Int *rend, HYPRE_Int *cval,
+                 HYPRE_Int *fill, HYPRE_Int *diag, HYPRE_Real *stats)
 {
-  START_FUNC_DH
+  START_FUNC_DH_2
   HYPRE_Int level = ctx->level, m = ctx->F->m;
-  HYPRE_Int *cval = ctx->F->cval, *diag = ctx->F->diag, *rp = ctx->F->rp; 
-  HYPRE_Int *fill = ctx->F->fill;
   HYPRE_Int count = 0;
   HYPRE_Int j, node, tmp, col, head;
   HYPRE_Int fill1, fill2, beg_row;
@@ -466,7 +667,7 @@ HYPRE_Int symbolic_row_private(HYPRE_Int localRow,
   REAL_DH scale;
 
   scale = ctx->scale[localRow]; 
-  ctx->stats[NZA_STATS] += (HYPRE_Real)len;
+  stats[NZA_STATS] += (HYPRE_Real)len;
   beg_row  = ctx->sg->beg_row[myid_dh];
 
   /* Insert col indices in linked list, and values in work vector.
@@ -502,7 +703,7 @@ HYPRE_Int symbolic_row_private(HYPRE_Int localRow,
     marker[localRow]  = localRow;
     ++count;
   }
-  ctx->stats[NZA_USED_STATS] += (HYPRE_Real)count;
+  stats[NZA_USED_STATS] += (HYPRE_Real)count;
 
   /* update row from previously factored rows */
   head = m;
@@ -516,7 +717,7 @@ HYPRE_Int symbolic_row_private(HYPRE_Int localRow,
       }
 
       if (fill1 < level) {
-        for (j = diag[node]+1; j<rp[node+1]; ++j) {
+        for (j = diag[node]+1; j<rend[node]; ++j) {
           col = cval[j];
           fill2 = fill1 + fill[j] + 1;
 
@@ -544,7 +745,7 @@ HYPRE_Int symbolic_row_private(HYPRE_Int localRow,
       head = list[head];  /* advance to next item in linked list */
     }
   }
-  END_FUNC_VAL(count)
+  END_FUNC_VAL_2(count)
 }
 
 
@@ -552,23 +753,23 @@ HYPRE_Int symbolic_row_private(HYPRE_Int localRow,
 #define __FUNC__ "numeric_row_private"
 HYPRE_Int numeric_row_private(HYPRE_Int localRow, 
                         HYPRE_Int len, HYPRE_Int *CVAL, HYPRE_Real *AVAL,
-                        REAL_DH *work, HYPRE_Int *o2n_col, Euclid_dh ctx, bool debug)
+                        REAL_DH *work, HYPRE_Int *o2n_col, Euclid_dh ctx, bool debug,
+                        HYPRE_Int *rbeg, HYPRE_Int *rend, HYPRE_Int *cval,
+                        HYPRE_Int *diag, REAL_DH *aval)
 {
-  START_FUNC_DH
+  START_FUNC_DH_2
   HYPRE_Real  pc, pv, multiplier;
   HYPRE_Int     j, k, col, row;
-  HYPRE_Int     *rp = ctx->F->rp, *cval = ctx->F->cval;
-  HYPRE_Int     *diag = ctx->F->diag;
   HYPRE_Int     beg_row;
   HYPRE_Real  val;
-  REAL_DH *aval = ctx->F->aval, scale;
+  REAL_DH scale;
 
   scale = ctx->scale[localRow]; 
   beg_row  = ctx->sg->beg_row[myid_dh];
 
   /* zero work vector */
   /* note: indices in col[] are already permuted. */
-  for (j=rp[localRow]; j<rp[localRow+1]; ++j) { 
+  for (j=rbeg[localRow]; j<rend[localRow]; ++j) { 
     col = cval[j];  
     work[col] = 0.0; 
   }
@@ -589,7 +790,7 @@ HYPRE_Int numeric_row_private(HYPRE_Int localRow,
 */
 
 
-  for (j=rp[localRow]; j<diag[localRow]; ++j) {
+  for (j=rbeg[localRow]; j<diag[localRow]; ++j) {
     row = cval[j];     /* previously factored row */
     pc = work[row];
 
@@ -610,7 +811,7 @@ hypre_fprintf(stderr, "pv= %g; pc= %g\n", pv, pc);
         hypre_fprintf(logFile, "ILU_seq   nf updating from row: %i; multiplier= %g\n", 1+row, multiplier);
       }
 
-      for (k=diag[row]+1; k<rp[row+1]; ++k) {
+      for (k=diag[row]+1; k<rend[row]; ++k) {
         col = cval[k];
         work[col] -= (multiplier * aval[k]);
       }
@@ -629,7 +830,7 @@ hypre_fprintf(stderr, "pv= %g; pc= %g\n", pv, pc);
   }
 #endif
 
-  END_FUNC_VAL(0)
+  END_FUNC_VAL_2(0)
 }
 
 
@@ -30,6 +30,7 @@
 
 #define PARASAILS_MAXLEN  300000 /* maximum nz in a pattern - can grow */
 #define PARASAILS_NROWS   300000 /* maximum rows stored per proc - can grow */
+#define PARASAILS_BATCH       64 /* maximum rows per batch of equal size rows */
 
 #ifndef ABS
 #define ABS(x) (((x)<0)?(-(x)):(x))
@@ -996,26 +996,141 @@ static void ConstructPatternForEachRowExt(HYPRE_Int symmetric,
 }
 
 /*--------------------------------------------------------------------------
- * ComputeValuesSym
+ * ValuesWork - workspace for computing the values of rows of the
+ * approximate inverse.  Each thread owns one, so that no allocations are
+ * shared between threads.  The marker array has length num_ind and is
+ * kept at -1 between rows.
  *--------------------------------------------------------------------------*/
 
-static HYPRE_Int ComputeValuesSym(StoredRows *stored_rows, Matrix *mat,
-  HYPRE_Int local_beg_row, Numbering *numb, HYPRE_Int symmetric)
+typedef struct
 {
-    HYPRE_Int *marker;
-    HYPRE_Int row, maxlen, len, *ind;
+    HYPRE_Int  *marker;
+    HYPRE_Int  *patt;
+    HYPRE_Int   pattsize;
+    HYPRE_Real *ahat;
+    HYPRE_Int   ahat_size;
+    HYPRE_Real *bhat;
+    HYPRE_Int   bhat_size;
+    HYPRE_Real *work;
+    HYPRE_Int   work_size;
+}
+ValuesWork;
+
+static ValuesWork *ValuesWorkCreate(HYPRE_Int num_ind, HYPRE_Int ahat_size,
+  HYPRE_Int symmetric)
+{
+    ValuesWork *w = hypre_TAlloc(ValuesWork, 1, HYPRE_MEMORY_HOST);
+    HYPRE_Int i;
+
+    w->marker = hypre_TAlloc(HYPRE_Int, num_ind, HYPRE_MEMORY_HOST);
+    for (i=0; i<num_ind; i++)
+        w->marker[i] = -1;
+
+    w->ahat_size = ahat_size;
+    w->ahat = hypre_TAlloc(HYPRE_Real, ahat_size, HYPRE_MEMORY_HOST);
+
+    /* least squares workspace, only for the nonsymmetric case */
+    w->pattsize  = symmetric ? 0 : 1000;
+    w->bhat_size = symmetric ? 0 : 1000;
+    w->work_size = symmetric ? 0 : 2000*64;
+    w->patt = hypre_TAlloc(HYPRE_Int, w->pattsize, HYPRE_MEMORY_HOST);
+    w->bhat = hypre_TAlloc(HYPRE_Real, w->bhat_size, HYPRE_MEMORY_HOST);
+    w->work = hypre_CTAlloc(HYPRE_Real, w->work_size, HYPRE_MEMORY_HOST);
+
+    return w;
+}
+
+static void ValuesWorkDestroy(ValuesWork *w)
+{
+    hypre_TFree(w->marker,HYPRE_MEMORY_HOST);
+    hypre_TFree(w->patt,HYPRE_MEMORY_HOST);
+    hypre_TFree(w->ahat,HYPRE_MEMORY_HOST);
+    hypre_TFree(w->bhat,HYPRE_MEMORY_HOST);
+    hypre_TFree(w->work,HYPRE_MEMORY_HOST);
+    hypre_TFree(w,HYPRE_MEMORY_HOST);
+}
+
+/*--------------------------------------------------------------------------
+ * BatchRowsBySize - group the rows local_beg_row..mat->end_row of "mat"
+ * into batches of rows with the same pattern size, holding at most
+ * PARASAILS_BATCH rows each.  The rows of batch b are
+ * rows[batch_ptr[b]..batch_ptr[b+1]-1], in increasing order; batches
+ * are ordered from the largest pattern size down, so that the most
+ * expensive batches are scheduled first.  Returns the number of batches.
+ * The local index of each row in "numb" is returned in "diag".
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int BatchRowsBySize(Matrix *mat, HYPRE_Int local_beg_row,
+  Numbering *numb, HYPRE_Int maxlen, HYPRE_Int **rowsp, HYPRE_Int **diagp,
+  HYPRE_Int **batch_ptrp)
+{
+    HYPRE_Int num_rows = mat->end_row - local_beg_row + 1;
+    HYPRE_Int *rows, *diag, *batch_ptr, *count;
+    HYPRE_Int row, len, *ind, i, num_batches;
+    HYPRE_Real *val;
+
+    rows      = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+    diag      = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+    batch_ptr = hypre_TAlloc(HYPRE_Int, num_rows+1, HYPRE_MEMORY_HOST);
+    count     = hypre_CTAlloc(HYPRE_Int, maxlen+2, HYPRE_MEMORY_HOST);
+
+    /* counting sort on decreasing length; count[maxlen-len+1] */
+    for (row=local_beg_row; row<=mat->end_row; row++)
+    {
+        MatrixGetRow(mat, row - mat->beg_row, &len, &ind, &val);
+        count[maxlen-len+1]++;
+    }
+    for (i=1; i<=maxlen+1; i++)
+        count[i] += count[i-1];
+    for (row=local_beg_row; row<=mat->end_row; row++)
+    {
+        MatrixGetRow(mat, row - mat->beg_row, &len, &ind, &val);
+        rows[count[maxlen-len]++] = row;
+    }
+
+    /* split into batches */
+    num_batches = 0;
+    for (i=0; i<num_rows; i++)
+    {
+        if (i == 0 || i - batch_ptr[num_batches-1] == PARASAILS_BATCH ||
+            mat->lens[rows[i] - mat->beg_row] !=
+            mat->lens[rows[i-1] - mat->beg_row])
+        {
+            batch_ptr[num_batches++] = i;
+        }
+    }
+    batch_ptr[num_batches] = num_rows;
+
+    /* local index of the diagonal of each row; numb may not be used
+       by more than one thread, since a lookup can insert new indices */
+    NumberingGlobalToLocal(numb, num_rows, rows, diag);
+
+    hypre_TFree(count,HYPRE_MEMORY_HOST);
+
+    *rowsp = rows;
+    *diagp = diag;
+    *batch_ptrp = batch_ptr;
+
+    return num_batches;
+}
+
+/*--------------------------------------------------------------------------
+ * ComputeValuesSymRow - compute row "row" of the approximate inverse;
+ * "diag" is the local index of "row".  Returns 1 if the local system
+ * could not be solved.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int ComputeValuesSymRow(StoredRows *stored_rows, Matrix *mat,
+  HYPRE_Int row, HYPRE_Int diag, HYPRE_Int symmetric, ValuesWork *w)
+{
+    HYPRE_Int *marker = w->marker;
+    HYPRE_Real *ahat = w->ahat, *ahatp;
+    HYPRE_Int len, *ind;
     HYPRE_Real *val;
 
-    HYPRE_Real *ahat, *ahatp;
     HYPRE_Int i, j, len2, *ind2, loc;
     HYPRE_Real *val2, temp;
-    HYPRE_Real error = 0;
-
-#ifdef PARASAILS_DEBUG
-    HYPRE_Real time0, time1;
-    HYPRE_Real timet = 0.0, timea = 0.0;
-    HYPRE_Real ahatcost = 0.0;
-#endif
+    HYPRE_Int error = 0;
 
 #ifndef ESSL
     char uplo = 'L';
@@ -1023,213 +1138,199 @@ static HYPRE_Int ComputeValuesSym(StoredRows *stored_rows, Matrix *mat,
     HYPRE_Int info;
 #endif
 
-    /* Allocate and initialize full length marker array */
-    marker = hypre_TAlloc(HYPRE_Int, numb->num_ind , HYPRE_MEMORY_HOST);
-    for (i=0; i<numb->num_ind; i++)
-        marker[i] = -1;
+    /* Retrieve local indices */
+    MatrixGetRow(mat, row - mat->beg_row, &len, &ind, &val);
 
-    /* Determine the length of the longest row of M on this processor */
-    /* This determines the maximum storage required for the ahat matrix */
-    maxlen = 0;
-    for (row=local_beg_row; row<=mat->end_row; row++)
-    {
-        MatrixGetRow(mat, row - mat->beg_row, &len, &ind, &val);
-        maxlen = (len > maxlen ? len : maxlen);
-    }
+    /* Fill marker array in locations of local indices */
+    for (i=0; i<len; i++)
+        marker[ind[i]] = i;
 
+    /* Initialize ahat to zero */
 #ifdef ESSL
-    ahat = hypre_TAlloc(HYPRE_Real, maxlen*(maxlen+1)/2 , HYPRE_MEMORY_HOST);
+    memset(ahat, 0, len*(len+1)/2 * sizeof(HYPRE_Real));
 #else
-    ahat = hypre_TAlloc(HYPRE_Real, maxlen*maxlen , HYPRE_MEMORY_HOST);
+    memset(ahat, 0, len*len * sizeof(HYPRE_Real));
 #endif
 
-    /* Compute values for row "row" of approximate inverse */
-    for (row=local_beg_row; row<=mat->end_row; row++)
+    /* Form ahat matrix, entries correspond to indices in "ind" only */
+    ahatp = ahat;
+    for (i=0; i<len; i++)
     {
-        /* Retrieve local indices */
-        MatrixGetRow(mat, row - mat->beg_row, &len, &ind, &val);
+        StoredRowsGet(stored_rows, ind[i], &len2, &ind2, &val2);
+        hypre_assert(len2 > 0);
 
-        /* Fill marker array in locations of local indices */
-        for (i=0; i<len; i++)
-            marker[ind[i]] = i;
-
-        /* Initialize ahat to zero */
 #ifdef ESSL
-/*        bzero((char *) ahat, len*(len+1)/2 * sizeof(HYPRE_Real));*/
-        memset(ahat, 0, len*(len+1)/2 * sizeof(HYPRE_Real));
-#else
-/*        bzero((char *) ahat, len*len * sizeof(HYPRE_Real));*/
-        memset(ahat, 0, len*len * sizeof(HYPRE_Real));
-#endif
-
-#ifdef PARASAILS_DEBUG
-        time0 = hypre_MPI_Wtime();
-#endif
-
-        /* Form ahat matrix, entries correspond to indices in "ind" only */
-        ahatp = ahat;
-        for (i=0; i<len; i++)
+        for (j=0; j<len2; j++)
         {
-            StoredRowsGet(stored_rows, ind[i], &len2, &ind2, &val2);
-            hypre_assert(len2 > 0);
+            loc = marker[ind2[j]];
 
-#ifdef ESSL
-            for (j=0; j<len2; j++)
-            {
-                loc = marker[ind2[j]];
-
-                if (loc != -1) /* redundant */
-                    if (loc >= i)
-                        ahatp[loc - i] = val2[j];
-            }
+            if (loc != -1) /* redundant */
+                if (loc >= i)
+                    ahatp[loc - i] = val2[j];
+        }
 
-            ahatp += (len-i);
+        ahatp += (len-i);
 #else
-            for (j=0; j<len2; j++)
-            {
-                loc = marker[ind2[j]];
+        for (j=0; j<len2; j++)
+        {
+            loc = marker[ind2[j]];
 
-                if (loc != -1)
-                    ahatp[loc] = val2[j];
-            }
+            if (loc != -1)
+                ahatp[loc] = val2[j];
+        }
 
-            ahatp += len;
+        ahatp += len;
 #endif
-        }
+    }
 
-        if (symmetric == 2)
-        {
+    if (symmetric == 2)
+    {
 #ifdef ESSL
-            hypre_printf("Symmetric precon for nonsym problem not yet available\n");
-            hypre_printf("for ESSL version.  Please contact the author.\n");
-            PARASAILS_EXIT;
+        hypre_printf("Symmetric precon for nonsym problem not yet available\n");
+        hypre_printf("for ESSL version.  Please contact the author.\n");
+        PARASAILS_EXIT;
 #else
-            HYPRE_Int k, kk;
-            k = 0;
-            for (i=0; i<len; i++)
+        HYPRE_Int k, kk;
+        k = 0;
+        for (i=0; i<len; i++)
+        {
+            for (j=0; j<len; j++)
             {
-                for (j=0; j<len; j++)
-                {
-                    kk = j*len + i;
-                    ahat[k] = (ahat[k] + ahat[kk]) / 2.0;
-                    k++;
-                }
+                kk = j*len + i;
+                ahat[k] = (ahat[k] + ahat[kk]) / 2.0;
+                k++;
             }
-#endif
         }
+#endif
+    }
 
-#ifdef PARASAILS_DEBUG
-        time1 = hypre_MPI_Wtime();
-        timea += (time1 - time0);
-        ahatcost += (HYPRE_Real) (len*len2);
+    /* Set the right-hand side */
+    memset(val, 0, len*sizeof(HYPRE_Real));
+    loc = marker[diag];
+    hypre_assert(loc != -1);
+    val[loc] = 1.0;
+
+    /* Reset marker array */
+    for (i=0; i<len; i++)
+        marker[ind[i]] = -1;
+
+#ifdef ESSL
+    dppf(ahat, len, 1);
+    dpps(ahat, len, val, 1);
+#else
+    /* Solve local linear system - factor phase */
+    hypre_dpotrf(&uplo, &len, ahat, &len, &info);
+    if (info != 0)
+        error = 1;
+
+    /* Solve local linear system - solve phase */
+    hypre_dpotrs(&uplo, &len, &one, ahat, &len, val, &len, &info);
+    if (info != 0)
+        error = 1;
 #endif
 
-        /* Set the right-hand side */
-/*        bzero((char *) val, len*sizeof(HYPRE_Real));*/
-        memset(val, 0, len*sizeof(HYPRE_Real));
-        NumberingGlobalToLocal(numb, 1, &row, &loc);
-        loc = marker[loc];
-        hypre_assert(loc != -1);
-        val[loc] = 1.0;
+    /* Scale the result */
+    temp = 1.0 / sqrt(ABS(val[loc]));
+    for (i=0; i<len; i++)
+        val[i] = val[i] * temp;
 
-        /* Reset marker array */
-        for (i=0; i<len; i++)
-            marker[ind[i]] = -1;
+    return error;
+}
+
+/*--------------------------------------------------------------------------
+ * ComputeValuesSym
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int ComputeValuesSym(StoredRows *stored_rows, Matrix *mat,
+  HYPRE_Int local_beg_row, Numbering *numb, HYPRE_Int symmetric)
+{
+    HYPRE_Int row, maxlen, len, *ind;
+    HYPRE_Real *val;
+    HYPRE_Int *rows, *diag, *batch_ptr, num_batches, b, k;
+    HYPRE_Int error = 0;
 
 #ifdef PARASAILS_DEBUG
-        time0 = hypre_MPI_Wtime();
+    HYPRE_Real time0 = hypre_MPI_Wtime();
 #endif
 
+    /* Determine the length of the longest row of M on this processor */
+    /* This determines the maximum storage required for the ahat matrix */
+    maxlen = 0;
+    for (row=local_beg_row; row<=mat->end_row; row++)
+    {
+        MatrixGetRow(mat, row - mat->beg_row, &len, &ind, &val);
+        maxlen = (len > maxlen ? len : maxlen);
+    }
+
+    num_batches = BatchRowsBySize(mat, local_beg_row, numb, maxlen,
+        &rows, &diag, &batch_ptr);
+
+    /* The rows are independent, so the result does not depend on which
+       thread computes a row */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(b, k) reduction(+:error)
+#endif
+    {
 #ifdef ESSL
-        dppf(ahat, len, 1);
-        dpps(ahat, len, val, 1);
+        ValuesWork *w = ValuesWorkCreate(numb->num_ind, maxlen*(maxlen+1)/2, 1);
 #else
-        /* Solve local linear system - factor phase */
-        hypre_dpotrf(&uplo, &len, ahat, &len, &info);
-        if (info != 0)
-        {
-#if 0
-            hypre_printf("Matrix may not be symmetric positive definite.\n");
-            hypre_printf("ParaSails: row %d, dpotrf returned %d.\n", row, info);
-            hypre_printf("ParaSails: len %d, ahat: %f %f %f %f\n", len,
-                ahat[0], ahat[1], ahat[2], ahat[3]);
-            PARASAILS_EXIT;
+        ValuesWork *w = ValuesWorkCreate(numb->num_ind, maxlen*maxlen, 1);
 #endif
-            error = 1;
-        }
 
-        /* Solve local linear system - solve phase */
-        hypre_dpotrs(&uplo, &len, &one, ahat, &len, val, &len, &info);
-        if (info != 0)
-        {
-#if 0
-            hypre_printf("ParaSails: row %d, dpotrs returned %d.\n", row, info);
-            hypre_printf("ParaSails: len %d, ahat: %f %f %f %f\n", len,
-                ahat[0], ahat[1], ahat[2], ahat[3]);
-            PARASAILS_EXIT;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for schedule(dynamic)
 #endif
-            error = 1;
+        for (b=0; b<num_batches; b++)
+        {
+            for (k=batch_ptr[b]; k<batch_ptr[b+1]; k++)
+            {
+                error += ComputeValuesSymRow(stored_rows, mat, rows[k], diag[k],
+                    symmetric, w);
+            }
         }
-#endif
-
-#ifdef PARASAILS_DEBUG
-        time1 = hypre_MPI_Wtime();
-        timet += (time1 - time0);
-#endif
 
-        /* Scale the result */
-        temp = 1.0 / sqrt(ABS(val[loc]));
-        for (i=0; i<len; i++)
-            val[i] = val[i] * temp;
+        ValuesWorkDestroy(w);
     }
 
-    hypre_TFree(marker,HYPRE_MEMORY_HOST);
-    hypre_TFree(ahat,HYPRE_MEMORY_HOST);
+    hypre_TFree(rows,HYPRE_MEMORY_HOST);
+    hypre_TFree(diag,HYPRE_MEMORY_HOST);
+    hypre_TFree(batch_ptr,HYPRE_MEMORY_HOST);
 
 #ifdef PARASAILS_DEBUG
     {
        HYPRE_Int mype;
 
        hypre_MPI_Comm_rank(hypre_MPI_COMM_WORLD, &mype);
-       hypre_printf("%d: Time for ahat: %f, for local solves: %f\n", mype, timea, timet);
-       hypre_printf("%d: ahatcost: %7.1e, numrows: %d, maxlen: %d\n",
-                    mype, ahatcost, mat->end_row-local_beg_row+1, maxlen);
+       hypre_printf("%d: Time for values: %f\n", mype, hypre_MPI_Wtime() - time0);
+       hypre_printf("%d: numrows: %d, maxlen: %d, batches: %d\n",
+                    mype, mat->end_row-local_beg_row+1, maxlen, num_batches);
        fflush(stdout);
     }
 #endif
 
-    return error;
+    return (error != 0);
 }
 
 /*--------------------------------------------------------------------------
- * ComputeValuesNonsym
+ * ComputeValuesNonsymRow - compute row "row" of the approximate inverse;
+ * "diag" is the local index of "row".  Returns 1 if the least squares
+ * problem could not be solved.
  *--------------------------------------------------------------------------*/
 
-static HYPRE_Int ComputeValuesNonsym(StoredRows *stored_rows, Matrix *mat,
-  HYPRE_Int local_beg_row, Numbering *numb)
+static HYPRE_Int ComputeValuesNonsymRow(StoredRows *stored_rows, Matrix *mat,
+  HYPRE_Int row, HYPRE_Int diag, ValuesWork *w)
 {
-    HYPRE_Int *marker;
-    HYPRE_Real *ahat, *ahatp, *bhat;
-    HYPRE_Real *work;
-    HYPRE_Int ahat_size = 10000, bhat_size = 1000, work_size = 2000*64;
+    HYPRE_Int *marker = w->marker;
+    HYPRE_Real *ahatp;
 
-    HYPRE_Int row, len, *ind;
+    HYPRE_Int len, *ind;
     HYPRE_Real *val;
 
     HYPRE_Int i, j, len2, *ind2, loc;
     HYPRE_Real *val2;
 
-#ifdef PARASAILS_DEBUG
-    HYPRE_Real time0, time1;
-    HYPRE_Real timet = 0.0, timea = 0.0;
-#endif
-
     HYPRE_Int npat;
-    HYPRE_Int pattsize = 1000;
-    HYPRE_Int *patt = hypre_TAlloc(HYPRE_Int, pattsize, HYPRE_MEMORY_HOST);
-
     HYPRE_Int info;
-
     HYPRE_Int error = 0;
 
 #ifndef ESSL
@@ -1237,158 +1338,164 @@ static HYPRE_Int ComputeValuesNonsym(StoredRows *stored_rows, Matrix *mat,
     HYPRE_Int one = 1;
 #endif
 
-    /* Allocate and initialize marker array */
-    /* Since numb already knows about the indices of the external rows that
-       will be needed, numb_ind is the maximum size of the marker array */
-    marker = hypre_TAlloc(HYPRE_Int, numb->num_ind , HYPRE_MEMORY_HOST);
-    for (i=0; i<numb->num_ind; i++)
-        marker[i] = -1;
+    /* Retrieve local indices */
+    MatrixGetRow(mat, row - mat->beg_row, &len, &ind, &val);
 
-    bhat = hypre_TAlloc(HYPRE_Real, bhat_size , HYPRE_MEMORY_HOST);
-    ahat = hypre_TAlloc(HYPRE_Real, ahat_size , HYPRE_MEMORY_HOST);
-    work = hypre_CTAlloc(HYPRE_Real, work_size, HYPRE_MEMORY_HOST);
+    npat = 0;
 
-    /* Compute values for row "row" of approximate inverse */
-    for (row=local_beg_row; row<=mat->end_row; row++)
-    {
-#ifdef PARASAILS_DEBUG
-        time0 = hypre_MPI_Wtime();
-#endif
-
-        /* Retrieve local indices */
-        MatrixGetRow(mat, row - mat->beg_row, &len, &ind, &val);
+    /* Put the diagonal entry into the marker array */
+    marker[diag] = npat;
+    w->patt[npat++] = diag;
 
-        npat = 0;
-
-        /* Put the diagonal entry into the marker array */
-        NumberingGlobalToLocal(numb, 1, &row, &loc);
-        marker[loc] = npat;
-        patt[npat++] = loc;
+    /* Fill marker array */
+    for (i=0; i<len; i++)
+    {
+        StoredRowsGet(stored_rows, ind[i], &len2, &ind2, &val2);
+        hypre_assert(len2 > 0);
 
-        /* Fill marker array */
-        for (i=0; i<len; i++)
+        for (j=0; j<len2; j++)
         {
-            StoredRowsGet(stored_rows, ind[i], &len2, &ind2, &val2);
-            hypre_assert(len2 > 0);
+            loc = marker[ind2[j]];
 
-            for (j=0; j<len2; j++)
+            if (loc == -1)
             {
-                loc = marker[ind2[j]];
-
-                if (loc == -1)
+                marker[ind2[j]] = npat;
+                if (npat >= w->pattsize)
                 {
-                    marker[ind2[j]] = npat;
-                    if (npat >= pattsize)
-                    {
-                        pattsize = npat*2;
-                        patt = hypre_TReAlloc(patt,HYPRE_Int,  pattsize, HYPRE_MEMORY_HOST);
-                    }
-                    patt[npat++] = ind2[j];
+                    w->pattsize = npat*2;
+                    w->patt = hypre_TReAlloc(w->patt,HYPRE_Int,  w->pattsize, HYPRE_MEMORY_HOST);
                 }
+                w->patt[npat++] = ind2[j];
             }
         }
+    }
 
-        if (len*npat > ahat_size)
+    if (len*npat > w->ahat_size)
+    {
+        hypre_TFree(w->ahat,HYPRE_MEMORY_HOST);
+        w->ahat_size = len*npat;
+        w->ahat = hypre_TAlloc(HYPRE_Real, w->ahat_size , HYPRE_MEMORY_HOST);
+    }
+
+    /* Initialize ahat to zero */
+    memset(w->ahat, 0, len*npat * sizeof(HYPRE_Real));
+
+    /* Form ahat matrix, entries correspond to indices in "ind" only */
+    ahatp = w->ahat;
+    for (i=0; i<len; i++)
+    {
+        StoredRowsGet(stored_rows, ind[i], &len2, &ind2, &val2);
+
+        for (j=0; j<len2; j++)
         {
-            hypre_TFree(ahat,HYPRE_MEMORY_HOST);
-            ahat_size = len*npat;
-            ahat = hypre_TAlloc(HYPRE_Real, ahat_size , HYPRE_MEMORY_HOST);
+            loc = marker[ind2[j]];
+            ahatp[loc] = val2[j];
         }
+        ahatp += npat;
+    }
 
-        /* Initialize ahat to zero */
-/*        bzero((char *) ahat, len*npat * sizeof(HYPRE_Real));*/
-        memset(ahat, 0, len*npat * sizeof(HYPRE_Real));
+    /* Reallocate bhat if necessary */
+    if (npat > w->bhat_size)
+    {
+        hypre_TFree(w->bhat,HYPRE_MEMORY_HOST);
+        w->bhat_size = npat;
+        w->bhat = hypre_TAlloc(HYPRE_Real, w->bhat_size , HYPRE_MEMORY_HOST);
+    }
 
-        /* Form ahat matrix, entries correspond to indices in "ind" only */
-        ahatp = ahat;
-        for (i=0; i<len; i++)
-        {
-            StoredRowsGet(stored_rows, ind[i], &len2, &ind2, &val2);
+    /* Set the right-hand side, bhat */
+    memset(w->bhat, 0, npat*sizeof(HYPRE_Real));
+    loc = marker[diag];
+    hypre_assert(loc != -1);
+    w->bhat[loc] = 1.0;
 
-            for (j=0; j<len2; j++)
-            {
-                loc = marker[ind2[j]];
-                ahatp[loc] = val2[j];
-            }
-            ahatp += npat;
-        }
+    /* Reset marker array */
+    for (i=0; i<npat; i++)
+        marker[w->patt[i]] = -1;
 
-#ifdef PARASAILS_DEBUG
-        time1 = hypre_MPI_Wtime();
-        timea += (time1 - time0);
+#ifdef ESSL
+    /* rhs in bhat, and put solution in val */
+    dgells(0, w->ahat, npat, w->bhat, npat, val, len, NULL, 1.e-12, npat, len, 1,
+        &info, w->work, w->work_size);
+#else
+    /* rhs in bhat, and put solution in bhat */
+    hypre_dgels(&trans, &npat, &len, &one, w->ahat, &npat,
+        w->bhat, &npat, w->work, &w->work_size, &info);
+
+    if (info != 0)
+        error = 1;
+
+    /* Copy result into row */
+    for (j=0; j<len; j++)
+        val[j] = w->bhat[j];
 #endif
 
-        /* Reallocate bhat if necessary */
-        if (npat > bhat_size)
-        {
-            hypre_TFree(bhat,HYPRE_MEMORY_HOST);
-            bhat_size = npat;
-            bhat = hypre_TAlloc(HYPRE_Real, bhat_size , HYPRE_MEMORY_HOST);
-        }
+    return error;
+}
 
-        /* Set the right-hand side, bhat */
-/*        bzero((char *) bhat, npat*sizeof(HYPRE_Real));*/
-        memset(bhat, 0, npat*sizeof(HYPRE_Real));
-        NumberingGlobalToLocal(numb, 1, &row, &loc);
-        loc = marker[loc];
-        hypre_assert(loc != -1);
-        bhat[loc] = 1.0;
+/*--------------------------------------------------------------------------
+ * ComputeValuesNonsym
+ *--------------------------------------------------------------------------*/
 
-        /* Reset marker array */
-        for (i=0; i<npat; i++)
-            marker[patt[i]] = -1;
+static HYPRE_Int ComputeValuesNonsym(StoredRows *stored_rows, Matrix *mat,
+  HYPRE_Int local_beg_row, Numbering *numb)
+{
+    HYPRE_Int row, maxlen, len, *ind;
+    HYPRE_Real *val;
+    HYPRE_Int *rows, *diag, *batch_ptr, num_batches, b, k;
+    HYPRE_Int error = 0;
 
 #ifdef PARASAILS_DEBUG
-        time0 = hypre_MPI_Wtime();
+    HYPRE_Real time0 = hypre_MPI_Wtime();
 #endif
 
-#ifdef ESSL
-        /* rhs in bhat, and put solution in val */
-        dgells(0, ahat, npat, bhat, npat, val, len, NULL, 1.e-12, npat, len, 1,
-            &info, work, work_size);
-#else
-        /* rhs in bhat, and put solution in bhat */
-        hypre_dgels(&trans, &npat, &len, &one, ahat, &npat,
-            bhat, &npat, work, &work_size, &info);
+    maxlen = 0;
+    for (row=local_beg_row; row<=mat->end_row; row++)
+    {
+        MatrixGetRow(mat, row - mat->beg_row, &len, &ind, &val);
+        maxlen = (len > maxlen ? len : maxlen);
+    }
 
-        if (info != 0)
-        {
-#if 0
-            hypre_printf("ParaSails: row %d, dgels returned %d.\n", row, info);
-            hypre_printf("ParaSails: len %d, ahat: %f %f %f %f\n", len,
-                ahat[0], ahat[1], ahat[2], ahat[3]);
-            PARASAILS_EXIT;
-#endif
-            error = 1;
-        }
+    num_batches = BatchRowsBySize(mat, local_beg_row, numb, maxlen,
+        &rows, &diag, &batch_ptr);
 
-        /* Copy result into row */
-        for (j=0; j<len; j++)
-            val[j] = bhat[j];
+    /* The rows are independent, so the result does not depend on which
+       thread computes a row */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(b, k) reduction(+:error)
 #endif
-#ifdef PARASAILS_DEBUG
-        time1 = hypre_MPI_Wtime();
-        timet += (time1 - time0);
+    {
+        ValuesWork *w = ValuesWorkCreate(numb->num_ind, 10000, 0);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for schedule(dynamic)
 #endif
+        for (b=0; b<num_batches; b++)
+        {
+            for (k=batch_ptr[b]; k<batch_ptr[b+1]; k++)
+            {
+                error += ComputeValuesNonsymRow(stored_rows, mat, rows[k],
+                    diag[k], w);
+            }
+        }
+
+        ValuesWorkDestroy(w);
     }
 
-    hypre_TFree(patt,HYPRE_MEMORY_HOST);
-    hypre_TFree(marker,HYPRE_MEMORY_HOST);
-    hypre_TFree(bhat,HYPRE_MEMORY_HOST);
-    hypre_TFree(ahat,HYPRE_MEMORY_HOST);
-    hypre_TFree(work,HYPRE_MEMORY_HOST);
+    hypre_TFree(rows,HYPRE_MEMORY_HOST);
+    hypre_TFree(diag,HYPRE_MEMORY_HOST);
+    hypre_TFree(batch_ptr,HYPRE_MEMORY_HOST);
 
 #ifdef PARASAILS_DEBUG
     {
        HYPRE_Int mype;
 
        hypre_MPI_Comm_rank(hypre_MPI_COMM_WORLD, &mype);
-       hypre_printf("%d: Time for ahat: %f, for local solves: %f\n", mype, timea, timet);
+       hypre_printf("%d: Time for values: %f\n", mype, hypre_MPI_Wtime() - time0);
        fflush(stdout);
     }
 #endif
 
-    return error;
+    return (error != 0);
 }
 
 /*--------------------------------------------------------------------------
@@ -211,6 +211,24 @@ HYPRE_GMRESGetSkipRealResidualCheck( HYPRE_Solver solver,
    return ( hypre_GMRESGetSkipRealResidualCheck( (void *) solver, skip_real_r_check ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_GMRESSetPipelined, HYPRE_GMRESGetPipelined
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_GMRESSetPipelined( HYPRE_Solver solver,
+                         HYPRE_Int    pipelined )
+{
+   return ( hypre_GMRESSetPipelined( (void *) solver, pipelined ) );
+}
+
+HYPRE_Int
+HYPRE_GMRESGetPipelined( HYPRE_Solver  solver,
+                         HYPRE_Int    *pipelined )
+{
+   return ( hypre_GMRESGetPipelined( (void *) solver, pipelined ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_GMRESSetPrecond
  *--------------------------------------------------------------------------*/
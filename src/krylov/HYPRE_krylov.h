@@ -178,6 +178,17 @@ HYPRE_Int HYPRE_PCGSetRecomputeResidual(HYPRE_Solver solver,
 HYPRE_Int HYPRE_PCGSetRecomputeResidualP(HYPRE_Solver solver,
                                          HYPRE_Int    recompute_residual_p);
 
+/**
+ * (Optional) Use the pipelined variant of PCG, which needs a single global
+ * reduction per iteration and overlaps it with the preconditioner and matvec.
+ * It needs six extra work vectors and is only active when the vector interface
+ * provides a nonblocking inner product (ParCSR, Struct, SStruct); otherwise
+ * the standard algorithm is used.  The relative change, residual tolerance
+ * and convergence factor tests are not available in this mode.
+ **/
+HYPRE_Int HYPRE_PCGSetPipelined(HYPRE_Solver solver,
+                                HYPRE_Int    pipelined);
+
 /**
  * (Optional) Set the preconditioner to use.
  **/
@@ -259,6 +270,11 @@ HYPRE_Int HYPRE_PCGGetTwoNorm(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_PCGGetRelChange(HYPRE_Solver  solver,
                                 HYPRE_Int    *rel_change);
 
+/**
+ **/
+HYPRE_Int HYPRE_PCGGetPipelined(HYPRE_Solver  solver,
+                                HYPRE_Int    *pipelined);
+
 /**
  **/
 HYPRE_Int HYPRE_GMRESGetSkipRealResidualCheck(HYPRE_Solver solver,
@@ -376,6 +392,17 @@ HYPRE_Int HYPRE_GMRESSetRelChange(HYPRE_Solver solver,
 HYPRE_Int HYPRE_GMRESSetSkipRealResidualCheck(HYPRE_Solver solver,
                                               HYPRE_Int    skip_real_r_check);
 
+/**
+ * (Optional) Use the pipelined variant of GMRES, which builds the Krylov basis
+ * with classical Gram-Schmidt in a single global reduction per iteration and
+ * overlaps that reduction with the next preconditioner and matvec.  It keeps
+ * k_dim+1 extra vectors and falls back to the standard algorithm when the
+ * vector interface provides no nonblocking inner product.  The relative change
+ * and convergence factor tests are not available in this mode.
+ **/
+HYPRE_Int HYPRE_GMRESSetPipelined(HYPRE_Solver solver,
+                                  HYPRE_Int    pipelined);
+
 /**
  * (Optional) Set the preconditioner to use.
  **/
@@ -457,6 +484,11 @@ HYPRE_Int HYPRE_GMRESGetKDim(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_GMRESGetRelChange(HYPRE_Solver  solver,
                                   HYPRE_Int    *rel_change);
 
+/**
+ **/
+HYPRE_Int HYPRE_GMRESGetPipelined(HYPRE_Solver  solver,
+                                  HYPRE_Int    *pipelined);
+
 /**
  **/
 HYPRE_Int HYPRE_GMRESGetPrecond(HYPRE_Solver  solver,
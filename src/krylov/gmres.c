@@ -61,10 +61,33 @@ hypre_GMRESFunctionsCreate(
    /* default preconditioner must be set here but can be changed later... */
    gmres_functions->precond_setup = PrecondSetup;
    gmres_functions->precond       = Precond;
+   gmres_functions->InnerProdLocal = NULL;
+   gmres_functions->IAllreduce     = NULL;
 
    return gmres_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_GMRESFunctionsSetAsyncInnerProd
+ *
+ * Optional: a local inner product and a nonblocking sum over the
+ * communicator of a vector, used by the pipelined solver.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GMRESFunctionsSetAsyncInnerProd(
+   hypre_GMRESFunctions *gmres_functions,
+   HYPRE_Real   (*InnerProdLocal) ( void *x, void *y ),
+   HYPRE_Int    (*IAllreduce)     ( void *x, HYPRE_Real *sendbuf, HYPRE_Real *recvbuf,
+                                    HYPRE_Int count, hypre_MPI_Request *request )
+)
+{
+   gmres_functions->InnerProdLocal = InnerProdLocal;
+   gmres_functions->IAllreduce     = IAllreduce;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_GMRESCreate
  *--------------------------------------------------------------------------*/
@@ -91,10 +114,12 @@ hypre_GMRESCreate( hypre_GMRESFunctions *gmres_functions )
    (gmres_data -> stop_crit)      = 0; /* rel. residual norm  - this is obsolete!*/
    (gmres_data -> converged)      = 0;
    (gmres_data -> hybrid)         = 0;
+   (gmres_data -> pipelined)      = 0;
    (gmres_data -> precond_data)   = NULL;
    (gmres_data -> print_level)    = 0;
    (gmres_data -> logging)        = 0;
    (gmres_data -> p)              = NULL;
+   (gmres_data -> ap)             = NULL;
    (gmres_data -> r)              = NULL;
    (gmres_data -> w)              = NULL;
    (gmres_data -> w_2)            = NULL;
@@ -159,6 +184,17 @@ hypre_GMRESDestroy( void *gmres_vdata )
          }
          hypre_TFreeF( gmres_data->p, gmres_functions );
       }
+      if ( (gmres_data -> ap) != NULL )
+      {
+         for (i = 0; i < (gmres_data -> k_dim + 1); i++)
+         {
+            if ( (gmres_data -> ap)[i] != NULL )
+            {
+               (*(gmres_functions->DestroyVector))( (gmres_data -> ap) [i]);
+            }
+         }
+         hypre_TFreeF( gmres_data->ap, gmres_functions );
+      }
       hypre_TFreeF( gmres_data, gmres_functions );
       hypre_TFreeF( gmres_functions, gmres_functions );
    }
@@ -214,6 +250,11 @@ hypre_GMRESSetup( void *gmres_vdata,
    {
       (gmres_data -> p) = (void**)(*(gmres_functions->CreateVectorArray))(k_dim + 1, x);
    }
+   if ((gmres_data -> ap) == NULL && (gmres_data -> pipelined) &&
+       (gmres_functions -> InnerProdLocal) && (gmres_functions -> IAllreduce))
+   {
+      (gmres_data -> ap) = (void**)(*(gmres_functions->CreateVectorArray))(k_dim + 1, x);
+   }
    if ((gmres_data -> r) == NULL)
    {
       (gmres_data -> r) = (*(gmres_functions->CreateVector))(b);
@@ -327,6 +368,18 @@ hypre_GMRESSolve(void  *gmres_vdata,
 
    HYPRE_Real real_r_norm_old, real_r_norm_new;
 
+   /* pipelining may have been turned on after Setup, allocate its vectors now */
+   if ((gmres_data -> ap) == NULL && (gmres_data -> pipelined) &&
+       (gmres_functions -> InnerProdLocal) && (gmres_functions -> IAllreduce))
+   {
+      (gmres_data -> ap) = (void**)(*(gmres_functions->CreateVectorArray))(k_dim + 1, x);
+   }
+
+   if ((gmres_data -> ap) != NULL && (gmres_data -> pipelined))
+   {
+      return hypre_GMRESSolvePipelined(gmres_vdata, A, b, x);
+   }
+
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
    (gmres_data -> converged) = 0;
@@ -925,6 +978,373 @@ hypre_GMRESSolve(void  *gmres_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_GMRESSolvePipelined
+ *
+ * Right-preconditioned GMRES with a pipelined Arnoldi process in the spirit
+ * of p(1)-GMRES (Ghysels, Ashby, Meerbergen, Vanroose, SISC 35, 2013).
+ * Besides the basis p[j] the images ap[j] = A*M*p[j] are kept.  At step i
+ * the classical Gram-Schmidt coefficients <p[j],ap[i-1]> and the norm
+ * <ap[i-1],ap[i-1]> are summed in one nonblocking reduction while
+ * A*M*ap[i-1] is computed; then
+ *
+ *    h[i][i-1] = sqrt(<ap,ap> - sum_j h[j][i-1]^2)
+ *    p[i]      = (ap[i-1] - sum_j h[j][i-1] p[j]) / h[i][i-1]
+ *    ap[i]     = (A*M*ap[i-1] - sum_j h[j][i-1] ap[j]) / h[i][i-1]
+ *
+ * When the norm update suffers from cancellation, h[i][i-1] and ap[i] are
+ * recomputed explicitly.  The true residual is recomputed at each restart.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GMRESSolvePipelined(void  *gmres_vdata,
+                          void  *A,
+                          void  *b,
+                          void  *x)
+{
+   hypre_GMRESData      *gmres_data         = (hypre_GMRESData *)gmres_vdata;
+   hypre_GMRESFunctions *gmres_functions    = gmres_data->functions;
+   HYPRE_Int             k_dim              = (gmres_data -> k_dim);
+   HYPRE_Int             min_iter           = (gmres_data -> min_iter);
+   HYPRE_Int             max_iter           = (gmres_data -> max_iter);
+   HYPRE_Int             skip_real_r_check  = (gmres_data -> skip_real_r_check);
+   HYPRE_Int             hybrid             = (gmres_data -> hybrid);
+   HYPRE_Real            r_tol              = (gmres_data -> tol);
+   HYPRE_Real            a_tol              = (gmres_data -> a_tol);
+   void                 *matvec_data        = (gmres_data -> matvec_data);
+   void                 *r                  = (gmres_data -> r);
+   void                 *w                  = (gmres_data -> w);
+   void                **p                  = (gmres_data -> p);
+   void                **ap                 = (gmres_data -> ap);
+
+   HYPRE_Int           (*precond)(void*, void*, void*, void*) = (gmres_functions -> precond);
+   HYPRE_Int            *precond_data = (HYPRE_Int*) (gmres_data -> precond_data);
+
+   HYPRE_Int             print_level        = (gmres_data -> print_level);
+   HYPRE_Int             logging            = (gmres_data -> logging);
+   HYPRE_Real           *norms              = (gmres_data -> norms);
+
+   hypre_MPI_Request     request;
+   hypre_MPI_Status      status;
+   HYPRE_Real           *local_prod, *global_prod;
+
+   HYPRE_Int             i, j, k;
+   HYPRE_Real           *rs, **hh, *c, *s;
+   HYPRE_Int             iter;
+   HYPRE_Int             my_id, num_procs;
+   HYPRE_Int             next_image;
+   HYPRE_Real            epsilon, gamma, t, r_norm, b_norm, den_norm;
+   HYPRE_Real            r_norm_est = 0.0;
+
+   HYPRE_Real            epsmac = 1.e-16;
+   HYPRE_Real            ieee_check = 0.;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   (gmres_data -> converged) = 0;
+
+   (*(gmres_functions->CommInfo))(A, &my_id, &num_procs);
+
+   /* initialize work arrays */
+   rs = hypre_CTAllocF(HYPRE_Real, k_dim + 1, gmres_functions, HYPRE_MEMORY_HOST);
+   c = hypre_CTAllocF(HYPRE_Real, k_dim, gmres_functions, HYPRE_MEMORY_HOST);
+   s = hypre_CTAllocF(HYPRE_Real, k_dim, gmres_functions, HYPRE_MEMORY_HOST);
+   hh = hypre_CTAllocF(HYPRE_Real*, k_dim + 1, gmres_functions, HYPRE_MEMORY_HOST);
+   for (i = 0; i < k_dim + 1; i++)
+   {
+      hh[i] = hypre_CTAllocF(HYPRE_Real, k_dim, gmres_functions, HYPRE_MEMORY_HOST);
+   }
+   local_prod  = hypre_CTAllocF(HYPRE_Real, k_dim + 1, gmres_functions, HYPRE_MEMORY_HOST);
+   global_prod = hypre_CTAllocF(HYPRE_Real, k_dim + 1, gmres_functions, HYPRE_MEMORY_HOST);
+
+   /* compute initial residual */
+   (*(gmres_functions->CopyVector))(b, p[0]);
+   (*(gmres_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, p[0]);
+
+   b_norm = sqrt((*(gmres_functions->InnerProd))(b, b));
+   r_norm = sqrt((*(gmres_functions->InnerProd))(p[0], p[0]));
+
+   /* INF -> NaN conversion */
+   if (b_norm != 0.) { ieee_check = b_norm / b_norm; }
+   if (r_norm != 0.) { ieee_check += r_norm / r_norm; }
+   if (ieee_check != ieee_check)
+   {
+      if (logging > 0 || print_level > 0)
+      {
+         hypre_printf("\n\nERROR detected by Hypre ... BEGIN\n");
+         hypre_printf("ERROR -- hypre_GMRESSolvePipelined: INFs and/or NaNs detected in input.\n");
+         hypre_printf("User probably placed non-numerics in supplied A, b or x_0.\n");
+         hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+         hypre_printf("ERROR detected by Hypre ... END\n\n\n");
+      }
+      hypre_error(HYPRE_ERROR_GENERIC);
+      hypre_TFreeF(c, gmres_functions);
+      hypre_TFreeF(s, gmres_functions);
+      hypre_TFreeF(rs, gmres_functions);
+      for (i = 0; i < k_dim + 1; i++)
+      {
+         hypre_TFreeF(hh[i], gmres_functions);
+      }
+      hypre_TFreeF(hh, gmres_functions);
+      hypre_TFreeF(local_prod, gmres_functions);
+      hypre_TFreeF(global_prod, gmres_functions);
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   if ( logging > 0 || print_level > 0)
+   {
+      norms[0] = r_norm;
+      if ( print_level > 1 && my_id == 0 )
+      {
+         hypre_printf("L2 norm of b: %e\n", b_norm);
+         if (b_norm == 0.0)
+         {
+            hypre_printf("Rel_resid_norm actually contains the residual norm\n");
+         }
+         hypre_printf("Initial L2 norm of residual: %e\n", r_norm);
+      }
+   }
+   iter = 0;
+
+   /* convergence criteria: |r_i| <= max( a_tol, r_tol * den_norm),
+      den_norm = |b|, or |r_0| if b = 0 */
+   den_norm = (b_norm > 0.0) ? b_norm : r_norm;
+   epsilon  = hypre_max(a_tol, r_tol * den_norm);
+
+   if ( print_level > 1 && my_id == 0 )
+   {
+      hypre_printf("=============================================\n\n");
+      if (b_norm > 0.0)
+      {
+         hypre_printf("Iters     resid.norm     conv.rate  rel.res.norm\n");
+         hypre_printf("-----    ------------    ---------- ------------\n");
+      }
+      else
+      {
+         hypre_printf("Iters     resid.norm     conv.rate\n");
+         hypre_printf("-----    ------------    ----------\n");
+      }
+   }
+
+   /* outer iteration cycle; p[0] holds the true residual b - A*x */
+   while (iter < max_iter)
+   {
+      if (r_norm == 0.0 || (r_norm <= epsilon && iter >= min_iter))
+      {
+         (gmres_data -> converged) = 1;
+         break;
+      }
+
+      rs[0] = r_norm;
+      t = 1.0 / r_norm;
+      (*(gmres_functions->ScaleVector))(t, p[0]);
+
+      /* ap[0] = A*M*p[0] */
+      (*(gmres_functions->ClearVector))(r);
+      precond(precond_data, A, p[0], r);
+      (*(gmres_functions->Matvec))(matvec_data, 1.0, A, r, 0.0, ap[0]);
+
+      i = 0;
+
+      /*** RESTART CYCLE (right-preconditioning) ***/
+      while (i < k_dim && iter < max_iter)
+      {
+         i++;
+         iter++;
+
+         /* <p[j],ap[i-1]> for j < i and <ap[i-1],ap[i-1]> in one reduction */
+         for (j = 0; j < i; j++)
+         {
+            local_prod[j] = (*(gmres_functions->InnerProdLocal))(p[j], ap[i - 1]);
+         }
+         local_prod[i] = (*(gmres_functions->InnerProdLocal))(ap[i - 1], ap[i - 1]);
+         (*(gmres_functions->IAllreduce))(b, local_prod, global_prod, i + 1, &request);
+
+         /* the image of the next basis vector is only needed if the cycle goes on */
+         next_image = (i < k_dim && iter < max_iter);
+         if (next_image)
+         {
+            (*(gmres_functions->ClearVector))(r);
+            precond(precond_data, A, ap[i - 1], r);
+            (*(gmres_functions->Matvec))(matvec_data, 1.0, A, r, 0.0, ap[i]);
+         }
+
+         hypre_MPI_Wait(&request, &status);
+
+         t = global_prod[i];
+         (*(gmres_functions->CopyVector))(ap[i - 1], p[i]);
+         for (j = 0; j < i; j++)
+         {
+            hh[j][i - 1] = global_prod[j];
+            t -= global_prod[j] * global_prod[j];
+            (*(gmres_functions->Axpy))(-hh[j][i - 1], p[j], p[i]);
+         }
+
+         if (t > 1.0e-8 * global_prod[i])
+         {
+            t = sqrt(t);
+            hh[i][i - 1] = t;
+            t = 1.0 / t;
+            (*(gmres_functions->ScaleVector))(t, p[i]);
+            if (next_image)
+            {
+               for (j = 0; j < i; j++)
+               {
+                  (*(gmres_functions->Axpy))(-hh[j][i - 1], ap[j], ap[i]);
+               }
+               (*(gmres_functions->ScaleVector))(t, ap[i]);
+            }
+         }
+         else
+         {
+            /* cancellation in the norm update: fall back to explicit norm */
+            t = sqrt((*(gmres_functions->InnerProd))(p[i], p[i]));
+            hh[i][i - 1] = t;
+            if (t != 0.0)
+            {
+               t = 1.0 / t;
+               (*(gmres_functions->ScaleVector))(t, p[i]);
+               if (next_image)
+               {
+                  (*(gmres_functions->ClearVector))(r);
+                  precond(precond_data, A, p[i], r);
+                  (*(gmres_functions->Matvec))(matvec_data, 1.0, A, r, 0.0, ap[i]);
+               }
+            }
+         }
+
+         /* update factorization of hh */
+         for (j = 1; j < i; j++)
+         {
+            t = hh[j - 1][i - 1];
+            hh[j - 1][i - 1] = s[j - 1] * hh[j][i - 1] + c[j - 1] * t;
+            hh[j][i - 1] = -s[j - 1] * t + c[j - 1] * hh[j][i - 1];
+         }
+         t = hh[i][i - 1] * hh[i][i - 1];
+         t += hh[i - 1][i - 1] * hh[i - 1][i - 1];
+         gamma = sqrt(t);
+         if (gamma == 0.0)
+         {
+            gamma = epsmac;
+         }
+         c[i - 1] = hh[i - 1][i - 1] / gamma;
+         s[i - 1] = hh[i][i - 1] / gamma;
+         rs[i] = -hh[i][i - 1] * rs[i - 1];
+         rs[i] /=  gamma;
+         rs[i - 1] = c[i - 1] * rs[i - 1];
+         /* determine residual norm */
+         hh[i - 1][i - 1] = s[i - 1] * hh[i][i - 1] + c[i - 1] * hh[i - 1][i - 1];
+         r_norm_est = fabs(rs[i]);
+
+         if ( logging > 0 || print_level > 0 )
+         {
+            norms[iter] = r_norm_est;
+            if ( print_level > 1 && my_id == 0 )
+            {
+               if (b_norm > 0.0)
+               {
+                  hypre_printf("% 5d    %e    %f   %e\n", iter,
+                               norms[iter], norms[iter] / norms[iter - 1],
+                               norms[iter] / b_norm);
+               }
+               else
+               {
+                  hypre_printf("% 5d    %e    %f\n", iter, norms[iter],
+                               norms[iter] / norms[iter - 1]);
+               }
+            }
+         }
+
+         if (r_norm_est <= epsilon && iter >= min_iter)
+         {
+            break;
+         }
+      } /*** end of restart cycle ***/
+
+      /* solve upper triangular system */
+      rs[i - 1] = rs[i - 1] / hh[i - 1][i - 1];
+      for (k = i - 2; k >= 0; k--)
+      {
+         t = 0.0;
+         for (j = k + 1; j < i; j++)
+         {
+            t -= hh[k][j] * rs[j];
+         }
+         t += rs[k];
+         rs[k] = t / hh[k][k];
+      }
+
+      (*(gmres_functions->CopyVector))(p[i - 1], w);
+      (*(gmres_functions->ScaleVector))(rs[i - 1], w);
+      for (j = i - 2; j >= 0; j--)
+      {
+         (*(gmres_functions->Axpy))(rs[j], p[j], w);
+      }
+
+      /* update current solution x with the correction M*w */
+      (*(gmres_functions->ClearVector))(r);
+      precond(precond_data, A, w, r);
+      (*(gmres_functions->Axpy))(1.0, r, x);
+
+      if (r_norm_est <= epsilon && iter >= min_iter && skip_real_r_check)
+      {
+         r_norm = r_norm_est;
+         (gmres_data -> converged) = 1;
+         break;
+      }
+
+      /* restart from the true residual */
+      (*(gmres_functions->CopyVector))(b, p[0]);
+      (*(gmres_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, p[0]);
+      r_norm = sqrt((*(gmres_functions->InnerProd))(p[0], p[0]));
+
+      if (r_norm_est <= epsilon && r_norm > epsilon && print_level > 0 && my_id == 0)
+      {
+         hypre_printf("false convergence 2, L2 norm of residual: %e\n", r_norm);
+      }
+      if (r_norm <= epsilon && iter >= min_iter)
+      {
+         if ( print_level > 1 && my_id == 0 )
+         {
+            hypre_printf("\n\n");
+            hypre_printf("Final L2 norm of residual: %e\n\n", r_norm);
+         }
+         (gmres_data -> converged) = 1;
+         break;
+      }
+   } /* END of iteration while loop */
+
+   if ( print_level > 1 && my_id == 0 )
+   {
+      hypre_printf("\n\n");
+   }
+
+   if (iter >= max_iter && r_norm > epsilon && epsilon > 0 && hybrid != -1)
+   {
+      hypre_error(HYPRE_ERROR_CONV);
+   }
+
+   (gmres_data -> num_iterations) = iter;
+   (gmres_data -> rel_residual_norm) = (b_norm > 0.0) ? r_norm / b_norm : r_norm;
+
+   hypre_TFreeF(c, gmres_functions);
+   hypre_TFreeF(s, gmres_functions);
+   hypre_TFreeF(rs, gmres_functions);
+   for (i = 0; i < k_dim + 1; i++)
+   {
+      hypre_TFreeF(hh[i], gmres_functions);
+   }
+   hypre_TFreeF(hh, gmres_functions);
+   hypre_TFreeF(local_prod, gmres_functions);
+   hypre_TFreeF(global_prod, gmres_functions);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_GMRESSetKDim, hypre_GMRESGetKDim
  *--------------------------------------------------------------------------*/
@@ -1146,6 +1566,32 @@ hypre_GMRESGetSkipRealResidualCheck( void      *gmres_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_GMRESSetPipelined, hypre_GMRESGetPipelined
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GMRESSetPipelined( void     *gmres_vdata,
+                         HYPRE_Int pipelined )
+{
+   hypre_GMRESData *gmres_data = (hypre_GMRESData *)gmres_vdata;
+
+   (gmres_data -> pipelined) = pipelined;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_GMRESGetPipelined( void      *gmres_vdata,
+                         HYPRE_Int *pipelined)
+{
+   hypre_GMRESData *gmres_data = (hypre_GMRESData *)gmres_vdata;
+
+   *pipelined = (gmres_data -> pipelined);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_GMRESSetStopCrit, hypre_GMRESGetStopCrit
  *
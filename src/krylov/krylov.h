@@ -415,6 +415,12 @@ typedef struct
    HYPRE_Int    (*precond)       (void *vdata, void *A, void *b, void *x);
    HYPRE_Int    (*precond_setup) (void *vdata, void *A, void *b, void *x);
 
+   /* optional split reduction used by the pipelined solver; NULL if the
+      vector interface does not provide it */
+   HYPRE_Real   (*InnerProdLocal) ( void *x, void *y );
+   HYPRE_Int    (*IAllreduce)     ( void *x, HYPRE_Real *sendbuf, HYPRE_Real *recvbuf,
+                                    HYPRE_Int count, hypre_MPI_Request *request );
+
 } hypre_GMRESFunctions;
 
 /**
@@ -431,6 +437,7 @@ typedef struct
    HYPRE_Int      stop_crit;
    HYPRE_Int      converged;
    HYPRE_Int      hybrid;
+   HYPRE_Int      pipelined;
    HYPRE_Real   tol;
    HYPRE_Real   cf_tol;
    HYPRE_Real   a_tol;
@@ -441,6 +448,7 @@ typedef struct
    void  *w;
    void  *w_2;
    void  **p;
+   void  **ap; /* A*M*p[i], only allocated for the pipelined solver */
 
    void    *matvec_data;
    void    *precond_data;
@@ -507,6 +515,19 @@ extern "C" {
    void *
    hypre_GMRESCreate( hypre_GMRESFunctions *gmres_functions );
 
+   /**
+    * Register the split (local + nonblocking) inner product used by the
+    * pipelined solver.
+    **/
+
+   HYPRE_Int
+   hypre_GMRESFunctionsSetAsyncInnerProd(
+      hypre_GMRESFunctions *gmres_functions,
+      HYPRE_Real   (*InnerProdLocal) ( void *x, void *y ),
+      HYPRE_Int    (*IAllreduce)     ( void *x, HYPRE_Real *sendbuf, HYPRE_Real *recvbuf,
+                                       HYPRE_Int count, hypre_MPI_Request *request )
+   );
+
 #ifdef __cplusplus
 }
 #endif
@@ -1070,6 +1091,12 @@ typedef struct
    HYPRE_Int    (*precond)(void *vdata, void *A, void *b, void *x);
    HYPRE_Int    (*precond_setup)(void *vdata, void *A, void *b, void *x);
 
+   /* optional split reduction used by the pipelined solver; NULL if the
+      vector interface does not provide it */
+   HYPRE_Real   (*InnerProdLocal) ( void *x, void *y );
+   HYPRE_Int    (*IAllreduce)     ( void *x, HYPRE_Real *sendbuf, HYPRE_Real *recvbuf,
+                                    HYPRE_Int count, hypre_MPI_Request *request );
+
 } hypre_PCGFunctions;
 
 /**
@@ -1105,6 +1132,9 @@ typedef struct
    every "recompute_residual_p" iterations.  This can be expensive and degrade the
    convergence. Use it only if you have seen a problem with the regular residual
    computation.
+   - pipelined!=0 means: use the pipelined (Ghysels-Vanroose) recurrences, in which
+   the single global reduction of each iteration is overlapped with the
+   preconditioner and matvec.  rel_change, rtol and cf_tol are not used then.
    */
 
 typedef struct
@@ -1122,12 +1152,14 @@ typedef struct
    HYPRE_Int      stop_crit;
    HYPRE_Int      converged;
    HYPRE_Int      hybrid;
+   HYPRE_Int      pipelined;
 
    void    *A;
    void    *p;
    void    *s;
    void    *r; /* ...contains the residual.  This is currently kept permanently.
                    If that is ever changed, it still must be kept if logging>1 */
+   void   **pipe_vectors; /* u, w, m, n, z, q of the pipelined recurrences */
 
    HYPRE_Int      owns_matvec_data;  /* normally 1; if 0, don't delete it */
    void    *matvec_data;
@@ -1196,6 +1228,19 @@ extern "C" {
    void *
    hypre_PCGCreate( hypre_PCGFunctions *pcg_functions );
 
+   /**
+    * Register the split (local + nonblocking) inner product used by the
+    * pipelined solver.
+    **/
+
+   HYPRE_Int
+   hypre_PCGFunctionsSetAsyncInnerProd(
+      hypre_PCGFunctions *pcg_functions,
+      HYPRE_Real   (*InnerProdLocal) ( void *x, void *y ),
+      HYPRE_Int    (*IAllreduce)     ( void *x, HYPRE_Real *sendbuf, HYPRE_Real *recvbuf,
+                                       HYPRE_Int count, hypre_MPI_Request *request )
+   );
+
 #ifdef __cplusplus
 }
 #endif
@@ -1251,6 +1296,7 @@ HYPRE_Int hypre_GMRESDestroy ( void *gmres_vdata );
 HYPRE_Int hypre_GMRESGetResidual ( void *gmres_vdata, void **residual );
 HYPRE_Int hypre_GMRESSetup ( void *gmres_vdata, void *A, void *b, void *x );
 HYPRE_Int hypre_GMRESSolve ( void *gmres_vdata, void *A, void *b, void *x );
+HYPRE_Int hypre_GMRESSolvePipelined ( void *gmres_vdata, void *A, void *b, void *x );
 HYPRE_Int hypre_GMRESSetKDim ( void *gmres_vdata, HYPRE_Int k_dim );
 HYPRE_Int hypre_GMRESGetKDim ( void *gmres_vdata, HYPRE_Int *k_dim );
 HYPRE_Int hypre_GMRESSetTol ( void *gmres_vdata, HYPRE_Real tol );
@@ -1267,6 +1313,8 @@ HYPRE_Int hypre_GMRESSetRelChange ( void *gmres_vdata, HYPRE_Int rel_change );
 HYPRE_Int hypre_GMRESGetRelChange ( void *gmres_vdata, HYPRE_Int *rel_change );
 HYPRE_Int hypre_GMRESSetSkipRealResidualCheck ( void *gmres_vdata, HYPRE_Int skip_real_r_check );
 HYPRE_Int hypre_GMRESGetSkipRealResidualCheck ( void *gmres_vdata, HYPRE_Int *skip_real_r_check );
+HYPRE_Int hypre_GMRESSetPipelined ( void *gmres_vdata, HYPRE_Int pipelined );
+HYPRE_Int hypre_GMRESGetPipelined ( void *gmres_vdata, HYPRE_Int *pipelined );
 HYPRE_Int hypre_GMRESSetStopCrit ( void *gmres_vdata, HYPRE_Int stop_crit );
 HYPRE_Int hypre_GMRESGetStopCrit ( void *gmres_vdata, HYPRE_Int *stop_crit );
 HYPRE_Int hypre_GMRESSetPrecond ( void *gmres_vdata, HYPRE_Int (*precond )(void*, void*, void*,
@@ -1452,6 +1500,8 @@ HYPRE_Int HYPRE_GMRESSetRelChange ( HYPRE_Solver solver, HYPRE_Int rel_change );
 HYPRE_Int HYPRE_GMRESGetRelChange ( HYPRE_Solver solver, HYPRE_Int *rel_change );
 HYPRE_Int HYPRE_GMRESSetSkipRealResidualCheck ( HYPRE_Solver solver, HYPRE_Int skip_real_r_check );
 HYPRE_Int HYPRE_GMRESGetSkipRealResidualCheck ( HYPRE_Solver solver, HYPRE_Int *skip_real_r_check );
+HYPRE_Int HYPRE_GMRESSetPipelined ( HYPRE_Solver solver, HYPRE_Int pipelined );
+HYPRE_Int HYPRE_GMRESGetPipelined ( HYPRE_Solver solver, HYPRE_Int *pipelined );
 HYPRE_Int HYPRE_GMRESSetPrecond ( HYPRE_Solver solver, HYPRE_PtrToSolverFcn precond,
                                   HYPRE_PtrToSolverFcn precond_setup, HYPRE_Solver precond_solver );
 HYPRE_Int HYPRE_GMRESGetPrecond ( HYPRE_Solver solver, HYPRE_Solver *precond_data_ptr );
@@ -1588,6 +1638,8 @@ HYPRE_Int HYPRE_PCGSetRecomputeResidual ( HYPRE_Solver solver, HYPRE_Int recompu
 HYPRE_Int HYPRE_PCGGetRecomputeResidual ( HYPRE_Solver solver, HYPRE_Int *recompute_residual );
 HYPRE_Int HYPRE_PCGSetRecomputeResidualP ( HYPRE_Solver solver, HYPRE_Int recompute_residual_p );
 HYPRE_Int HYPRE_PCGGetRecomputeResidualP ( HYPRE_Solver solver, HYPRE_Int *recompute_residual_p );
+HYPRE_Int HYPRE_PCGSetPipelined ( HYPRE_Solver solver, HYPRE_Int pipelined );
+HYPRE_Int HYPRE_PCGGetPipelined ( HYPRE_Solver solver, HYPRE_Int *pipelined );
 HYPRE_Int HYPRE_PCGSetPrecond ( HYPRE_Solver solver, HYPRE_PtrToSolverFcn precond,
                                 HYPRE_PtrToSolverFcn precond_setup, HYPRE_Solver precond_solver );
 HYPRE_Int HYPRE_PCGGetPrecond ( HYPRE_Solver solver, HYPRE_Solver *precond_data_ptr );
@@ -1606,6 +1658,7 @@ HYPRE_Int hypre_PCGDestroy ( void *pcg_vdata );
 HYPRE_Int hypre_PCGGetResidual ( void *pcg_vdata, void **residual );
 HYPRE_Int hypre_PCGSetup ( void *pcg_vdata, void *A, void *b, void *x );
 HYPRE_Int hypre_PCGSolve ( void *pcg_vdata, void *A, void *b, void *x );
+HYPRE_Int hypre_PCGSolvePipelined ( void *pcg_vdata, void *A, void *b, void *x );
 HYPRE_Int hypre_PCGSetTol ( void *pcg_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_PCGGetTol ( void *pcg_vdata, HYPRE_Real *tol );
 HYPRE_Int hypre_PCGSetAbsoluteTol ( void *pcg_vdata, HYPRE_Real a_tol );
@@ -1626,6 +1679,8 @@ HYPRE_Int hypre_PCGSetRecomputeResidual ( void *pcg_vdata, HYPRE_Int recompute_r
 HYPRE_Int hypre_PCGGetRecomputeResidual ( void *pcg_vdata, HYPRE_Int *recompute_residual );
 HYPRE_Int hypre_PCGSetRecomputeResidualP ( void *pcg_vdata, HYPRE_Int recompute_residual_p );
 HYPRE_Int hypre_PCGGetRecomputeResidualP ( void *pcg_vdata, HYPRE_Int *recompute_residual_p );
+HYPRE_Int hypre_PCGSetPipelined ( void *pcg_vdata, HYPRE_Int pipelined );
+HYPRE_Int hypre_PCGGetPipelined ( void *pcg_vdata, HYPRE_Int *pipelined );
 HYPRE_Int hypre_PCGSetStopCrit ( void *pcg_vdata, HYPRE_Int stop_crit );
 HYPRE_Int hypre_PCGGetStopCrit ( void *pcg_vdata, HYPRE_Int *stop_crit );
 HYPRE_Int hypre_PCGGetPrecond ( void *pcg_vdata, HYPRE_Solver *precond_data_ptr );
@@ -68,10 +68,33 @@ hypre_PCGFunctionsCreate(
    /* default preconditioner must be set here but can be changed later... */
    pcg_functions->precond_setup = PrecondSetup;
    pcg_functions->precond       = Precond;
+   pcg_functions->InnerProdLocal = NULL;
+   pcg_functions->IAllreduce     = NULL;
 
    return pcg_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGFunctionsSetAsyncInnerProd
+ *
+ * Optional: a local inner product and a nonblocking sum over the
+ * communicator of a vector, used by the pipelined solver.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGFunctionsSetAsyncInnerProd(
+   hypre_PCGFunctions *pcg_functions,
+   HYPRE_Real   (*InnerProdLocal) ( void *x, void *y ),
+   HYPRE_Int    (*IAllreduce)     ( void *x, HYPRE_Real *sendbuf, HYPRE_Real *recvbuf,
+                                    HYPRE_Int count, hypre_MPI_Request *request )
+)
+{
+   pcg_functions->InnerProdLocal = InnerProdLocal;
+   pcg_functions->IAllreduce     = IAllreduce;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGCreate
  *--------------------------------------------------------------------------*/
@@ -101,6 +124,7 @@ hypre_PCGCreate( hypre_PCGFunctions *pcg_functions )
    (pcg_data -> stop_crit)    = 0;
    (pcg_data -> converged)    = 0;
    (pcg_data -> hybrid)       = 0;
+   (pcg_data -> pipelined)    = 0;
    (pcg_data -> owns_matvec_data ) = 1;
    (pcg_data -> matvec_data)  = NULL;
    (pcg_data -> precond_data) = NULL;
@@ -111,6 +135,7 @@ hypre_PCGCreate( hypre_PCGFunctions *pcg_functions )
    (pcg_data -> p)            = NULL;
    (pcg_data -> s)            = NULL;
    (pcg_data -> r)            = NULL;
+   (pcg_data -> pipe_vectors) = NULL;
 
    HYPRE_ANNOTATE_FUNC_END;
 
@@ -125,6 +150,7 @@ HYPRE_Int
 hypre_PCGDestroy( void *pcg_vdata )
 {
    hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+   HYPRE_Int      i;
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
@@ -161,6 +187,15 @@ hypre_PCGDestroy( void *pcg_vdata )
          (*(pcg_functions->DestroyVector))(pcg_data -> r);
          pcg_data -> r = NULL;
       }
+      if ( pcg_data -> pipe_vectors != NULL )
+      {
+         for (i = 0; i < 6; i++)
+         {
+            (*(pcg_functions->DestroyVector))((pcg_data -> pipe_vectors)[i]);
+         }
+         hypre_TFreeF( pcg_data -> pipe_vectors, pcg_functions );
+         pcg_data -> pipe_vectors = NULL;
+      }
       hypre_TFreeF( pcg_data, pcg_functions );
       hypre_TFreeF( pcg_functions, pcg_functions );
    }
@@ -198,6 +233,7 @@ hypre_PCGSetup( void *pcg_vdata,
    HYPRE_Int            max_iter         = (pcg_data -> max_iter);
    HYPRE_Int          (*precond_setup)(void*, void*, void*, void*) = (pcg_functions -> precond_setup);
    void          *precond_data     = (pcg_data -> precond_data);
+   HYPRE_Int      i;
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
@@ -227,6 +263,26 @@ hypre_PCGSetup( void *pcg_vdata,
    }
    (pcg_data -> r) = (*(pcg_functions->CreateVector))(b);
 
+   /* u, m, q live in the solution space, w, n, z in the residual space */
+   if ( pcg_data -> pipe_vectors != NULL )
+   {
+      for (i = 0; i < 6; i++)
+      {
+         (*(pcg_functions->DestroyVector))((pcg_data -> pipe_vectors)[i]);
+      }
+      hypre_TFreeF( pcg_data -> pipe_vectors, pcg_functions );
+      (pcg_data -> pipe_vectors) = NULL;
+   }
+   if ( (pcg_data -> pipelined) && (pcg_functions -> InnerProdLocal) &&
+        (pcg_functions -> IAllreduce) )
+   {
+      (pcg_data -> pipe_vectors) = hypre_CTAllocF(void *, 6, pcg_functions, HYPRE_MEMORY_HOST);
+      for (i = 0; i < 6; i++)
+      {
+         (pcg_data -> pipe_vectors)[i] = (*(pcg_functions->CreateVector))((i % 2) ? b : x);
+      }
+   }
+
    if ( pcg_data -> matvec_data != NULL && pcg_data->owns_matvec_data )
    {
       (*(pcg_functions->MatvecDestroy))(pcg_data -> matvec_data);
@@ -334,6 +390,22 @@ hypre_PCGSolve( void *pcg_vdata,
    HYPRE_Int       i = 0;
    HYPRE_Int       my_id, num_procs;
 
+   /* pipelining may have been turned on after Setup, allocate its vectors now */
+   if ( (pcg_data -> pipe_vectors) == NULL && (pcg_data -> pipelined) &&
+        (pcg_functions -> InnerProdLocal) && (pcg_functions -> IAllreduce) )
+   {
+      (pcg_data -> pipe_vectors) = hypre_CTAllocF(void *, 6, pcg_functions, HYPRE_MEMORY_HOST);
+      for (i = 0; i < 6; i++)
+      {
+         (pcg_data -> pipe_vectors)[i] = (*(pcg_functions->CreateVector))((i % 2) ? b : x);
+      }
+   }
+
+   if ( (pcg_data -> pipe_vectors) != NULL && (pcg_data -> pipelined) )
+   {
+      return hypre_PCGSolvePipelined(pcg_vdata, A, b, x);
+   }
+
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
    (pcg_data -> converged) = 0;
@@ -797,6 +869,322 @@ hypre_PCGSolve( void *pcg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGSolvePipelined
+ *
+ * Pipelined PCG (Ghysels and Vanroose, Parallel Computing 40, 2014).
+ * Auxiliary recurrences for u = C*r, w = A*u and their search directions
+ * allow the three inner products of an iteration to be summed in a single
+ * nonblocking reduction, which is overlapped with m = C*w and n = A*m.
+ *
+ * The convergence test is the same as in hypre_PCGSolve; the residual norm
+ * is the one of the iterate at the start of each pass, so a converged solve
+ * performs one extra preconditioner and matvec application.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSolvePipelined( void *pcg_vdata,
+                         void *A,
+                         void *b,
+                         void *x )
+{
+   hypre_PCGData      *pcg_data      = (hypre_PCGData *)pcg_vdata;
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+
+   HYPRE_Real      r_tol        = (pcg_data -> tol);
+   HYPRE_Real      a_tol        = (pcg_data -> a_tol);
+   HYPRE_Real      atolf        = (pcg_data -> atolf);
+   HYPRE_Int       max_iter     = (pcg_data -> max_iter);
+   HYPRE_Int       two_norm     = (pcg_data -> two_norm);
+   HYPRE_Int       rel_change   = (pcg_data -> rel_change);
+   HYPRE_Int       recompute_residual   = (pcg_data -> recompute_residual);
+   HYPRE_Int       recompute_residual_p = (pcg_data -> recompute_residual_p);
+   HYPRE_Int       stop_crit    = (pcg_data -> stop_crit);
+   HYPRE_Int       hybrid       = (pcg_data -> hybrid);
+   void           *p            = (pcg_data -> p);
+   void           *s            = (pcg_data -> s);
+   void           *r            = (pcg_data -> r);
+   void           *u            = (pcg_data -> pipe_vectors)[0];
+   void           *w            = (pcg_data -> pipe_vectors)[1];
+   void           *m            = (pcg_data -> pipe_vectors)[2];
+   void           *n            = (pcg_data -> pipe_vectors)[3];
+   void           *q            = (pcg_data -> pipe_vectors)[4];
+   void           *z            = (pcg_data -> pipe_vectors)[5];
+   void           *matvec_data  = (pcg_data -> matvec_data);
+   HYPRE_Int     (*precond)(void*, void*, void*, void*)   = (pcg_functions -> precond);
+   void           *precond_data = (pcg_data -> precond_data);
+   HYPRE_Int       print_level  = (pcg_data -> print_level);
+   HYPRE_Int       logging      = (pcg_data -> logging);
+   HYPRE_Real     *norms        = (pcg_data -> norms);
+   HYPRE_Real     *rel_norms    = (pcg_data -> rel_norms);
+
+   hypre_MPI_Request request;
+   hypre_MPI_Status  status;
+   HYPRE_Real      local_prod[3], global_prod[3];
+
+   HYPRE_Real      alpha = 0.0, beta;
+   HYPRE_Real      gamma, gamma_old = 0.0, delta;
+   HYPRE_Real      bi_prod, eps;
+   HYPRE_Real      i_prod = 0.0;
+   HYPRE_Real      ieee_check = 0.;
+
+   HYPRE_Int       restart = 1;
+   HYPRE_Int       true_residual = 1;
+   HYPRE_Int       i = 0;
+   HYPRE_Int       my_id, num_procs;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   (pcg_data -> converged) = 0;
+
+   (*(pcg_functions->CommInfo))(A, &my_id, &num_procs);
+
+   /* compute eps */
+   if (two_norm)
+   {
+      /* bi_prod = <b,b> */
+      bi_prod = (*(pcg_functions->InnerProd))(b, b);
+      if (print_level > 1 && my_id == 0)
+      {
+         hypre_printf("<b,b>: %e\n", bi_prod);
+      }
+   }
+   else
+   {
+      /* bi_prod = <C*b,b> */
+      (*(pcg_functions->ClearVector))(p);
+      precond(precond_data, A, b, p);
+      bi_prod = (*(pcg_functions->InnerProd))(p, b);
+      if (print_level > 1 && my_id == 0)
+      {
+         hypre_printf("<C*b,b>: %e\n", bi_prod);
+      }
+   }
+
+   if (bi_prod != 0.) { ieee_check = bi_prod / bi_prod; } /* INF -> NaN conversion */
+   if (ieee_check != ieee_check)
+   {
+      if (print_level > 0 || logging > 0)
+      {
+         hypre_printf("\n\nERROR detected by Hypre ...  BEGIN\n");
+         hypre_printf("ERROR -- hypre_PCGSolvePipelined: INFs and/or NaNs detected in input.\n");
+         hypre_printf("User probably placed non-numerics in supplied b.\n");
+         hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+         hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
+      }
+      hypre_error(HYPRE_ERROR_GENERIC);
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   eps = r_tol * r_tol;
+   if ( bi_prod > 0.0 )
+   {
+      if ( stop_crit && !rel_change && atolf <= 0 ) /* pure absolute tolerance */
+      {
+         eps = eps / bi_prod;
+      }
+      else if ( atolf > 0 ) /* mixed relative and absolute tolerance */
+      {
+         bi_prod += atolf;
+      }
+      else
+      {
+         eps = hypre_max(r_tol * r_tol, a_tol * a_tol / bi_prod);
+      }
+   }
+   else    /* bi_prod==0.0: the rhs vector b is zero */
+   {
+      (*(pcg_functions->CopyVector))(b, x);
+      if (logging > 0 || print_level > 0)
+      {
+         norms[0]     = 0.0;
+         rel_norms[0] = 0.0;
+      }
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   if ( print_level > 1 && my_id == 0 )
+   {
+      hypre_printf("\n\n");
+      if (two_norm)
+      {
+         hypre_printf("Iters       ||r||_2     conv.rate  ||r||_2/||b||_2\n");
+         hypre_printf("-----    ------------   ---------  ------------ \n");
+      }
+      else
+      {
+         hypre_printf("Iters       ||r||_C     conv.rate  ||r||_C/||b||_C\n");
+         hypre_printf("-----    ------------    ---------  ------------ \n");
+      }
+   }
+
+   while (1)
+   {
+      if (restart)
+      {
+         /* r = b - A*x, u = C*r, w = A*u */
+         (*(pcg_functions->CopyVector))(b, r);
+         (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+         (*(pcg_functions->ClearVector))(u);
+         precond(precond_data, A, r, u);
+         (*(pcg_functions->Matvec))(matvec_data, 1.0, A, u, 0.0, w);
+      }
+
+      /* gamma = <r,u>, delta = <w,u> and <r,r>, summed in one reduction */
+      local_prod[0] = (*(pcg_functions->InnerProdLocal))(r, u);
+      local_prod[1] = (*(pcg_functions->InnerProdLocal))(w, u);
+      local_prod[2] = two_norm ? (*(pcg_functions->InnerProdLocal))(r, r) : 0.0;
+      (*(pcg_functions->IAllreduce))(r, local_prod, global_prod, two_norm ? 3 : 2, &request);
+
+      /* m = C*w, n = A*m while the reduction is in flight */
+      (*(pcg_functions->ClearVector))(m);
+      precond(precond_data, A, w, m);
+      (*(pcg_functions->Matvec))(matvec_data, 1.0, A, m, 0.0, n);
+
+      hypre_MPI_Wait(&request, &status);
+      gamma  = global_prod[0];
+      delta  = global_prod[1];
+      i_prod = two_norm ? global_prod[2] : gamma;
+
+      if (i == 0 && restart)
+      {
+         if (i_prod != 0.) { ieee_check = i_prod / i_prod; }
+         if (ieee_check != ieee_check)
+         {
+            if (print_level > 0 || logging > 0)
+            {
+               hypre_printf("\n\nERROR detected by Hypre ...  BEGIN\n");
+               hypre_printf("ERROR -- hypre_PCGSolvePipelined: INFs and/or NaNs detected in input.\n");
+               hypre_printf("User probably placed non-numerics in supplied A or x_0.\n");
+               hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+               hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
+            }
+            hypre_error(HYPRE_ERROR_GENERIC);
+            HYPRE_ANNOTATE_FUNC_END;
+
+            return hypre_error_flag;
+         }
+      }
+
+      /* print norm info */
+      if ( logging > 0 || print_level > 0 )
+      {
+         norms[i]     = sqrt(i_prod);
+         rel_norms[i] = bi_prod ? sqrt(i_prod / bi_prod) : 0;
+         if ( print_level > 1 && my_id == 0 && i > 0 )
+         {
+            hypre_printf("% 5d    %e    %f    %e\n", i, norms[i],
+                         norms[i] / norms[i - 1], rel_norms[i] );
+         }
+      }
+
+      /* check for convergence */
+      if (i_prod / bi_prod < eps)
+      {
+         if (recompute_residual && !true_residual)
+         {
+            /* don't trust the recursive residual; restart from r = b - A*x */
+            true_residual = 1;
+            restart = 1;
+            continue;
+         }
+         (pcg_data -> converged) = 1;
+         break;
+      }
+
+      if (i >= max_iter)
+      {
+         break;
+      }
+
+      if (! (gamma > HYPRE_REAL_MIN) )
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Subnormal gamma value in PCG");
+         break;
+      }
+
+      /* alpha and beta from the recurrences, beta = 0 after a restart */
+      if (restart)
+      {
+         beta  = 0.0;
+         alpha = gamma / delta;
+      }
+      else
+      {
+         beta  = gamma / gamma_old;
+         alpha = gamma / (delta - beta * gamma / alpha);
+      }
+      if (! (alpha > HYPRE_REAL_MIN) )
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Subnormal alpha value in PCG");
+         break;
+      }
+      gamma_old = gamma;
+
+      /* z = n + beta*z, q = m + beta*q, s = w + beta*s, p = u + beta*p */
+      if (restart)
+      {
+         (*(pcg_functions->CopyVector))(n, z);
+         (*(pcg_functions->CopyVector))(m, q);
+         (*(pcg_functions->CopyVector))(w, s);
+         (*(pcg_functions->CopyVector))(u, p);
+      }
+      else
+      {
+         (*(pcg_functions->ScaleVector))(beta, z);
+         (*(pcg_functions->Axpy))(1.0, n, z);
+         (*(pcg_functions->ScaleVector))(beta, q);
+         (*(pcg_functions->Axpy))(1.0, m, q);
+         (*(pcg_functions->ScaleVector))(beta, s);
+         (*(pcg_functions->Axpy))(1.0, w, s);
+         (*(pcg_functions->ScaleVector))(beta, p);
+         (*(pcg_functions->Axpy))(1.0, u, p);
+      }
+
+      /* x = x + alpha*p, r = r - alpha*s, u = u - alpha*q, w = w - alpha*z */
+      (*(pcg_functions->Axpy))(alpha, p, x);
+      (*(pcg_functions->Axpy))(-alpha, s, r);
+      (*(pcg_functions->Axpy))(-alpha, q, u);
+      (*(pcg_functions->Axpy))(-alpha, z, w);
+
+      i++;
+      restart = 0;
+      true_residual = 0;
+
+      /* At user request, periodically replace the recursive residual */
+      if (recompute_residual_p && !(i % recompute_residual_p))
+      {
+         if (print_level > 1 && my_id == 0)
+         {
+            hypre_printf("Recomputing the residual...\n");
+         }
+         restart = 1;
+         true_residual = 1;
+      }
+   }
+
+   if ( print_level > 1 && my_id == 0 )
+   {
+      hypre_printf("\n\n");
+   }
+
+   if (i >= max_iter && (i_prod / bi_prod) >= eps && eps > 0 && hybrid != -1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_CONV, "Reached max iterations in PCG before convergence");
+   }
+
+   (pcg_data -> num_iterations) = i;
+   (pcg_data -> rel_residual_norm) = sqrt(i_prod / bi_prod);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGSetTol, hypre_PCGGetTol
  *--------------------------------------------------------------------------*/
@@ -1063,6 +1451,32 @@ hypre_PCGGetRecomputeResidualP( void *pcg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetPipelined, hypre_PCGGetPipelined
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetPipelined( void *pcg_vdata,
+                       HYPRE_Int   pipelined  )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   (pcg_data -> pipelined) = pipelined;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PCGGetPipelined( void *pcg_vdata,
+                       HYPRE_Int * pipelined  )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   *pipelined = (pcg_data -> pipelined);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGSetStopCrit, hypre_PCGGetStopCrit
  *--------------------------------------------------------------------------*/
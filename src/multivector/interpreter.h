@@ -48,6 +48,14 @@ typedef struct
    void   (*MultiXapy)          ( void *x, HYPRE_Int, HYPRE_Int, HYPRE_Int, HYPRE_Complex*, void *y );
    void   (*Eval)               ( void (*f)( void*, void*, void* ), void*, void *x, void *y );
 
+   /* optional block operations on arrays of vectors, NULL if not provided:
+      BlockInnerProd: r[i + j*ld] = <x[i], y[j]> with a single global reduction
+      BlockAxpy:      y[j] = beta*y[j] + sum_i r[i + j*ld]*x[i] */
+   HYPRE_Int    (*BlockInnerProd) ( HYPRE_Int nx, void **x, HYPRE_Int ny, void **y,
+                                    HYPRE_Int ld, HYPRE_Complex *r );
+   HYPRE_Int    (*BlockAxpy)      ( HYPRE_Int nx, void **x, HYPRE_Int ny, void **y,
+                                    HYPRE_Int ld, HYPRE_Complex *r, HYPRE_Complex beta );
+
 } mv_InterfaceInterpreter;
 
 #endif
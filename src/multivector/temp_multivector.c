@@ -355,6 +355,15 @@ mv_TempMultiVectorByMultiVector( void* x_, void* y_,
    mv_collectVectorPtr( x->mask, x, px );
    mv_collectVectorPtr( y->mask, y, py );
 
+   if ( x->interpreter->BlockInnerProd != NULL )
+   {
+      (x->interpreter->BlockInnerProd)( mx, px, my, py, xyGHeight, xyVal );
+
+      hypre_TFree(px, HYPRE_MEMORY_HOST);
+      hypre_TFree(py, HYPRE_MEMORY_HOST);
+      return;
+   }
+
    jxy = xyGHeight - xyHeight;
    for ( iy = 0, p = xyVal; iy < my; iy++ )
    {
@@ -446,6 +455,15 @@ mv_TempMultiVectorByMatrix( void* x_,
    mv_collectVectorPtr( x->mask, x, px );
    mv_collectVectorPtr( y->mask, y, py );
 
+   if ( x->interpreter->BlockAxpy != NULL )
+   {
+      (x->interpreter->BlockAxpy)( mx, px, my, py, rGHeight, rVal, 0.0 );
+
+      hypre_TFree(px, HYPRE_MEMORY_HOST);
+      hypre_TFree(py, HYPRE_MEMORY_HOST);
+      return;
+   }
+
    jump = rGHeight - rHeight;
    for ( j = 0, p = rVal; j < my; j++ )
    {
@@ -493,6 +511,15 @@ mv_TempMultiVectorXapy( void* x_,
    mv_collectVectorPtr( x->mask, x, px );
    mv_collectVectorPtr( y->mask, y, py );
 
+   if ( x->interpreter->BlockAxpy != NULL )
+   {
+      (x->interpreter->BlockAxpy)( mx, px, my, py, rGHeight, rVal, 1.0 );
+
+      hypre_TFree(px, HYPRE_MEMORY_HOST);
+      hypre_TFree(py, HYPRE_MEMORY_HOST);
+      return;
+   }
+
    jump = rGHeight - rHeight;
    for ( j = 0, p = rVal; j < my; j++ )
    {
@@ -969,6 +969,21 @@ hypre_CSRBlockMatrixBlockMatvec(HYPRE_Complex alpha,
       HYPRE_Int    i, j;
       HYPRE_Complex ddata;
 
+      /* ov = ov +/- mat*v, as used by the block smoothers */
+      if (beta == 1.0 && (alpha == 1.0 || alpha == -1.0))
+      {
+         for (i = 0; i < block_size; i++)
+         {
+            ddata = 0.0;
+            for (j = 0; j < block_size; j++)
+            {
+               ddata += mat[i * block_size + j] * v[j];
+            }
+            ov[i] += alpha * ddata;
+         }
+         return ierr;
+      }
+
       /* if alpha = 0, then no matvec */
       if (alpha == 0.0)
       {
@@ -1039,8 +1054,18 @@ hypre_CSRBlockMatrixBlockInvMatvec(HYPRE_Complex* mat, HYPRE_Complex* v,
 {
    HYPRE_Int ierr = 0;
    HYPRE_Complex *mat_i;
+   HYPRE_Complex  mat_buf[16] = {0.0};
 
-   mat_i = hypre_CTAlloc(HYPRE_Complex,  block_size * block_size, HYPRE_MEMORY_HOST);
+   /* this is called for every point in the block smoothers, so small blocks
+      are factored on the stack */
+   if (block_size <= 4)
+   {
+      mat_i = mat_buf;
+   }
+   else
+   {
+      mat_i = hypre_CTAlloc(HYPRE_Complex,  block_size * block_size, HYPRE_MEMORY_HOST);
+   }
 
 #if LB_VERSION
    {
@@ -1064,7 +1089,10 @@ hypre_CSRBlockMatrixBlockInvMatvec(HYPRE_Complex* mat, HYPRE_Complex* v,
       dgetrf_(&block_size, &block_size, mat_i, &block_size, piv, &info);
       if (info)
       {
-         hypre_TFree(mat_i, HYPRE_MEMORY_HOST);
+         if (mat_i != mat_buf)
+         {
+            hypre_TFree(mat_i, HYPRE_MEMORY_HOST);
+         }
          hypre_TFree(piv, HYPRE_MEMORY_HOST);
          return (-1);
       }
@@ -1074,7 +1102,10 @@ hypre_CSRBlockMatrixBlockInvMatvec(HYPRE_Complex* mat, HYPRE_Complex* v,
               mat_i, &block_size, piv, ov, &block_size, &info);
       if (info)
       {
-         hypre_TFree(mat_i, HYPRE_MEMORY_HOST);
+         if (mat_i != mat_buf)
+         {
+            hypre_TFree(mat_i, HYPRE_MEMORY_HOST);
+         }
          hypre_TFree(piv, HYPRE_MEMORY_HOST);
          return (-1);
       }
@@ -1097,13 +1128,19 @@ hypre_CSRBlockMatrixBlockInvMatvec(HYPRE_Complex* mat, HYPRE_Complex* v,
          if (hypre_cabs(mat[0]) > 1e-10)
          {
             ov[0] = v[0] / mat[0];
-            hypre_TFree(mat_i, HYPRE_MEMORY_HOST);
+            if (mat_i != mat_buf)
+            {
+               hypre_TFree(mat_i, HYPRE_MEMORY_HOST);
+            }
             return (ierr);
          }
          else
          {
             /* hypre_printf("GE zero pivot error\n"); */
-            hypre_TFree(mat_i, HYPRE_MEMORY_HOST);
+            if (mat_i != mat_buf)
+            {
+               hypre_TFree(mat_i, HYPRE_MEMORY_HOST);
+            }
             return (-1);
          }
       }
@@ -1169,7 +1206,10 @@ hypre_CSRBlockMatrixBlockInvMatvec(HYPRE_Complex* mat, HYPRE_Complex* v,
             else
             {
                /* hypre_printf("Block of matrix is nearly singular: zero pivot error\n");  */
-               hypre_TFree(mat_i, HYPRE_MEMORY_HOST);
+               if (mat_i != mat_buf)
+               {
+                  hypre_TFree(mat_i, HYPRE_MEMORY_HOST);
+               }
                return (-1);
             }
          }
@@ -1179,7 +1219,10 @@ hypre_CSRBlockMatrixBlockInvMatvec(HYPRE_Complex* mat, HYPRE_Complex* v,
          if ( hypre_cabs(mat_i[k * block_size + k]) < eps)
          {
             /* hypre_printf("Block of matrix is nearly singular: zero pivot error\n");  */
-            hypre_TFree(mat_i, HYPRE_MEMORY_HOST);
+            if (mat_i != mat_buf)
+            {
+               hypre_TFree(mat_i, HYPRE_MEMORY_HOST);
+            }
             return (-1);
          }
 
@@ -1203,7 +1246,10 @@ hypre_CSRBlockMatrixBlockInvMatvec(HYPRE_Complex* mat, HYPRE_Complex* v,
 #endif
 
 
-   hypre_TFree(mat_i, HYPRE_MEMORY_HOST);
+   if (mat_i != mat_buf)
+   {
+      hypre_TFree(mat_i, HYPRE_MEMORY_HOST);
+   }
 
    return (ierr);
 }
@@ -37,6 +37,8 @@ hypre_CSRBlockMatrixMatvec(HYPRE_Complex alpha, hypre_CSRBlockMatrix *A,
    HYPRE_Int         i, b1, b2, jj, bnnz = blk_size * blk_size;
    HYPRE_Int         ierr = 0;
    HYPRE_Complex     temp;
+   HYPRE_Complex    *a, *xj;
+   HYPRE_Complex     y0, y1, y2;
 
    /*---------------------------------------------------------------------
     *  Check for size compatibility.  Matvec returns ierr = 1 if
@@ -101,22 +103,76 @@ hypre_CSRBlockMatrixMatvec(HYPRE_Complex alpha, hypre_CSRBlockMatrix *A,
     * y += A*x
     *-----------------------------------------------------------------*/
 
+   /* The common block sizes keep the block row of y in registers */
+   if (blk_size == 2)
+   {
 #ifdef HYPRE_USING_OPENMP
-   #pragma omp parallel for private(i,jj,b1,b2,temp) HYPRE_SMP_SCHEDULE
+      #pragma omp parallel for private(i,jj,a,xj,y0,y1) HYPRE_SMP_SCHEDULE
 #endif
-
-   for (i = 0; i < num_rows; i++)
+      for (i = 0; i < num_rows; i++)
+      {
+         y0 = y_data[2 * i];
+         y1 = y_data[2 * i + 1];
+         for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+         {
+            a  = &A_data[4 * jj];
+            xj = &x_data[2 * A_j[jj]];
+            y0 += a[0] * xj[0];
+            y0 += a[1] * xj[1];
+            y1 += a[2] * xj[0];
+            y1 += a[3] * xj[1];
+         }
+         y_data[2 * i]     = y0;
+         y_data[2 * i + 1] = y1;
+      }
+   }
+   else if (blk_size == 3)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i,jj,a,xj,y0,y1,y2) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         y0 = y_data[3 * i];
+         y1 = y_data[3 * i + 1];
+         y2 = y_data[3 * i + 2];
+         for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+         {
+            a  = &A_data[9 * jj];
+            xj = &x_data[3 * A_j[jj]];
+            y0 += a[0] * xj[0];
+            y0 += a[1] * xj[1];
+            y0 += a[2] * xj[2];
+            y1 += a[3] * xj[0];
+            y1 += a[4] * xj[1];
+            y1 += a[5] * xj[2];
+            y2 += a[6] * xj[0];
+            y2 += a[7] * xj[1];
+            y2 += a[8] * xj[2];
+         }
+         y_data[3 * i]     = y0;
+         y_data[3 * i + 1] = y1;
+         y_data[3 * i + 2] = y2;
+      }
+   }
+   else
    {
-      for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i,jj,b1,b2,temp) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
       {
-         for (b1 = 0; b1 < blk_size; b1++)
+         for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
          {
-            temp = y_data[i * blk_size + b1];
-            for (b2 = 0; b2 < blk_size; b2++)
+            for (b1 = 0; b1 < blk_size; b1++)
             {
-               temp += A_data[jj * bnnz + b1 * blk_size + b2] * x_data[A_j[jj] * blk_size + b2];
+               temp = y_data[i * blk_size + b1];
+               for (b2 = 0; b2 < blk_size; b2++)
+               {
+                  temp += A_data[jj * bnnz + b1 * blk_size + b2] * x_data[A_j[jj] * blk_size + b2];
+               }
+               y_data[i * blk_size + b1] = temp;
             }
-            y_data[i * blk_size + b1] = temp;
          }
       }
    }
@@ -167,6 +223,8 @@ hypre_CSRBlockMatrixMatvecT( HYPRE_Complex         alpha,
    HYPRE_Int         y_size = hypre_VectorSize(y);
 
    HYPRE_Complex     temp;
+   HYPRE_Complex    *a, *yj;
+   HYPRE_Complex     x0, x1, x2;
 
    HYPRE_Int         i, j, jj;
    HYPRE_Int         ierr  = 0;
@@ -251,21 +309,62 @@ hypre_CSRBlockMatrixMatvecT( HYPRE_Complex         alpha,
     * y += A^T*x
     *-----------------------------------------------------------------*/
 
-#ifdef HYPRE_USING_OPENMP
-   #pragma omp parallel for private(i, jj,j, b1, b2) HYPRE_SMP_SCHEDULE
-#endif
-
-   for (i = 0; i < num_rows; i++)
+   /* Different rows of A scatter into the same entries of y, so this loop
+      is not threaded */
+   if (blk_size == 2)
+   {
+      for (i = 0; i < num_rows; i++)
+      {
+         x0 = x_data[2 * i];
+         x1 = x_data[2 * i + 1];
+         for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+         {
+            a  = &A_data[4 * jj];
+            yj = &y_data[2 * A_j[jj]];
+            yj[0] += a[0] * x0;
+            yj[1] += a[1] * x0;
+            yj[0] += a[2] * x1;
+            yj[1] += a[3] * x1;
+         }
+      }
+   }
+   else if (blk_size == 3)
+   {
+      for (i = 0; i < num_rows; i++)
+      {
+         x0 = x_data[3 * i];
+         x1 = x_data[3 * i + 1];
+         x2 = x_data[3 * i + 2];
+         for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+         {
+            a  = &A_data[9 * jj];
+            yj = &y_data[3 * A_j[jj]];
+            yj[0] += a[0] * x0;
+            yj[1] += a[1] * x0;
+            yj[2] += a[2] * x0;
+            yj[0] += a[3] * x1;
+            yj[1] += a[4] * x1;
+            yj[2] += a[5] * x1;
+            yj[0] += a[6] * x2;
+            yj[1] += a[7] * x2;
+            yj[2] += a[8] * x2;
+         }
+      }
+   }
+   else
    {
-      for (jj = A_i[i]; jj < A_i[i + 1]; jj++) /*each nonzero in that row*/
+      for (i = 0; i < num_rows; i++)
       {
-         for (b1 = 0; b1 < blk_size; b1++) /*row */
+         for (jj = A_i[i]; jj < A_i[i + 1]; jj++) /*each nonzero in that row*/
          {
-            for (b2 = 0; b2 < blk_size; b2++) /*col*/
+            j = A_j[jj]; /*col */
+            for (b1 = 0; b1 < blk_size; b1++) /*row */
             {
-               j = A_j[jj]; /*col */
-               y_data[j * blk_size + b2] +=
-                  A_data[jj * bnnz + b1 * blk_size + b2] * x_data[i * blk_size + b1];
+               for (b2 = 0; b2 < blk_size; b2++) /*col*/
+               {
+                  y_data[j * blk_size + b2] +=
+                     A_data[jj * bnnz + b1 * blk_size + b2] * x_data[i * blk_size + b1];
+               }
             }
          }
       }
@@ -1783,6 +1783,70 @@ hypre_F90_IFACE(hypre_boomeramgsetkeeptransp, HYPRE_BOOMERAMGSETKEEPTRANSP)
                 hypre_F90_PassInt (keep_transpose) ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetPersistentComm
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_F90_IFACE(hypre_boomeramgsetpersistentcomm, HYPRE_BOOMERAMGSETPERSISTENTCOMM)
+( hypre_F90_Obj *solver,
+  hypre_F90_Int *persistent_comm,
+  hypre_F90_Int *ierr          )
+{
+   *ierr = (hypre_F90_Int)
+           ( HYPRE_BoomerAMGSetPersistentComm(
+                hypre_F90_PassObj (HYPRE_Solver, solver),
+                hypre_F90_PassInt (persistent_comm) ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetFuseGridTransfer
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_F90_IFACE(hypre_boomeramgsetfusegridtransfer, HYPRE_BOOMERAMGSETFUSEGRIDTRANSFER)
+( hypre_F90_Obj *solver,
+  hypre_F90_Int *fuse_grid_transfer,
+  hypre_F90_Int *ierr          )
+{
+   *ierr = (hypre_F90_Int)
+           ( HYPRE_BoomerAMGSetFuseGridTransfer(
+                hypre_F90_PassObj (HYPRE_Solver, solver),
+                hypre_F90_PassInt (fuse_grid_transfer) ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetMixedPrecision
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_F90_IFACE(hypre_boomeramgsetmixedprecision, HYPRE_BOOMERAMGSETMIXEDPRECISION)
+( hypre_F90_Obj *solver,
+  hypre_F90_Int *mixed_precision,
+  hypre_F90_Int *ierr          )
+{
+   *ierr = (hypre_F90_Int)
+           ( HYPRE_BoomerAMGSetMixedPrecision(
+                hypre_F90_PassObj (HYPRE_Solver, solver),
+                hypre_F90_PassInt (mixed_precision) ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetReuseCFRAPStructure
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_F90_IFACE(hypre_boomeramgsetreusecfrapstructure, HYPRE_BOOMERAMGSETREUSECFRAPSTRUCTURE)
+( hypre_F90_Obj *solver,
+  hypre_F90_Int *reuse_cf_rap_structure,
+  hypre_F90_Int *ierr          )
+{
+   *ierr = (hypre_F90_Int)
+           ( HYPRE_BoomerAMGSetReuseCFRAPStructure(
+                hypre_F90_PassObj (HYPRE_Solver, solver),
+                hypre_F90_PassInt (reuse_cf_rap_structure) ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetRAP2
  *--------------------------------------------------------------------------*/
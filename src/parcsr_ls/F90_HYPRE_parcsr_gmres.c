@@ -167,6 +167,22 @@ hypre_F90_IFACE(hypre_parcsrgmressetmaxiter, HYPRE_PARCSRGMRESSETMAXITER)
                 hypre_F90_PassInt (max_iter) ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRGMRESSetPipelined
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_F90_IFACE(hypre_parcsrgmressetpipelined, HYPRE_PARCSRGMRESSETPIPELINED)
+( hypre_F90_Obj *solver,
+  hypre_F90_Int *pipelined,
+  hypre_F90_Int *ierr      )
+{
+   *ierr = (hypre_F90_Int)
+           ( HYPRE_ParCSRGMRESSetPipelined(
+                hypre_F90_PassObj (HYPRE_Solver, solver),
+                hypre_F90_PassInt (pipelined) ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRGMRESSetStopCrit
  *--------------------------------------------------------------------------*/
@@ -278,6 +278,22 @@ hypre_F90_IFACE(hypre_ilusetlocalreordering, HYPRE_ILUSETLOCALREORDERING)
                 hypre_F90_PassInt (ordering_type) ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ILUSetIterativeSetupMaxIter
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_F90_IFACE(hypre_ilusetiterativesetupmaxiter, HYPRE_ILUSETITERATIVESETUPMAXITER)
+( hypre_F90_Obj *solver,
+  hypre_F90_Int *max_iter,
+  hypre_F90_Int *ierr )
+{
+   *ierr = (hypre_F90_Int)
+           ( HYPRE_ILUSetIterativeSetupMaxIter(
+                hypre_F90_PassObj (HYPRE_Solver, solver),
+                hypre_F90_PassInt (max_iter) ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ILUGetNumIterations
  *--------------------------------------------------------------------------*/
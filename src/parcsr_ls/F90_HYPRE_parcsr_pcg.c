@@ -184,6 +184,22 @@ hypre_F90_IFACE(hypre_parcsrpcgsetrelchange, HYPRE_PARCSRPCGSETRELCHANGE)
                 hypre_F90_PassInt (rel_change) ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRPCGSetPipelined
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_F90_IFACE(hypre_parcsrpcgsetpipelined, HYPRE_PARCSRPCGSETPIPELINED)
+( hypre_F90_Obj *solver,
+  hypre_F90_Int *pipelined,
+  hypre_F90_Int *ierr        )
+{
+   *ierr = (hypre_F90_Int)
+           ( HYPRE_ParCSRPCGSetPipelined(
+                hypre_F90_PassObj (HYPRE_Solver, solver),
+                hypre_F90_PassInt (pipelined) ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRPCGSetPrecond
  *--------------------------------------------------------------------------*/
@@ -1974,6 +1974,50 @@ HYPRE_BoomerAMGSetKeepTranspose (HYPRE_Solver solver,
    return (hypre_BoomerAMGSetKeepTranspose ( (void *) solver, keepTranspose ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetPersistentComm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetPersistentComm (HYPRE_Solver solver,
+                                  HYPRE_Int    persistent_comm)
+{
+   return (hypre_BoomerAMGSetPersistentComm ( (void *) solver, persistent_comm ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetFuseGridTransfer
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetFuseGridTransfer (HYPRE_Solver solver,
+                                    HYPRE_Int    fuse_grid_transfer)
+{
+   return (hypre_BoomerAMGSetFuseGridTransfer ( (void *) solver, fuse_grid_transfer ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetMixedPrecision
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetMixedPrecision (HYPRE_Solver solver,
+                                  HYPRE_Int    mixed_precision)
+{
+   return (hypre_BoomerAMGSetMixedPrecision ( (void *) solver, mixed_precision ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetReuseCFRAPStructure
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetReuseCFRAPStructure (HYPRE_Solver solver,
+                                       HYPRE_Int    reuse_cf_rap_structure)
+{
+   return (hypre_BoomerAMGSetReuseCFRAPStructure ( (void *) solver, reuse_cf_rap_structure ) );
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetDSLUThreshold
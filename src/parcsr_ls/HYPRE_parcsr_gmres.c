@@ -32,6 +32,8 @@ HYPRE_ParCSRGMRESCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovClearVector,
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+   hypre_GMRESFunctionsSetAsyncInnerProd(gmres_functions, hypre_ParKrylovInnerProdLocal,
+                                        hypre_ParKrylovIAllreduce);
    *solver = ( (HYPRE_Solver) hypre_GMRESCreate( gmres_functions ) );
 
    return hypre_error_flag;
@@ -133,6 +135,17 @@ HYPRE_ParCSRGMRESSetMaxIter( HYPRE_Solver solver,
    return ( HYPRE_GMRESSetMaxIter( solver, max_iter ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRGMRESSetPipelined
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRGMRESSetPipelined( HYPRE_Solver solver,
+                               HYPRE_Int    pipelined )
+{
+   return ( HYPRE_GMRESSetPipelined( solver, pipelined ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRGMRESSetStopCrit - OBSOLETE
  *--------------------------------------------------------------------------*/
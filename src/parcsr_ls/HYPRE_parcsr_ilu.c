@@ -195,6 +195,16 @@ HYPRE_ILUSetLocalReordering(  HYPRE_Solver solver, HYPRE_Int ordering_type )
    return hypre_ILUSetLocalReordering(solver, ordering_type);
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ILUSetIterativeSetupMaxIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ILUSetIterativeSetupMaxIter( HYPRE_Solver solver, HYPRE_Int max_iter )
+{
+   return hypre_ILUSetIterativeSetupMaxIter( solver, max_iter );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ILUGetNumIterations
  *--------------------------------------------------------------------------*/
@@ -195,6 +195,8 @@ HYPRE_TempParCSRSetupInterpreter( mv_InterfaceInterpreter *i )
    i->MultiAxpy = mv_TempMultiVectorAxpy;
    i->MultiXapy = mv_TempMultiVectorXapy;
    i->Eval = mv_TempMultiVectorEval;
+   i->BlockInnerProd = hypre_ParKrylovBlockInnerProd;
+   i->BlockAxpy = hypre_ParKrylovBlockAxpy;
 
    return 0;
 }
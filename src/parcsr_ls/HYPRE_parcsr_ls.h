@@ -1236,6 +1236,57 @@ HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2(HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose(HYPRE_Solver solver,
                                           HYPRE_Int    keepTranspose);
 
+/**
+ * (Optional) If set to 1, the setup attaches persistent MPI requests and
+ * communication buffers to the communication package of every level matrix
+ * (A, P and R). The matvecs, residuals and Jacobi/hybrid Gauss-Seidel halo
+ * exchanges of the solve phase then reuse them instead of posting new
+ * nonblocking sends and receives. Host execution only. The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetPersistentComm(HYPRE_Solver solver,
+                                           HYPRE_Int    persistent_comm);
+
+/**
+ * (Optional) If set to 1, the cycle computes the coarse right-hand side
+ * \f$P^T (f - A u)\f$ in a single fused pass that never stores the fine-grid
+ * residual, and applies the coarse-grid correction \f$u + P e\f$ in a single
+ * pass over \f$u\f$. Only used on the host, for ParCSR (non-block) matrices
+ * and when \f$R = P^T\f$ (restriction type 0). The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetFuseGridTransfer(HYPRE_Solver solver,
+                                             HYPRE_Int    fuse_grid_transfer);
+
+/**
+ * (Optional) If set to 1, the values of the interpolation and restriction
+ * operators are stored in single precision at the end of the setup phase.
+ * The grid transfers of the cycle then read P and R in single precision,
+ * while A, all vectors, the residual, the relaxation and the coarse grid
+ * solve stay in double precision. This halves the memory of the values of P
+ * and R and reduces the bandwidth of the grid transfers. AMG-DD and in-place
+ * changes of the values convert them back to double precision (without
+ * undoing the rounding). Only used on the host, for ParCSR (non-block)
+ * matrices. The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetMixedPrecision(HYPRE_Solver solver,
+                                           HYPRE_Int    mixed_precision);
+
+/**
+ * (Optional) If set to 1, a repeated call to HYPRE_BoomerAMGSetup reuses the
+ * C/F splittings and the Galerkin product (RAP) structure of the previous
+ * setup. The C/F splitting of every level is kept and the coarsening is
+ * skipped. On the host, the symbolic structure of each standard Galerkin
+ * product is kept as well, and is reused (only the numeric phases of the
+ * local products are run) when A and P have the same sparsity patterns as
+ * in the previous setup on all processes. Nothing else is reused: the
+ * strength matrix is recomputed with the new values, and the interpolation
+ * operator, including its sparsity pattern, is rebuilt from scratch. This is
+ * meant for sequences of matrices with the same sparsity pattern, e.g., in a
+ * Newton iteration. Levels with aggressive coarsening, nodal coarsening and
+ * block (systems) mode are always coarsened again. The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetReuseCFRAPStructure(HYPRE_Solver solver,
+                                                HYPRE_Int    reuse_cf_rap_structure);
+
 /**
  * HYPRE_BoomerAMGSetPlotGrids
  **/
@@ -2606,6 +2657,12 @@ HYPRE_Int HYPRE_ParCSRPCGSetTwoNorm(HYPRE_Solver solver,
 HYPRE_Int HYPRE_ParCSRPCGSetRelChange(HYPRE_Solver solver,
                                       HYPRE_Int    rel_change);
 
+/**
+ * (Optional) Use pipelined PCG, see HYPRE_PCGSetPipelined.
+ **/
+HYPRE_Int HYPRE_ParCSRPCGSetPipelined(HYPRE_Solver solver,
+                                      HYPRE_Int    pipelined);
+
 HYPRE_Int HYPRE_ParCSRPCGSetPrecond(HYPRE_Solver            solver,
                                     HYPRE_PtrToParSolverFcn precond,
                                     HYPRE_PtrToParSolverFcn precond_setup,
@@ -2712,6 +2769,12 @@ HYPRE_Int HYPRE_ParCSRGMRESSetMinIter(HYPRE_Solver solver,
 HYPRE_Int HYPRE_ParCSRGMRESSetMaxIter(HYPRE_Solver solver,
                                       HYPRE_Int    max_iter);
 
+/**
+ * (Optional) Use pipelined GMRES, see HYPRE_GMRESSetPipelined.
+ **/
+HYPRE_Int HYPRE_ParCSRGMRESSetPipelined(HYPRE_Solver solver,
+                                        HYPRE_Int    pipelined);
+
 /*
  * Obsolete
  **/
@@ -4356,6 +4419,10 @@ HYPRE_ILUSetSchurMaxIter( HYPRE_Solver solver, HYPRE_Int ss_max_iter );
  * Options for \e ilu_type are:
  *    - 0 : BJ with ILU(k) (default, with k = 0)
  *    - 1 : BJ with ILUT
+ *    - 2 : BJ with iterative ILU(k), the factors are computed with
+ *          fine-grained parallel fixed-point sweeps (see
+ *          HYPRE_ILUSetIterativeSetupMaxIter); the symbolic phase that
+ *          computes the ILU(k) pattern is still sequential
  *    - 10 : GMRES with ILU(k)
  *    - 11 : GMRES with ILUT
  *    - 20 : NSH with ILU(k)
@@ -4369,6 +4436,17 @@ HYPRE_ILUSetSchurMaxIter( HYPRE_Solver solver, HYPRE_Int ss_max_iter );
 HYPRE_Int
 HYPRE_ILUSetType( HYPRE_Solver solver, HYPRE_Int ilu_type );
 
+/**
+ * (Optional) Set the number of fixed-point sweeps used to compute the factors
+ * for the iterative ILU(k) setup (ilu_type 2). Each sweep updates all the
+ * entries of L and U concurrently. Only the numeric phase of block Jacobi
+ * ILU(k) is threaded; the ILU(k) pattern is computed sequentially, and ILUT
+ * and the GMRES, NSH, RAS and DDPQ variants use the sequential factorization.
+ * The default is 5.
+ **/
+HYPRE_Int
+HYPRE_ILUSetIterativeSetupMaxIter( HYPRE_Solver solver, HYPRE_Int max_iter );
+
 /**
  * Set the type of reordering for the local matrix.
  *
@@ -31,6 +31,8 @@ HYPRE_ParCSRPCGCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovClearVector,
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+   hypre_PCGFunctionsSetAsyncInnerProd(pcg_functions, hypre_ParKrylovInnerProdLocal,
+                                      hypre_ParKrylovIAllreduce);
    *solver = ( (HYPRE_Solver) hypre_PCGCreate( pcg_functions ) );
 
    return hypre_error_flag;
@@ -143,6 +145,17 @@ HYPRE_ParCSRPCGSetRelChange( HYPRE_Solver solver,
    return ( HYPRE_PCGSetRelChange( solver, rel_change ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRPCGSetPipelined
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRPCGSetPipelined( HYPRE_Solver solver,
+                             HYPRE_Int    pipelined )
+{
+   return ( HYPRE_PCGSetPipelined( solver, pipelined ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRPCGSetPrecond
  *--------------------------------------------------------------------------*/
@@ -238,9 +238,11 @@ typedef struct
    hypre_ParVector     *u_coarse;
    MPI_Comm             new_comm;
 
-   /* store matrix, vector and communication info for Gaussian elimination */
+   /* store matrix, vector and communication info for Gaussian elimination;
+      A_mat holds the factors of the coarse matrix (pivots in A_piv) */
    HYPRE_Int   gs_setup;
    HYPRE_Real *A_mat, *A_inv;
+   HYPRE_Int  *A_piv;
    HYPRE_Real *b_vec;
    HYPRE_Int  *comm_info;
 
@@ -264,6 +266,22 @@ typedef struct
    HYPRE_Int keepTranspose;
    HYPRE_Int modularized_matmat;
 
+   /* reuse persistent MPI requests for all halo exchanges in the cycle */
+   HYPRE_Int persistent_comm;
+
+   /* fused residual-restriction and interpolation-correction in the cycle */
+   HYPRE_Int fuse_grid_transfer;
+   HYPRE_Complex *fuse_work;      /* per-thread partial sums of f_c = P^T r */
+   HYPRE_Int      fuse_work_size;
+
+   /* store interpolation and restriction in single precision after setup */
+   HYPRE_Int mixed_precision;
+
+   /* keep the C/F splittings and RAP structure when setup is called again */
+   HYPRE_Int reuse_cf_rap_structure;
+   hypre_ParCSRRAPSymbolic **rap_symbolic;     /* kept Galerkin product structures */
+   HYPRE_Int                 num_rap_symbolic;
+
    /* information for preserving indices as coarse grid points */
    HYPRE_Int      num_C_points;
    HYPRE_Int      C_points_coarse_level;
@@ -490,6 +508,7 @@ typedef struct
 #define hypre_ParAMGDataGSSetup(amg_data) ((amg_data)->gs_setup)
 #define hypre_ParAMGDataAMat(amg_data) ((amg_data)->A_mat)
 #define hypre_ParAMGDataAInv(amg_data) ((amg_data)->A_inv)
+#define hypre_ParAMGDataAPiv(amg_data) ((amg_data)->A_piv)
 #define hypre_ParAMGDataBVec(amg_data) ((amg_data)->b_vec)
 #define hypre_ParAMGDataCommInfo(amg_data) ((amg_data)->comm_info)
 
@@ -517,6 +536,14 @@ typedef struct
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
 #define hypre_ParAMGDataModularizedMatMat(amg_data) ((amg_data)->modularized_matmat)
+#define hypre_ParAMGDataPersistentComm(amg_data) ((amg_data)->persistent_comm)
+#define hypre_ParAMGDataFuseGridTransfer(amg_data) ((amg_data)->fuse_grid_transfer)
+#define hypre_ParAMGDataFuseWork(amg_data) ((amg_data)->fuse_work)
+#define hypre_ParAMGDataFuseWorkSize(amg_data) ((amg_data)->fuse_work_size)
+#define hypre_ParAMGDataMixedPrecision(amg_data) ((amg_data)->mixed_precision)
+#define hypre_ParAMGDataReuseCFRAPStructure(amg_data) ((amg_data)->reuse_cf_rap_structure)
+#define hypre_ParAMGDataRAPSymbolic(amg_data) ((amg_data)->rap_symbolic)
+#define hypre_ParAMGDataNumRAPSymbolic(amg_data) ((amg_data)->num_rap_symbolic)
 
 /*indices for the dof which will keep coarsening to the coarse level */
 #define hypre_ParAMGDataNumCPoints(amg_data)  ((amg_data)->num_C_points)
@@ -1439,6 +1466,10 @@ HYPRE_Int HYPRE_BoomerAMGSetNonGalerkTol ( HYPRE_Solver solver, HYPRE_Int nongal
 HYPRE_Int HYPRE_BoomerAMGSetRAP2 ( HYPRE_Solver solver, HYPRE_Int rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2 ( HYPRE_Solver solver, HYPRE_Int mod_rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose ( HYPRE_Solver solver, HYPRE_Int keepTranspose );
+HYPRE_Int HYPRE_BoomerAMGSetPersistentComm ( HYPRE_Solver solver, HYPRE_Int persistent_comm );
+HYPRE_Int HYPRE_BoomerAMGSetFuseGridTransfer ( HYPRE_Solver solver, HYPRE_Int fuse_grid_transfer );
+HYPRE_Int HYPRE_BoomerAMGSetMixedPrecision ( HYPRE_Solver solver, HYPRE_Int mixed_precision );
+HYPRE_Int HYPRE_BoomerAMGSetReuseCFRAPStructure ( HYPRE_Solver solver, HYPRE_Int reuse_cf_rap_structure );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int HYPRE_BoomerAMGSetDSLUThreshold ( HYPRE_Solver solver, HYPRE_Int slu_threshold );
 #endif
@@ -1583,6 +1614,7 @@ HYPRE_Int HYPRE_ParCSRGMRESSetTol ( HYPRE_Solver solver, HYPRE_Real tol );
 HYPRE_Int HYPRE_ParCSRGMRESSetAbsoluteTol ( HYPRE_Solver solver, HYPRE_Real a_tol );
 HYPRE_Int HYPRE_ParCSRGMRESSetMinIter ( HYPRE_Solver solver, HYPRE_Int min_iter );
 HYPRE_Int HYPRE_ParCSRGMRESSetMaxIter ( HYPRE_Solver solver, HYPRE_Int max_iter );
+HYPRE_Int HYPRE_ParCSRGMRESSetPipelined ( HYPRE_Solver solver, HYPRE_Int pipelined );
 HYPRE_Int HYPRE_ParCSRGMRESSetStopCrit ( HYPRE_Solver solver, HYPRE_Int stop_crit );
 HYPRE_Int HYPRE_ParCSRGMRESSetPrecond ( HYPRE_Solver solver, HYPRE_PtrToParSolverFcn precond,
                                         HYPRE_PtrToParSolverFcn precond_setup, HYPRE_Solver precond_solver );
@@ -1800,6 +1832,7 @@ HYPRE_Int HYPRE_ParCSRPCGSetMaxIter ( HYPRE_Solver solver, HYPRE_Int max_iter );
 HYPRE_Int HYPRE_ParCSRPCGSetStopCrit ( HYPRE_Solver solver, HYPRE_Int stop_crit );
 HYPRE_Int HYPRE_ParCSRPCGSetTwoNorm ( HYPRE_Solver solver, HYPRE_Int two_norm );
 HYPRE_Int HYPRE_ParCSRPCGSetRelChange ( HYPRE_Solver solver, HYPRE_Int rel_change );
+HYPRE_Int HYPRE_ParCSRPCGSetPipelined ( HYPRE_Solver solver, HYPRE_Int pipelined );
 HYPRE_Int HYPRE_ParCSRPCGSetPrecond ( HYPRE_Solver solver, HYPRE_PtrToParSolverFcn precond,
                                       HYPRE_PtrToParSolverFcn precond_setup, HYPRE_Solver precond_solver );
 HYPRE_Int HYPRE_ParCSRPCGGetPrecond ( HYPRE_Solver solver, HYPRE_Solver *precond_data_ptr );
@@ -2041,6 +2074,10 @@ HYPRE_Int hypre_BoomerAMGSetNonGalerkTol ( void *data, HYPRE_Int nongalerk_num_t
 HYPRE_Int hypre_BoomerAMGSetRAP2 ( void *data, HYPRE_Int rap2 );
 HYPRE_Int hypre_BoomerAMGSetModuleRAP2 ( void *data, HYPRE_Int mod_rap2 );
 HYPRE_Int hypre_BoomerAMGSetKeepTranspose ( void *data, HYPRE_Int keepTranspose );
+HYPRE_Int hypre_BoomerAMGSetPersistentComm ( void *data, HYPRE_Int persistent_comm );
+HYPRE_Int hypre_BoomerAMGSetFuseGridTransfer ( void *data, HYPRE_Int fuse_grid_transfer );
+HYPRE_Int hypre_BoomerAMGSetMixedPrecision ( void *data, HYPRE_Int mixed_precision );
+HYPRE_Int hypre_BoomerAMGSetReuseCFRAPStructure ( void *data, HYPRE_Int reuse_cf_rap_structure );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int hypre_BoomerAMGSetDSLUThreshold ( void *data, HYPRE_Int slu_threshold );
 #endif
@@ -2762,12 +2799,19 @@ HYPRE_Int hypre_ParKrylovMatvecT ( void *matvec_data, HYPRE_Complex alpha, void
                                    HYPRE_Complex beta, void *y );
 HYPRE_Int hypre_ParKrylovMatvecDestroy ( void *matvec_data );
 HYPRE_Real hypre_ParKrylovInnerProd ( void *x, void *y );
+HYPRE_Real hypre_ParKrylovInnerProdLocal ( void *x, void *y );
+HYPRE_Int hypre_ParKrylovIAllreduce ( void *x, HYPRE_Real *sendbuf, HYPRE_Real *recvbuf,
+                                      HYPRE_Int count, hypre_MPI_Request *request );
 HYPRE_Int hypre_ParKrylovMassInnerProd ( void *x, void **y, HYPRE_Int k, HYPRE_Int unroll,
                                          void *result );
 HYPRE_Int hypre_ParKrylovMassDotpTwo ( void *x, void *y, void **z, HYPRE_Int k, HYPRE_Int unroll,
                                        void *result_x, void *result_y );
 HYPRE_Int hypre_ParKrylovMassAxpy( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
                                    HYPRE_Int unroll);
+HYPRE_Int hypre_ParKrylovBlockInnerProd ( HYPRE_Int nx, void **x, HYPRE_Int ny, void **y,
+                                          HYPRE_Int ld, HYPRE_Complex *result );
+HYPRE_Int hypre_ParKrylovBlockAxpy ( HYPRE_Int nx, void **x, HYPRE_Int ny, void **y, HYPRE_Int ld,
+                                     HYPRE_Complex *coef, HYPRE_Complex beta );
 HYPRE_Int hypre_ParKrylovCopyVector ( void *x, void *y );
 HYPRE_Int hypre_ParKrylovClearVector ( void *x );
 HYPRE_Int hypre_ParKrylovScaleVector ( HYPRE_Complex alpha, void *x );
@@ -2777,15 +2821,27 @@ HYPRE_Int hypre_ParKrylovIdentitySetup ( void *vdata, void *A, void *b, void *x
 HYPRE_Int hypre_ParKrylovIdentity ( void *vdata, void *A, void *b, void *x );
 
 /* schwarz.c */
+HYPRE_Int hypre_SchwarzDomainBlockStarts ( HYPRE_Int num_domains, HYPRE_Int *i_domain_dof,
+                                           HYPRE_Int **block_starts_ptr );
+HYPRE_Int hypre_SchwarzFactorDomainBlocks ( HYPRE_Int num_domains, HYPRE_Int *i_domain_dof,
+                                            HYPRE_Int *block_starts, HYPRE_Real *blocks, HYPRE_Int *piv,
+                                            HYPRE_Int use_nonsymm, HYPRE_Int *num_failed_ptr );
+HYPRE_Int hypre_SchwarzDomainColoring ( hypre_CSRMatrix *domain_structure, hypre_CSRMatrix *A_diag,
+                                        hypre_CSRMatrix *A_offd, hypre_CSRMatrix *A_boundary,
+                                        HYPRE_Int *num_colors_ptr, HYPRE_Int **color_starts_ptr,
+                                        HYPRE_Int **color_domains_ptr );
 HYPRE_Int hypre_AMGNodalSchwarzSmoother ( hypre_CSRMatrix *A, HYPRE_Int num_functions,
                                           HYPRE_Int option, hypre_CSRMatrix **domain_structure_pointer );
 HYPRE_Int hypre_ParMPSchwarzSolve ( hypre_ParCSRMatrix *par_A, hypre_CSRMatrix *A_boundary,
                                     hypre_ParVector *rhs_vector, hypre_CSRMatrix *domain_structure, hypre_ParVector *par_x,
                                     HYPRE_Real relax_wt, HYPRE_Real *scale, hypre_ParVector *Vtemp, HYPRE_Int *pivots,
-                                    HYPRE_Int use_nonsymm );
+                                    HYPRE_Int use_nonsymm, HYPRE_Int num_colors, HYPRE_Int *color_starts,
+                                    HYPRE_Int *color_domains, HYPRE_Int *block_starts );
 HYPRE_Int hypre_MPSchwarzSolve ( hypre_ParCSRMatrix *par_A, hypre_Vector *rhs_vector,
                                  hypre_CSRMatrix *domain_structure, hypre_ParVector *par_x, HYPRE_Real relax_wt,
-                                 hypre_Vector *aux_vector, HYPRE_Int *pivots, HYPRE_Int use_nonsymm );
+                                 hypre_Vector *aux_vector, HYPRE_Int *pivots, HYPRE_Int use_nonsymm,
+                                 HYPRE_Int num_colors, HYPRE_Int *color_starts, HYPRE_Int *color_domains,
+                                 HYPRE_Int *block_starts );
 HYPRE_Int hypre_MPSchwarzCFSolve ( hypre_ParCSRMatrix *par_A, hypre_Vector *rhs_vector,
                                    hypre_CSRMatrix *domain_structure, hypre_ParVector *par_x, HYPRE_Real relax_wt,
                                    hypre_Vector *aux_vector, HYPRE_Int *CF_marker, HYPRE_Int rlx_pt, HYPRE_Int *pivots,
@@ -3026,6 +3082,7 @@ HYPRE_Int hypre_ILUSolve( void *ilu_vdata, hypre_ParCSRMatrix *A, hypre_ParVecto
 HYPRE_Int hypre_ILUSetPrintLevel( void *ilu_vdata, HYPRE_Int print_level );
 HYPRE_Int hypre_ILUSetLogging( void *ilu_vdata, HYPRE_Int logging );
 HYPRE_Int hypre_ILUSetLocalReordering( void *ilu_vdata, HYPRE_Int ordering_type );
+HYPRE_Int hypre_ILUSetIterativeSetupMaxIter( void *ilu_vdata, HYPRE_Int max_iter );
 HYPRE_Int hypre_ILUSetSchurSolverKDIM( void *ilu_vdata, HYPRE_Int ss_kDim );
 HYPRE_Int hypre_ILUSetSchurSolverMaxIter( void *ilu_vdata, HYPRE_Int ss_max_iter );
 HYPRE_Int hypre_ILUSetSchurSolverTol( void *ilu_vdata, HYPRE_Real ss_tol );
@@ -3085,6 +3142,9 @@ HYPRE_Int hypre_ILUSetupMILU0(hypre_ParCSRMatrix *A, HYPRE_Int *permp, HYPRE_Int
 HYPRE_Int hypre_ILUSetupILUK(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Int *permp,
                              HYPRE_Int *qpermp, HYPRE_Int nLU, HYPRE_Int nI, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr,
                              hypre_ParCSRMatrix **Uptr, hypre_ParCSRMatrix **Sptr, HYPRE_Int **u_end);
+HYPRE_Int hypre_ILUSetupILUKIter(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Int *permp,
+                                 HYPRE_Int max_iter, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr,
+                                 hypre_ParCSRMatrix **Uptr);
 HYPRE_Int hypre_ILUSetupILUKSymbolic(HYPRE_Int n, HYPRE_Int *A_diag_i, HYPRE_Int *A_diag_j,
                                      HYPRE_Int lfil, HYPRE_Int *perm, HYPRE_Int *rperm, HYPRE_Int *iw, HYPRE_Int nLU,
                                      HYPRE_Int *L_diag_i, HYPRE_Int *U_diag_i, HYPRE_Int *S_diag_i, HYPRE_Int **L_diag_j,
@@ -3100,12 +3160,16 @@ HYPRE_Int hypre_ILUSetupILUKRASSymbolic(HYPRE_Int n, HYPRE_Int *A_diag_i, HYPRE_
                                         HYPRE_Int *L_diag_i, HYPRE_Int *U_diag_i, HYPRE_Int **L_diag_j, HYPRE_Int **U_diag_j);
 HYPRE_Int hypre_ILUSetupILUKRAS(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Int *perm,
                                 HYPRE_Int nLU, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr, hypre_ParCSRMatrix **Uptr);
+HYPRE_Int hypre_ILUSetupLevelSchedule(HYPRE_Int n, HYPRE_Int *A_i, HYPRE_Int *A_j, HYPRE_Int upper,
+                                      HYPRE_Int *num_levelsp, HYPRE_Int **level_ptrp, HYPRE_Int **level_rowsp);
 HYPRE_Int hypre_ILUSetupILUTRAS(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Real *tol,
                                 HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr,
                                 hypre_ParCSRMatrix **Uptr);
 HYPRE_Int hypre_ILUSolveLU(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u,
                            HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U,
-                           hypre_ParVector *utemp, hypre_ParVector *ftemp);
+                           hypre_ParVector *utemp, hypre_ParVector *ftemp, HYPRE_Int num_lower_levels,
+                           HYPRE_Int *lower_level_ptr, HYPRE_Int *lower_level_rows, HYPRE_Int num_upper_levels,
+                           HYPRE_Int *upper_level_ptr, HYPRE_Int *upper_level_rows);
 HYPRE_Int hypre_ILUSolveSchurGMRES(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u,
                                    HYPRE_Int *perm, HYPRE_Int *qperm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D,
                                    hypre_ParCSRMatrix *U, hypre_ParCSRMatrix *S, hypre_ParVector *ftemp, hypre_ParVector *utemp,
@@ -3117,7 +3181,9 @@ HYPRE_Int hypre_ILUSolveSchurNSH(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypr
                                  hypre_ParVector *rhs, hypre_ParVector *x, HYPRE_Int *u_end);
 HYPRE_Int hypre_ILUSolveLURAS(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u,
                               HYPRE_Int *perm, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U,
-                              hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Real *fext, HYPRE_Real *uext);
+                              hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Real *fext, HYPRE_Real *uext,
+                              HYPRE_Int num_lower_levels, HYPRE_Int *lower_level_ptr, HYPRE_Int *lower_level_rows,
+                              HYPRE_Int num_upper_levels, HYPRE_Int *upper_level_ptr, HYPRE_Int *upper_level_rows);
 HYPRE_Int hypre_ILUSetSchurNSHDropThreshold( void *ilu_vdata, HYPRE_Real threshold);
 HYPRE_Int hypre_ILUSetSchurNSHDropThresholdArray( void *ilu_vdata, HYPRE_Real *threshold);
 HYPRE_Int hypre_ILUSetupRAPILU0(hypre_ParCSRMatrix *A, HYPRE_Int *perm, HYPRE_Int n, HYPRE_Int nLU,
@@ -476,6 +476,7 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataGSSetup(amg_data) = 0;
    hypre_ParAMGDataAMat(amg_data) = NULL;
    hypre_ParAMGDataAInv(amg_data) = NULL;
+   hypre_ParAMGDataAPiv(amg_data) = NULL;
    hypre_ParAMGDataBVec(amg_data) = NULL;
    hypre_ParAMGDataCommInfo(amg_data) = NULL;
 
@@ -485,6 +486,14 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataRAP2(amg_data)              = rap2;
    hypre_ParAMGDataKeepTranspose(amg_data)     = keepT;
    hypre_ParAMGDataModularizedMatMat(amg_data) = modu_rap;
+   hypre_ParAMGDataPersistentComm(amg_data)    = 0;
+   hypre_ParAMGDataFuseGridTransfer(amg_data)  = 0;
+   hypre_ParAMGDataFuseWork(amg_data)          = NULL;
+   hypre_ParAMGDataFuseWorkSize(amg_data)      = 0;
+   hypre_ParAMGDataMixedPrecision(amg_data)    = 0;
+   hypre_ParAMGDataReuseCFRAPStructure(amg_data) = 0;
+   hypre_ParAMGDataRAPSymbolic(amg_data)       = NULL;
+   hypre_ParAMGDataNumRAPSymbolic(amg_data)    = 0;
 
    /* information for preserving indices as coarse grid points */
    hypre_ParAMGDataCPointsMarker(amg_data)      = NULL;
@@ -733,6 +742,16 @@ hypre_BoomerAMGDestroy( void *data )
    {
       hypre_ParVectorDestroy(hypre_ParAMGDataZtemp(amg_data));
    }
+   hypre_TFree(hypre_ParAMGDataFuseWork(amg_data), HYPRE_MEMORY_HOST);
+
+   if (hypre_ParAMGDataRAPSymbolic(amg_data))
+   {
+      for (i = 0; i < hypre_ParAMGDataNumRAPSymbolic(amg_data); i++)
+      {
+         hypre_ParCSRRAPSymbolicDestroy(hypre_ParAMGDataRAPSymbolic(amg_data)[i]);
+      }
+      hypre_TFree(hypre_ParAMGDataRAPSymbolic(amg_data), HYPRE_MEMORY_HOST);
+   }
 
    if (hypre_ParAMGDataDofFuncArray(amg_data))
    {
@@ -874,6 +893,7 @@ hypre_BoomerAMGDestroy( void *data )
    hypre_TFree(hypre_ParAMGDataIsolatedFPointsMarker(amg_data), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_ParAMGDataAMat(amg_data), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_ParAMGDataAInv(amg_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParAMGDataAPiv(amg_data), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_ParAMGDataBVec(amg_data), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_ParAMGDataCommInfo(amg_data), HYPRE_MEMORY_HOST);
 
@@ -4780,6 +4800,70 @@ hypre_BoomerAMGSetKeepTranspose( void       *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetPersistentComm( void       *data,
+                                  HYPRE_Int   persistent_comm )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataPersistentComm(amg_data) = persistent_comm;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetFuseGridTransfer( void       *data,
+                                    HYPRE_Int   fuse_grid_transfer )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataFuseGridTransfer(amg_data) = fuse_grid_transfer;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetMixedPrecision( void       *data,
+                                  HYPRE_Int   mixed_precision )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataMixedPrecision(amg_data) = mixed_precision;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetReuseCFRAPStructure( void       *data,
+                                       HYPRE_Int   reuse_cf_rap_structure )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataReuseCFRAPStructure(amg_data) = reuse_cf_rap_structure;
+   return hypre_error_flag;
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int
 hypre_BoomerAMGSetDSLUThreshold( void   *data,
@@ -220,9 +220,11 @@ typedef struct
    hypre_ParVector     *u_coarse;
    MPI_Comm             new_comm;
 
-   /* store matrix, vector and communication info for Gaussian elimination */
+   /* store matrix, vector and communication info for Gaussian elimination;
+      A_mat holds the factors of the coarse matrix (pivots in A_piv) */
    HYPRE_Int   gs_setup;
    HYPRE_Real *A_mat, *A_inv;
+   HYPRE_Int  *A_piv;
    HYPRE_Real *b_vec;
    HYPRE_Int  *comm_info;
 
@@ -246,6 +248,22 @@ typedef struct
    HYPRE_Int keepTranspose;
    HYPRE_Int modularized_matmat;
 
+   /* reuse persistent MPI requests for all halo exchanges in the cycle */
+   HYPRE_Int persistent_comm;
+
+   /* fused residual-restriction and interpolation-correction in the cycle */
+   HYPRE_Int fuse_grid_transfer;
+   HYPRE_Complex *fuse_work;      /* per-thread partial sums of f_c = P^T r */
+   HYPRE_Int      fuse_work_size;
+
+   /* store interpolation and restriction in single precision after setup */
+   HYPRE_Int mixed_precision;
+
+   /* keep the C/F splittings and RAP structure when setup is called again */
+   HYPRE_Int reuse_cf_rap_structure;
+   hypre_ParCSRRAPSymbolic **rap_symbolic;     /* kept Galerkin product structures */
+   HYPRE_Int                 num_rap_symbolic;
+
    /* information for preserving indices as coarse grid points */
    HYPRE_Int      num_C_points;
    HYPRE_Int      C_points_coarse_level;
@@ -472,6 +490,7 @@ typedef struct
 #define hypre_ParAMGDataGSSetup(amg_data) ((amg_data)->gs_setup)
 #define hypre_ParAMGDataAMat(amg_data) ((amg_data)->A_mat)
 #define hypre_ParAMGDataAInv(amg_data) ((amg_data)->A_inv)
+#define hypre_ParAMGDataAPiv(amg_data) ((amg_data)->A_piv)
 #define hypre_ParAMGDataBVec(amg_data) ((amg_data)->b_vec)
 #define hypre_ParAMGDataCommInfo(amg_data) ((amg_data)->comm_info)
 
@@ -499,6 +518,14 @@ typedef struct
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
 #define hypre_ParAMGDataModularizedMatMat(amg_data) ((amg_data)->modularized_matmat)
+#define hypre_ParAMGDataPersistentComm(amg_data) ((amg_data)->persistent_comm)
+#define hypre_ParAMGDataFuseGridTransfer(amg_data) ((amg_data)->fuse_grid_transfer)
+#define hypre_ParAMGDataFuseWork(amg_data) ((amg_data)->fuse_work)
+#define hypre_ParAMGDataFuseWorkSize(amg_data) ((amg_data)->fuse_work_size)
+#define hypre_ParAMGDataMixedPrecision(amg_data) ((amg_data)->mixed_precision)
+#define hypre_ParAMGDataReuseCFRAPStructure(amg_data) ((amg_data)->reuse_cf_rap_structure)
+#define hypre_ParAMGDataRAPSymbolic(amg_data) ((amg_data)->rap_symbolic)
+#define hypre_ParAMGDataNumRAPSymbolic(amg_data) ((amg_data)->num_rap_symbolic)
 
 /*indices for the dof which will keep coarsening to the coarse level */
 #define hypre_ParAMGDataNumCPoints(amg_data)  ((amg_data)->num_C_points)
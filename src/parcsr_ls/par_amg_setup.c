@@ -45,6 +45,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    hypre_ParCSRMatrix **R_array;
    hypre_ParVector     *Residual_array;
    hypre_IntArray     **CF_marker_array;
+   hypre_IntArray     **reuse_CF_marker_array = NULL;
+   hypre_ParCSRRAPSymbolic **rap_symbolic = NULL;
    hypre_IntArray     **dof_func_array;
    hypre_IntArray      *dof_func;
    HYPRE_Int           *dof_func_data;
@@ -109,6 +111,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    HYPRE_Real         **cheby_coefs = NULL;
 
    HYPRE_Int       old_num_levels, num_levels;
+   HYPRE_Int       reuse_num_levels = 0;
+   HYPRE_Int       reuse_level;
    HYPRE_Int       level;
    HYPRE_Int       local_size, i, row;
    HYPRE_BigInt    first_local_row;
@@ -386,6 +390,45 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    /* end of systems checks */
 
+   /* keep the C/F splittings of the previous setup if requested */
+
+   if (hypre_ParAMGDataReuseCFRAPStructure(amg_data) && CF_marker_array &&
+       old_num_levels > 1 && !block_mode)
+   {
+      reuse_num_levels = old_num_levels - 1;
+      reuse_CF_marker_array = hypre_CTAlloc(hypre_IntArray*, reuse_num_levels, HYPRE_MEMORY_HOST);
+      for (j = 0; j < reuse_num_levels; j++)
+      {
+         reuse_CF_marker_array[j] = CF_marker_array[j];
+         CF_marker_array[j] = NULL;
+      }
+   }
+
+   /* keep the symbolic structures of the Galerkin products if requested */
+
+   if (hypre_ParAMGDataRAPSymbolic(amg_data) &&
+       (!hypre_ParAMGDataReuseCFRAPStructure(amg_data) || block_mode ||
+        hypre_ParAMGDataNumRAPSymbolic(amg_data) != max_levels - 1))
+   {
+      for (j = 0; j < hypre_ParAMGDataNumRAPSymbolic(amg_data); j++)
+      {
+         hypre_ParCSRRAPSymbolicDestroy(hypre_ParAMGDataRAPSymbolic(amg_data)[j]);
+      }
+      hypre_TFree(hypre_ParAMGDataRAPSymbolic(amg_data), HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataNumRAPSymbolic(amg_data) = 0;
+   }
+   if (hypre_ParAMGDataReuseCFRAPStructure(amg_data) && !block_mode && max_levels > 1 &&
+       hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_HOST)
+   {
+      if (!hypre_ParAMGDataRAPSymbolic(amg_data))
+      {
+         hypre_ParAMGDataRAPSymbolic(amg_data) = hypre_CTAlloc(hypre_ParCSRRAPSymbolic*,
+                                                               max_levels - 1, HYPRE_MEMORY_HOST);
+         hypre_ParAMGDataNumRAPSymbolic(amg_data) = max_levels - 1;
+      }
+      rap_symbolic = hypre_ParAMGDataRAPSymbolic(amg_data);
+   }
+
    /* free up storage in case of new setup without previous destroy */
 
    if (A_array || A_block_array || P_array || P_block_array || CF_marker_array ||
@@ -466,6 +509,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          hypre_ParVectorDestroy(hypre_ParAMGDataZtemp(amg_data));
          hypre_ParAMGDataZtemp(amg_data) = NULL;
       }
+      hypre_TFree(hypre_ParAMGDataFuseWork(amg_data), HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataFuseWorkSize(amg_data) = 0;
 
       if (hypre_ParAMGDataACoarse(amg_data))
       {
@@ -487,6 +532,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
       hypre_TFree(hypre_ParAMGDataAMat(amg_data), HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_ParAMGDataAInv(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataAPiv(amg_data), HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_ParAMGDataBVec(amg_data), HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_ParAMGDataCommInfo(amg_data), HYPRE_MEMORY_HOST);
 
@@ -1059,9 +1105,28 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                                             num_functions, dof_func_data, &S);
          }
 
-         /* Allocate CF_marker for the current level */
-         CF_marker_array[level] = hypre_IntArrayCreate(local_num_vars);
-         hypre_IntArrayInitialize(CF_marker_array[level]);
+         /* Reuse the splitting of the previous setup if all processes still
+            have a splitting of the right size on this level */
+         reuse_level = 0;
+         if (level < reuse_num_levels && level >= agg_num_levels && nodal == 0)
+         {
+            HYPRE_Int reuse_local = (reuse_CF_marker_array[level] != NULL &&
+                                     hypre_IntArraySize(reuse_CF_marker_array[level]) == local_num_vars);
+
+            hypre_MPI_Allreduce(&reuse_local, &reuse_level, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+         }
+
+         if (reuse_level)
+         {
+            CF_marker_array[level] = reuse_CF_marker_array[level];
+            reuse_CF_marker_array[level] = NULL;
+         }
+         else
+         {
+            /* Allocate CF_marker for the current level */
+            CF_marker_array[level] = hypre_IntArrayCreate(local_num_vars);
+            hypre_IntArrayInitialize(CF_marker_array[level]);
+         }
          CF_marker = hypre_IntArrayData(CF_marker_array[level]);
 
          /* Set isolated fine points (SF_PT) given by the user */
@@ -1107,7 +1172,11 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          /**** Do the appropriate coarsening ****/
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Coarsening");
 
-         if (nodal == 0) /* no nodal coarsening */
+         if (reuse_level)
+         {
+            /* C/F splitting taken from the previous setup */
+         }
+         else if (nodal == 0) /* no nodal coarsening */
          {
             if (coarsen_type == 6)
                hypre_BoomerAMGCoarsenFalgout(S, A_array[level], measure_type,
@@ -2884,7 +2953,14 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          else
          {
             /* Compute standard Galerkin coarse-grid product */
-            if (hypre_ParAMGDataModularizedMatMat(amg_data))
+            if (rap_symbolic)
+            {
+               /* numeric-only product if the patterns of A and P are unchanged */
+               A_H = hypre_ParCSRMatrixRAPKTReuse(P_array[level], A_array[level],
+                                                  P_array[level], keepTranspose,
+                                                  &rap_symbolic[level]);
+            }
+            else if (hypre_ParAMGDataModularizedMatMat(amg_data))
             {
                A_H = hypre_ParCSRMatrixRAPKT(P_array[level], A_array[level],
                                              P_array[level], keepTranspose);
@@ -3061,6 +3137,15 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    num_levels = level + 1;
    hypre_ParAMGDataNumLevels(amg_data) = num_levels;
+
+   if (reuse_CF_marker_array)
+   {
+      for (j = 0; j < reuse_num_levels; j++)
+      {
+         hypre_IntArrayDestroy(reuse_CF_marker_array[j]);
+      }
+      hypre_TFree(reuse_CF_marker_array, HYPRE_MEMORY_HOST);
+   }
    if (hypre_ParAMGDataSmoothNumLevels(amg_data) > num_levels - 1)
    {
       hypre_ParAMGDataSmoothNumLevels(amg_data) = num_levels;
@@ -3523,6 +3608,53 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_CreateLambda(amg_data);
    }
 
+   /*-----------------------------------------------------------------------
+    * Attach persistent communication to the comm_pkg of every level so the
+    * halo exchanges of the cycle reuse the same requests and buffers
+    *-----------------------------------------------------------------------*/
+
+   if (hypre_ParAMGDataPersistentComm(amg_data) && !block_mode &&
+       hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_HOST)
+   {
+      for (level = 0; level < num_levels; level++)
+      {
+         hypre_ParCSRMatrixSetPersistentComm(A_array[level], 1);
+         if (level < num_levels - 1)
+         {
+            hypre_ParCSRMatrixSetPersistentComm(P_array[level], 1);
+            if (restri_type)
+            {
+               hypre_ParCSRMatrixSetPersistentComm(R_array[level], 1);
+            }
+         }
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Allocate the per-thread partial sums of the fused residual-restriction
+    * once, sized for the largest level, so the cycle does not allocate
+    *-----------------------------------------------------------------------*/
+
+   if (hypre_ParAMGDataFuseGridTransfer(amg_data) && !block_mode && !restri_type &&
+       hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_HOST)
+   {
+      HYPRE_Int num_threads    = hypre_NumThreads();
+      HYPRE_Int fuse_work_size = 0;
+
+      for (level = 0; level < num_levels - 1; level++)
+      {
+         fuse_work_size = hypre_max(fuse_work_size,
+                                    hypre_CSRMatrixNumCols(hypre_ParCSRMatrixDiag(P_array[level])) +
+                                    hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(P_array[level])));
+      }
+      fuse_work_size *= num_threads - 1;
+
+      hypre_TFree(hypre_ParAMGDataFuseWork(amg_data), HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataFuseWork(amg_data) = fuse_work_size > 0 ?
+                                           hypre_TAlloc(HYPRE_Complex, fuse_work_size, HYPRE_MEMORY_HOST) : NULL;
+      hypre_ParAMGDataFuseWorkSize(amg_data) = fuse_work_size;
+   }
+
    /*-----------------------------------------------------------------------
     * Print some stuff
     *-----------------------------------------------------------------------*/
@@ -3722,6 +3854,25 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    }
 #endif
 
+   /*-----------------------------------------------------------------------
+    * Store the grid transfer operators in single precision.  This is done
+    * last, since the setup and the output above need their values; the
+    * cycle only reads them through matvecs.
+    *-----------------------------------------------------------------------*/
+
+   if (hypre_ParAMGDataMixedPrecision(amg_data) && !block_mode &&
+       hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_HOST)
+   {
+      for (level = 0; level < num_levels - 1; level++)
+      {
+         hypre_ParCSRMatrixConvertToFloat(P_array[level]);
+         if (restri_type)
+         {
+            hypre_ParCSRMatrixConvertToFloat(R_array[level]);
+         }
+      }
+   }
+
    HYPRE_ANNOTATE_FUNC_END;
 
    return (hypre_error_flag);
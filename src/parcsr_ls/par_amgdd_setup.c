@@ -69,6 +69,16 @@ hypre_BoomerAMGDDSetup( void               *amgdd_vdata,
       hypre_BoomerAMGSetup((void*) amg_data, A, b, x);
    }
 
+   // The composite grids read the values of P and R, undo the single precision storage
+   for (level = 0; level < hypre_ParAMGDataNumLevels(amg_data) - 1; level++)
+   {
+      hypre_ParCSRMatrixConvertFromFloat(hypre_ParAMGDataPArray(amg_data)[level]);
+      if (hypre_ParAMGDataRestriction(amg_data))
+      {
+         hypre_ParCSRMatrixConvertFromFloat(hypre_ParAMGDataRArray(amg_data)[level]);
+      }
+   }
+
    // Get number of processes
    comm = hypre_ParCSRMatrixComm(A);
    hypre_MPI_Comm_size(comm, &num_procs);
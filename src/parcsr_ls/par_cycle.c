@@ -91,6 +91,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
    HYPRE_Int       smooth_num_levels;
    HYPRE_Int       my_id;
    HYPRE_Int       restri_type;
+   HYPRE_Int       fuse_grid_transfer;
    HYPRE_Real      alpha;
    hypre_Vector  **l1_norms = NULL;
    hypre_Vector   *l1_norms_level;
@@ -147,6 +148,11 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
    /* RL */
    restri_type = hypre_ParAMGDataRestriction(amg_data);
 
+   /* fused grid transfers: host, non-block, double precision and R = P^T only */
+   fuse_grid_transfer = hypre_ParAMGDataFuseGridTransfer(amg_data) && !block_mode && !restri_type &&
+                        !hypre_ParAMGDataMixedPrecision(amg_data) &&
+                        hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A_array[0])) == HYPRE_EXEC_HOST;
+
    partial_cycle_coarsest_level = hypre_ParAMGDataPartialCycleCoarsestLevel(amg_data);
    partial_cycle_control = hypre_ParAMGDataPartialCycleControl(amg_data);
 
@@ -675,54 +681,71 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          alpha = -1.0;
          beta = 1.0;
 
-         HYPRE_ANNOTATE_REGION_BEGIN("%s", "Residual");
+         if (fuse_grid_transfer)
+         {
+            /* f_c = P^T (f - A u) without storing the fine-grid residual */
+            HYPRE_ANNOTATE_REGION_BEGIN("%s", "Restriction");
 #if defined(HYPRE_USING_NVTX)
-         hypre_GpuProfilingPushRange("Residual");
+            hypre_GpuProfilingPushRange("Restriction");
 #endif
-         if (block_mode)
-         {
-            hypre_ParVectorCopy(F_array[fine_grid], Vtemp);
-            hypre_ParCSRBlockMatrixMatvec(alpha, A_block_array[fine_grid], U_array[fine_grid],
-                                          beta, Vtemp);
+            hypre_ParCSRMatrixResidualRestrict(A_array[fine_grid], R_array[fine_grid],
+                                               U_array[fine_grid], F_array[fine_grid],
+                                               F_array[coarse_grid],
+                                               hypre_ParAMGDataFuseWork(amg_data),
+                                               hypre_ParAMGDataFuseWorkSize(amg_data));
+            HYPRE_ANNOTATE_REGION_END("%s", "Restriction");
          }
          else
          {
-            // JSP: avoid unnecessary copy using out-of-place version of SpMV
-            hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A_array[fine_grid], U_array[fine_grid],
-                                               beta, F_array[fine_grid], Vtemp);
-         }
-         HYPRE_ANNOTATE_REGION_END("%s", "Residual");
+            HYPRE_ANNOTATE_REGION_BEGIN("%s", "Residual");
 #if defined(HYPRE_USING_NVTX)
-         hypre_GpuProfilingPopRange();
+            hypre_GpuProfilingPushRange("Residual");
+#endif
+            if (block_mode)
+            {
+               hypre_ParVectorCopy(F_array[fine_grid], Vtemp);
+               hypre_ParCSRBlockMatrixMatvec(alpha, A_block_array[fine_grid], U_array[fine_grid],
+                                             beta, Vtemp);
+            }
+            else
+            {
+               // JSP: avoid unnecessary copy using out-of-place version of SpMV
+               hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A_array[fine_grid], U_array[fine_grid],
+                                                  beta, F_array[fine_grid], Vtemp);
+            }
+            HYPRE_ANNOTATE_REGION_END("%s", "Residual");
+#if defined(HYPRE_USING_NVTX)
+            hypre_GpuProfilingPopRange();
 #endif
 
-         alpha = 1.0;
-         beta = 0.0;
+            alpha = 1.0;
+            beta = 0.0;
 
-         HYPRE_ANNOTATE_REGION_BEGIN("%s", "Restriction");
+            HYPRE_ANNOTATE_REGION_BEGIN("%s", "Restriction");
 #if defined(HYPRE_USING_NVTX)
-         hypre_GpuProfilingPushRange("Restriction");
+            hypre_GpuProfilingPushRange("Restriction");
 #endif
-         if (block_mode)
-         {
-            hypre_ParCSRBlockMatrixMatvecT(alpha, R_block_array[fine_grid], Vtemp,
-                                           beta, F_array[coarse_grid]);
-         }
-         else
-         {
-            if (restri_type)
+            if (block_mode)
             {
-               /* RL: no transpose for R */
-               hypre_ParCSRMatrixMatvec(alpha, R_array[fine_grid], Vtemp,
-                                        beta, F_array[coarse_grid]);
+               hypre_ParCSRBlockMatrixMatvecT(alpha, R_block_array[fine_grid], Vtemp,
+                                              beta, F_array[coarse_grid]);
             }
             else
             {
-               hypre_ParCSRMatrixMatvecT(alpha, R_array[fine_grid], Vtemp,
-                                         beta, F_array[coarse_grid]);
+               if (restri_type)
+               {
+                  /* RL: no transpose for R */
+                  hypre_ParCSRMatrixMatvec(alpha, R_array[fine_grid], Vtemp,
+                                           beta, F_array[coarse_grid]);
+               }
+               else
+               {
+                  hypre_ParCSRMatrixMatvecT(alpha, R_array[fine_grid], Vtemp,
+                                            beta, F_array[coarse_grid]);
+               }
             }
+            HYPRE_ANNOTATE_REGION_END("%s", "Restriction");
          }
-         HYPRE_ANNOTATE_REGION_END("%s", "Restriction");
          HYPRE_ANNOTATE_MGLEVEL_END(level);
 #if defined(HYPRE_USING_NVTX)
          hypre_GpuProfilingPopRange();
@@ -768,6 +791,11 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
                                           U_array[coarse_grid],
                                           beta, U_array[fine_grid]);
          }
+         else if (fuse_grid_transfer)
+         {
+            hypre_ParCSRMatrixInterpCorrect(P_array[fine_grid], U_array[coarse_grid],
+                                            U_array[fine_grid]);
+         }
          else
          {
             /* printf("Proc %d: level %d, n %d, Interpolation\n", my_id, level, local_size); */
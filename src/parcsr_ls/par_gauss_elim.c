@@ -16,6 +16,115 @@
  *
  *------------------------------------------------------------------------ */
 
+/*--------------------------------------------------------------------------
+ * hypre_GaussElimFactorNoPivot
+ *
+ * Factors the row-major n x n matrix A in place, without pivoting, the same
+ * way hypre_gselim eliminates it: U is kept in the upper triangle and the
+ * elimination factors in the strict lower triangle. Columns with a zero
+ * pivot are not eliminated, as in hypre_gselim.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_GaussElimFactorNoPivot( HYPRE_Real *A,
+                              HYPRE_Int   n )
+{
+   HYPRE_Int  j, k, m;
+   HYPRE_Real factor, divA;
+
+   for (k = 0; k < n - 1; k++)
+   {
+      if (A[k * n + k] != 0.0)
+      {
+         divA = 1.0 / A[k * n + k];
+         for (j = k + 1; j < n; j++)
+         {
+            if (A[j * n + k] != 0.0)
+            {
+               factor = A[j * n + k] * divA;
+               for (m = k + 1; m < n; m++)
+               {
+                  A[j * n + m] -= factor * A[k * n + m];
+               }
+               A[j * n + k] = factor;
+            }
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GaussElimSolveNoPivot
+ *
+ * Solves with the factors of hypre_GaussElimFactorNoPivot, overwriting x.
+ * Returns the same error count as hypre_gselim.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_GaussElimSolveNoPivot( HYPRE_Real *A,
+                             HYPRE_Real *x,
+                             HYPRE_Int   n )
+{
+   HYPRE_Int j, k;
+
+   if (n == 1)
+   {
+      if (A[0] == 0.0)
+      {
+         return 1;
+      }
+      x[0] = x[0] / A[0];
+
+      return 0;
+   }
+
+   /* Forward elimination */
+   for (k = 0; k < n - 1; k++)
+   {
+      if (A[k * n + k] != 0.0)
+      {
+         for (j = k + 1; j < n; j++)
+         {
+            if (A[j * n + k] != 0.0)
+            {
+               x[j] -= A[j * n + k] * x[k];
+            }
+         }
+      }
+   }
+
+   /* Back substitution */
+   for (k = n - 1; k > 0; --k)
+   {
+      if (A[k * n + k] != 0.0)
+      {
+         x[k] /= A[k * n + k];
+         for (j = 0; j < k; j++)
+         {
+            if (A[j * n + k] != 0.0)
+            {
+               x[j] -= x[k] * A[j * n + k];
+            }
+         }
+      }
+   }
+   if (A[0] != 0.0)
+   {
+      x[0] /= A[0];
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GaussElimSetup
+ *
+ * Gathers the coarse matrix on the ranks that own rows and factors it once;
+ * hypre_GaussElimSolve then only applies the factors.
+ *--------------------------------------------------------------------------*/
+
 HYPRE_Int hypre_GaussElimSetup (hypre_ParAMGData *amg_data, HYPRE_Int level, HYPRE_Int relax_type)
 {
 #ifdef HYPRE_PROFILE
@@ -122,6 +231,9 @@ HYPRE_Int hypre_GaussElimSetup (hypre_ParAMGData *amg_data, HYPRE_Int level, HYP
       {
          HYPRE_Real *AT_mat = hypre_CTAlloc(HYPRE_Real, global_num_rows * global_num_rows,
                                             HYPRE_MEMORY_HOST);
+         HYPRE_Int  *piv    = hypre_CTAlloc(HYPRE_Int, global_num_rows, HYPRE_MEMORY_HOST);
+         HYPRE_Int   my_info;
+
          for (i = 0; i < global_num_rows; i++)
          {
             for (jj = 0; jj < global_num_rows; jj++)
@@ -129,11 +241,17 @@ HYPRE_Int hypre_GaussElimSetup (hypre_ParAMGData *amg_data, HYPRE_Int level, HYP
                AT_mat[i * global_num_rows + jj] = A_mat[i + jj * global_num_rows];
             }
          }
+
+         /* write over AT_mat with LU */
+         hypre_dgetrf(&global_num_rows, &global_num_rows, AT_mat, &global_num_rows, piv, &my_info);
+
          hypre_ParAMGDataAMat(amg_data) = AT_mat;
+         hypre_ParAMGDataAPiv(amg_data) = piv;
          hypre_TFree(A_mat, HYPRE_MEMORY_HOST);
       }
       else if (relax_type == 9)
       {
+         hypre_GaussElimFactorNoPivot(A_mat, global_num_rows);
          hypre_ParAMGDataAMat(amg_data) = A_mat;
       }
       else if (relax_type == 199)
@@ -279,39 +397,26 @@ HYPRE_Int hypre_GaussElimSolve (hypre_ParAMGData *amg_data, HYPRE_Int level, HYP
 
       if (relax_type == 9 || relax_type == 99)
       {
+         /* A_mat was factored in hypre_GaussElimSetup */
          HYPRE_Real *A_mat = hypre_ParAMGDataAMat(amg_data);
-         HYPRE_Real *A_tmp;
          HYPRE_Int   i, my_info;
 
-         A_tmp = hypre_CTAlloc(HYPRE_Real, n_global * n_global, HYPRE_MEMORY_HOST);
-         for (i = 0; i < n_global * n_global; i++)
-         {
-            A_tmp[i] = A_mat[i];
-         }
-
          if (relax_type == 9)
          {
-            hypre_gselim(A_tmp, b_vec, n_global, error_flag);
+            error_flag = hypre_GaussElimSolveNoPivot(A_mat, b_vec, n_global);
          }
          else if (relax_type == 99) /* use pivoting */
          {
-            HYPRE_Int *piv = hypre_CTAlloc(HYPRE_Int, n_global, HYPRE_MEMORY_HOST);
-
-            /* write over A with LU */
-            hypre_dgetrf(&n_global, &n_global, A_tmp, &n_global, piv, &my_info);
+            HYPRE_Int *piv = hypre_ParAMGDataAPiv(amg_data);
 
             /* now b_vec = inv(A)*b_vec */
-            hypre_dgetrs("N", &n_global, &one_i, A_tmp, &n_global, piv, b_vec, &n_global, &my_info);
-
-            hypre_TFree(piv, HYPRE_MEMORY_HOST);
+            hypre_dgetrs("N", &n_global, &one_i, A_mat, &n_global, piv, b_vec, &n_global, &my_info);
          }
 
          for (i = 0; i < n; i++)
          {
             u_data_host[i] = b_vec[first_row_index + i];
          }
-
-         hypre_TFree(A_tmp, HYPRE_MEMORY_HOST);
       }
       else if (relax_type == 199)
       {
@@ -91,6 +91,7 @@ hypre_ILUCreate()
    hypre_ParILUDataOperatorComplexity(ilu_data) = 0.;
 
    hypre_ParILUDataIluType(ilu_data) = 0;
+   hypre_ParILUDataIterSetupMaxIter(ilu_data) = 5;
    hypre_ParILUDataNLU(ilu_data) = 0;
    hypre_ParILUDataNI(ilu_data) = 0;
    hypre_ParILUDataUEnd(ilu_data) = NULL;
@@ -98,6 +99,14 @@ hypre_ILUCreate()
    /* reordering_type default to use local RCM */
    hypre_ParILUDataReorderingType(ilu_data) = 1;
 
+   /* level schedules, built in setup when running with threads */
+   hypre_ParILUDataNumLowerLevels(ilu_data) = 0;
+   hypre_ParILUDataLowerLevelPtr(ilu_data) = NULL;
+   hypre_ParILUDataLowerLevelRows(ilu_data) = NULL;
+   hypre_ParILUDataNumUpperLevels(ilu_data) = 0;
+   hypre_ParILUDataUpperLevelPtr(ilu_data) = NULL;
+   hypre_ParILUDataUpperLevelRows(ilu_data) = NULL;
+
    /* see hypre_ILUSetType for more default values */
    hypre_ParILUDataTestOption(ilu_data) = 0;
 
@@ -317,6 +326,12 @@ hypre_ILUDestroy( void *data )
       hypre_ParILUDataUEnd(ilu_data) = NULL;
    }
 
+   /* level schedules */
+   hypre_TFree(hypre_ParILUDataLowerLevelPtr(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataLowerLevelRows(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataUpperLevelPtr(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataUpperLevelRows(ilu_data), HYPRE_MEMORY_HOST);
+
    /* Factors */
    if (hypre_ParILUDataMatL(ilu_data))
    {
@@ -589,6 +604,14 @@ hypre_ILUSetLocalReordering( void *ilu_vdata, HYPRE_Int ordering_type )
    hypre_ParILUDataReorderingType(ilu_data) = ordering_type;
    return hypre_error_flag;
 }
+/* Set number of sweeps for iterative ILU setup */
+HYPRE_Int
+hypre_ILUSetIterativeSetupMaxIter( void *ilu_vdata, HYPRE_Int max_iter )
+{
+   hypre_ParILUData   *ilu_data = (hypre_ParILUData*) ilu_vdata;
+   hypre_ParILUDataIterSetupMaxIter(ilu_data) = max_iter;
+   return hypre_error_flag;
+}
 
 /* Set KDim (for GMRES) for Solver of Schur System */
 HYPRE_Int
@@ -854,6 +877,12 @@ hypre_ILUWriteSolverParams(void *ilu_vdata)
          }
 #endif
          break;
+      case 2:
+         hypre_printf("Block Jacobi with iterative ILU(%d), %d sweeps \n", hypre_ParILUDataLfil(ilu_data),
+                      hypre_ParILUDataIterSetupMaxIter(ilu_data));
+         hypre_printf("Operator Complexity (Fill factor) = %f \n",
+                      hypre_ParILUDataOperatorComplexity(ilu_data));
+         break;
       case 1:
          hypre_printf("Block Jacobi with ILUT \n");
          hypre_printf("drop tolerance for B = %e, E&F = %e, S = %e \n", hypre_ParILUDataDroptol(ilu_data)[0],
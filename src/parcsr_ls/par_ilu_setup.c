@@ -285,6 +285,12 @@ hypre_ILUSetup( void               *ilu_vdata,
       hypre_TFree(CF_marker_array, HYPRE_MEMORY_HOST);
       CF_marker_array = NULL;
    }
+   hypre_TFree(hypre_ParILUDataLowerLevelPtr(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataLowerLevelRows(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataUpperLevelPtr(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataUpperLevelRows(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_ParILUDataNumLowerLevels(ilu_data) = 0;
+   hypre_ParILUDataNumUpperLevels(ilu_data) = 0;
 
 
    /* clear old l1_norm data, if created */
@@ -405,7 +411,7 @@ hypre_ILUSetup( void               *ilu_vdata,
          case 40: case 41:/* ddPQ */
             hypre_ILUGetPermddPQ(matA, &perm, &qperm, tol_ddPQ, &nLU, &nI, reordering_type);
             break;
-         case 0: case 1:
+         case 0: case 1: case 2:
             hypre_ILUGetLocalPerm(matA, &perm, &nLU, reordering_type);
             break;
          default:
@@ -437,6 +443,18 @@ hypre_ILUSetup( void               *ilu_vdata,
 #else
          hypre_ILUSetupILUK(matA, fill_level, perm, perm, n, n, &matL, &matD, &matU, &matS,
                             &u_end); //BJ + hypre_iluk()
+#endif
+         break;
+      case 2:
+#ifdef HYPRE_USING_CUDA
+         /* the iterative setup is host only, use the device ILU(k) */
+         hypre_ILUSetupILUKDevice(matA, fill_level, perm, perm, n, n, matL_des, matU_des, ilu_solve_policy,
+                                  &ilu_solve_buffer,
+                                  &matBL_info, &matBU_info, &matSL_info, &matSU_info, &matBLU_d, &matS,
+                                  &matE_d, &matF_d, &A_diag_fake);//BJ + hypre_iluk(), setup the device solve
+#else
+         hypre_ILUSetupILUKIter(matA, fill_level, perm, hypre_ParILUDataIterSetupMaxIter(ilu_data),
+                                &matL, &matD, &matU); //BJ + iterative hypre_iluk()
 #endif
          break;
       case 1:
@@ -524,6 +542,34 @@ hypre_ILUSetup( void               *ilu_vdata,
 #endif
          break;
    }
+
+#ifndef HYPRE_USING_CUDA
+   /* build level schedules of L and U once, so that the block-Jacobi and RAS
+    * triangular solves can process the rows of each level with threads */
+   if (hypre_NumThreads() > 1 && matL && matU)
+   {
+      switch (ilu_type)
+      {
+         case 10: case 11: case 20: case 21: case 40: case 41: case 50:
+            /* Schur complement solves, rows are processed sequentially */
+            break;
+         default:
+            hypre_ILUSetupLevelSchedule(hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(matL)),
+                                        hypre_CSRMatrixI(hypre_ParCSRMatrixDiag(matL)),
+                                        hypre_CSRMatrixJ(hypre_ParCSRMatrixDiag(matL)), 0,
+                                        &hypre_ParILUDataNumLowerLevels(ilu_data),
+                                        &hypre_ParILUDataLowerLevelPtr(ilu_data),
+                                        &hypre_ParILUDataLowerLevelRows(ilu_data));
+            hypre_ILUSetupLevelSchedule(hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(matU)),
+                                        hypre_CSRMatrixI(hypre_ParCSRMatrixDiag(matU)),
+                                        hypre_CSRMatrixJ(hypre_ParCSRMatrixDiag(matU)), 1,
+                                        &hypre_ParILUDataNumUpperLevels(ilu_data),
+                                        &hypre_ParILUDataUpperLevelPtr(ilu_data),
+                                        &hypre_ParILUDataUpperLevelRows(ilu_data));
+            break;
+      }
+   }
+#endif
    /* setup Schur solver */
    switch (ilu_type)
    {
@@ -1114,7 +1160,7 @@ hypre_ILUSetup( void               *ilu_vdata,
    {
       hypre_ParILUDataOperatorComplexity(ilu_data) =  1.0;
    }
-   else if (ilu_type == 0 || ilu_type == 1 || ilu_type == 10 || ilu_type == 11)
+   else if (ilu_type == 0 || ilu_type == 1 || ilu_type == 2 || ilu_type == 10 || ilu_type == 11)
    {
       if (matBLU_d)
       {
@@ -5085,6 +5131,412 @@ hypre_ILUSetupILUK(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Int *permp, HYPR
    return hypre_error_flag;
 }
 
+/* Merge two sorted sparse index lists and return the dot product of the
+ * matching entries. Used by the iterative ILU(k) sweeps below.
+ */
+static HYPRE_Real
+hypre_ILUSparseSortedDot(HYPRE_Int *ja, HYPRE_Real *va, HYPRE_Int na,
+                         HYPRE_Int *jb, HYPRE_Real *vb, HYPRE_Int nb)
+{
+   HYPRE_Int  ia = 0, ib = 0;
+   HYPRE_Real sum = 0.0;
+
+   while (ia < na && ib < nb)
+   {
+      if (ja[ia] == jb[ib])
+      {
+         sum += va[ia++] * vb[ib++];
+      }
+      else if (ja[ia] < jb[ib])
+      {
+         ia++;
+      }
+      else
+      {
+         ib++;
+      }
+   }
+
+   return sum;
+}
+
+/* Iterative ILU(k), fine-grained parallel variant of Chow and Patel.
+ * A: input matrix
+ * lfil: level of fill-in, the k in ILU(k)
+ * permp: permutation array indicating ordering of factorization. Perm could come from a
+ *    CF_marker: array or a reordering routine.
+ * max_iter: number of nonlinear Jacobi sweeps over the factor entries
+ * Lptr, Dptr, Uptr: L, D, U factors.
+ *
+ * The sparsity pattern comes from the (sequential) ILU(k) symbolic factorization.
+ * Every entry of L, D and U is then updated from the previous sweep only, so the
+ * rows can be processed concurrently and the result does not depend on the number
+ * of threads. With enough sweeps the factors converge to those of hypre_ILUSetupILUK.
+ * Only the full local block (nLU = n) is supported, no Schur complement is formed.
+ */
+HYPRE_Int
+hypre_ILUSetupILUKIter(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Int *permp, HYPRE_Int max_iter,
+                       hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr, hypre_ParCSRMatrix **Uptr)
+{
+   /*
+    * 1: Setup and create buffers
+    * L/U_diag_*: the pattern and values of L and U (U in CSR)
+    * Ut_*: the pattern of U in CSC, Ut_map maps a CSR slot of U to its CSC slot
+    * AL/AD/AU: entries of A on the pattern of L, D and U
+    * L/Uc/d_old, L/Uc/d_new: values of the previous and the current sweep
+    */
+   HYPRE_Real              local_nnz, total_nnz;
+   HYPRE_Int               i, ii, j, k, k1, k2, col, iter;
+   HYPRE_Int               *iw;
+   MPI_Comm                comm = hypre_ParCSRMatrixComm(A);
+
+   /* data objects for A */
+   hypre_CSRMatrix         *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real              *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int               *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int               *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+
+   /* data objects for L, D, U */
+   hypre_ParCSRMatrix      *matL;
+   hypre_ParCSRMatrix      *matU;
+   hypre_CSRMatrix         *L_diag;
+   hypre_CSRMatrix         *U_diag;
+   HYPRE_Real              *D_data;
+   HYPRE_Real              *L_diag_data   = NULL;
+   HYPRE_Int               *L_diag_i;
+   HYPRE_Int               *L_diag_j      = NULL;
+   HYPRE_Real              *U_diag_data   = NULL;
+   HYPRE_Int               *U_diag_i;
+   HYPRE_Int               *U_diag_j      = NULL;
+   HYPRE_Int               *S_diag_i;
+   HYPRE_Int               *S_diag_j      = NULL;
+   HYPRE_Int               *u_end         = NULL;
+
+   /* transpose of U and sweep buffers */
+   HYPRE_Int               *Ut_i;
+   HYPRE_Int               *Ut_j          = NULL;
+   HYPRE_Int               *Ut_map        = NULL;
+   HYPRE_Real              *AL            = NULL;
+   HYPRE_Real              *AU            = NULL;
+   HYPRE_Real              *AD;
+   HYPRE_Real              *L_old         = NULL;
+   HYPRE_Real              *L_new         = NULL;
+   HYPRE_Real              *Uc_old        = NULL;
+   HYPRE_Real              *Uc_new        = NULL;
+   HYPRE_Real              *d_old;
+   HYPRE_Real              *d_new;
+   HYPRE_Real              *swap;
+
+   /* problem size */
+   HYPRE_Int               n;
+   HYPRE_Int               nnz_L, nnz_U;
+
+   /* reverse permutation array */
+   HYPRE_Int               *rperm;
+   HYPRE_Int               *perm;
+
+   /* start setup */
+   n = hypre_CSRMatrixNumRows(A_diag);
+   if (max_iter < 0)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_ARG, "WARNING: negative number of iterative ILU sweeps.\n");
+      max_iter = 0;
+   }
+
+   D_data = hypre_CTAlloc(HYPRE_Real, n, HYPRE_MEMORY_DEVICE);
+   L_diag_i = hypre_CTAlloc(HYPRE_Int, (n + 1), HYPRE_MEMORY_DEVICE);
+   U_diag_i = hypre_CTAlloc(HYPRE_Int, (n + 1), HYPRE_MEMORY_DEVICE);
+   S_diag_i = hypre_CTAlloc(HYPRE_Int, 1, HYPRE_MEMORY_DEVICE);
+
+   /*
+    * 2: Symbolic factorization
+    * setup iw and rperm first
+    */
+   iw = hypre_CTAlloc(HYPRE_Int, 4 * n, HYPRE_MEMORY_HOST);
+   rperm = iw + 3 * n;
+
+   if (!permp)
+   {
+      perm = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_DEVICE);
+      for (i = 0; i < n; i++)
+      {
+         perm[i] = i;
+      }
+   }
+   else
+   {
+      perm = permp;
+   }
+
+   for (i = 0; i < n; i++)
+   {
+      rperm[perm[i]] = i;
+   }
+
+   hypre_ILUSetupILUKSymbolic(n, A_diag_i, A_diag_j, lfil, perm, rperm, iw,
+                              n, L_diag_i, U_diag_i, S_diag_i, &L_diag_j, &U_diag_j, &S_diag_j, &u_end);
+   hypre_TFree(u_end, HYPRE_MEMORY_HOST);
+   hypre_TFree(S_diag_j, HYPRE_MEMORY_DEVICE);
+   hypre_TFree(S_diag_i, HYPRE_MEMORY_DEVICE);
+
+   nnz_L = L_diag_i[n];
+   nnz_U = U_diag_i[n];
+
+   /* L rows are sorted by the symbolic factorization, U rows are not when nLU == n */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(ii) HYPRE_SMP_SCHEDULE
+#endif
+   for (ii = 0; ii < n; ii++)
+   {
+      hypre_qsort0(U_diag_j, U_diag_i[ii], U_diag_i[ii + 1] - 1);
+   }
+
+   /* build the CSC pattern of U, row indices in each column come out ascending */
+   Ut_i = hypre_CTAlloc(HYPRE_Int, (n + 1), HYPRE_MEMORY_HOST);
+   if (nnz_U)
+   {
+      Ut_j = hypre_TAlloc(HYPRE_Int, nnz_U, HYPRE_MEMORY_HOST);
+      Ut_map = hypre_TAlloc(HYPRE_Int, nnz_U, HYPRE_MEMORY_HOST);
+   }
+   for (j = 0; j < nnz_U; j++)
+   {
+      Ut_i[U_diag_j[j] + 1]++;
+   }
+   for (i = 0; i < n; i++)
+   {
+      Ut_i[i + 1] += Ut_i[i];
+      iw[i] = Ut_i[i];
+   }
+   for (ii = 0; ii < n; ii++)
+   {
+      for (j = U_diag_i[ii]; j < U_diag_i[ii + 1]; j++)
+      {
+         k = iw[U_diag_j[j]]++;
+         Ut_j[k] = ii;
+         Ut_map[j] = k;
+      }
+   }
+
+   /*
+    * 3: Copy A onto the pattern and set the initial guess
+    * L = a_ij / a_jj, D = a_ii, U = a_ij
+    */
+   if (nnz_L)
+   {
+      AL = hypre_CTAlloc(HYPRE_Real, nnz_L, HYPRE_MEMORY_HOST);
+      L_old = hypre_CTAlloc(HYPRE_Real, nnz_L, HYPRE_MEMORY_HOST);
+      L_new = hypre_CTAlloc(HYPRE_Real, nnz_L, HYPRE_MEMORY_HOST);
+   }
+   if (nnz_U)
+   {
+      AU = hypre_CTAlloc(HYPRE_Real, nnz_U, HYPRE_MEMORY_HOST);
+      Uc_old = hypre_CTAlloc(HYPRE_Real, nnz_U, HYPRE_MEMORY_HOST);
+      Uc_new = hypre_CTAlloc(HYPRE_Real, nnz_U, HYPRE_MEMORY_HOST);
+   }
+   AD = hypre_CTAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+   d_old = hypre_CTAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+   d_new = hypre_CTAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(ii, i, j, k, k1, col) HYPRE_SMP_SCHEDULE
+#endif
+   for (ii = 0; ii < n; ii++)
+   {
+      i = perm[ii];
+      for (j = A_diag_i[i]; j < A_diag_i[i + 1]; j++)
+      {
+         col = rperm[A_diag_j[j]];
+         if (col < ii)
+         {
+            k1 = L_diag_i[ii];
+            k = hypre_BinarySearch(L_diag_j + k1, col, L_diag_i[ii + 1] - k1);
+            AL[k1 + k] = A_diag_data[j];
+         }
+         else if (col == ii)
+         {
+            AD[ii] = A_diag_data[j];
+         }
+         else
+         {
+            k1 = U_diag_i[ii];
+            k = hypre_BinarySearch(U_diag_j + k1, col, U_diag_i[ii + 1] - k1);
+            AU[k1 + k] = A_diag_data[j];
+         }
+      }
+      d_old[ii] = fabs(AD[ii]) < MAT_TOL ? 1e-06 : AD[ii];
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(ii, j) HYPRE_SMP_SCHEDULE
+#endif
+   for (ii = 0; ii < n; ii++)
+   {
+      for (j = L_diag_i[ii]; j < L_diag_i[ii + 1]; j++)
+      {
+         L_old[j] = AL[j] / d_old[L_diag_j[j]];
+      }
+      for (j = U_diag_i[ii]; j < U_diag_i[ii + 1]; j++)
+      {
+         Uc_old[Ut_map[j]] = AU[j];
+      }
+   }
+
+   /*
+    * 4: Fixed-point sweeps
+    * l_ij = (a_ij - sum_{k<j} l_ik u_kj) / d_j
+    * d_i  =  a_ii - sum_{k<i} l_ik u_ki
+    * u_ij =  a_ij - sum_{k<i} l_ik u_kj
+    * all right-hand sides use the previous sweep
+    */
+   for (iter = 0; iter < max_iter; iter++)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(ii, j, k1, k2, col) HYPRE_SMP_SCHEDULE
+#endif
+      for (ii = 0; ii < n; ii++)
+      {
+         HYPRE_Real dpiv;
+
+         k1 = L_diag_i[ii];
+         k2 = L_diag_i[ii + 1];
+         for (j = k1; j < k2; j++)
+         {
+            col = L_diag_j[j];
+            dpiv = d_old[col];
+            if (fabs(dpiv) < MAT_TOL)
+            {
+               dpiv = 1e-06;
+            }
+            L_new[j] = (AL[j] - hypre_ILUSparseSortedDot(L_diag_j + k1, L_old + k1, j - k1,
+                                                          Ut_j + Ut_i[col], Uc_old + Ut_i[col],
+                                                          Ut_i[col + 1] - Ut_i[col])) / dpiv;
+         }
+         d_new[ii] = AD[ii] - hypre_ILUSparseSortedDot(L_diag_j + k1, L_old + k1, k2 - k1,
+                                                      Ut_j + Ut_i[ii], Uc_old + Ut_i[ii],
+                                                      Ut_i[ii + 1] - Ut_i[ii]);
+         for (j = U_diag_i[ii]; j < U_diag_i[ii + 1]; j++)
+         {
+            col = U_diag_j[j];
+            Uc_new[Ut_map[j]] = AU[j] - hypre_ILUSparseSortedDot(L_diag_j + k1, L_old + k1, k2 - k1,
+                                                                 Ut_j + Ut_i[col], Uc_old + Ut_i[col],
+                                                                 Ut_i[col + 1] - Ut_i[col]);
+         }
+      }
+      swap = L_old; L_old = L_new; L_new = swap;
+      swap = Uc_old; Uc_old = Uc_new; Uc_new = swap;
+      swap = d_old; d_old = d_new; d_new = swap;
+   }
+
+   /*
+    * 5: Finishing up and free
+    */
+   if (nnz_L)
+   {
+      L_diag_data = hypre_TAlloc(HYPRE_Real, nnz_L, HYPRE_MEMORY_DEVICE);
+   }
+   if (nnz_U)
+   {
+      U_diag_data = hypre_TAlloc(HYPRE_Real, nnz_U, HYPRE_MEMORY_DEVICE);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(ii, j) HYPRE_SMP_SCHEDULE
+#endif
+   for (ii = 0; ii < n; ii++)
+   {
+      for (j = L_diag_i[ii]; j < L_diag_i[ii + 1]; j++)
+      {
+         L_diag_data[j] = L_old[j];
+      }
+      for (j = U_diag_i[ii]; j < U_diag_i[ii + 1]; j++)
+      {
+         U_diag_data[j] = Uc_old[Ut_map[j]];
+      }
+      /* diagonal part (we store the inverse) */
+      D_data[ii] = fabs(d_old[ii]) < MAT_TOL ? 1e-06 : d_old[ii];
+      D_data[ii] = 1. / D_data[ii];
+   }
+
+   matL = hypre_ParCSRMatrixCreate( comm,
+                                    hypre_ParCSRMatrixGlobalNumRows(A),
+                                    hypre_ParCSRMatrixGlobalNumRows(A),
+                                    hypre_ParCSRMatrixRowStarts(A),
+                                    hypre_ParCSRMatrixColStarts(A),
+                                    0 /* num_cols_offd */,
+                                    nnz_L,
+                                    0 /* num_nonzeros_offd */);
+
+   L_diag = hypre_ParCSRMatrixDiag(matL);
+   hypre_CSRMatrixI(L_diag) = L_diag_i;
+   if (nnz_L > 0)
+   {
+      hypre_CSRMatrixData(L_diag) = L_diag_data;
+      hypre_CSRMatrixJ(L_diag) = L_diag_j;
+   }
+   else
+   {
+      /* we allocated some initial length, so free them */
+      hypre_TFree(L_diag_j, HYPRE_MEMORY_DEVICE);
+   }
+   /* store (global) total number of nonzeros */
+   local_nnz = (HYPRE_Real) nnz_L;
+   hypre_MPI_Allreduce(&local_nnz, &total_nnz, 1, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+   hypre_ParCSRMatrixDNumNonzeros(matL) = total_nnz;
+
+   matU = hypre_ParCSRMatrixCreate( comm,
+                                    hypre_ParCSRMatrixGlobalNumRows(A),
+                                    hypre_ParCSRMatrixGlobalNumRows(A),
+                                    hypre_ParCSRMatrixRowStarts(A),
+                                    hypre_ParCSRMatrixColStarts(A),
+                                    0,
+                                    nnz_U,
+                                    0 );
+
+   U_diag = hypre_ParCSRMatrixDiag(matU);
+   hypre_CSRMatrixI(U_diag) = U_diag_i;
+   if (nnz_U > 0)
+   {
+      hypre_CSRMatrixData(U_diag) = U_diag_data;
+      hypre_CSRMatrixJ(U_diag) = U_diag_j;
+   }
+   else
+   {
+      /* we allocated some initial length, so free them */
+      hypre_TFree(U_diag_j, HYPRE_MEMORY_DEVICE);
+   }
+   /* store (global) total number of nonzeros */
+   local_nnz = (HYPRE_Real) nnz_U;
+   hypre_MPI_Allreduce(&local_nnz, &total_nnz, 1, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+   hypre_ParCSRMatrixDNumNonzeros(matU) = total_nnz;
+
+   /* free */
+   hypre_TFree(iw, HYPRE_MEMORY_HOST);
+   hypre_TFree(Ut_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(Ut_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(Ut_map, HYPRE_MEMORY_HOST);
+   hypre_TFree(AL, HYPRE_MEMORY_HOST);
+   hypre_TFree(AD, HYPRE_MEMORY_HOST);
+   hypre_TFree(AU, HYPRE_MEMORY_HOST);
+   hypre_TFree(L_old, HYPRE_MEMORY_HOST);
+   hypre_TFree(L_new, HYPRE_MEMORY_HOST);
+   hypre_TFree(Uc_old, HYPRE_MEMORY_HOST);
+   hypre_TFree(Uc_new, HYPRE_MEMORY_HOST);
+   hypre_TFree(d_old, HYPRE_MEMORY_HOST);
+   hypre_TFree(d_new, HYPRE_MEMORY_HOST);
+
+   if (!permp)
+   {
+      hypre_TFree(perm, HYPRE_MEMORY_DEVICE);
+   }
+
+   /* set matrix pointers */
+   *Lptr = matL;
+   *Dptr = D_data;
+   *Uptr = matU;
+
+   return hypre_error_flag;
+}
+
 /* ILUT
  * A: input matrix
  * lfil: maximum nnz per row in L and U
@@ -8774,3 +9226,77 @@ hypre_ILUSetupILUTRAS(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Real *tol,
 
    return hypre_error_flag;
 }
+
+/* Level scheduling of a triangular factor for the threaded triangular solves
+ * n = number of rows of the factor
+ * A_i/A_j = the I and J slots of the (strictly) triangular factor, the
+ *    diagonal is not stored
+ * upper = 0 for the lower factor (forward solve), 1 for the upper factor
+ *    (backward solve)
+ * num_levelsp = pointer to the number of levels
+ * level_ptrp = pointer to the level start array, rows in level l are
+ *    level_rows[level_ptr[l]] to level_rows[level_ptr[l+1]-1]
+ * level_rowsp = pointer to the array of rows grouped by level
+ * Rows in one level only depend on rows of the previous levels, so they can
+ * be eliminated concurrently.
+ */
+HYPRE_Int
+hypre_ILUSetupLevelSchedule(HYPRE_Int n, HYPRE_Int *A_i, HYPRE_Int *A_j, HYPRE_Int upper,
+                            HYPRE_Int *num_levelsp, HYPRE_Int **level_ptrp, HYPRE_Int **level_rowsp)
+{
+   HYPRE_Int   i, ii, j, col, lev;
+   HYPRE_Int   num_levels = 0;
+   HYPRE_Int   *level;
+   HYPRE_Int   *level_ptr;
+   HYPRE_Int   *level_rows;
+
+   level      = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   level_rows = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+
+   /* level of a row is one plus the maximum level of the rows it depends on,
+    * visit the rows in elimination order */
+   for (ii = 0; ii < n; ii++)
+   {
+      i = upper ? n - 1 - ii : ii;
+      lev = 0;
+      for (j = A_i[i]; j < A_i[i + 1]; j++)
+      {
+         col = A_j[j];
+         if (col < n && level[col] + 1 > lev)
+         {
+            lev = level[col] + 1;
+         }
+      }
+      level[i] = lev;
+      num_levels = hypre_max(num_levels, lev + 1);
+   }
+
+   /* bucket rows by level, keeping the elimination order within each level */
+   level_ptr = hypre_CTAlloc(HYPRE_Int, num_levels + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < n; i++)
+   {
+      level_ptr[level[i] + 1]++;
+   }
+   for (lev = 0; lev < num_levels; lev++)
+   {
+      level_ptr[lev + 1] += level_ptr[lev];
+   }
+   for (ii = 0; ii < n; ii++)
+   {
+      i = upper ? n - 1 - ii : ii;
+      level_rows[level_ptr[level[i]]++] = i;
+   }
+   for (lev = num_levels; lev > 0; lev--)
+   {
+      level_ptr[lev] = level_ptr[lev - 1];
+   }
+   level_ptr[0] = 0;
+
+   hypre_TFree(level, HYPRE_MEMORY_HOST);
+
+   *num_levelsp = num_levels;
+   *level_ptrp  = level_ptr;
+   *level_rowsp = level_rows;
+
+   return hypre_error_flag;
+}
@@ -66,6 +66,14 @@ hypre_ILUSolve( void               *ilu_vdata,
 #endif
    hypre_ParCSRMatrix   *matS          = hypre_ParILUDataMatS(ilu_data);
 
+   /* level schedules of L and U, NULL if not built */
+   HYPRE_Int            num_lower_levels = hypre_ParILUDataNumLowerLevels(ilu_data);
+   HYPRE_Int            *lower_level_ptr = hypre_ParILUDataLowerLevelPtr(ilu_data);
+   HYPRE_Int            *lower_level_rows = hypre_ParILUDataLowerLevelRows(ilu_data);
+   HYPRE_Int            num_upper_levels = hypre_ParILUDataNumUpperLevels(ilu_data);
+   HYPRE_Int            *upper_level_ptr = hypre_ParILUDataUpperLevelPtr(ilu_data);
+   HYPRE_Int            *upper_level_rows = hypre_ParILUDataUpperLevelRows(ilu_data);
+
    HYPRE_Int            iter, num_procs,  my_id;
 
    hypre_ParVector      *F_array       = hypre_ParILUDataF(ilu_data);
@@ -246,14 +254,16 @@ hypre_ILUSolve( void               *ilu_vdata,
       /* Do one solve on LUe=r */
       switch (ilu_type)
       {
-         case 0: case 1:
+         case 0: case 1: case 2:
 #ifdef HYPRE_USING_CUDA
             /* Apply GPU-accelerated LU solve */
             hypre_ILUSolveCusparseLU(matA, matL_des, matU_des, matBL_info, matBU_info, matBLU_d,
                                      ilu_solve_policy,
                                      ilu_solve_buffer, F_array, U_array, perm, n, Utemp, Ftemp);//BJ-cusparse
 #else
-            hypre_ILUSolveLU(matA, F_array, U_array, perm, n, matL, matD, matU, Utemp, Ftemp); //BJ
+            hypre_ILUSolveLU(matA, F_array, U_array, perm, n, matL, matD, matU, Utemp, Ftemp,
+                             num_lower_levels, lower_level_ptr, lower_level_rows,
+                             num_upper_levels, upper_level_ptr, upper_level_rows); //BJ
 #endif
             break;
          case 10: case 11:
@@ -273,7 +283,9 @@ hypre_ILUSolve( void               *ilu_vdata,
                                    Utemp, Ftemp, schur_solver, rhs, x, u_end); //MR+NSH
             break;
          case 30: case 31:
-            hypre_ILUSolveLURAS(matA, F_array, U_array, perm, matL, matD, matU, Utemp, Utemp, fext, uext); //RAS
+            hypre_ILUSolveLURAS(matA, F_array, U_array, perm, matL, matD, matU, Utemp, Utemp, fext, uext,
+                                num_lower_levels, lower_level_ptr, lower_level_rows,
+                                num_upper_levels, upper_level_ptr, upper_level_rows); //RAS
             break;
          case 40: case 41:
             hypre_ILUSolveSchurGMRES(matA, F_array, U_array, perm, qperm, nLU, matL, matD, matU, matS,
@@ -299,7 +311,9 @@ hypre_ILUSolve( void               *ilu_vdata,
                                      ilu_solve_policy,
                                      ilu_solve_buffer, F_array, U_array, perm, n, Utemp, Ftemp);//BJ-cusparse
 #else
-            hypre_ILUSolveLU(matA, F_array, U_array, perm, n, matL, matD, matU, Utemp, Ftemp); //BJ
+            hypre_ILUSolveLU(matA, F_array, U_array, perm, n, matL, matD, matU, Utemp, Ftemp,
+                             num_lower_levels, lower_level_ptr, lower_level_rows,
+                             num_upper_levels, upper_level_ptr, upper_level_rows); //BJ
 #endif
             break;
 
@@ -724,6 +738,10 @@ hypre_ILUSolveSchurNSH(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
  * L, D and U factors only have local scope (no off-diagonal processor terms)
  * so apart from the residual calculation (which uses A), the solves with the
  * L and U factors are local.
+ * lower/upper_level_ptr and lower/upper_level_rows are the level schedules of
+ * L and U built in setup (see hypre_ILUSetupLevelSchedule). When they are
+ * given, the rows of each level are solved concurrently by the threads.
+ * Pass NULL for the sequential row-by-row solve.
 */
 
 HYPRE_Int
@@ -731,7 +749,9 @@ hypre_ILUSolveLU(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
                  hypre_ParVector    *u, HYPRE_Int *perm,
                  HYPRE_Int nLU, hypre_ParCSRMatrix *L,
                  HYPRE_Real* D, hypre_ParCSRMatrix *U,
-                 hypre_ParVector *ftemp, hypre_ParVector *utemp)
+                 hypre_ParVector *ftemp, hypre_ParVector *utemp,
+                 HYPRE_Int num_lower_levels, HYPRE_Int *lower_level_ptr, HYPRE_Int *lower_level_rows,
+                 HYPRE_Int num_upper_levels, HYPRE_Int *upper_level_ptr, HYPRE_Int *upper_level_rows)
 {
    hypre_CSRMatrix *L_diag = hypre_ParCSRMatrixDiag(L);
    HYPRE_Real      *L_diag_data = hypre_CSRMatrixData(L_diag);
@@ -751,7 +771,8 @@ hypre_ILUSolveLU(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
 
    HYPRE_Real      alpha;
    HYPRE_Real      beta;
-   HYPRE_Int       i, j, k1, k2;
+   HYPRE_Real      sum;
+   HYPRE_Int       i, ii, j, k1, k2, lev;
 
    /* begin */
    alpha = -1.0;
@@ -765,6 +786,51 @@ hypre_ILUSolveLU(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
    /* compute residual */
    hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A, u, beta, f, ftemp);
 
+   if (lower_level_ptr && upper_level_ptr)
+   {
+      /* L solve - Forward solve, level by level */
+      for (lev = 0; lev < num_lower_levels; lev++)
+      {
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(ii,i,j,sum) HYPRE_SMP_SCHEDULE
+#endif
+         for (ii = lower_level_ptr[lev]; ii < lower_level_ptr[lev + 1]; ii++)
+         {
+            i = lower_level_rows[ii];
+            sum = ftemp_data[perm[i]];
+            for (j = L_diag_i[i]; j < L_diag_i[i + 1]; j++)
+            {
+               sum -= L_diag_data[j] * utemp_data[perm[L_diag_j[j]]];
+            }
+            utemp_data[perm[i]] = sum;
+         }
+      }
+
+      /* U solve - Backward substitution, level by level */
+      for (lev = 0; lev < num_upper_levels; lev++)
+      {
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(ii,i,j,sum) HYPRE_SMP_SCHEDULE
+#endif
+         for (ii = upper_level_ptr[lev]; ii < upper_level_ptr[lev + 1]; ii++)
+         {
+            i = upper_level_rows[ii];
+            sum = utemp_data[perm[i]];
+            for (j = U_diag_i[i]; j < U_diag_i[i + 1]; j++)
+            {
+               sum -= U_diag_data[j] * utemp_data[perm[U_diag_j[j]]];
+            }
+            /* diagonal scaling (contribution from D. Note: D is stored as its inverse) */
+            utemp_data[perm[i]] = sum * D[i];
+         }
+      }
+
+      /* Update solution */
+      hypre_ParVectorAxpy(beta, utemp, u);
+
+      return hypre_error_flag;
+   }
+
    /* L solve - Forward solve */
    /* copy rhs to account for diagonal of L (which is identity) */
    for ( i = 0; i < nLU; i++ )
@@ -806,6 +872,8 @@ hypre_ILUSolveLU(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
  * so apart from the residual calculation (which uses A), the solves with the
  * L and U factors are local.
  * fext and uext are tempory arrays for external data
+ * lower/upper_level_ptr and lower/upper_level_rows are the optional level
+ * schedules of L and U, see hypre_ILUSolveLU.
 */
 
 HYPRE_Int
@@ -814,7 +882,9 @@ hypre_ILUSolveLURAS(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
                     hypre_ParCSRMatrix *L,
                     HYPRE_Real* D, hypre_ParCSRMatrix *U,
                     hypre_ParVector *ftemp, hypre_ParVector *utemp,
-                    HYPRE_Real *fext, HYPRE_Real *uext)
+                    HYPRE_Real *fext, HYPRE_Real *uext,
+                    HYPRE_Int num_lower_levels, HYPRE_Int *lower_level_ptr, HYPRE_Int *lower_level_rows,
+                    HYPRE_Int num_upper_levels, HYPRE_Int *upper_level_ptr, HYPRE_Int *upper_level_rows)
 {
 
    hypre_ParCSRCommPkg        *comm_pkg;
@@ -848,7 +918,8 @@ hypre_ILUSolveLURAS(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
 
    HYPRE_Real                 alpha;
    HYPRE_Real                 beta;
-   HYPRE_Int                  i, j, k1, k2;
+   HYPRE_Real                 sum;
+   HYPRE_Int                  i, ii, j, k1, k2, lev;
 
    /* begin */
    alpha = -1.0;
@@ -893,6 +964,67 @@ hypre_ILUSolveLURAS(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
    comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, uext, fext);
    hypre_ParCSRCommHandleDestroy(comm_handle);
 
+   if (lower_level_ptr && upper_level_ptr)
+   {
+      /* L solve - Forward solve, level by level */
+      for (lev = 0; lev < num_lower_levels; lev++)
+      {
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(ii,i,j,col,sum) HYPRE_SMP_SCHEDULE
+#endif
+         for (ii = lower_level_ptr[lev]; ii < lower_level_ptr[lev + 1]; ii++)
+         {
+            i = lower_level_rows[ii];
+            sum = (i < n) ? ftemp_data[perm[i]] : fext[i - n];
+            for (j = L_diag_i[i]; j < L_diag_i[i + 1]; j++)
+            {
+               col = L_diag_j[j];
+               sum -= L_diag_data[j] * ((col < n) ? utemp_data[perm[col]] : uext[col - n]);
+            }
+            if (i < n)
+            {
+               utemp_data[perm[i]] = sum;
+            }
+            else
+            {
+               uext[i - n] = sum;
+            }
+         }
+      }
+
+      /* U solve - Backward substitution, level by level */
+      for (lev = 0; lev < num_upper_levels; lev++)
+      {
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(ii,i,j,col,sum) HYPRE_SMP_SCHEDULE
+#endif
+         for (ii = upper_level_ptr[lev]; ii < upper_level_ptr[lev + 1]; ii++)
+         {
+            i = upper_level_rows[ii];
+            sum = (i < n) ? utemp_data[perm[i]] : uext[i - n];
+            for (j = U_diag_i[i]; j < U_diag_i[i + 1]; j++)
+            {
+               col = U_diag_j[j];
+               sum -= U_diag_data[j] * ((col < n) ? utemp_data[perm[col]] : uext[col - n]);
+            }
+            /* diagonal scaling (contribution from D. Note: D is stored as its inverse) */
+            if (i < n)
+            {
+               utemp_data[perm[i]] = sum * D[i];
+            }
+            else
+            {
+               uext[i - n] = sum * D[i];
+            }
+         }
+      }
+
+      /* Update solution */
+      hypre_ParVectorAxpy(beta, utemp, u);
+
+      return hypre_error_flag;
+   }
+
    /* L solve - Forward solve */
    for ( i = 0 ; i < n_total ; i ++)
    {
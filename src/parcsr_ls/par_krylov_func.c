@@ -176,6 +176,39 @@ hypre_ParKrylovInnerProd( void *x,
                                       (hypre_ParVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovInnerProdLocal
+ *
+ * Inner product of the locally owned parts only; to be summed with
+ * hypre_ParKrylovIAllreduce.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_ParKrylovInnerProdLocal( void *x,
+                               void *y )
+{
+   return ( hypre_SeqVectorInnerProd(hypre_ParVectorLocalVector((hypre_ParVector *) x),
+                                     hypre_ParVectorLocalVector((hypre_ParVector *) y)) );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovIAllreduce
+ *
+ * Start a nonblocking sum of count local inner products over the
+ * communicator of x.  Complete it with hypre_MPI_Wait.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovIAllreduce( void              *x,
+                           HYPRE_Real        *sendbuf,
+                           HYPRE_Real        *recvbuf,
+                           HYPRE_Int          count,
+                           hypre_MPI_Request *request )
+{
+   return hypre_MPI_Iallreduce(sendbuf, recvbuf, count, HYPRE_MPI_REAL, hypre_MPI_SUM,
+                               hypre_ParVectorComm((hypre_ParVector *) x), request);
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParKrylovMassInnerProd
  *--------------------------------------------------------------------------*/
@@ -262,6 +295,39 @@ hypre_ParKrylovMassAxpy( HYPRE_Complex *alpha,
                                      (hypre_ParVector *) y, k, unroll));
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovBlockInnerProd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovBlockInnerProd( HYPRE_Int       nx,
+                               void          **x,
+                               HYPRE_Int       ny,
+                               void          **y,
+                               HYPRE_Int       ld,
+                               HYPRE_Complex  *result )
+{
+   return ( hypre_ParVectorBlockInnerProd( nx, (hypre_ParVector **) x,
+                                           ny, (hypre_ParVector **) y, ld, result ) );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovBlockAxpy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovBlockAxpy( HYPRE_Int       nx,
+                          void          **x,
+                          HYPRE_Int       ny,
+                          void          **y,
+                          HYPRE_Int       ld,
+                          HYPRE_Complex  *coef,
+                          HYPRE_Complex   beta )
+{
+   return ( hypre_ParVectorBlockAxpy( nx, (hypre_ParVector **) x,
+                                      ny, (hypre_ParVector **) y, ld, coef, beta ) );
+}
+
 
 
 /*--------------------------------------------------------------------------
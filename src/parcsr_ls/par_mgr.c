@@ -464,6 +464,7 @@ hypre_MGRCreateGSElimData()
    hypre_ParAMGDataGSSetup(gsdata) = 0;
    hypre_ParAMGDataAMat(gsdata) = NULL;
    hypre_ParAMGDataAInv(gsdata) = NULL;
+   hypre_ParAMGDataAPiv(gsdata) = NULL;
    hypre_ParAMGDataBVec(gsdata) = NULL;
    hypre_ParAMGDataCommInfo(gsdata) = NULL;
 
@@ -478,6 +479,7 @@ hypre_MGRDestroyGSElimData( void *data )
 
    if (hypre_ParAMGDataAMat(gsdata)) { hypre_TFree(hypre_ParAMGDataAMat(gsdata), HYPRE_MEMORY_HOST); }
    if (hypre_ParAMGDataAInv(gsdata)) { hypre_TFree(hypre_ParAMGDataAInv(gsdata), HYPRE_MEMORY_HOST); }
+   if (hypre_ParAMGDataAPiv(gsdata)) { hypre_TFree(hypre_ParAMGDataAPiv(gsdata), HYPRE_MEMORY_HOST); }
    if (hypre_ParAMGDataBVec(gsdata)) { hypre_TFree(hypre_ParAMGDataBVec(gsdata), HYPRE_MEMORY_HOST); }
    if (hypre_ParAMGDataCommInfo(gsdata)) { hypre_TFree(hypre_ParAMGDataCommInfo(gsdata), HYPRE_MEMORY_HOST); }
 
@@ -514,6 +516,7 @@ hypre_MGRCreateFrelaxVcycleData()
    hypre_ParAMGDataGSSetup(vdata) = 0;
    hypre_ParAMGDataAMat(vdata) = NULL;
    hypre_ParAMGDataAInv(vdata) = NULL;
+   hypre_ParAMGDataAPiv(vdata) = NULL;
    hypre_ParAMGDataBVec(vdata) = NULL;
    hypre_ParAMGDataCommInfo(vdata) = NULL;
 
@@ -571,6 +574,7 @@ hypre_MGRDestroyFrelaxVcycleData( void *data )
 
    if (hypre_ParAMGDataAMat(vdata)) { hypre_TFree(hypre_ParAMGDataAMat(vdata), HYPRE_MEMORY_HOST); }
    if (hypre_ParAMGDataAInv(vdata)) { hypre_TFree(hypre_ParAMGDataAInv(vdata), HYPRE_MEMORY_HOST); }
+   if (hypre_ParAMGDataAPiv(vdata)) { hypre_TFree(hypre_ParAMGDataAPiv(vdata), HYPRE_MEMORY_HOST); }
    if (hypre_ParAMGDataBVec(vdata)) { hypre_TFree(hypre_ParAMGDataBVec(vdata), HYPRE_MEMORY_HOST); }
    if (hypre_ParAMGDataCommInfo(vdata)) { hypre_TFree(hypre_ParAMGDataCommInfo(vdata), HYPRE_MEMORY_HOST); }
 
@@ -4163,10 +4167,7 @@ HYPRE_Int
 hypre_BlockDiagInvLapack(HYPRE_Real *diag, HYPRE_Int N, HYPRE_Int blk_size)
 {
    HYPRE_Int nblock, left_size, i;
-   //HYPRE_Int *IPIV = hypre_CTAlloc(HYPRE_Int, blk_size, HYPRE_MEMORY_HOST);
-   HYPRE_Int LWORK = blk_size * blk_size;
-   HYPRE_Real *WORK = hypre_CTAlloc(HYPRE_Real, LWORK, HYPRE_MEMORY_HOST);
-   HYPRE_Int INFO;
+   HYPRE_Int bs2 = blk_size * blk_size;
 
    HYPRE_Real wall_time;
    HYPRE_Int my_id;
@@ -4175,38 +4176,30 @@ hypre_BlockDiagInvLapack(HYPRE_Real *diag, HYPRE_Int N, HYPRE_Int blk_size)
 
    nblock = N / blk_size;
    left_size = N - blk_size * nblock;
-   HYPRE_Int *IPIV = hypre_CTAlloc(HYPRE_Int, blk_size, HYPRE_MEMORY_HOST);
 
    wall_time = time_getWallclockSeconds();
    if (blk_size >= 2 && blk_size <= 4)
    {
       for (i = 0; i < nblock; i++)
       {
-         hypre_MGRSmallBlkInverse(diag + i * LWORK, blk_size);
-         //hypre_blas_smat_inv_n2(diag+i*LWORK);
+         hypre_MGRSmallBlkInverse(diag + i * bs2, blk_size);
+         //hypre_blas_smat_inv_n2(diag+i*bs2);
       }
    }
    else if (blk_size > 4)
    {
-      for (i = 0; i < nblock; i++)
-      {
-         hypre_dgetrf(&blk_size, &blk_size, diag + i * LWORK, &blk_size, IPIV, &INFO);
-         hypre_dgetri(&blk_size, diag + i * LWORK, &blk_size, IPIV, WORK, &LWORK, &INFO);
-      }
+      /* Invert all blocks in one batched call instead of dgetrf/dgetri per block */
+      hypre_DenseInverseBatched(blk_size, blk_size, bs2, nblock, diag);
    }
 
    // Left size
    if (left_size > 0)
    {
-      hypre_dgetrf(&left_size, &left_size, diag + i * LWORK, &left_size, IPIV, &INFO);
-      hypre_dgetri(&left_size, diag + i * LWORK, &left_size, IPIV, WORK, &LWORK, &INFO);
+      hypre_DenseInverseBatched(left_size, left_size, 0, 1, diag + nblock * bs2);
    }
    wall_time = time_getWallclockSeconds() - wall_time;
    //if (my_id == 0) hypre_printf("Proc = %d, Compute inverse time: %1.5f\n", my_id, wall_time);
 
-   hypre_TFree(IPIV, HYPRE_MEMORY_HOST);
-   hypre_TFree(WORK, HYPRE_MEMORY_HOST);
-
    return hypre_error_flag;
 }
 // Extract the block diagonal part of a A or a principal submatrix of A defined by a marker (point_type)
@@ -56,6 +56,10 @@ hypre_SchwarzCreate()
    hypre_SchwarzDataScale(schwarz_data) = NULL;
    hypre_SchwarzDataVtemp(schwarz_data) = NULL;
    hypre_SchwarzDataDofFunc(schwarz_data) = NULL;
+   hypre_SchwarzDataNumColors(schwarz_data) = 0;
+   hypre_SchwarzDataColorStarts(schwarz_data) = NULL;
+   hypre_SchwarzDataColorDomains(schwarz_data) = NULL;
+   hypre_SchwarzDataBlockStarts(schwarz_data) = NULL;
 
    return (void *) schwarz_data;
 }
@@ -88,7 +92,9 @@ hypre_SchwarzDestroy( void *data )
    {
       hypre_TFree(hypre_SchwarzDataPivots(schwarz_data), HYPRE_MEMORY_HOST);
    }
-
+   hypre_TFree(hypre_SchwarzDataColorStarts(schwarz_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_SchwarzDataColorDomains(schwarz_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_SchwarzDataBlockStarts(schwarz_data), HYPRE_MEMORY_HOST);
 
    hypre_TFree(schwarz_data, HYPRE_MEMORY_HOST);
    return hypre_error_flag;
@@ -178,6 +184,33 @@ hypre_SchwarzSetup(void               *schwarz_vdata,
    hypre_SchwarzDataDomainStructure(schwarz_data) = domain_structure;
    hypre_SchwarzDataPivots(schwarz_data) = pivots;
 
+   /* color the domains, so that the multiplicative variants can update
+      the domains of one color concurrently */
+   if (domain_structure && (variant == 0 || variant == 3) && hypre_NumThreads() > 1)
+   {
+      if (variant == 3)
+      {
+         hypre_SchwarzDomainColoring(domain_structure,
+                                     hypre_ParCSRMatrixDiag(A),
+                                     hypre_ParCSRMatrixOffd(A),
+                                     hypre_SchwarzDataABoundary(schwarz_data),
+                                     &hypre_SchwarzDataNumColors(schwarz_data),
+                                     &hypre_SchwarzDataColorStarts(schwarz_data),
+                                     &hypre_SchwarzDataColorDomains(schwarz_data));
+      }
+      else
+      {
+         hypre_SchwarzDomainColoring(domain_structure,
+                                     hypre_ParCSRMatrixDiag(A), NULL, NULL,
+                                     &hypre_SchwarzDataNumColors(schwarz_data),
+                                     &hypre_SchwarzDataColorStarts(schwarz_data),
+                                     &hypre_SchwarzDataColorDomains(schwarz_data));
+      }
+      hypre_SchwarzDomainBlockStarts(hypre_CSRMatrixNumRows(domain_structure),
+                                     hypre_CSRMatrixI(domain_structure),
+                                     &hypre_SchwarzDataBlockStarts(schwarz_data));
+   }
+
    return hypre_error_flag;
 
 }
@@ -204,6 +237,10 @@ hypre_SchwarzSolve(void               *schwarz_vdata,
    HYPRE_Int use_nonsymm = hypre_SchwarzDataUseNonSymm(schwarz_data);
 
    HYPRE_Int *pivots = hypre_SchwarzDataPivots(schwarz_data);
+   HYPRE_Int num_colors = hypre_SchwarzDataNumColors(schwarz_data);
+   HYPRE_Int *color_starts = hypre_SchwarzDataColorStarts(schwarz_data);
+   HYPRE_Int *color_domains = hypre_SchwarzDataColorDomains(schwarz_data);
+   HYPRE_Int *block_starts = hypre_SchwarzDataBlockStarts(schwarz_data);
 
    if (domain_structure)
    {
@@ -214,7 +251,8 @@ hypre_SchwarzSolve(void               *schwarz_vdata,
       else if (variant == 3)
       {
          hypre_ParMPSchwarzSolve(A, A_boundary, f, domain_structure, u,
-                                 relax_wt, scale, Vtemp, pivots, use_nonsymm);
+                                 relax_wt, scale, Vtemp, pivots, use_nonsymm,
+                                 num_colors, color_starts, color_domains, block_starts);
       }
       else if (variant == 1)
       {
@@ -230,7 +268,8 @@ hypre_SchwarzSolve(void               *schwarz_vdata,
       {
          hypre_MPSchwarzSolve(A, hypre_ParVectorLocalVector(f),
                               domain_structure, u, relax_wt,
-                              hypre_ParVectorLocalVector(Vtemp), pivots, use_nonsymm);
+                              hypre_ParVectorLocalVector(Vtemp), pivots, use_nonsymm,
+                              num_colors, color_starts, color_domains, block_starts);
       }
    }
 
@@ -20,6 +20,264 @@
    B can be used to define strength matrix;
    ----------------------------------------------------------------------- */
 
+/*--------------------------------------------------------------------------
+ * hypre_SchwarzDomainBlockStarts
+ *
+ * The dense domain matrices are stored one after the other in the data
+ * array of the domain structure.  Returns the offset of each of them
+ * (num_domains + 1 entries), so that the blocks can be accessed in any order.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SchwarzDomainBlockStarts( HYPRE_Int   num_domains,
+                                HYPRE_Int  *i_domain_dof,
+                                HYPRE_Int **block_starts_ptr )
+{
+   HYPRE_Int *block_starts = hypre_TAlloc(HYPRE_Int, num_domains + 1, HYPRE_MEMORY_HOST);
+   HYPRE_Int  i, size;
+
+   block_starts[0] = 0;
+   for (i = 0; i < num_domains; i++)
+   {
+      size = i_domain_dof[i + 1] - i_domain_dof[i];
+      block_starts[i + 1] = block_starts[i] + size * size;
+   }
+
+   *block_starts_ptr = block_starts;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SchwarzFactorDomainBlocks
+ *
+ * Factors all domain matrices of the contiguous arena 'blocks' in place
+ * (Cholesky, or LU when use_nonsymm is set, with the pivots of domain i at
+ * piv[i_domain_dof[i]]).  The blocks are independent, so they are factored
+ * as one batch by a threaded loop.  The number of blocks whose factorization
+ * failed is returned in num_failed_ptr.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SchwarzFactorDomainBlocks( HYPRE_Int   num_domains,
+                                 HYPRE_Int  *i_domain_dof,
+                                 HYPRE_Int  *block_starts,
+                                 HYPRE_Real *blocks,
+                                 HYPRE_Int  *piv,
+                                 HYPRE_Int   use_nonsymm,
+                                 HYPRE_Int  *num_failed_ptr )
+{
+   HYPRE_Int i, size, ierr;
+   HYPRE_Int num_failed = 0;
+   char      uplo = 'L';
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, size, ierr) reduction(+:num_failed) schedule(dynamic)
+#endif
+   for (i = 0; i < num_domains; i++)
+   {
+      size = i_domain_dof[i + 1] - i_domain_dof[i];
+      ierr = 0;
+      if (use_nonsymm)
+      {
+         hypre_dgetrf(&size, &size, &blocks[block_starts[i]], &size,
+                      &piv[i_domain_dof[i]], &ierr);
+      }
+      else
+      {
+         hypre_dpotrf(&uplo, &size, &blocks[block_starts[i]], &size, &ierr);
+      }
+      if (ierr)
+      {
+         num_failed++;
+      }
+   }
+
+   if (num_failed_ptr)
+   {
+      *num_failed_ptr = num_failed;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SchwarzDomainColoring
+ *
+ * Colors the domains for the threaded multiplicative Schwarz sweeps.  The
+ * update of a domain writes x on its dofs and reads x on their neighbors,
+ * so two domains get different colors if one of them contains a dof of the
+ * other or a neighbor (in either direction) of one of its dofs.  Domains of
+ * one color can then be updated concurrently, and a sweep over the colors
+ * is a multiplicative Schwarz sweep with the domains reordered by color.
+ *
+ * The dofs are the local rows of A_diag followed, if A_offd is given, by
+ * the external columns of A_offd, whose rows are taken from A_boundary (see
+ * hypre_ParMPSchwarzSolve).  The coloring is greedy in domain order, and
+ * the domains of each color are listed in increasing order.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SchwarzDomainColoring( hypre_CSRMatrix  *domain_structure,
+                             hypre_CSRMatrix  *A_diag,
+                             hypre_CSRMatrix  *A_offd,
+                             hypre_CSRMatrix  *A_boundary,
+                             HYPRE_Int        *num_colors_ptr,
+                             HYPRE_Int       **color_starts_ptr,
+                             HYPRE_Int       **color_domains_ptr )
+{
+   HYPRE_Int  num_domains   = hypre_CSRMatrixNumRows(domain_structure);
+   HYPRE_Int *i_domain_dof  = hypre_CSRMatrixI(domain_structure);
+   HYPRE_Int *j_domain_dof  = hypre_CSRMatrixJ(domain_structure);
+   HYPRE_Int  num_variables = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int  num_cols_offd = A_offd ? hypre_CSRMatrixNumCols(A_offd) : 0;
+   HYPRE_Int  num_dofs      = num_variables + num_cols_offd;
+
+   HYPRE_Int *i_dof_domain, *j_dof_domain;
+   HYPRE_Int *S_i, *S_j, *ST_i, *ST_j;
+   HYPRE_Int *color, *forbidden;
+   HYPRE_Int *color_starts, *color_domains;
+   HYPRE_Int  num_colors = 0;
+   HYPRE_Int  i, j, k, l, d, c, dof, sweep;
+
+   /* dof -> domain graph */
+   transpose_matrix_create(&i_dof_domain, &j_dof_domain, i_domain_dof, j_domain_dof,
+                           num_domains, num_dofs);
+
+   /* dof -> dof graph read by the updates, and its transpose */
+   S_i = hypre_CTAlloc(HYPRE_Int, num_dofs + 1, HYPRE_MEMORY_HOST);
+   for (d = 0; d < num_dofs; d++)
+   {
+      if (d < num_variables)
+      {
+         S_i[d + 1] = S_i[d] + hypre_CSRMatrixI(A_diag)[d + 1] - hypre_CSRMatrixI(A_diag)[d];
+         if (num_cols_offd)
+         {
+            S_i[d + 1] += hypre_CSRMatrixI(A_offd)[d + 1] - hypre_CSRMatrixI(A_offd)[d];
+         }
+      }
+      else
+      {
+         S_i[d + 1] = S_i[d];
+         if (A_boundary)
+         {
+            l = d - num_variables;
+            S_i[d + 1] += hypre_CSRMatrixI(A_boundary)[l + 1] - hypre_CSRMatrixI(A_boundary)[l];
+         }
+      }
+   }
+   S_j = hypre_TAlloc(HYPRE_Int, S_i[num_dofs], HYPRE_MEMORY_HOST);
+   k = 0;
+   for (d = 0; d < num_dofs; d++)
+   {
+      if (d < num_variables)
+      {
+         for (j = hypre_CSRMatrixI(A_diag)[d]; j < hypre_CSRMatrixI(A_diag)[d + 1]; j++)
+         {
+            S_j[k++] = hypre_CSRMatrixJ(A_diag)[j];
+         }
+         if (num_cols_offd)
+         {
+            for (j = hypre_CSRMatrixI(A_offd)[d]; j < hypre_CSRMatrixI(A_offd)[d + 1]; j++)
+            {
+               S_j[k++] = hypre_CSRMatrixJ(A_offd)[j] + num_variables;
+            }
+         }
+      }
+      else if (A_boundary)
+      {
+         l = d - num_variables;
+         for (j = hypre_CSRMatrixI(A_boundary)[l]; j < hypre_CSRMatrixI(A_boundary)[l + 1]; j++)
+         {
+            S_j[k++] = hypre_CSRMatrixJ(A_boundary)[j];
+         }
+      }
+   }
+   transpose_matrix_create(&ST_i, &ST_j, S_i, S_j, num_dofs, num_dofs);
+
+   /* greedy coloring */
+   color     = hypre_TAlloc(HYPRE_Int, num_domains, HYPRE_MEMORY_HOST);
+   forbidden = hypre_TAlloc(HYPRE_Int, num_domains + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_domains; i++)
+   {
+      color[i]     = -1;
+      forbidden[i] = -1;
+   }
+   forbidden[num_domains] = -1;
+
+   for (i = 0; i < num_domains; i++)
+   {
+      for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
+      {
+         dof = j_domain_dof[j];
+
+         /* sweep 0: the dof itself, 1: its neighbors, 2: transposed neighbors */
+         for (sweep = 0; sweep < 3; sweep++)
+         {
+            HYPRE_Int  first = (sweep == 0) ? 0 : (sweep == 1) ? S_i[dof] : ST_i[dof];
+            HYPRE_Int  last  = (sweep == 0) ? 1 : (sweep == 1) ? S_i[dof + 1] : ST_i[dof + 1];
+
+            for (k = first; k < last; k++)
+            {
+               d = (sweep == 0) ? dof : (sweep == 1) ? S_j[k] : ST_j[k];
+               for (l = i_dof_domain[d]; l < i_dof_domain[d + 1]; l++)
+               {
+                  c = color[j_dof_domain[l]];
+                  if (c >= 0)
+                  {
+                     forbidden[c] = i;
+                  }
+               }
+            }
+         }
+      }
+
+      c = 0;
+      while (forbidden[c] == i)
+      {
+         c++;
+      }
+      color[i]   = c;
+      num_colors = hypre_max(num_colors, c + 1);
+   }
+
+   /* list the domains by color */
+   color_starts  = hypre_CTAlloc(HYPRE_Int, num_colors + 1, HYPRE_MEMORY_HOST);
+   color_domains = hypre_TAlloc(HYPRE_Int, num_domains, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_domains; i++)
+   {
+      color_starts[color[i] + 1]++;
+   }
+   for (c = 0; c < num_colors; c++)
+   {
+      color_starts[c + 1] += color_starts[c];
+   }
+   for (i = 0; i < num_domains; i++)
+   {
+      color_domains[color_starts[color[i]]++] = i;
+   }
+   for (c = num_colors; c > 0; c--)
+   {
+      color_starts[c] = color_starts[c - 1];
+   }
+   color_starts[0] = 0;
+
+   hypre_TFree(i_dof_domain, HYPRE_MEMORY_HOST);
+   hypre_TFree(j_dof_domain, HYPRE_MEMORY_HOST);
+   hypre_TFree(S_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(S_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(ST_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(ST_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(color, HYPRE_MEMORY_HOST);
+   hypre_TFree(forbidden, HYPRE_MEMORY_HOST);
+
+   *num_colors_ptr    = num_colors;
+   *color_starts_ptr  = color_starts;
+   *color_domains_ptr = color_domains;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_AMGNodalSchwarzSmoother: (Not used currently)
  *--------------------------------------------------------------------------*/
@@ -67,6 +325,8 @@ hypre_AMGNodalSchwarzSmoother( hypre_CSRMatrix    *A,
    HYPRE_Int domain_dof_counter = 0, domain_matrixinverse_counter = 0;
 
    HYPRE_Real *AE;
+   HYPRE_Int *block_starts;
+   HYPRE_Int num_failed = 0;
 
    char uplo = 'L';
 
@@ -266,12 +526,7 @@ hypre_AMGNodalSchwarzSmoother( hypre_CSRMatrix    *A,
             }
          }
 
-         /* get block for Schwarz smoother: ============================= */
-         /* ierr = hypre_matinv(XE, AE, local_dof_counter); */
-         /* hypre_printf("ierr_AE_inv: %d\n", ierr); */
-         hypre_dpotrf(&uplo, &local_dof_counter, AE,
-                      &local_dof_counter, &ierr);
-         if (ierr == 1) { hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error! Matrix not SPD\n"); }
+         /* the blocks are factored as one batch after this loop */
 
          for (i_loc = 0; i_loc < local_dof_counter; i_loc++)
             j_domain_dof[domain_dof_counter + i_loc]
@@ -336,6 +591,16 @@ hypre_AMGNodalSchwarzSmoother( hypre_CSRMatrix    *A,
 
    i_domain_dof[num_nodes] = domain_dof_counter;
 
+   /* get blocks for Schwarz smoother: ================================= */
+   if (option == 1)
+   {
+      hypre_SchwarzDomainBlockStarts(num_domains, i_domain_dof, &block_starts);
+      hypre_SchwarzFactorDomainBlocks(num_domains, i_domain_dof, block_starts,
+                                      domain_matrixinverse, NULL, 0, &num_failed);
+      if (num_failed) { hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error! Matrix not SPD\n"); }
+      hypre_TFree(block_starts, HYPRE_MEMORY_HOST);
+   }
+
    hypre_TFree(i_dof_node, HYPRE_MEMORY_HOST);
    hypre_TFree(j_dof_node, HYPRE_MEMORY_HOST);
 
@@ -360,6 +625,121 @@ hypre_AMGNodalSchwarzSmoother( hypre_CSRMatrix    *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParMPSchwarzDomainUpdate
+ *
+ * Multiplicative Schwarz correction of domain i in hypre_ParMPSchwarzSolve:
+ * x_D += relax_wt * A_DD^{-1} (rhs - A x)_D.  Dofs >= num_variables are
+ * external; their rows are in A_boundary and their values in x_ext and
+ * rhs_ext.  'block' (and 'piv' when use_nonsymm) hold the factored A_DD and
+ * 'aux' must hold the domain size.  Returns the LAPACK error code.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParMPSchwarzDomainUpdate( HYPRE_Int   i,
+                                HYPRE_Int  *i_domain_dof,
+                                HYPRE_Int  *j_domain_dof,
+                                HYPRE_Real *block,
+                                HYPRE_Int  *piv,
+                                HYPRE_Int   use_nonsymm,
+                                HYPRE_Int   num_variables,
+                                HYPRE_Int  *A_diag_i,
+                                HYPRE_Int  *A_diag_j,
+                                HYPRE_Real *A_diag_data,
+                                HYPRE_Int  *A_offd_i,
+                                HYPRE_Int  *A_offd_j,
+                                HYPRE_Real *A_offd_data,
+                                HYPRE_Int  *A_boundary_i,
+                                HYPRE_Int  *A_boundary_j,
+                                HYPRE_Real *A_boundary_data,
+                                HYPRE_Real *rhs,
+                                HYPRE_Real *rhs_ext,
+                                HYPRE_Real *x,
+                                HYPRE_Real *x_ext,
+                                HYPRE_Real  relax_wt,
+                                HYPRE_Real *aux )
+{
+   HYPRE_Int  matrix_size = i_domain_dof[i + 1] - i_domain_dof[i];
+   HYPRE_Int  one = 1;
+   HYPRE_Int  ierr = 0;
+   char       uplo = use_nonsymm ? 'N' : 'L';
+   HYPRE_Int  jj, j, k, j_loc, k_loc;
+
+   /* compute residual: ---------------------------------------- */
+   jj = 0;
+   for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
+   {
+      j_loc = j_domain_dof[j];
+      if (j_loc < num_variables)
+      {
+         aux[jj] = rhs[j_loc];
+         for (k = A_diag_i[j_loc]; k < A_diag_i[j_loc + 1]; k++)
+         {
+            aux[jj] -= A_diag_data[k] * x[A_diag_j[k]];
+         }
+         for (k = A_offd_i[j_loc]; k < A_offd_i[j_loc + 1]; k++)
+         {
+            aux[jj] -= A_offd_data[k] * x_ext[A_offd_j[k]];
+         }
+      }
+      else
+      {
+         j_loc -= num_variables;
+         aux[jj] = rhs_ext[j_loc];
+         for (k = A_boundary_i[j_loc]; k < A_boundary_i[j_loc + 1]; k++)
+         {
+            k_loc = A_boundary_j[k];
+            if (k_loc < num_variables)
+            {
+               aux[jj] -= A_boundary_data[k] * x[k_loc];
+            }
+            else
+            {
+               aux[jj] -= A_boundary_data[k] * x_ext[k_loc - num_variables];
+            }
+         }
+      }
+      jj++;
+   }
+
+   /* solve for correction: ------------------------------------- */
+   if (use_nonsymm)
+   {
+      hypre_dgetrs(&uplo, &matrix_size, &one, block, &matrix_size, piv,
+                   aux, &matrix_size, &ierr);
+   }
+   else
+   {
+      hypre_dpotrs(&uplo, &matrix_size, &one, block, &matrix_size,
+                   aux, &matrix_size, &ierr);
+   }
+
+   jj = 0;
+   for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
+   {
+      j_loc = j_domain_dof[j];
+      if (j_loc < num_variables)
+      {
+         x[j_loc] +=  relax_wt * aux[jj++];
+      }
+      else
+      {
+         x_ext[j_loc - num_variables] +=  relax_wt * aux[jj++];
+      }
+   }
+
+   return ierr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParMPSchwarzSolve
+ *
+ * If num_colors > 0, the domains are visited by color (see
+ * hypre_SchwarzDomainColoring) and the domains of one color are updated by
+ * different threads; block_starts gives the offset of each factored domain
+ * matrix.  Otherwise the domains are visited in their natural order.
+ *--------------------------------------------------------------------------*/
+
 HYPRE_Int hypre_ParMPSchwarzSolve(hypre_ParCSRMatrix *par_A,
                                   hypre_CSRMatrix *A_boundary,
                                   hypre_ParVector *rhs_vector,
@@ -368,7 +748,11 @@ HYPRE_Int hypre_ParMPSchwarzSolve(hypre_ParCSRMatrix *par_A,
                                   HYPRE_Real relax_wt,
                                   HYPRE_Real *scale,
                                   hypre_ParVector *Vtemp, HYPRE_Int *pivots,
-                                  HYPRE_Int use_nonsymm)
+                                  HYPRE_Int use_nonsymm,
+                                  HYPRE_Int num_colors,
+                                  HYPRE_Int *color_starts,
+                                  HYPRE_Int *color_domains,
+                                  HYPRE_Int *block_starts)
 {
    hypre_ParCSRCommPkg *comm_pkg = hypre_ParCSRMatrixCommPkg(par_A);
    HYPRE_Int num_sends = 0;
@@ -385,13 +769,13 @@ HYPRE_Int hypre_ParMPSchwarzSolve(hypre_ParCSRMatrix *par_A,
    HYPRE_Real *A_diag_data;
    hypre_CSRMatrix *A_offd;
    HYPRE_Int *A_offd_i;
-   HYPRE_Int *A_offd_j;
-   HYPRE_Real *A_offd_data;
+   HYPRE_Int *A_offd_j = NULL;
+   HYPRE_Real *A_offd_data = NULL;
    HYPRE_Real *x;
-   HYPRE_Real *x_ext;
-   HYPRE_Real *x_ext_old;
+   HYPRE_Real *x_ext = NULL;
+   HYPRE_Real *x_ext_old = NULL;
    HYPRE_Real *rhs;
-   HYPRE_Real *rhs_ext;
+   HYPRE_Real *rhs_ext = NULL;
    HYPRE_Real *vtemp_data;
    HYPRE_Real *aux;
    HYPRE_Real *buf_data;
@@ -402,18 +786,17 @@ HYPRE_Int hypre_ParMPSchwarzSolve(hypre_ParCSRMatrix *par_A,
    HYPRE_Int *i_domain_dof = hypre_CSRMatrixI(domain_structure);
    HYPRE_Int *j_domain_dof = hypre_CSRMatrixJ(domain_structure);
    HYPRE_Real *domain_matrixinverse = hypre_CSRMatrixData(domain_structure);
-   HYPRE_Int *A_boundary_i;
-   HYPRE_Int *A_boundary_j;
-   HYPRE_Real *A_boundary_data;
+   HYPRE_Int *A_boundary_i = NULL;
+   HYPRE_Int *A_boundary_j = NULL;
+   HYPRE_Real *A_boundary_data = NULL;
    HYPRE_Int num_variables;
    HYPRE_Int num_cols_offd;
 
    HYPRE_Int piv_counter = 0;
-   HYPRE_Int one = 1;
-   char uplo = 'L';
 
-   HYPRE_Int jj, i, j, k, j_loc, k_loc;
+   HYPRE_Int i, j, k_loc;
    HYPRE_Int index;
+   HYPRE_Int ii, c, cc, num_failed = 0;
 
    HYPRE_Int matrix_size, matrix_size_counter = 0;
 
@@ -432,11 +815,6 @@ HYPRE_Int hypre_ParMPSchwarzSolve(hypre_ParCSRMatrix *par_A,
    vtemp_data = hypre_VectorData(hypre_ParVectorLocalVector(Vtemp));
    rhs = hypre_VectorData(hypre_ParVectorLocalVector(rhs_vector));
 
-   if (use_nonsymm)
-   {
-      uplo = 'N';
-   }
-
    /*x_vector = hypre_ParVectorLocalVector(par_x);*/
    A_diag_i = hypre_CSRMatrixI(A_diag);
    A_diag_j = hypre_CSRMatrixJ(A_diag);
@@ -450,7 +828,15 @@ HYPRE_Int hypre_ParMPSchwarzSolve(hypre_ParCSRMatrix *par_A,
       A_boundary_j = hypre_CSRMatrixJ(A_boundary);
       A_boundary_data = hypre_CSRMatrixData(A_boundary);
    }
-   aux = hypre_CTAlloc(HYPRE_Real,  max_domain_size, HYPRE_MEMORY_HOST);
+   if (num_colors > 0)
+   {
+      /* one work vector per thread */
+      aux = hypre_CTAlloc(HYPRE_Real, hypre_NumThreads() * max_domain_size, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      aux = hypre_CTAlloc(HYPRE_Real,  max_domain_size, HYPRE_MEMORY_HOST);
+   }
 
    hypre_ParVectorCopy(rhs_vector, Vtemp);
    hypre_ParCSRMatrixMatvec(-1.0, par_A, par_x, 1.0, Vtemp);
@@ -511,221 +897,137 @@ HYPRE_Int hypre_ParMPSchwarzSolve(hypre_ParCSRMatrix *par_A,
          }
       }
    }
-   /* forward solve: ----------------------------------------------- */
 
-   matrix_size_counter = 0;
-   for (i = 0; i < num_domains; i++)
+   if (num_colors > 0)
    {
-      matrix_size = i_domain_dof[i + 1] - i_domain_dof[i];
-
-      /* compute residual: ---------------------------------------- */
-
-      jj = 0;
-      for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
-      {
-         j_loc = j_domain_dof[j];
-         if (j_loc < num_variables)
-         {
-            aux[jj] = rhs[j_loc];
-            for (k = A_diag_i[j_loc]; k < A_diag_i[j_loc + 1]; k++)
-            {
-               aux[jj] -= A_diag_data[k] * x[A_diag_j[k]];
-            }
-            for (k = A_offd_i[j_loc]; k < A_offd_i[j_loc + 1]; k++)
-            {
-               aux[jj] -= A_offd_data[k] * x_ext[A_offd_j[k]];
-            }
-         }
-         else
+      /* forward and backward sweep over the colors: ------------------ */
+      for (cc = 0; cc < 2 * num_colors; cc++)
+      {
+         c = (cc < num_colors) ? cc : 2 * num_colors - 1 - cc;
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(ii, i) reduction(+:num_failed) schedule(dynamic)
+#endif
+         for (ii = color_starts[c]; ii < color_starts[c + 1]; ii++)
          {
-            j_loc -= num_variables;
-            aux[jj] = rhs_ext[j_loc];
-            for (k = A_boundary_i[j_loc]; k < A_boundary_i[j_loc + 1]; k++)
-            {
-               k_loc = A_boundary_j[k];
-            }
-            if (k_loc < num_variables)
-            {
-               aux[jj] -= A_boundary_data[k] * x[k_loc];
-            }
-            else
+            i = color_domains[ii];
+            if (hypre_ParMPSchwarzDomainUpdate(i, i_domain_dof, j_domain_dof,
+                                               &domain_matrixinverse[block_starts[i]],
+                                               use_nonsymm ? &pivots[i_domain_dof[i]] : NULL,
+                                               use_nonsymm, num_variables,
+                                               A_diag_i, A_diag_j, A_diag_data,
+                                               A_offd_i, A_offd_j, A_offd_data,
+                                               A_boundary_i, A_boundary_j, A_boundary_data,
+                                               rhs, rhs_ext, x, x_ext, relax_wt,
+                                               &aux[hypre_GetThreadNum() * max_domain_size]))
             {
-               aux[jj] -= A_boundary_data[k] * x_ext[k_loc - num_variables];
+               num_failed++;
             }
          }
-         jj++;
-      }
-      /* solve for correction: ------------------------------------- */
-      if (use_nonsymm)
-      {
-         hypre_dgetrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, &pivots[piv_counter], aux,
-                      &matrix_size, &ierr);
-      }
-      else
-      {
-         hypre_dpotrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, aux,
-                      &matrix_size, &ierr);
-      }
-      if (ierr) { hypre_error(HYPRE_ERROR_GENERIC); }
-      jj = 0;
-      for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
-      {
-         j_loc = j_domain_dof[j];
-         if (j_loc < num_variables)
-         {
-            x[j_loc] +=  relax_wt * aux[jj++];
-         }
-         else
-         {
-            x_ext[j_loc - num_variables] +=  relax_wt * aux[jj++];
-         }
       }
-      matrix_size_counter += matrix_size * matrix_size;
-      piv_counter += matrix_size;
-
-
+      if (num_failed) { hypre_error(HYPRE_ERROR_GENERIC); }
    }
-   /*
-     for (i=0; i < num_cols_offd; i++)
-     x_ext[i] -= x_ext_old[i];
+   else
+   {
+      /* forward solve: ----------------------------------------------- */
 
-     if (comm_pkg)
-     {
-     comm_handle=hypre_ParCSRCommHandleCreate (2,comm_pkg,x_ext,buf_data);
+      matrix_size_counter = 0;
+      for (i = 0; i < num_domains; i++)
+      {
+         matrix_size = i_domain_dof[i + 1] - i_domain_dof[i];
 
-     hypre_ParCSRCommHandleDestroy(comm_handle);
-     comm_handle = NULL;
+         ierr = hypre_ParMPSchwarzDomainUpdate(i, i_domain_dof, j_domain_dof,
+                                               &domain_matrixinverse[matrix_size_counter],
+                                               use_nonsymm ? &pivots[piv_counter] : NULL,
+                                               use_nonsymm, num_variables,
+                                               A_diag_i, A_diag_j, A_diag_data,
+                                               A_offd_i, A_offd_j, A_offd_data,
+                                               A_boundary_i, A_boundary_j, A_boundary_data,
+                                               rhs, rhs_ext, x, x_ext, relax_wt, aux);
+         if (ierr) { hypre_error(HYPRE_ERROR_GENERIC); }
 
-     index = 0;
-     for (i=0; i < num_sends; i++)
-     {
-     for (j = send_map_starts[i]; j < send_map_starts[i+1]; j++)
-     x[send_map_elmts[j]] += buf_data[index++];
-     }
-     }
-     for (i=0; i < num_variables; i++)
-     x[i] *= scale[i];
+         matrix_size_counter += matrix_size * matrix_size;
+         piv_counter += matrix_size;
+      }
+      /*
+        for (i=0; i < num_cols_offd; i++)
+        x_ext[i] -= x_ext_old[i];
 
-     hypre_ParVectorCopy(rhs_vector,Vtemp);
-     hypre_ParCSRMatrixMatvec(-1.0,par_A,par_x,1.0,Vtemp);
+        if (comm_pkg)
+        {
+        comm_handle=hypre_ParCSRCommHandleCreate (2,comm_pkg,x_ext,buf_data);
 
-     if (comm_pkg)
-     {
-     index = 0;
-     for (i=0; i < num_sends; i++)
-     {
-     for (j = send_map_starts[i]; j < send_map_starts[i+1]; j++)
-     buf_data[index++] = vtemp_data[send_map_elmts[j]];
-     }
+        hypre_ParCSRCommHandleDestroy(comm_handle);
+        comm_handle = NULL;
 
-     comm_handle = hypre_ParCSRCommHandleCreate(1,comm_pkg,buf_data,
-     rhs_ext);
-     hypre_ParCSRCommHandleDestroy(comm_handle);
-     comm_handle = NULL;
+        index = 0;
+        for (i=0; i < num_sends; i++)
+        {
+        for (j = send_map_starts[i]; j < send_map_starts[i+1]; j++)
+        x[send_map_elmts[j]] += buf_data[index++];
+        }
+        }
+        for (i=0; i < num_variables; i++)
+        x[i] *= scale[i];
 
-     index = 0;
-     for (i=0; i < num_sends; i++)
-     {
-     for (j = send_map_starts[i]; j < send_map_starts[i+1]; j++)
-     buf_data[index++] = x[send_map_elmts[j]];
-     }
+        hypre_ParVectorCopy(rhs_vector,Vtemp);
+        hypre_ParCSRMatrixMatvec(-1.0,par_A,par_x,1.0,Vtemp);
 
-     comm_handle = hypre_ParCSRCommHandleCreate(1,comm_pkg,buf_data,x_ext);
-     hypre_ParCSRCommHandleDestroy(comm_handle);
-     comm_handle = NULL;
-     }
-   */
-   /* correction of residual for exterior points to be updated locally */
-   /*   for (i=0; i < num_cols_offd; i++)
+        if (comm_pkg)
         {
-        x_ext_old[i] = x_ext[i];
-        for (j = A_boundary_i[i]; j < A_boundary_i[i+1]; j++)
+        index = 0;
+        for (i=0; i < num_sends; i++)
         {
-        k_loc = A_boundary_j[j];
-        if (k_loc < num_variables)
-        rhs_ext[i] += A_boundary_i[k]*x[k_loc];
-        else
-        rhs_ext[i] += A_boundary_i[k]*x_ext[k_loc-num_variables];
-        }
+        for (j = send_map_starts[i]; j < send_map_starts[i+1]; j++)
+        buf_data[index++] = vtemp_data[send_map_elmts[j]];
         }
-   */
-   /* backward solve: ------------------------------------------------ */
-   for (i = num_domains - 1; i > -1; i--)
-   {
-      matrix_size = i_domain_dof[i + 1] - i_domain_dof[i];
-      matrix_size_counter -= matrix_size * matrix_size;
-      piv_counter -= matrix_size;
 
-      /* compute residual: ---------------------------------------- */
-      jj = 0;
-      for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
-      {
-         j_loc = j_domain_dof[j];
-         if (j_loc < num_variables)
-         {
-            aux[jj] = rhs[j_loc];
-            for (k = A_diag_i[j_loc]; k < A_diag_i[j_loc + 1]; k++)
-            {
-               aux[jj] -= A_diag_data[k] * x[A_diag_j[k]];
-            }
-            for (k = A_offd_i[j_loc]; k < A_offd_i[j_loc + 1]; k++)
-            {
-               aux[jj] -= A_offd_data[k] * x_ext[A_offd_j[k]];
-            }
-         }
-         else
-         {
-            j_loc -= num_variables;
-            aux[jj] = rhs_ext[j_loc];
-            for (k = A_boundary_i[j_loc]; k < A_boundary_i[j_loc + 1]; k++)
-            {
-               k_loc = A_boundary_j[k];
-            }
-            if (k_loc < num_variables)
-            {
-               aux[jj] -= A_boundary_data[k] * x[k_loc];
-            }
-            else
-            {
-               aux[jj] -= A_boundary_data[k] * x_ext[k_loc - num_variables];
-            }
-         }
-         jj++;
-      }
+        comm_handle = hypre_ParCSRCommHandleCreate(1,comm_pkg,buf_data,
+        rhs_ext);
+        hypre_ParCSRCommHandleDestroy(comm_handle);
+        comm_handle = NULL;
 
-      /* solve for correction: ------------------------------------- */
-      if (use_nonsymm)
-      {
-         hypre_dgetrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, &pivots[piv_counter], aux,
-                      &matrix_size, &ierr);
-      }
-      else
-      {
-         hypre_dpotrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, aux,
-                      &matrix_size, &ierr);
-      }
+        index = 0;
+        for (i=0; i < num_sends; i++)
+        {
+        for (j = send_map_starts[i]; j < send_map_starts[i+1]; j++)
+        buf_data[index++] = x[send_map_elmts[j]];
+        }
 
-      if (ierr) { hypre_error(HYPRE_ERROR_GENERIC); }
-      jj = 0;
-      for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
+        comm_handle = hypre_ParCSRCommHandleCreate(1,comm_pkg,buf_data,x_ext);
+        hypre_ParCSRCommHandleDestroy(comm_handle);
+        comm_handle = NULL;
+        }
+      */
+      /* correction of residual for exterior points to be updated locally */
+      /*   for (i=0; i < num_cols_offd; i++)
+           {
+           x_ext_old[i] = x_ext[i];
+           for (j = A_boundary_i[i]; j < A_boundary_i[i+1]; j++)
+           {
+           k_loc = A_boundary_j[j];
+           if (k_loc < num_variables)
+           rhs_ext[i] += A_boundary_i[k]*x[k_loc];
+           else
+           rhs_ext[i] += A_boundary_i[k]*x_ext[k_loc-num_variables];
+           }
+           }
+      */
+      /* backward solve: ------------------------------------------------ */
+      for (i = num_domains - 1; i > -1; i--)
       {
-         j_loc = j_domain_dof[j];
-         if (j_loc < num_variables)
-         {
-            x[j_loc] +=  relax_wt * aux[jj++];
-         }
-         else
-         {
-            x_ext[j_loc - num_variables] +=  relax_wt * aux[jj++];
-         }
+         matrix_size = i_domain_dof[i + 1] - i_domain_dof[i];
+         matrix_size_counter -= matrix_size * matrix_size;
+         piv_counter -= matrix_size;
+
+         ierr = hypre_ParMPSchwarzDomainUpdate(i, i_domain_dof, j_domain_dof,
+                                               &domain_matrixinverse[matrix_size_counter],
+                                               use_nonsymm ? &pivots[piv_counter] : NULL,
+                                               use_nonsymm, num_variables,
+                                               A_diag_i, A_diag_j, A_diag_data,
+                                               A_offd_i, A_offd_j, A_offd_data,
+                                               A_boundary_i, A_boundary_j, A_boundary_data,
+                                               rhs, rhs_ext, x, x_ext, relax_wt, aux);
+         if (ierr) { hypre_error(HYPRE_ERROR_GENERIC); }
       }
    }
 
@@ -766,13 +1068,87 @@ HYPRE_Int hypre_ParMPSchwarzSolve(hypre_ParCSRMatrix *par_A,
 
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_MPSchwarzDomainUpdate
+ *
+ * Multiplicative Schwarz correction of domain i with the local matrix A,
+ * x_D += relax_wt * A_DD^{-1} (rhs - A x)_D.  'block' (and 'piv' when
+ * use_nonsymm) hold the factored A_DD and 'aux' must hold the domain size.
+ * Returns the LAPACK error code.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_MPSchwarzDomainUpdate( HYPRE_Int   i,
+                             HYPRE_Int  *i_domain_dof,
+                             HYPRE_Int  *j_domain_dof,
+                             HYPRE_Real *block,
+                             HYPRE_Int  *piv,
+                             HYPRE_Int   use_nonsymm,
+                             HYPRE_Int  *i_dof_dof,
+                             HYPRE_Int  *j_dof_dof,
+                             HYPRE_Real *a_dof_dof,
+                             HYPRE_Real *rhs,
+                             HYPRE_Real *x,
+                             HYPRE_Real  relax_wt,
+                             HYPRE_Real *aux )
+{
+   HYPRE_Int  matrix_size = i_domain_dof[i + 1] - i_domain_dof[i];
+   HYPRE_Int  one = 1;
+   HYPRE_Int  ierr = 0;
+   char       uplo = use_nonsymm ? 'N' : 'L';
+   HYPRE_Int  jj, j, k;
+
+   /* compute residual: ---------------------------------------- */
+   jj = 0;
+   for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
+   {
+      aux[jj] = rhs[j_domain_dof[j]];
+      for (k = i_dof_dof[j_domain_dof[j]];
+           k < i_dof_dof[j_domain_dof[j] + 1]; k++)
+      {
+         aux[jj] -= a_dof_dof[k] * x[j_dof_dof[k]];
+      }
+      jj++;
+   }
+
+   /* solve for correction: ------------------------------------- */
+   if (use_nonsymm)
+   {
+      hypre_dgetrs(&uplo, &matrix_size, &one, block, &matrix_size, piv,
+                   aux, &matrix_size, &ierr);
+   }
+   else
+   {
+      hypre_dpotrs(&uplo, &matrix_size, &one, block, &matrix_size,
+                   aux, &matrix_size, &ierr);
+   }
+
+   jj = 0;
+   for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
+   {
+      x[j_domain_dof[j]] +=  relax_wt * aux[jj++];
+   }
+
+   return ierr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_MPSchwarzSolve
+ *
+ * The coloring arguments are used as in hypre_ParMPSchwarzSolve.
+ *--------------------------------------------------------------------------*/
+
 HYPRE_Int hypre_MPSchwarzSolve(hypre_ParCSRMatrix *par_A,
                                hypre_Vector *rhs_vector,
                                hypre_CSRMatrix *domain_structure,
                                hypre_ParVector *par_x,
                                HYPRE_Real relax_wt,
                                hypre_Vector *aux_vector, HYPRE_Int *pivots,
-                               HYPRE_Int use_nonsymm)
+                               HYPRE_Int use_nonsymm,
+                               HYPRE_Int num_colors,
+                               HYPRE_Int *color_starts,
+                               HYPRE_Int *color_domains,
+                               HYPRE_Int *block_starts)
 {
    HYPRE_Int ierr = 0;
    /* HYPRE_Int num_dofs; */
@@ -786,16 +1162,15 @@ HYPRE_Int hypre_MPSchwarzSolve(hypre_ParCSRMatrix *par_A,
    hypre_Vector *x_vector;
    MPI_Comm comm = hypre_ParCSRMatrixComm(par_A);
    HYPRE_Int num_domains = hypre_CSRMatrixNumRows(domain_structure);
+   HYPRE_Int max_domain_size = hypre_CSRMatrixNumCols(domain_structure);
    HYPRE_Int *i_domain_dof = hypre_CSRMatrixI(domain_structure);
    HYPRE_Int *j_domain_dof = hypre_CSRMatrixJ(domain_structure);
    HYPRE_Real *domain_matrixinverse = hypre_CSRMatrixData(domain_structure);
 
    HYPRE_Int piv_counter = 0;
-   HYPRE_Int one = 1;
-   char uplo = 'L';
-
-   HYPRE_Int jj, i, j, k; /*, j_loc, k_loc;*/
 
+   HYPRE_Int i;
+   HYPRE_Int ii, c, cc, num_failed = 0;
 
    HYPRE_Int matrix_size, matrix_size_counter = 0;
 
@@ -815,12 +1190,6 @@ HYPRE_Int hypre_MPSchwarzSolve(hypre_ParCSRMatrix *par_A,
    /* for (i=0; i < num_dofs; i++)
       x[i] = 0.e0; */
 
-   if (use_nonsymm)
-   {
-      uplo = 'N';
-   }
-
-
    if (num_procs > 1)
    {
       hypre_parCorrRes(par_A, par_x, rhs_vector, &rhs);
@@ -830,95 +1199,69 @@ HYPRE_Int hypre_MPSchwarzSolve(hypre_ParCSRMatrix *par_A,
       rhs = rhs_vector;
    }
 
-   /* forward solve: ----------------------------------------------- */
-
-   matrix_size_counter = 0;
-   for (i = 0; i < num_domains; i++)
+   if (num_colors > 0)
    {
-      matrix_size = i_domain_dof[i + 1] - i_domain_dof[i];
+      /* one work vector per thread */
+      aux = hypre_TAlloc(HYPRE_Real, hypre_NumThreads() * max_domain_size, HYPRE_MEMORY_HOST);
 
-      /* compute residual: ---------------------------------------- */
-
-      jj = 0;
-      for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
+      /* forward and backward sweep over the colors: ------------------ */
+      for (cc = 0; cc < 2 * num_colors; cc++)
       {
-         aux[jj] = hypre_VectorData(rhs)[j_domain_dof[j]];
-         for (k = i_dof_dof[j_domain_dof[j]];
-              k < i_dof_dof[j_domain_dof[j] + 1]; k++)
+         c = (cc < num_colors) ? cc : 2 * num_colors - 1 - cc;
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(ii, i) reduction(+:num_failed) schedule(dynamic)
+#endif
+         for (ii = color_starts[c]; ii < color_starts[c + 1]; ii++)
          {
-            aux[jj] -= a_dof_dof[k] * x[j_dof_dof[k]];
+            i = color_domains[ii];
+            if (hypre_MPSchwarzDomainUpdate(i, i_domain_dof, j_domain_dof,
+                                            &domain_matrixinverse[block_starts[i]],
+                                            use_nonsymm ? &pivots[i_domain_dof[i]] : NULL,
+                                            use_nonsymm, i_dof_dof, j_dof_dof, a_dof_dof,
+                                            hypre_VectorData(rhs), x, relax_wt,
+                                            &aux[hypre_GetThreadNum() * max_domain_size]))
+            {
+               num_failed++;
+            }
          }
-         jj++;
-      }
-      /* solve for correction: ------------------------------------- */
-      if (use_nonsymm)
-      {
-         hypre_dgetrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, &pivots[piv_counter], aux,
-                      &matrix_size, &ierr);
-      }
-      else
-      {
-         hypre_dpotrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, aux,
-                      &matrix_size, &ierr);
       }
+      if (num_failed) { hypre_error(HYPRE_ERROR_GENERIC); }
 
-      if (ierr) { hypre_error(HYPRE_ERROR_GENERIC); }
-      jj = 0;
-      for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
-      {
-         x[j_domain_dof[j]] +=  relax_wt * aux[jj++];
-      }
-      matrix_size_counter += matrix_size * matrix_size;
-      piv_counter += matrix_size;
+      hypre_TFree(aux, HYPRE_MEMORY_HOST);
    }
-
-   /* backward solve: ------------------------------------------------ */
-   for (i = num_domains - 1; i > -1; i--)
+   else
    {
-      matrix_size = i_domain_dof[i + 1] - i_domain_dof[i];
-      matrix_size_counter -= matrix_size * matrix_size;
-      piv_counter -= matrix_size;
-
-      /* compute residual: ---------------------------------------- */
+      /* forward solve: ----------------------------------------------- */
 
-      jj = 0;
-      for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
+      matrix_size_counter = 0;
+      for (i = 0; i < num_domains; i++)
       {
-         aux[jj] = hypre_VectorData(rhs)[j_domain_dof[j]];
-         for (k = i_dof_dof[j_domain_dof[j]];
-              k < i_dof_dof[j_domain_dof[j] + 1]; k++)
-         {
-            aux[jj] -= a_dof_dof[k] * x[j_dof_dof[k]];
-         }
-         jj++;
-      }
+         matrix_size = i_domain_dof[i + 1] - i_domain_dof[i];
 
-      /* solve for correction: ------------------------------------- */
+         ierr = hypre_MPSchwarzDomainUpdate(i, i_domain_dof, j_domain_dof,
+                                            &domain_matrixinverse[matrix_size_counter],
+                                            use_nonsymm ? &pivots[piv_counter] : NULL,
+                                            use_nonsymm, i_dof_dof, j_dof_dof, a_dof_dof,
+                                            hypre_VectorData(rhs), x, relax_wt, aux);
+         if (ierr) { hypre_error(HYPRE_ERROR_GENERIC); }
 
-      if (use_nonsymm)
-      {
-         hypre_dgetrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, &pivots[piv_counter], aux,
-                      &matrix_size, &ierr);
-      }
-      else
-      {
-         hypre_dpotrs(&uplo, &matrix_size, &one,
-                      &domain_matrixinverse[matrix_size_counter],
-                      &matrix_size, aux,
-                      &matrix_size, &ierr);
+         matrix_size_counter += matrix_size * matrix_size;
+         piv_counter += matrix_size;
       }
 
-      if (ierr) { hypre_error(HYPRE_ERROR_GENERIC); }
-      jj = 0;
-      for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
+      /* backward solve: ------------------------------------------------ */
+      for (i = num_domains - 1; i > -1; i--)
       {
-         x[j_domain_dof[j]] += relax_wt * aux[jj++];
+         matrix_size = i_domain_dof[i + 1] - i_domain_dof[i];
+         matrix_size_counter -= matrix_size * matrix_size;
+         piv_counter -= matrix_size;
+
+         ierr = hypre_MPSchwarzDomainUpdate(i, i_domain_dof, j_domain_dof,
+                                            &domain_matrixinverse[matrix_size_counter],
+                                            use_nonsymm ? &pivots[piv_counter] : NULL,
+                                            use_nonsymm, i_dof_dof, j_dof_dof, a_dof_dof,
+                                            hypre_VectorData(rhs), x, relax_wt, aux);
+         if (ierr) { hypre_error(HYPRE_ERROR_GENERIC); }
       }
    }
 
@@ -1582,10 +1925,8 @@ hypre_AMGCreateDomainDof(hypre_CSRMatrix     *A,
 
    HYPRE_Int *i_dof_index;
 
-   HYPRE_Int ierr = 0;
-   HYPRE_Int i, j, k,  l_loc, i_loc, j_loc;
+   HYPRE_Int i, j, k, i_loc, j_loc;
    HYPRE_Int i_dof;
-   HYPRE_Int *i_local_to_global;
    HYPRE_Int *i_global_to_local;
 
    HYPRE_Int local_dof_counter, max_local_dof_counter = 0;
@@ -1594,12 +1935,10 @@ hypre_AMGCreateDomainDof(hypre_CSRMatrix     *A,
    HYPRE_Int nf;
 
    HYPRE_Real *AE;
+   HYPRE_Int *block_starts;
 
    HYPRE_Int piv_counter = 0;
-   HYPRE_Int *ipiv;
    HYPRE_Int *piv = NULL;
-   char uplo = 'L';
-   HYPRE_Int cnt;
 
    /* --------------------------------------------------------------------- */
 
@@ -1859,76 +2198,57 @@ hypre_AMGCreateDomainDof(hypre_CSRMatrix     *A,
       piv = hypre_CTAlloc(HYPRE_Int,  piv_counter, HYPRE_MEMORY_HOST);
    }
 
-   i_local_to_global = hypre_CTAlloc(HYPRE_Int,  max_local_dof_counter, HYPRE_MEMORY_HOST);
-
-   i_global_to_local = hypre_CTAlloc(HYPRE_Int, num_dofs, HYPRE_MEMORY_HOST);
+   hypre_SchwarzDomainBlockStarts(num_domains, i_domain_dof, &block_starts);
 
-   for (i = 0; i < num_dofs; i++)
-   {
-      i_global_to_local[i] = -1;
-   }
-
-   piv_counter = 0;
-   domain_matrixinverse_counter = 0;
-   for (i = 0; i < num_domains; i++)
+   /* get local matrices into the (zeroed) arena: ====================== */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(i, j, i_loc, j_loc, i_dof, local_dof_counter, AE, i_global_to_local)
+#endif
    {
-      local_dof_counter = 0;
-      for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
+      i_global_to_local = hypre_TAlloc(HYPRE_Int, num_dofs, HYPRE_MEMORY_HOST);
+      for (i_dof = 0; i_dof < num_dofs; i_dof++)
       {
-         i_global_to_local[j_domain_dof[j]] = local_dof_counter;
-         i_local_to_global[local_dof_counter] = j_domain_dof[j];
-         local_dof_counter++;
+         i_global_to_local[i_dof] = -1;
       }
 
-      /* get local matrix in AE: ======================================== */
-      cnt = 0;
-
-      AE = &domain_matrixinverse[domain_matrixinverse_counter];
-      ipiv = &piv[piv_counter];
-      for (i_loc = 0; i_loc < local_dof_counter; i_loc++)
-         for (j_loc = 0; j_loc < local_dof_counter; j_loc++)
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp for schedule(dynamic)
+#endif
+      for (i = 0; i < num_domains; i++)
+      {
+         local_dof_counter = i_domain_dof[i + 1] - i_domain_dof[i];
+         for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
          {
-            AE[cnt++] = 0.e0;
+            i_global_to_local[j_domain_dof[j]] = j - i_domain_dof[i];
          }
 
-      for (i_loc = 0; i_loc < local_dof_counter; i_loc++)
-      {
-         i_dof = i_local_to_global[i_loc];
-         for (j = i_dof_dof[i_dof]; j < i_dof_dof[i_dof + 1]; j++)
+         AE = &domain_matrixinverse[block_starts[i]];
+         for (i_loc = 0; i_loc < local_dof_counter; i_loc++)
          {
-            j_loc = i_global_to_local[j_dof_dof[j]];
-            if (j_loc >= 0)
+            i_dof = j_domain_dof[i_domain_dof[i] + i_loc];
+            for (j = i_dof_dof[i_dof]; j < i_dof_dof[i_dof + 1]; j++)
             {
-               AE[i_loc + j_loc * local_dof_counter] = a_dof_dof[j];
+               j_loc = i_global_to_local[j_dof_dof[j]];
+               if (j_loc >= 0)
+               {
+                  AE[i_loc + j_loc * local_dof_counter] = a_dof_dof[j];
+               }
             }
          }
-      }
-
-      if (use_nonsymm)
-      {
-         hypre_dgetrf(&local_dof_counter,
-                      &local_dof_counter, AE,
-                      &local_dof_counter, ipiv, &ierr);
-         piv_counter += local_dof_counter;
-      }
-
-      else
-      {
-         hypre_dpotrf(&uplo, &local_dof_counter, AE,
-                      &local_dof_counter, &ierr);
-      }
-
-      domain_matrixinverse_counter += local_dof_counter * local_dof_counter;
 
-      for (l_loc = 0; l_loc < local_dof_counter; l_loc++)
-      {
-         i_global_to_local[i_local_to_global[l_loc]] = -1;
+         for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
+         {
+            i_global_to_local[j_domain_dof[j]] = -1;
+         }
       }
 
+      hypre_TFree(i_global_to_local, HYPRE_MEMORY_HOST);
    }
 
-   hypre_TFree(i_local_to_global, HYPRE_MEMORY_HOST);
-   hypre_TFree(i_global_to_local, HYPRE_MEMORY_HOST);
+   /* factor all of them as one batch: ================================= */
+   hypre_SchwarzFactorDomainBlocks(num_domains, i_domain_dof, block_starts,
+                                   domain_matrixinverse, piv, use_nonsymm, NULL);
+   hypre_TFree(block_starts, HYPRE_MEMORY_HOST);
 
    domain_structure = hypre_CSRMatrixCreate(num_domains, max_local_dof_counter,
                                             i_domain_dof[num_domains]);
@@ -3231,11 +3551,9 @@ hypre_ParAMGCreateDomainDof(hypre_ParCSRMatrix   *A,
    HYPRE_Int num_recvs = 0;
    HYPRE_Int *recv_vec_starts = NULL;
 
-   HYPRE_Int ierr = 0;
-   HYPRE_Int i, j, k, l_loc, i_loc, j_loc;
+   HYPRE_Int i, j, k, i_loc, j_loc;
    HYPRE_Int i_dof;
    HYPRE_Int nf;
-   HYPRE_Int *i_local_to_global;
    HYPRE_Int *i_global_to_local;
 
    HYPRE_Int local_dof_counter, max_local_dof_counter = 0;
@@ -3243,14 +3561,12 @@ hypre_ParAMGCreateDomainDof(hypre_ParCSRMatrix   *A,
    HYPRE_Int domain_dof_counter = 0, domain_matrixinverse_counter = 0;
 
    HYPRE_Real *AE;
+   HYPRE_Int *block_starts;
 
-
-   HYPRE_Int *ipiv;
-   char uplo = 'L';
    HYPRE_Int piv_counter;
    HYPRE_Int *piv = NULL;
 
-   HYPRE_Int cnt, indx;
+   HYPRE_Int indx;
    HYPRE_Int num_procs, my_id;
 
    if (num_variables == 0)
@@ -3624,117 +3940,95 @@ hypre_ParAMGCreateDomainDof(hypre_ParCSRMatrix   *A,
       A_ext = NULL;
    }
 
-   i_local_to_global = hypre_CTAlloc(HYPRE_Int,  max_local_dof_counter, HYPRE_MEMORY_HOST);
-
-   i_global_to_local = hypre_CTAlloc(HYPRE_Int,  num_variables + num_cols_offd, HYPRE_MEMORY_HOST);
-
-   for (i = 0; i < num_variables + num_cols_offd; i++)
-   {
-      i_global_to_local[i] = -1;
-   }
+   hypre_SchwarzDomainBlockStarts(num_domains, i_domain_dof, &block_starts);
 
-   piv_counter = 0;
-   domain_matrixinverse_counter = 0;
-   for (i = 0; i < num_domains; i++)
+   /* get local matrices into the (zeroed) arena: ====================== */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(i, j, i_loc, j_loc, i_dof, local_dof_counter, AE, i_global_to_local)
+#endif
    {
-      local_dof_counter = 0;
-      for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
+      i_global_to_local = hypre_TAlloc(HYPRE_Int, num_variables + num_cols_offd, HYPRE_MEMORY_HOST);
+      for (i_dof = 0; i_dof < num_variables + num_cols_offd; i_dof++)
       {
-         i_global_to_local[j_domain_dof[j]] = local_dof_counter;
-         i_local_to_global[local_dof_counter] = j_domain_dof[j];
-         local_dof_counter++;
+         i_global_to_local[i_dof] = -1;
       }
 
-      /* get local matrix in AE: ======================================== */
-
-      AE = &domain_matrixinverse[domain_matrixinverse_counter];
-      ipiv = &piv[piv_counter];
-
-      cnt = 0;
-      for (i_loc = 0; i_loc < local_dof_counter; i_loc++)
-         for (j_loc = 0; j_loc < local_dof_counter; j_loc++)
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp for schedule(dynamic)
+#endif
+      for (i = 0; i < num_domains; i++)
+      {
+         local_dof_counter = i_domain_dof[i + 1] - i_domain_dof[i];
+         for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
          {
-            AE[cnt++] = 0.e0;
+            i_global_to_local[j_domain_dof[j]] = j - i_domain_dof[i];
          }
 
-      for (i_loc = 0; i_loc < local_dof_counter; i_loc++)
-      {
-         i_dof = i_local_to_global[i_loc];
-         if (i_dof < num_variables)
+         AE = &domain_matrixinverse[block_starts[i]];
+         for (i_loc = 0; i_loc < local_dof_counter; i_loc++)
          {
-            for (j = a_diag_i[i_dof]; j < a_diag_i[i_dof + 1]; j++)
+            i_dof = j_domain_dof[i_domain_dof[i] + i_loc];
+            if (i_dof < num_variables)
             {
-               j_loc = i_global_to_local[a_diag_j[j]];
-               if (j_loc >= 0)
+               for (j = a_diag_i[i_dof]; j < a_diag_i[i_dof + 1]; j++)
                {
-                  AE[i_loc + j_loc * local_dof_counter] = a_diag_data[j];
+                  j_loc = i_global_to_local[a_diag_j[j]];
+                  if (j_loc >= 0)
+                  {
+                     AE[i_loc + j_loc * local_dof_counter] = a_diag_data[j];
+                  }
                }
-            }
-            for (j = a_offd_i[i_dof]; j < a_offd_i[i_dof + 1]; j++)
-            {
-               j_loc = i_global_to_local[a_offd_j[j] + num_variables];
-               if (j_loc >= 0)
+               for (j = a_offd_i[i_dof]; j < a_offd_i[i_dof + 1]; j++)
                {
-                  AE[i_loc + j_loc * local_dof_counter] = a_offd_data[j];
+                  j_loc = i_global_to_local[a_offd_j[j] + num_variables];
+                  if (j_loc >= 0)
+                  {
+                     AE[i_loc + j_loc * local_dof_counter] = a_offd_data[j];
+                  }
                }
             }
-         }
-         else
-         {
-            HYPRE_BigInt jj;
-            HYPRE_Int j2;
-            i_dof -= num_variables;
-            for (j = a_ext_i[i_dof]; j < a_ext_i[i_dof + 1]; j++)
+            else
             {
-               jj = a_ext_j[j];
-               if (jj > col_0 && jj < col_n)
+               HYPRE_BigInt jj;
+               HYPRE_Int j2;
+               i_dof -= num_variables;
+               for (j = a_ext_i[i_dof]; j < a_ext_i[i_dof + 1]; j++)
                {
-                  j2 = (HYPRE_Int)(jj - first_col_diag);
-               }
-               else
-               {
-                  j2 = hypre_BigBinarySearch(col_map_offd, jj, num_cols_offd);
-                  if (j2 > -1) { j2 += num_variables; }
-               }
-               if (j2 > -1)
-               {
-                  j_loc = i_global_to_local[j2];
-                  if (j_loc >= 0)
+                  jj = a_ext_j[j];
+                  if (jj > col_0 && jj < col_n)
+                  {
+                     j2 = (HYPRE_Int)(jj - first_col_diag);
+                  }
+                  else
                   {
-                     AE[i_loc + j_loc * local_dof_counter] = a_ext_data[j];
+                     j2 = hypre_BigBinarySearch(col_map_offd, jj, num_cols_offd);
+                     if (j2 > -1) { j2 += num_variables; }
+                  }
+                  if (j2 > -1)
+                  {
+                     j_loc = i_global_to_local[j2];
+                     if (j_loc >= 0)
+                     {
+                        AE[i_loc + j_loc * local_dof_counter] = a_ext_data[j];
+                     }
                   }
                }
             }
          }
-      }
-
-      if (use_nonsymm)
-      {
-         hypre_dgetrf(&local_dof_counter,
-                      &local_dof_counter, AE,
-                      &local_dof_counter, ipiv, &ierr);
-         piv_counter += local_dof_counter;
-      }
-
-      else
-      {
-         hypre_dpotrf(&uplo, &local_dof_counter, AE,
-                      &local_dof_counter, &ierr);
-      }
-
-      domain_matrixinverse_counter += local_dof_counter * local_dof_counter;
-
 
-
-      for (l_loc = 0; l_loc < local_dof_counter; l_loc++)
-      {
-         i_global_to_local[i_local_to_global[l_loc]] = -1;
+         for (j = i_domain_dof[i]; j < i_domain_dof[i + 1]; j++)
+         {
+            i_global_to_local[j_domain_dof[j]] = -1;
+         }
       }
 
+      hypre_TFree(i_global_to_local, HYPRE_MEMORY_HOST);
    }
 
-   hypre_TFree(i_local_to_global, HYPRE_MEMORY_HOST);
-   hypre_TFree(i_global_to_local, HYPRE_MEMORY_HOST);
+   /* factor all of them as one batch: ================================= */
+   hypre_SchwarzFactorDomainBlocks(num_domains, i_domain_dof, block_starts,
+                                   domain_matrixinverse, piv, use_nonsymm, NULL);
+   hypre_TFree(block_starts, HYPRE_MEMORY_HOST);
    hypre_CSRMatrixDestroy(A_ext);
 
    domain_structure = hypre_CSRMatrixCreate(num_domains, max_local_dof_counter,
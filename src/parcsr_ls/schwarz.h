@@ -28,7 +28,11 @@ typedef struct
    HYPRE_Int     *dof_func;
    HYPRE_Int     *pivots;
 
-
+   /* domain coloring for the threaded multiplicative variants */
+   HYPRE_Int      num_colors;
+   HYPRE_Int     *color_starts;
+   HYPRE_Int     *color_domains;
+   HYPRE_Int     *block_starts;
 
 } hypre_SchwarzData;
 
@@ -52,6 +56,11 @@ typedef struct
 #define hypre_SchwarzDataScale(schwarz_data) ((schwarz_data)->scale)
 #define hypre_SchwarzDataDofFunc(schwarz_data) ((schwarz_data)->dof_func)
 #define hypre_SchwarzDataPivots(schwarz_data) ((schwarz_data)->pivots)
+#define hypre_SchwarzDataNumColors(schwarz_data) ((schwarz_data)->num_colors)
+#define hypre_SchwarzDataColorStarts(schwarz_data) ((schwarz_data)->color_starts)
+#define hypre_SchwarzDataColorDomains(schwarz_data) \
+((schwarz_data)->color_domains)
+#define hypre_SchwarzDataBlockStarts(schwarz_data) ((schwarz_data)->block_starts)
 
 #endif
 
@@ -0,0 +1,1025 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Binary I/O for hypre_ParCSRMatrix and hypre_ParVector
+ *
+ * Each rank writes one file "<name>.bin.<rank>" with a fixed-size header of
+ * HYPRE_BINARY_HEADER_SIZE hypre_longint entries followed by the raw local
+ * arrays. For a matrix, these are diag_i, diag_j, diag_data, offd_i, offd_j,
+ * offd_data and col_map_offd; for a vector, the local data. Every array
+ * starts at an offset that is a multiple of 8 bytes.
+ *
+ * The header records the type sizes used by the writer, so a file can only
+ * be read back by a build with the same HYPRE_Int, HYPRE_BigInt and
+ * HYPRE_Complex sizes. When the file set was written with as many ranks as
+ * the reading communicator, each rank reads its own file. Otherwise the rows
+ * are redistributed uniformly over the reading ranks and every rank reads the
+ * row ranges it needs from the files that contain them.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+#define HYPRE_BINARY_MAGIC        0x48595052
+#define HYPRE_BINARY_VERSION      1
+#define HYPRE_BINARY_HEADER_SIZE  32
+
+#define HYPRE_BINARY_PARCSR       1
+#define HYPRE_BINARY_PARVECTOR    2
+
+/* Header entries */
+#define HYPRE_BINARY_HDR_MAGIC         0
+#define HYPRE_BINARY_HDR_VERSION       1
+#define HYPRE_BINARY_HDR_OBJECT        2
+#define HYPRE_BINARY_HDR_INT_SIZE      3
+#define HYPRE_BINARY_HDR_BIGINT_SIZE   4
+#define HYPRE_BINARY_HDR_COMPLEX_SIZE  5
+#define HYPRE_BINARY_HDR_NUM_PROCS     6
+#define HYPRE_BINARY_HDR_RANK          7
+#define HYPRE_BINARY_HDR_GLOBAL_ROWS   8
+#define HYPRE_BINARY_HDR_GLOBAL_COLS   9
+#define HYPRE_BINARY_HDR_ROW_START     10
+#define HYPRE_BINARY_HDR_ROW_END       11
+#define HYPRE_BINARY_HDR_COL_START     12
+#define HYPRE_BINARY_HDR_COL_END       13
+#define HYPRE_BINARY_HDR_NUM_COLS_OFFD 14
+#define HYPRE_BINARY_HDR_NNZ_DIAG      15
+#define HYPRE_BINARY_HDR_NNZ_OFFD      16
+
+/* Sections of a matrix file */
+#define HYPRE_BINARY_DIAG_I       0
+#define HYPRE_BINARY_DIAG_J       1
+#define HYPRE_BINARY_DIAG_DATA    2
+#define HYPRE_BINARY_OFFD_I       3
+#define HYPRE_BINARY_OFFD_J       4
+#define HYPRE_BINARY_OFFD_DATA    5
+#define HYPRE_BINARY_COL_MAP      6
+#define HYPRE_BINARY_NUM_SECTIONS 7
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryPadded
+ *--------------------------------------------------------------------------*/
+
+static inline size_t
+hypre_BinaryPadded( size_t nbytes )
+{
+   return (nbytes + 7) & ~((size_t) 7);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryFileName
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BinaryFileName( const char *file_name,
+                      HYPRE_Int   rank,
+                      char       *new_file_name )
+{
+   hypre_sprintf(new_file_name, "%s.bin.%05d", file_name, rank);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryWriteArray
+ *
+ * Writes n entries of size elt_size, padded with zeros to a multiple of
+ * 8 bytes.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BinaryWriteArray( FILE       *fp,
+                        const void *data,
+                        size_t      elt_size,
+                        size_t      n )
+{
+   static const char zeros[8] = {0};
+   size_t            nbytes = elt_size * n;
+   size_t            npad   = hypre_BinaryPadded(nbytes) - nbytes;
+
+   if (n > 0 && fwrite(data, elt_size, n, fp) != n)
+   {
+      return 1;
+   }
+
+   if (npad > 0 && fwrite(zeros, 1, npad, fp) != npad)
+   {
+      return 1;
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryReadAt
+ *
+ * Reads n entries of size elt_size starting at byte offset "offset".
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BinaryReadAt( FILE   *fp,
+                    size_t  offset,
+                    void   *data,
+                    size_t  elt_size,
+                    size_t  n )
+{
+   if (n == 0)
+   {
+      return 0;
+   }
+
+#if defined(_WIN32)
+   if (_fseeki64(fp, (__int64) offset, SEEK_SET) != 0)
+#else
+   if (fseeko(fp, (off_t) offset, SEEK_SET) != 0)
+#endif
+   {
+      return 1;
+   }
+
+   return (fread(data, elt_size, n, fp) != n);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryInitHeader
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BinaryInitHeader( hypre_longint *header,
+                        HYPRE_Int      object,
+                        MPI_Comm       comm )
+{
+   HYPRE_Int  my_id, num_procs, i;
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   for (i = 0; i < HYPRE_BINARY_HEADER_SIZE; i++)
+   {
+      header[i] = 0;
+   }
+
+   header[HYPRE_BINARY_HDR_MAGIC]        = HYPRE_BINARY_MAGIC;
+   header[HYPRE_BINARY_HDR_VERSION]      = HYPRE_BINARY_VERSION;
+   header[HYPRE_BINARY_HDR_OBJECT]       = object;
+   header[HYPRE_BINARY_HDR_INT_SIZE]     = (hypre_longint) sizeof(HYPRE_Int);
+   header[HYPRE_BINARY_HDR_BIGINT_SIZE]  = (hypre_longint) sizeof(HYPRE_BigInt);
+   header[HYPRE_BINARY_HDR_COMPLEX_SIZE] = (hypre_longint) sizeof(HYPRE_Complex);
+   header[HYPRE_BINARY_HDR_NUM_PROCS]    = num_procs;
+   header[HYPRE_BINARY_HDR_RANK]         = my_id;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryReadHeader
+ *
+ * Opens the file of rank "rank", reads and checks its header. Returns the
+ * open file, or NULL on error.
+ *--------------------------------------------------------------------------*/
+
+static FILE *
+hypre_BinaryReadHeader( const char    *file_name,
+                        HYPRE_Int      rank,
+                        HYPRE_Int      object,
+                        hypre_longint *header )
+{
+   char   new_file_name[1024];
+   FILE  *fp;
+
+   hypre_BinaryFileName(file_name, rank, new_file_name);
+   if ((fp = fopen(new_file_name, "rb")) == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open binary input file\n");
+      return NULL;
+   }
+
+   if (fread(header, sizeof(hypre_longint), HYPRE_BINARY_HEADER_SIZE, fp) !=
+       HYPRE_BINARY_HEADER_SIZE                                              ||
+       header[HYPRE_BINARY_HDR_MAGIC]   != HYPRE_BINARY_MAGIC                ||
+       header[HYPRE_BINARY_HDR_VERSION] >  HYPRE_BINARY_VERSION              ||
+       header[HYPRE_BINARY_HDR_OBJECT]  != object)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: invalid binary file header\n");
+      fclose(fp);
+      return NULL;
+   }
+
+   if (header[HYPRE_BINARY_HDR_INT_SIZE]     != (hypre_longint) sizeof(HYPRE_Int)    ||
+       header[HYPRE_BINARY_HDR_BIGINT_SIZE]  != (hypre_longint) sizeof(HYPRE_BigInt) ||
+       header[HYPRE_BINARY_HDR_COMPLEX_SIZE] != (hypre_longint) sizeof(HYPRE_Complex))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Error: binary file was written with different type sizes\n");
+      fclose(fp);
+      return NULL;
+   }
+
+   return fp;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryReadRowStarts
+ *
+ * Returns in row_starts[0:num_files] the row partitioning of a file set
+ * written by num_files ranks. Only rank 0 reads the headers. The return
+ * value is nonzero on all ranks if rank 0 failed to read any of them.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BinaryReadRowStarts( MPI_Comm      comm,
+                           const char   *file_name,
+                           HYPRE_Int     object,
+                           HYPRE_Int     num_files,
+                           HYPRE_BigInt *row_starts )
+{
+   hypre_longint  header[HYPRE_BINARY_HEADER_SIZE];
+   HYPRE_Int      my_id, f, ierr = 0;
+   FILE          *fp;
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   if (my_id == 0)
+   {
+      for (f = 0; f < num_files; f++)
+      {
+         if ((fp = hypre_BinaryReadHeader(file_name, f, object, header)) == NULL)
+         {
+            ierr = 1;
+            break;
+         }
+         fclose(fp);
+         row_starts[f] = (HYPRE_BigInt) header[HYPRE_BINARY_HDR_ROW_START];
+      }
+      if (!ierr)
+      {
+         row_starts[num_files] = (HYPRE_BigInt) header[HYPRE_BINARY_HDR_ROW_END];
+      }
+   }
+
+   hypre_MPI_Bcast(&ierr, 1, HYPRE_MPI_INT, 0, comm);
+   if (ierr)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't read binary file set\n");
+      return ierr;
+   }
+   hypre_MPI_Bcast(row_starts, num_files + 1, HYPRE_MPI_BIG_INT, 0, comm);
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixBinaryOffsets
+ *
+ * Byte offsets of the sections of a matrix file with the given header.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRMatrixBinaryOffsets( hypre_longint *header,
+                                 size_t        *offsets )
+{
+   size_t  num_rows = (size_t) (header[HYPRE_BINARY_HDR_ROW_END] -
+                                header[HYPRE_BINARY_HDR_ROW_START]);
+   size_t  nnz_diag = (size_t) header[HYPRE_BINARY_HDR_NNZ_DIAG];
+   size_t  nnz_offd = (size_t) header[HYPRE_BINARY_HDR_NNZ_OFFD];
+
+   offsets[HYPRE_BINARY_DIAG_I]    = HYPRE_BINARY_HEADER_SIZE * sizeof(hypre_longint);
+   offsets[HYPRE_BINARY_DIAG_J]    = offsets[HYPRE_BINARY_DIAG_I] +
+                                     hypre_BinaryPadded((num_rows + 1) * sizeof(HYPRE_Int));
+   offsets[HYPRE_BINARY_DIAG_DATA] = offsets[HYPRE_BINARY_DIAG_J] +
+                                     hypre_BinaryPadded(nnz_diag * sizeof(HYPRE_Int));
+   offsets[HYPRE_BINARY_OFFD_I]    = offsets[HYPRE_BINARY_DIAG_DATA] +
+                                     hypre_BinaryPadded(nnz_diag * sizeof(HYPRE_Complex));
+   offsets[HYPRE_BINARY_OFFD_J]    = offsets[HYPRE_BINARY_OFFD_I] +
+                                     hypre_BinaryPadded((num_rows + 1) * sizeof(HYPRE_Int));
+   offsets[HYPRE_BINARY_OFFD_DATA] = offsets[HYPRE_BINARY_OFFD_J] +
+                                     hypre_BinaryPadded(nnz_offd * sizeof(HYPRE_Int));
+   offsets[HYPRE_BINARY_COL_MAP]   = offsets[HYPRE_BINARY_OFFD_DATA] +
+                                     hypre_BinaryPadded(nnz_offd * sizeof(HYPRE_Complex));
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixPrintBinary
+ *
+ * Writes the matrix to the per-rank files "<file_name>.bin.<rank>".
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixPrintBinary( hypre_ParCSRMatrix *matrix,
+                               const char         *file_name )
+{
+   hypre_ParCSRMatrix  *h_matrix;
+   hypre_CSRMatrix     *diag, *offd;
+   HYPRE_Int            num_rows, num_cols_offd, nnz_diag, nnz_offd;
+   hypre_longint        header[HYPRE_BINARY_HEADER_SIZE];
+   HYPRE_Int            my_id, ierr = 0;
+   char                 new_file_name[1024];
+   FILE                *fp;
+
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   /* Write from host memory */
+   if (hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(matrix)) != hypre_MEMORY_HOST)
+   {
+      h_matrix = hypre_ParCSRMatrixClone_v2(matrix, 1, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      h_matrix = matrix;
+   }
+
+   diag          = hypre_ParCSRMatrixDiag(h_matrix);
+   offd          = hypre_ParCSRMatrixOffd(h_matrix);
+   num_rows      = hypre_CSRMatrixNumRows(diag);
+   num_cols_offd = hypre_CSRMatrixNumCols(offd);
+   nnz_diag      = hypre_CSRMatrixNumNonzeros(diag);
+   nnz_offd      = hypre_CSRMatrixNumNonzeros(offd);
+
+   if ((nnz_diag && !hypre_CSRMatrixData(diag)) || (nnz_offd && !hypre_CSRMatrixData(offd)))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't write a matrix without values\n");
+      if (h_matrix != matrix)
+      {
+         hypre_ParCSRMatrixDestroy(h_matrix);
+      }
+      return hypre_error_flag;
+   }
+
+   hypre_BinaryInitHeader(header, HYPRE_BINARY_PARCSR, hypre_ParCSRMatrixComm(h_matrix));
+   header[HYPRE_BINARY_HDR_GLOBAL_ROWS]   = hypre_ParCSRMatrixGlobalNumRows(h_matrix);
+   header[HYPRE_BINARY_HDR_GLOBAL_COLS]   = hypre_ParCSRMatrixGlobalNumCols(h_matrix);
+   header[HYPRE_BINARY_HDR_ROW_START]     = hypre_ParCSRMatrixRowStarts(h_matrix)[0];
+   header[HYPRE_BINARY_HDR_ROW_END]       = hypre_ParCSRMatrixRowStarts(h_matrix)[1];
+   header[HYPRE_BINARY_HDR_COL_START]     = hypre_ParCSRMatrixColStarts(h_matrix)[0];
+   header[HYPRE_BINARY_HDR_COL_END]       = hypre_ParCSRMatrixColStarts(h_matrix)[1];
+   header[HYPRE_BINARY_HDR_NUM_COLS_OFFD] = num_cols_offd;
+   header[HYPRE_BINARY_HDR_NNZ_DIAG]      = nnz_diag;
+   header[HYPRE_BINARY_HDR_NNZ_OFFD]      = nnz_offd;
+
+   my_id = (HYPRE_Int) header[HYPRE_BINARY_HDR_RANK];
+   hypre_BinaryFileName(file_name, my_id, new_file_name);
+
+   if ((fp = fopen(new_file_name, "wb")) == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open binary output file\n");
+      if (h_matrix != matrix)
+      {
+         hypre_ParCSRMatrixDestroy(h_matrix);
+      }
+      return hypre_error_flag;
+   }
+
+   ierr += hypre_BinaryWriteArray(fp, header, sizeof(hypre_longint), HYPRE_BINARY_HEADER_SIZE);
+   ierr += hypre_BinaryWriteArray(fp, hypre_CSRMatrixI(diag), sizeof(HYPRE_Int), num_rows + 1);
+   ierr += hypre_BinaryWriteArray(fp, hypre_CSRMatrixJ(diag), sizeof(HYPRE_Int), nnz_diag);
+   ierr += hypre_BinaryWriteArray(fp, hypre_CSRMatrixData(diag), sizeof(HYPRE_Complex), nnz_diag);
+   ierr += hypre_BinaryWriteArray(fp, hypre_CSRMatrixI(offd), sizeof(HYPRE_Int), num_rows + 1);
+   ierr += hypre_BinaryWriteArray(fp, hypre_CSRMatrixJ(offd), sizeof(HYPRE_Int), nnz_offd);
+   ierr += hypre_BinaryWriteArray(fp, hypre_CSRMatrixData(offd), sizeof(HYPRE_Complex), nnz_offd);
+   ierr += hypre_BinaryWriteArray(fp, hypre_ParCSRMatrixColMapOffd(h_matrix),
+                                  sizeof(HYPRE_BigInt), num_cols_offd);
+   fclose(fp);
+
+   if (ierr)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't write binary output file\n");
+   }
+
+   if (h_matrix != matrix)
+   {
+      hypre_ParCSRMatrixDestroy(h_matrix);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixReadBinaryLocal
+ *
+ * Reads a matrix whose file set was written with the same number of ranks
+ * as comm has. Each rank reads its own file.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRMatrixReadBinaryLocal( MPI_Comm             comm,
+                                   const char          *file_name,
+                                   hypre_ParCSRMatrix **matrix_ptr )
+{
+   hypre_ParCSRMatrix  *matrix;
+   hypre_CSRMatrix     *diag, *offd;
+   hypre_longint        header[HYPRE_BINARY_HEADER_SIZE];
+   size_t               offsets[HYPRE_BINARY_NUM_SECTIONS];
+   HYPRE_BigInt         row_starts[2], col_starts[2];
+   HYPRE_Int            num_rows, num_cols_offd, nnz_diag, nnz_offd;
+   HYPRE_Int            my_id, ierr = 0, gerr;
+   FILE                *fp;
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   /* All ranks fail together if any of them can't open its file */
+   fp = hypre_BinaryReadHeader(file_name, my_id, HYPRE_BINARY_PARCSR, header);
+   ierr = (fp == NULL);
+   hypre_MPI_Allreduce(&ierr, &gerr, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   if (gerr)
+   {
+      if (fp)
+      {
+         fclose(fp);
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't read binary file set\n");
+      }
+      return hypre_error_flag;
+   }
+
+   row_starts[0] = (HYPRE_BigInt) header[HYPRE_BINARY_HDR_ROW_START];
+   row_starts[1] = (HYPRE_BigInt) header[HYPRE_BINARY_HDR_ROW_END];
+   col_starts[0] = (HYPRE_BigInt) header[HYPRE_BINARY_HDR_COL_START];
+   col_starts[1] = (HYPRE_BigInt) header[HYPRE_BINARY_HDR_COL_END];
+   num_rows      = (HYPRE_Int) (row_starts[1] - row_starts[0]);
+   num_cols_offd = (HYPRE_Int) header[HYPRE_BINARY_HDR_NUM_COLS_OFFD];
+   nnz_diag      = (HYPRE_Int) header[HYPRE_BINARY_HDR_NNZ_DIAG];
+   nnz_offd      = (HYPRE_Int) header[HYPRE_BINARY_HDR_NNZ_OFFD];
+
+   matrix = hypre_ParCSRMatrixCreate(comm,
+                                     (HYPRE_BigInt) header[HYPRE_BINARY_HDR_GLOBAL_ROWS],
+                                     (HYPRE_BigInt) header[HYPRE_BINARY_HDR_GLOBAL_COLS],
+                                     row_starts, col_starts, num_cols_offd,
+                                     nnz_diag, nnz_offd);
+   hypre_ParCSRMatrixInitialize_v2(matrix, HYPRE_MEMORY_HOST);
+
+   diag = hypre_ParCSRMatrixDiag(matrix);
+   offd = hypre_ParCSRMatrixOffd(matrix);
+
+   hypre_ParCSRMatrixBinaryOffsets(header, offsets);
+   ierr += hypre_BinaryReadAt(fp, offsets[HYPRE_BINARY_DIAG_I], hypre_CSRMatrixI(diag),
+                              sizeof(HYPRE_Int), num_rows + 1);
+   ierr += hypre_BinaryReadAt(fp, offsets[HYPRE_BINARY_DIAG_J], hypre_CSRMatrixJ(diag),
+                              sizeof(HYPRE_Int), nnz_diag);
+   ierr += hypre_BinaryReadAt(fp, offsets[HYPRE_BINARY_DIAG_DATA], hypre_CSRMatrixData(diag),
+                              sizeof(HYPRE_Complex), nnz_diag);
+   ierr += hypre_BinaryReadAt(fp, offsets[HYPRE_BINARY_OFFD_I], hypre_CSRMatrixI(offd),
+                              sizeof(HYPRE_Int), num_rows + 1);
+   ierr += hypre_BinaryReadAt(fp, offsets[HYPRE_BINARY_OFFD_J], hypre_CSRMatrixJ(offd),
+                              sizeof(HYPRE_Int), nnz_offd);
+   ierr += hypre_BinaryReadAt(fp, offsets[HYPRE_BINARY_OFFD_DATA], hypre_CSRMatrixData(offd),
+                              sizeof(HYPRE_Complex), nnz_offd);
+   ierr += hypre_BinaryReadAt(fp, offsets[HYPRE_BINARY_COL_MAP],
+                              hypre_ParCSRMatrixColMapOffd(matrix),
+                              sizeof(HYPRE_BigInt), num_cols_offd);
+   fclose(fp);
+
+   hypre_MPI_Allreduce(&ierr, &gerr, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   if (gerr)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: truncated binary input file\n");
+      hypre_ParCSRMatrixDestroy(matrix);
+      return hypre_error_flag;
+   }
+
+   *matrix_ptr = matrix;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixReadBinaryRepartition
+ *
+ * Reads a matrix from a file set written with num_files ranks and
+ * distributes its rows uniformly over the ranks of comm.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRMatrixReadBinaryRepartition( MPI_Comm             comm,
+                                         const char          *file_name,
+                                         HYPRE_Int            num_files,
+                                         hypre_longint       *header0,
+                                         hypre_ParCSRMatrix **matrix_ptr )
+{
+   hypre_ParCSRMatrix  *matrix;
+   hypre_CSRMatrix     *diag, *offd;
+   HYPRE_Int           *diag_i, *diag_j, *offd_i, *offd_j;
+   HYPRE_Complex       *diag_data, *offd_data;
+   HYPRE_BigInt        *col_map_offd;
+
+   HYPRE_BigInt         global_num_rows = (HYPRE_BigInt) header0[HYPRE_BINARY_HDR_GLOBAL_ROWS];
+   HYPRE_BigInt         global_num_cols = (HYPRE_BigInt) header0[HYPRE_BINARY_HDR_GLOBAL_COLS];
+   HYPRE_BigInt        *file_row_starts;
+   HYPRE_BigInt         row_starts[2], col_starts[2];
+   HYPRE_Int            my_id, num_procs, num_rows, f, i, j, k, ierr = 0, gerr;
+
+   /* Rows of the new partitioning, stored with global column indices */
+   HYPRE_Int           *row_nnz;
+   HYPRE_BigInt        *big_j = NULL;
+   HYPRE_Complex       *big_data = NULL;
+   HYPRE_Int            nnz = 0, max_nnz = 0;
+
+   HYPRE_Int            nnz_diag, nnz_offd, num_cols_offd;
+   HYPRE_BigInt        *tmp_j;
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   file_row_starts = hypre_TAlloc(HYPRE_BigInt, num_files + 1, HYPRE_MEMORY_HOST);
+   if (hypre_BinaryReadRowStarts(comm, file_name, HYPRE_BINARY_PARCSR, num_files, file_row_starts))
+   {
+      hypre_TFree(file_row_starts, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+
+   hypre_GenerateLocalPartitioning(global_num_rows, num_procs, my_id, row_starts);
+   if (global_num_rows == global_num_cols)
+   {
+      col_starts[0] = row_starts[0];
+      col_starts[1] = row_starts[1];
+   }
+   else
+   {
+      hypre_GenerateLocalPartitioning(global_num_cols, num_procs, my_id, col_starts);
+   }
+   num_rows = (HYPRE_Int) (row_starts[1] - row_starts[0]);
+   row_nnz  = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+
+   /* Read the overlapping row ranges of all files */
+   for (f = 0; f < num_files && !ierr; f++)
+   {
+      hypre_longint   header[HYPRE_BINARY_HEADER_SIZE];
+      size_t          offsets[HYPRE_BINARY_NUM_SECTIONS];
+      HYPRE_BigInt    lo, hi, file_col_start;
+      HYPRE_Int       nrows, row_offset, f_num_cols_offd;
+      HYPRE_Int      *f_diag_i, *f_offd_i, *f_diag_j, *f_offd_j;
+      HYPRE_Complex  *f_diag_data, *f_offd_data;
+      HYPRE_BigInt   *f_col_map;
+      HYPRE_Int       nd, no;
+      FILE           *fp;
+
+      lo = hypre_max(row_starts[0], file_row_starts[f]);
+      hi = hypre_min(row_starts[1], file_row_starts[f + 1]);
+      if (lo >= hi)
+      {
+         continue;
+      }
+
+      if ((fp = hypre_BinaryReadHeader(file_name, f, HYPRE_BINARY_PARCSR, header)) == NULL)
+      {
+         ierr = 1;
+         break;
+      }
+      hypre_ParCSRMatrixBinaryOffsets(header, offsets);
+
+      nrows           = (HYPRE_Int) (hi - lo);
+      row_offset      = (HYPRE_Int) (lo - file_row_starts[f]);
+      file_col_start  = (HYPRE_BigInt) header[HYPRE_BINARY_HDR_COL_START];
+      f_num_cols_offd = (HYPRE_Int) header[HYPRE_BINARY_HDR_NUM_COLS_OFFD];
+
+      f_diag_i  = hypre_TAlloc(HYPRE_Int, nrows + 1, HYPRE_MEMORY_HOST);
+      f_offd_i  = hypre_TAlloc(HYPRE_Int, nrows + 1, HYPRE_MEMORY_HOST);
+      f_col_map = hypre_TAlloc(HYPRE_BigInt, f_num_cols_offd, HYPRE_MEMORY_HOST);
+
+      ierr += hypre_BinaryReadAt(fp, offsets[HYPRE_BINARY_DIAG_I] + row_offset * sizeof(HYPRE_Int),
+                                 f_diag_i, sizeof(HYPRE_Int), nrows + 1);
+      ierr += hypre_BinaryReadAt(fp, offsets[HYPRE_BINARY_OFFD_I] + row_offset * sizeof(HYPRE_Int),
+                                 f_offd_i, sizeof(HYPRE_Int), nrows + 1);
+      ierr += hypre_BinaryReadAt(fp, offsets[HYPRE_BINARY_COL_MAP], f_col_map,
+                                 sizeof(HYPRE_BigInt), f_num_cols_offd);
+
+      nd = ierr ? 0 : f_diag_i[nrows] - f_diag_i[0];
+      no = ierr ? 0 : f_offd_i[nrows] - f_offd_i[0];
+
+      f_diag_j    = hypre_TAlloc(HYPRE_Int, nd, HYPRE_MEMORY_HOST);
+      f_diag_data = hypre_TAlloc(HYPRE_Complex, nd, HYPRE_MEMORY_HOST);
+      f_offd_j    = hypre_TAlloc(HYPRE_Int, no, HYPRE_MEMORY_HOST);
+      f_offd_data = hypre_TAlloc(HYPRE_Complex, no, HYPRE_MEMORY_HOST);
+
+      if (!ierr)
+      {
+         ierr += hypre_BinaryReadAt(fp, offsets[HYPRE_BINARY_DIAG_J] + f_diag_i[0] * sizeof(HYPRE_Int),
+                                    f_diag_j, sizeof(HYPRE_Int), nd);
+         ierr += hypre_BinaryReadAt(fp, offsets[HYPRE_BINARY_DIAG_DATA] +
+                                    f_diag_i[0] * sizeof(HYPRE_Complex),
+                                    f_diag_data, sizeof(HYPRE_Complex), nd);
+         ierr += hypre_BinaryReadAt(fp, offsets[HYPRE_BINARY_OFFD_J] + f_offd_i[0] * sizeof(HYPRE_Int),
+                                    f_offd_j, sizeof(HYPRE_Int), no);
+         ierr += hypre_BinaryReadAt(fp, offsets[HYPRE_BINARY_OFFD_DATA] +
+                                    f_offd_i[0] * sizeof(HYPRE_Complex),
+                                    f_offd_data, sizeof(HYPRE_Complex), no);
+      }
+      fclose(fp);
+
+      if (!ierr)
+      {
+         /* Append the rows with global column indices */
+         if (nnz + nd + no > max_nnz)
+         {
+            HYPRE_Int new_max = hypre_max(2 * max_nnz, nnz + nd + no);
+
+            big_j    = hypre_TReAlloc_v2(big_j, HYPRE_BigInt, max_nnz, HYPRE_BigInt, new_max,
+                                         HYPRE_MEMORY_HOST);
+            big_data = hypre_TReAlloc_v2(big_data, HYPRE_Complex, max_nnz, HYPRE_Complex, new_max,
+                                         HYPRE_MEMORY_HOST);
+            max_nnz  = new_max;
+         }
+
+         for (i = 0; i < nrows; i++)
+         {
+            HYPRE_Int row = (HYPRE_Int) (lo - row_starts[0]) + i;
+
+            for (j = f_diag_i[i] - f_diag_i[0]; j < f_diag_i[i + 1] - f_diag_i[0]; j++)
+            {
+               big_j[nnz]    = file_col_start + (HYPRE_BigInt) f_diag_j[j];
+               big_data[nnz] = f_diag_data[j];
+               nnz++;
+            }
+            for (j = f_offd_i[i] - f_offd_i[0]; j < f_offd_i[i + 1] - f_offd_i[0]; j++)
+            {
+               big_j[nnz]    = f_col_map[f_offd_j[j]];
+               big_data[nnz] = f_offd_data[j];
+               nnz++;
+            }
+            row_nnz[row + 1] = (f_diag_i[i + 1] - f_diag_i[i]) + (f_offd_i[i + 1] - f_offd_i[i]);
+         }
+      }
+
+      hypre_TFree(f_diag_i, HYPRE_MEMORY_HOST);
+      hypre_TFree(f_offd_i, HYPRE_MEMORY_HOST);
+      hypre_TFree(f_col_map, HYPRE_MEMORY_HOST);
+      hypre_TFree(f_diag_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(f_diag_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(f_offd_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(f_offd_data, HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(file_row_starts, HYPRE_MEMORY_HOST);
+
+   hypre_MPI_Allreduce(&ierr, &gerr, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   if (gerr)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't read binary file set\n");
+      hypre_TFree(row_nnz, HYPRE_MEMORY_HOST);
+      hypre_TFree(big_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(big_data, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+
+   for (i = 0; i < num_rows; i++)
+   {
+      row_nnz[i + 1] += row_nnz[i];
+   }
+
+   /* Split into diag and offd parts for the new column partitioning */
+   nnz_diag = nnz_offd = 0;
+   for (k = 0; k < nnz; k++)
+   {
+      if (big_j[k] >= col_starts[0] && big_j[k] < col_starts[1])
+      {
+         nnz_diag++;
+      }
+      else
+      {
+         nnz_offd++;
+      }
+   }
+
+   tmp_j = hypre_TAlloc(HYPRE_BigInt, nnz_offd, HYPRE_MEMORY_HOST);
+   for (k = 0, j = 0; k < nnz; k++)
+   {
+      if (big_j[k] < col_starts[0] || big_j[k] >= col_starts[1])
+      {
+         tmp_j[j++] = big_j[k];
+      }
+   }
+
+   num_cols_offd = 0;
+   if (nnz_offd)
+   {
+      hypre_BigQsort0(tmp_j, 0, nnz_offd - 1);
+      for (k = 1, num_cols_offd = 1; k < nnz_offd; k++)
+      {
+         if (tmp_j[k] > tmp_j[num_cols_offd - 1])
+         {
+            tmp_j[num_cols_offd++] = tmp_j[k];
+         }
+      }
+   }
+
+   matrix = hypre_ParCSRMatrixCreate(comm, global_num_rows, global_num_cols,
+                                     row_starts, col_starts, num_cols_offd,
+                                     nnz_diag, nnz_offd);
+   hypre_ParCSRMatrixInitialize_v2(matrix, HYPRE_MEMORY_HOST);
+
+   diag         = hypre_ParCSRMatrixDiag(matrix);
+   offd         = hypre_ParCSRMatrixOffd(matrix);
+   diag_i       = hypre_CSRMatrixI(diag);
+   diag_j       = hypre_CSRMatrixJ(diag);
+   diag_data    = hypre_CSRMatrixData(diag);
+   offd_i       = hypre_CSRMatrixI(offd);
+   offd_j       = hypre_CSRMatrixJ(offd);
+   offd_data    = hypre_CSRMatrixData(offd);
+   col_map_offd = hypre_ParCSRMatrixColMapOffd(matrix);
+
+   for (k = 0; k < num_cols_offd; k++)
+   {
+      col_map_offd[k] = tmp_j[k];
+   }
+   hypre_TFree(tmp_j, HYPRE_MEMORY_HOST);
+
+   nnz_diag = nnz_offd = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      diag_i[i] = nnz_diag;
+      offd_i[i] = nnz_offd;
+      for (k = row_nnz[i]; k < row_nnz[i + 1]; k++)
+      {
+         if (big_j[k] >= col_starts[0] && big_j[k] < col_starts[1])
+         {
+            diag_j[nnz_diag]    = (HYPRE_Int) (big_j[k] - col_starts[0]);
+            diag_data[nnz_diag] = big_data[k];
+            nnz_diag++;
+         }
+         else
+         {
+            offd_j[nnz_offd]    = hypre_BigBinarySearch(col_map_offd, big_j[k], num_cols_offd);
+            offd_data[nnz_offd] = big_data[k];
+            nnz_offd++;
+         }
+      }
+   }
+   diag_i[num_rows] = nnz_diag;
+   offd_i[num_rows] = nnz_offd;
+
+   /* move diagonal element in first position in each row */
+   if (row_starts[0] == col_starts[0] && row_starts[1] == col_starts[1])
+   {
+      for (i = 0; i < num_rows; i++)
+      {
+         for (k = diag_i[i]; k < diag_i[i + 1]; k++)
+         {
+            if (diag_j[k] == i)
+            {
+               HYPRE_Complex tmp = diag_data[k];
+
+               diag_j[k]            = diag_j[diag_i[i]];
+               diag_data[k]         = diag_data[diag_i[i]];
+               diag_j[diag_i[i]]    = i;
+               diag_data[diag_i[i]] = tmp;
+               break;
+            }
+         }
+      }
+   }
+
+   hypre_TFree(row_nnz, HYPRE_MEMORY_HOST);
+   hypre_TFree(big_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(big_data, HYPRE_MEMORY_HOST);
+
+   *matrix_ptr = matrix;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixReadBinary
+ *
+ * Reads a matrix written by hypre_ParCSRMatrixPrintBinary. If the file set
+ * was written with as many ranks as comm has, the writer's partitioning is
+ * kept; otherwise the rows are redistributed uniformly.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixReadBinary( MPI_Comm             comm,
+                              const char          *file_name,
+                              hypre_ParCSRMatrix **matrix_ptr )
+{
+   hypre_longint  header[HYPRE_BINARY_HEADER_SIZE];
+   HYPRE_Int      num_procs, num_files, ierr, gerr;
+   FILE          *fp;
+
+   *matrix_ptr = NULL;
+
+   /* Every rank reads the header of file 0; all fail together */
+   fp = hypre_BinaryReadHeader(file_name, 0, HYPRE_BINARY_PARCSR, header);
+   ierr = (fp == NULL);
+   if (fp)
+   {
+      fclose(fp);
+   }
+   hypre_MPI_Allreduce(&ierr, &gerr, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   if (gerr)
+   {
+      if (!ierr)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't read binary file set\n");
+      }
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   num_files = (HYPRE_Int) header[HYPRE_BINARY_HDR_NUM_PROCS];
+
+   if (num_files == num_procs)
+   {
+      return hypre_ParCSRMatrixReadBinaryLocal(comm, file_name, matrix_ptr);
+   }
+
+   return hypre_ParCSRMatrixReadBinaryRepartition(comm, file_name, num_files, header, matrix_ptr);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorPrintBinary
+ *
+ * Writes the vector to the per-rank files "<file_name>.bin.<rank>".
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorPrintBinary( hypre_ParVector *vector,
+                            const char      *file_name )
+{
+   hypre_ParVector  *h_vector;
+   hypre_longint     header[HYPRE_BINARY_HEADER_SIZE];
+   HYPRE_Int         my_id, ierr = 0;
+   char              new_file_name[1024];
+   FILE             *fp;
+
+   if (!vector)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (hypre_ParVectorNumVectors(vector) != 1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: binary output of multivectors not supported\n");
+      return hypre_error_flag;
+   }
+
+   if (hypre_GetActualMemLocation(hypre_ParVectorMemoryLocation(vector)) != hypre_MEMORY_HOST)
+   {
+      h_vector = hypre_ParVectorCloneDeep_v2(vector, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      h_vector = vector;
+   }
+
+   hypre_BinaryInitHeader(header, HYPRE_BINARY_PARVECTOR, hypre_ParVectorComm(h_vector));
+   header[HYPRE_BINARY_HDR_GLOBAL_ROWS] = hypre_ParVectorGlobalSize(h_vector);
+   header[HYPRE_BINARY_HDR_ROW_START]   = hypre_ParVectorPartitioning(h_vector)[0];
+   header[HYPRE_BINARY_HDR_ROW_END]     = hypre_ParVectorPartitioning(h_vector)[1];
+
+   my_id = (HYPRE_Int) header[HYPRE_BINARY_HDR_RANK];
+   hypre_BinaryFileName(file_name, my_id, new_file_name);
+
+   if ((fp = fopen(new_file_name, "wb")) == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open binary output file\n");
+   }
+   else
+   {
+      ierr += hypre_BinaryWriteArray(fp, header, sizeof(hypre_longint), HYPRE_BINARY_HEADER_SIZE);
+      ierr += hypre_BinaryWriteArray(fp, hypre_VectorData(hypre_ParVectorLocalVector(h_vector)),
+                                     sizeof(HYPRE_Complex),
+                                     hypre_VectorSize(hypre_ParVectorLocalVector(h_vector)));
+      fclose(fp);
+
+      if (ierr)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't write binary output file\n");
+      }
+   }
+
+   if (h_vector != vector)
+   {
+      hypre_ParVectorDestroy(h_vector);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorReadBinary
+ *
+ * Reads a vector written by hypre_ParVectorPrintBinary. If the file set was
+ * written with as many ranks as comm has, the writer's partitioning is kept;
+ * otherwise the entries are redistributed uniformly.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorReadBinary( MPI_Comm          comm,
+                           const char       *file_name,
+                           hypre_ParVector **vector_ptr )
+{
+   hypre_ParVector  *vector;
+   HYPRE_Complex    *data;
+   hypre_longint     header[HYPRE_BINARY_HEADER_SIZE];
+   HYPRE_BigInt      partitioning[2];
+   HYPRE_BigInt     *file_starts;
+   HYPRE_BigInt      global_size, lo, hi;
+   HYPRE_Int         my_id, num_procs, num_files, f, ierr = 0, gerr;
+   size_t            data_offset = HYPRE_BINARY_HEADER_SIZE * sizeof(hypre_longint);
+   FILE             *fp;
+
+   *vector_ptr = NULL;
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   /* Every rank reads the header of file 0; all fail together */
+   fp = hypre_BinaryReadHeader(file_name, 0, HYPRE_BINARY_PARVECTOR, header);
+   ierr = (fp == NULL);
+   if (fp)
+   {
+      fclose(fp);
+   }
+   hypre_MPI_Allreduce(&ierr, &gerr, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   if (gerr)
+   {
+      if (!ierr)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't read binary file set\n");
+      }
+      return hypre_error_flag;
+   }
+
+   global_size = (HYPRE_BigInt) header[HYPRE_BINARY_HDR_GLOBAL_ROWS];
+   num_files   = (HYPRE_Int) header[HYPRE_BINARY_HDR_NUM_PROCS];
+   file_starts = hypre_TAlloc(HYPRE_BigInt, num_files + 1, HYPRE_MEMORY_HOST);
+
+   if (num_files == num_procs)
+   {
+      fp = hypre_BinaryReadHeader(file_name, my_id, HYPRE_BINARY_PARVECTOR, header);
+      ierr = (fp == NULL);
+      if (fp)
+      {
+         fclose(fp);
+      }
+      hypre_MPI_Allreduce(&ierr, &gerr, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+      if (gerr)
+      {
+         if (!ierr)
+         {
+            hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't read binary file set\n");
+         }
+         hypre_TFree(file_starts, HYPRE_MEMORY_HOST);
+         return hypre_error_flag;
+      }
+      partitioning[0] = (HYPRE_BigInt) header[HYPRE_BINARY_HDR_ROW_START];
+      partitioning[1] = (HYPRE_BigInt) header[HYPRE_BINARY_HDR_ROW_END];
+      file_starts[my_id]     = partitioning[0];
+      file_starts[my_id + 1] = partitioning[1];
+   }
+   else
+   {
+      if (hypre_BinaryReadRowStarts(comm, file_name, HYPRE_BINARY_PARVECTOR,
+                                    num_files, file_starts))
+      {
+         hypre_TFree(file_starts, HYPRE_MEMORY_HOST);
+         return hypre_error_flag;
+      }
+      hypre_GenerateLocalPartitioning(global_size, num_procs, my_id, partitioning);
+   }
+
+   vector = hypre_ParVectorCreate(comm, global_size, partitioning);
+   hypre_ParVectorInitialize_v2(vector, HYPRE_MEMORY_HOST);
+   data = hypre_VectorData(hypre_ParVectorLocalVector(vector));
+
+   for (f = 0; f < num_files; f++)
+   {
+      if (num_files == num_procs && f != my_id)
+      {
+         continue;
+      }
+
+      lo = hypre_max(partitioning[0], file_starts[f]);
+      hi = hypre_min(partitioning[1], file_starts[f + 1]);
+      if (lo >= hi)
+      {
+         continue;
+      }
+
+      if ((fp = hypre_BinaryReadHeader(file_name, f, HYPRE_BINARY_PARVECTOR, header)) == NULL)
+      {
+         ierr = 1;
+         break;
+      }
+      ierr += hypre_BinaryReadAt(fp, data_offset + (size_t) (lo - file_starts[f]) * sizeof(HYPRE_Complex),
+                                 data + (lo - partitioning[0]), sizeof(HYPRE_Complex),
+                                 (size_t) (hi - lo));
+      fclose(fp);
+   }
+   hypre_TFree(file_starts, HYPRE_MEMORY_HOST);
+
+   hypre_MPI_Allreduce(&ierr, &gerr, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   if (gerr)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't read binary file set\n");
+      hypre_ParVectorDestroy(vector);
+      return hypre_error_flag;
+   }
+
+   *vector_ptr = vector;
+
+   return hypre_error_flag;
+}
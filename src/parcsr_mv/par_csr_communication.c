@@ -9,7 +9,6 @@
 
 /*==========================================================================*/
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 static CommPkgJobType getJobTypeOf(HYPRE_Int job)
 {
    CommPkgJobType job_type = HYPRE_COMM_PKG_JOB_COMPLEX;
@@ -251,6 +250,12 @@ hypre_ParCSRCommPkgGetPersistentCommHandle( HYPRE_Int job, hypre_ParCSRCommPkg *
 void
 hypre_ParCSRPersistentCommHandleDestroy( hypre_ParCSRPersistentCommHandle *comm_handle )
 {
+   HYPRE_Int i;
+
+   for (i = 0; i < hypre_ParCSRCommHandleNumRequests(comm_handle); i++)
+   {
+      hypre_MPI_Request_free(&hypre_ParCSRCommHandleRequest(comm_handle, i));
+   }
    hypre_TFree(hypre_ParCSRCommHandleSendDataBuffer(comm_handle), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_ParCSRCommHandleRecvDataBuffer(comm_handle), HYPRE_MEMORY_HOST);
    hypre_TFree(comm_handle->requests, HYPRE_MEMORY_HOST);
@@ -266,12 +271,16 @@ void hypre_ParCSRPersistentCommHandleStart( hypre_ParCSRPersistentCommHandle *co
 
    if (hypre_ParCSRCommHandleNumRequests(comm_handle) > 0)
    {
-      hypre_TMemcpy( hypre_ParCSRCommHandleSendDataBuffer(comm_handle),
-                     send_data,
-                     char,
-                     hypre_ParCSRCommHandleNumSendBytes(comm_handle),
-                     HYPRE_MEMORY_HOST,
-                     send_memory_location );
+      /* callers may pack directly into the persistent buffer */
+      if (send_data != hypre_ParCSRCommHandleSendDataBuffer(comm_handle))
+      {
+         hypre_TMemcpy( hypre_ParCSRCommHandleSendDataBuffer(comm_handle),
+                        send_data,
+                        char,
+                        hypre_ParCSRCommHandleNumSendBytes(comm_handle),
+                        HYPRE_MEMORY_HOST,
+                        send_memory_location );
+      }
 
       HYPRE_Int ret = hypre_MPI_Startall(hypre_ParCSRCommHandleNumRequests(comm_handle),
                                          hypre_ParCSRCommHandleRequests(comm_handle));
@@ -301,15 +310,83 @@ void hypre_ParCSRPersistentCommHandleWait( hypre_ParCSRPersistentCommHandle *com
          /*hypre_printf("MPI error %d in %s (%s, line %u)\n", ret, __FUNCTION__, __FILE__, __LINE__);*/
       }
 
-      hypre_TMemcpy(recv_data,
-                    hypre_ParCSRCommHandleRecvDataBuffer(comm_handle),
-                    char,
-                    hypre_ParCSRCommHandleNumRecvBytes(comm_handle),
-                    recv_memory_location,
-                    HYPRE_MEMORY_HOST);
+      /* callers may read directly from the persistent buffer */
+      if (recv_data != hypre_ParCSRCommHandleRecvDataBuffer(comm_handle))
+      {
+         hypre_TMemcpy(recv_data,
+                       hypre_ParCSRCommHandleRecvDataBuffer(comm_handle),
+                       char,
+                       hypre_ParCSRCommHandleNumRecvBytes(comm_handle),
+                       recv_memory_location,
+                       HYPRE_MEMORY_HOST);
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommPkgUsePersistent
+ *
+ * Returns 1 if communication with comm_pkg should go through its persistent
+ * comm handles: always with HYPRE_USING_PERSISTENT_COMM, otherwise only when
+ * requested at runtime (e.g., by BoomerAMG setup for every level).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRCommPkgUsePersistent( hypre_ParCSRCommPkg *comm_pkg )
+{
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   return comm_pkg != NULL;
+#else
+   return comm_pkg ? hypre_ParCSRCommPkgUsePersistentComm(comm_pkg) : 0;
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixSetPersistentComm
+ *
+ * Turn persistent communication on or off for the matvec comm_pkg of A
+ * (created if needed). Turning it off releases the persistent requests and
+ * buffers. The requests themselves are created on first use.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixSetPersistentComm( hypre_ParCSRMatrix *A,
+                                     HYPRE_Int           use_persistent_comm )
+{
+   hypre_ParCSRCommPkg *comm_pkg;
+   HYPRE_Int            i;
+
+   if (!A)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      if (!use_persistent_comm)
+      {
+         return hypre_error_flag;
+      }
+      hypre_MatvecCommPkgCreate(A);
+   }
+   comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+
+   if (!use_persistent_comm)
+   {
+      for (i = HYPRE_COMM_PKG_JOB_COMPLEX; i < NUM_OF_COMM_PKG_JOB_TYPE; ++i)
+      {
+         if (comm_pkg->persistent_comm_handles[i])
+         {
+            hypre_ParCSRPersistentCommHandleDestroy(comm_pkg->persistent_comm_handles[i]);
+            comm_pkg->persistent_comm_handles[i] = NULL;
+         }
+      }
    }
+   hypre_ParCSRCommPkgUsePersistentComm(comm_pkg) = use_persistent_comm;
+
+   return hypre_error_flag;
 }
-#endif // HYPRE_USING_PERSISTENT_COMM
 
 hypre_ParCSRCommHandle*
 hypre_ParCSRCommHandleCreate ( HYPRE_Int            job,
@@ -377,7 +454,6 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
     *           datatypes need to point to absolute
     *           addresses, e.g. generated using hypre_MPI_Address .
     *--------------------------------------------------------------------*/
-#ifndef HYPRE_WITH_GPU_AWARE_MPI
    switch (job)
    {
       case 1:
@@ -406,6 +482,7 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
          break;
    }
 
+#ifndef HYPRE_WITH_GPU_AWARE_MPI
    hypre_MemoryLocation act_send_memory_location = hypre_GetActualMemLocation(send_memory_location);
 
    if ( act_send_memory_location == hypre_MEMORY_DEVICE ||
@@ -604,6 +681,13 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
    hypre_ParCSRCommHandleNumRequests(comm_handle)        = num_requests;
    hypre_ParCSRCommHandleRequests(comm_handle)           = requests;
 
+   if (hypre_TraceEnabled())
+   {
+      hypre_TraceAddCounter(HYPRE_TRACE_MSGS, (job == 2 || job == 12 || job == 22) ?
+                            num_recvs : num_sends);
+      hypre_TraceAddCounter(HYPRE_TRACE_MSG_BYTES, num_send_bytes);
+   }
+
 #if defined(HYPRE_USING_NVTX)
    hypre_GpuProfilingPopRange();
 #endif
@@ -1013,7 +1097,6 @@ hypre_MatvecCommPkgCreate ( hypre_ParCSRMatrix *A )
 HYPRE_Int
 hypre_MatvecCommPkgDestroy( hypre_ParCSRCommPkg *comm_pkg )
 {
-#ifdef HYPRE_USING_PERSISTENT_COMM
    HYPRE_Int i;
    for (i = HYPRE_COMM_PKG_JOB_COMPLEX; i < NUM_OF_COMM_PKG_JOB_TYPE; ++i)
    {
@@ -1022,7 +1105,6 @@ hypre_MatvecCommPkgDestroy( hypre_ParCSRCommPkg *comm_pkg )
          hypre_ParCSRPersistentCommHandleDestroy(comm_pkg->persistent_comm_handles[i]);
       }
    }
-#endif
 
    if (hypre_ParCSRCommPkgNumSends(comm_pkg))
    {
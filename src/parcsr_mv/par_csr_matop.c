@@ -4327,9 +4327,6 @@ hypre_ParcsrBdiagInvScal( hypre_ParCSRMatrix   *A,
    HYPRE_Real *dense_all = hypre_CTAlloc(HYPRE_Complex, num_blocks * blockSize * blockSize,
                                          HYPRE_MEMORY_HOST);
    HYPRE_Real *dense = dense_all;
-   HYPRE_Int *IPIV  = hypre_TAlloc(HYPRE_Int, blockSize, HYPRE_MEMORY_HOST);
-   HYPRE_Complex *dgetri_work = NULL;
-   HYPRE_Int      dgetri_lwork = -1, lapack_info;
 
    HYPRE_Int  num_cols_A_offd_new;
    HYPRE_BigInt *col_map_offd_A_new;
@@ -4454,7 +4451,7 @@ hypre_ParcsrBdiagInvScal( hypre_ParCSRMatrix   *A,
       marker_newoffd[i] = -1;
    }
 
-   /* outer most loop for blocks */
+   /* first pass over the blocks */
    for (block_start = first_row_block; block_start < end_row_block;
         block_start += (HYPRE_BigInt)blockSize)
    {
@@ -4517,30 +4514,27 @@ hypre_ParcsrBdiagInvScal( hypre_ParCSRMatrix   *A,
          }
       }
 
-      /* 2. invert the dense matrix */
-      hypre_dgetrf(&s, &s, dense, &blockSize, IPIV, &lapack_info);
-
-      hypre_assert(lapack_info == 0);
-
-      if (lapack_info == 0)
+      /* pad a trailing partial block with the identity so that all the
+         blocks have the same size for the batched inversion */
+      for (i = s; i < blockSize; i++)
       {
-         HYPRE_Int query = -1;
-         HYPRE_Real lwork_opt;
-         /* query the optimal size of work */
-         hypre_dgetri(&s, dense, &blockSize, IPIV, &lwork_opt, &query, &lapack_info);
-
-         hypre_assert(lapack_info == 0);
+         dense[i + i * blockSize] = 1.0;
+      }
 
-         if (lwork_opt > dgetri_lwork)
-         {
-            dgetri_lwork = lwork_opt;
-            dgetri_work = hypre_TReAlloc(dgetri_work, HYPRE_Complex, dgetri_lwork, HYPRE_MEMORY_HOST);
-         }
+      dense += blockSize * blockSize;
+   } /* for each block */
 
-         hypre_dgetri(&s, dense, &blockSize, IPIV, dgetri_work, &dgetri_lwork, &lapack_info);
+   /* 2. invert the dense matrices */
+   hypre_DenseInverseBatched(blockSize, blockSize, blockSize * blockSize, num_blocks, dense_all);
 
-         hypre_assert(lapack_info == 0);
-      }
+   /* second pass over the blocks */
+   dense = dense_all;
+   for (block_start = first_row_block; block_start < end_row_block;
+        block_start += (HYPRE_BigInt)blockSize)
+   {
+      HYPRE_BigInt big_i;
+      block_end = hypre_min(block_start + (HYPRE_BigInt)blockSize, nrow_global);
+      s = (HYPRE_Int)(block_end - block_start);
 
       /* filter out *zeros* */
       HYPRE_Real Fnorm = 0.0;
@@ -4849,8 +4843,6 @@ hypre_ParcsrBdiagInvScal( hypre_ParCSRMatrix   *A,
    A->bdiaginv = dense_all;
 
    /* free workspace */
-   hypre_TFree(IPIV, HYPRE_MEMORY_HOST);
-   hypre_TFree(dgetri_work, HYPRE_MEMORY_HOST);
    hypre_TFree(marker_diag, HYPRE_MEMORY_HOST);
    hypre_TFree(marker_newoffd, HYPRE_MEMORY_HOST);
    hypre_TFree(offd2new, HYPRE_MEMORY_HOST);
@@ -2827,6 +2827,51 @@ hypre_ParCSRMatrixSetConstantValues( hypre_ParCSRMatrix *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixConvertToFloat
+ *
+ * Attach single precision copies of the values of the diag and offd blocks
+ * (and of their transposes, if kept); see hypre_CSRMatrixConvertToFloat.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixConvertToFloat( hypre_ParCSRMatrix *A )
+{
+   if (!A)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixConvertToFloat(hypre_ParCSRMatrixDiag(A));
+   hypre_CSRMatrixConvertToFloat(hypre_ParCSRMatrixOffd(A));
+   hypre_CSRMatrixConvertToFloat(hypre_ParCSRMatrixDiagT(A));
+   hypre_CSRMatrixConvertToFloat(hypre_ParCSRMatrixOffdT(A));
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixConvertFromFloat
+ *
+ * Drop the single precision copies made by hypre_ParCSRMatrixConvertToFloat.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixConvertFromFloat( hypre_ParCSRMatrix *A )
+{
+   if (!A)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixConvertFromFloat(hypre_ParCSRMatrixDiag(A));
+   hypre_CSRMatrixConvertFromFloat(hypre_ParCSRMatrixOffd(A));
+   hypre_CSRMatrixConvertFromFloat(hypre_ParCSRMatrixDiagT(A));
+   hypre_CSRMatrixConvertFromFloat(hypre_ParCSRMatrixOffdT(A));
+
+   return hypre_error_flag;
+}
+
 void
 hypre_ParCSRMatrixCopyColMapOffdToDevice(hypre_ParCSRMatrix *A)
 {
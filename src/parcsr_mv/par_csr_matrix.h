@@ -139,6 +139,25 @@ hypre_ParCSRMatrixMemoryLocation(hypre_ParCSRMatrix *matrix)
    return memory_diag;
 }
 
+/*--------------------------------------------------------------------------
+ * Symbolic structure of a host Galerkin product R^T A P
+ *
+ * Keeps the sparsity patterns of the inputs and of the local products
+ * computed by hypre_ParCSRMatrixRAPKTHost, so that a later product with
+ * unchanged patterns only runs the numeric phases of the local products
+ * (see hypre_ParCSRMatrixRAPKTReuse).
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_RAP_SYMBOLIC_NUM_PRODUCTS 8
+
+typedef struct
+{
+   hypre_CSRMatrix  *inputs[6];        /* diag and offd patterns of R, A and P */
+   HYPRE_BigInt     *col_map_offd[3];  /* col_map_offd of R, A and P */
+   hypre_CSRMatrix  *products[HYPRE_RAP_SYMBOLIC_NUM_PRODUCTS];
+
+} hypre_ParCSRRAPSymbolic;
+
 /*--------------------------------------------------------------------------
  * Parallel CSR Boolean Matrix
  *--------------------------------------------------------------------------*/
@@ -126,21 +126,16 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
 #endif
 
-   HYPRE_Int use_persistent_comm = 0;
-
-#ifdef HYPRE_USING_PERSISTENT_COMM
-   use_persistent_comm = num_vectors == 1;
-   // JSP TODO: we can use persistent communication for multi-vectors,
-   // but then we need different communication handles for different
-   // num_vectors.
-   hypre_ParCSRPersistentCommHandle *persistent_comm_handle;
-#endif
+   /* JSP TODO: we can use persistent communication for multi-vectors,
+      but then we need different communication handles for different
+      num_vectors. */
+   HYPRE_Int use_persistent_comm = num_vectors == 1 &&
+                                   hypre_ParCSRCommPkgUsePersistent(comm_pkg);
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
 
    if (use_persistent_comm)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
       persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
-#endif
    }
    else
    {
@@ -168,11 +163,9 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
 #else
    if (use_persistent_comm)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
       hypre_VectorData(x_tmp) = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(
                                    persistent_comm_handle);
       hypre_SeqVectorSetDataOwner(x_tmp, 0);
-#endif
    }
 #endif
 
@@ -205,10 +198,8 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
 #endif
       if (use_persistent_comm)
       {
-#ifdef HYPRE_USING_PERSISTENT_COMM
          x_buf_data[0] = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
          continue;
-#endif
       }
 
       x_buf_data[jv] = hypre_TAlloc(HYPRE_Complex,
@@ -300,9 +291,7 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    /* nonblocking communication starts */
    if (use_persistent_comm)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
       hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_DEVICE, x_buf_data[0]);
-#endif
    }
    else
    {
@@ -329,9 +318,7 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    /* nonblocking communication ends */
    if (use_persistent_comm)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
       hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_DEVICE, x_tmp_data);
-#endif
    }
    else
    {
@@ -371,8 +358,8 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
 #endif
          hypre_TFree(x_buf_data[jv], HYPRE_MEMORY_DEVICE);
       }
-      hypre_TFree(x_buf_data, HYPRE_MEMORY_HOST);
    }
+   hypre_TFree(x_buf_data, HYPRE_MEMORY_HOST);
 
 #if defined(HYPRE_USING_GPU)
    hypre_SetSyncCudaCompute(sync_stream);
@@ -383,6 +370,14 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
 #endif
 
+   if (hypre_TraceEnabled())
+   {
+      hypre_TraceAddMatvec(hypre_CSRMatrixNumRows(diag), hypre_CSRMatrixNumCols(diag),
+                           hypre_CSRMatrixNumNonzeros(diag), num_vectors);
+      hypre_TraceAddMatvec(hypre_CSRMatrixNumRows(offd), num_cols_offd,
+                           hypre_CSRMatrixNumNonzeros(offd), num_vectors);
+   }
+
    HYPRE_ANNOTATE_FUNC_END;
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
@@ -512,21 +507,16 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
    hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
 #endif
 
-   HYPRE_Int use_persistent_comm = 0;
-
-#ifdef HYPRE_USING_PERSISTENT_COMM
-   use_persistent_comm = num_vectors == 1;
-   // JSP TODO: we can use persistent communication for multi-vectors,
-   // but then we need different communication handles for different
-   // num_vectors.
-   hypre_ParCSRPersistentCommHandle *persistent_comm_handle;
-#endif
+   /* JSP TODO: we can use persistent communication for multi-vectors,
+      but then we need different communication handles for different
+      num_vectors. */
+   HYPRE_Int use_persistent_comm = num_vectors == 1 &&
+                                   hypre_ParCSRCommPkgUsePersistent(comm_pkg);
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
 
    if (use_persistent_comm)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
       persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(2, comm_pkg);
-#endif
    }
    else
    {
@@ -554,11 +544,9 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
 #else
    if (use_persistent_comm)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
       hypre_VectorData(y_tmp) = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(
                                    persistent_comm_handle);
       hypre_SeqVectorSetDataOwner(y_tmp, 0);
-#endif
    }
 #endif
 
@@ -591,10 +579,8 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
 #endif
       if (use_persistent_comm)
       {
-#ifdef HYPRE_USING_PERSISTENT_COMM
          y_buf_data[0] = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
          continue;
-#endif
       }
 
       y_buf_data[jv] = hypre_TAlloc(HYPRE_Complex,
@@ -643,9 +629,7 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
 
    if (use_persistent_comm)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
       hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_DEVICE, y_tmp_data);
-#endif
    }
    else
    {
@@ -682,9 +666,7 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
    /* nonblocking communication ends */
    if (use_persistent_comm)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
       hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_DEVICE, y_buf_data[0]);
-#endif
    }
    else
    {
@@ -780,8 +762,8 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
 #endif
          hypre_TFree(y_buf_data[jv], HYPRE_MEMORY_DEVICE);
       }
-      hypre_TFree(y_buf_data, HYPRE_MEMORY_HOST);
    }
+   hypre_TFree(y_buf_data, HYPRE_MEMORY_HOST);
 
 #if defined(HYPRE_USING_GPU)
    hypre_SetSyncCudaCompute(sync_stream);
@@ -792,6 +774,14 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
    hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
 #endif
 
+   if (hypre_TraceEnabled())
+   {
+      hypre_TraceAddMatvec(hypre_CSRMatrixNumRows(diag), hypre_CSRMatrixNumCols(diag),
+                           hypre_CSRMatrixNumNonzeros(diag), num_vectors);
+      hypre_TraceAddMatvec(hypre_CSRMatrixNumRows(offd), num_cols_offd,
+                           hypre_CSRMatrixNumNonzeros(offd), num_vectors);
+   }
+
    HYPRE_ANNOTATE_FUNC_END;
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
@@ -937,6 +927,444 @@ hypre_ParCSRMatrixMatvec_FF( HYPRE_Complex       alpha,
    return ierr;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixResidualRestrict
+ *
+ * Fused residual and restriction, f_c = P^T (f - A u), on the host.
+ *
+ * Each row residual r_i is formed in a register and immediately scattered
+ * through row i of P, so the fine-grid residual vector is never written.
+ * The halo exchange of u is overlapped with the rows of A that have no
+ * off-processor entries, and the exchange of the off-processor coarse
+ * contributions is overlapped with the reduction of the thread-local
+ * partial sums.
+ *
+ * The thread-local partial sums live in the caller's workspace 'work' when
+ * it holds at least (num_threads - 1) * (num_cols(P_diag) + num_cols(P_offd))
+ * entries; otherwise they are allocated here.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixResidualRestrict( hypre_ParCSRMatrix *A,
+                                    hypre_ParCSRMatrix *P,
+                                    hypre_ParVector    *u,
+                                    hypre_ParVector    *f,
+                                    hypre_ParVector    *f_c,
+                                    HYPRE_Complex      *work,
+                                    HYPRE_Int           work_size )
+{
+   MPI_Comm             comm          = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix     *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int           *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int           *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Complex       *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   hypre_CSRMatrix     *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int           *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int           *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Complex       *A_offd_data   = hypre_CSRMatrixData(A_offd);
+   hypre_CSRMatrix     *P_diag        = hypre_ParCSRMatrixDiag(P);
+   HYPRE_Int           *P_diag_i      = hypre_CSRMatrixI(P_diag);
+   HYPRE_Int           *P_diag_j      = hypre_CSRMatrixJ(P_diag);
+   HYPRE_Complex       *P_diag_data   = hypre_CSRMatrixData(P_diag);
+   hypre_CSRMatrix     *P_offd        = hypre_ParCSRMatrixOffd(P);
+   HYPRE_Int           *P_offd_i      = hypre_CSRMatrixI(P_offd);
+   HYPRE_Int           *P_offd_j      = hypre_CSRMatrixJ(P_offd);
+   HYPRE_Complex       *P_offd_data   = hypre_CSRMatrixData(P_offd);
+   HYPRE_Int            num_rows      = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int            num_coarse    = hypre_CSRMatrixNumCols(P_diag);
+   HYPRE_Int            num_cols_P_offd = hypre_CSRMatrixNumCols(P_offd);
+   HYPRE_Complex       *u_data        = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Complex       *f_data        = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Complex       *f_c_data      = hypre_VectorData(hypre_ParVectorLocalVector(f_c));
+
+   hypre_ParCSRCommPkg              *A_comm_pkg;
+   hypre_ParCSRCommPkg              *P_comm_pkg;
+   hypre_ParCSRCommHandle           *comm_handle = NULL;
+   hypre_ParCSRPersistentCommHandle *A_persistent_handle = NULL;
+   hypre_ParCSRPersistentCommHandle *P_persistent_handle = NULL;
+   HYPRE_Int                         A_use_persistent = 0;
+   HYPRE_Int                         P_use_persistent = 0;
+
+   HYPRE_Complex *u_buf_data  = NULL;
+   HYPRE_Complex *u_ext_data  = NULL;
+   HYPRE_Complex *y_offd_data = NULL;
+   HYPRE_Complex *y_recv_data = NULL;
+   HYPRE_Complex *thr_data    = NULL;
+   HYPRE_Int      thr_stride  = num_coarse + num_cols_P_offd;
+   HYPRE_Int      num_threads = hypre_NumThreads();
+   HYPRE_Int      num_procs, num_sends, phase, i, j, t;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+   if (!hypre_ParCSRMatrixCommPkg(P))
+   {
+      hypre_MatvecCommPkgCreate(P);
+   }
+   A_comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   P_comm_pkg = hypre_ParCSRMatrixCommPkg(P);
+
+   /*-----------------------------------------------------------------
+    * Start the halo exchange of u
+    *-----------------------------------------------------------------*/
+
+   if (num_procs > 1)
+   {
+      num_sends = hypre_ParCSRCommPkgNumSends(A_comm_pkg);
+      A_use_persistent = hypre_ParCSRCommPkgUsePersistent(A_comm_pkg);
+      if (A_use_persistent)
+      {
+         A_persistent_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, A_comm_pkg);
+         u_buf_data = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(A_persistent_handle);
+         u_ext_data = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(A_persistent_handle);
+      }
+      else
+      {
+         u_buf_data = hypre_TAlloc(HYPRE_Complex,
+                                   hypre_ParCSRCommPkgSendMapStart(A_comm_pkg, num_sends),
+                                   HYPRE_MEMORY_HOST);
+         u_ext_data = hypre_TAlloc(HYPRE_Complex, hypre_CSRMatrixNumCols(A_offd),
+                                   HYPRE_MEMORY_HOST);
+      }
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < hypre_ParCSRCommPkgSendMapStart(A_comm_pkg, num_sends); i++)
+      {
+         u_buf_data[i] = u_data[hypre_ParCSRCommPkgSendMapElmt(A_comm_pkg, i)];
+      }
+
+      if (A_use_persistent)
+      {
+         hypre_ParCSRPersistentCommHandleStart(A_persistent_handle, HYPRE_MEMORY_HOST, u_buf_data);
+      }
+      else
+      {
+         comm_handle = hypre_ParCSRCommHandleCreate(1, A_comm_pkg, u_buf_data, u_ext_data);
+      }
+
+      P_use_persistent = hypre_ParCSRCommPkgUsePersistent(P_comm_pkg);
+      if (P_use_persistent)
+      {
+         P_persistent_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(2, P_comm_pkg);
+         y_offd_data = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(P_persistent_handle);
+         y_recv_data = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(P_persistent_handle);
+      }
+      else
+      {
+         num_sends = hypre_ParCSRCommPkgNumSends(P_comm_pkg);
+         y_offd_data = hypre_TAlloc(HYPRE_Complex, num_cols_P_offd, HYPRE_MEMORY_HOST);
+         y_recv_data = hypre_TAlloc(HYPRE_Complex,
+                                    hypre_ParCSRCommPkgSendMapStart(P_comm_pkg, num_sends),
+                                    HYPRE_MEMORY_HOST);
+      }
+   }
+
+   /* thread 0 accumulates into f_c and y_offd, the others into private copies */
+   if (num_threads > 1)
+   {
+      if (work && work_size >= (num_threads - 1) * thr_stride)
+      {
+         thr_data = work;
+      }
+      else
+      {
+         thr_data = hypre_TAlloc(HYPRE_Complex, (num_threads - 1) * thr_stride, HYPRE_MEMORY_HOST);
+      }
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < (num_threads - 1) * thr_stride; i++)
+      {
+         thr_data[i] = 0.0;
+      }
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_coarse; i++)
+   {
+      f_c_data[i] = 0.0;
+   }
+   for (i = 0; i < num_cols_P_offd; i++)
+   {
+      y_offd_data[i] = 0.0;
+   }
+
+   /*-----------------------------------------------------------------
+    * Phase 0: rows without off-processor couplings in A (overlaps the
+    * halo exchange of u). Phase 1: the remaining rows.
+    *-----------------------------------------------------------------*/
+
+   for (phase = 0; phase < 2; phase++)
+   {
+      if (phase == 1 && num_procs > 1)
+      {
+         if (A_use_persistent)
+         {
+            hypre_ParCSRPersistentCommHandleWait(A_persistent_handle, HYPRE_MEMORY_HOST, u_ext_data);
+         }
+         else
+         {
+            hypre_ParCSRCommHandleDestroy(comm_handle);
+            comm_handle = NULL;
+         }
+      }
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(t) HYPRE_SMP_SCHEDULE
+#endif
+      for (t = 0; t < num_threads; t++)
+      {
+         HYPRE_Complex *fc_t = t ? thr_data + (t - 1) * thr_stride : f_c_data;
+         HYPRE_Complex *yo_t = t ? thr_data + (t - 1) * thr_stride + num_coarse : y_offd_data;
+         HYPRE_Complex  res;
+         HYPRE_Int      ii, jj, ns, ne;
+
+         hypre_partition1D(num_rows, num_threads, t, &ns, &ne);
+
+         for (ii = ns; ii < ne; ii++)
+         {
+            if ((A_offd_i[ii + 1] > A_offd_i[ii]) != phase)
+            {
+               continue;
+            }
+
+            res = f_data[ii];
+            for (jj = A_diag_i[ii]; jj < A_diag_i[ii + 1]; jj++)
+            {
+               res -= A_diag_data[jj] * u_data[A_diag_j[jj]];
+            }
+            for (jj = A_offd_i[ii]; jj < A_offd_i[ii + 1]; jj++)
+            {
+               res -= A_offd_data[jj] * u_ext_data[A_offd_j[jj]];
+            }
+
+            for (jj = P_diag_i[ii]; jj < P_diag_i[ii + 1]; jj++)
+            {
+               fc_t[P_diag_j[jj]] += P_diag_data[jj] * res;
+            }
+            for (jj = P_offd_i[ii]; jj < P_offd_i[ii + 1]; jj++)
+            {
+               yo_t[P_offd_j[jj]] += P_offd_data[jj] * res;
+            }
+         }
+      }
+   }
+
+   /*-----------------------------------------------------------------
+    * Send the off-processor coarse contributions, reduce the local ones
+    * while they are in flight, then add the received contributions
+    *-----------------------------------------------------------------*/
+
+   if (num_procs > 1)
+   {
+      for (t = 1; t < num_threads; t++)
+      {
+         HYPRE_Complex *yo_t = thr_data + (t - 1) * thr_stride + num_coarse;
+         for (i = 0; i < num_cols_P_offd; i++)
+         {
+            y_offd_data[i] += yo_t[i];
+         }
+      }
+
+      if (P_use_persistent)
+      {
+         hypre_ParCSRPersistentCommHandleStart(P_persistent_handle, HYPRE_MEMORY_HOST, y_offd_data);
+      }
+      else
+      {
+         comm_handle = hypre_ParCSRCommHandleCreate(2, P_comm_pkg, y_offd_data, y_recv_data);
+      }
+   }
+
+   if (num_threads > 1)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i,t) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_coarse; i++)
+      {
+         for (t = 1; t < num_threads; t++)
+         {
+            f_c_data[i] += thr_data[(t - 1) * thr_stride + i];
+         }
+      }
+   }
+
+   if (num_procs > 1)
+   {
+      if (P_use_persistent)
+      {
+         hypre_ParCSRPersistentCommHandleWait(P_persistent_handle, HYPRE_MEMORY_HOST, y_recv_data);
+      }
+      else
+      {
+         hypre_ParCSRCommHandleDestroy(comm_handle);
+         comm_handle = NULL;
+      }
+
+      num_sends = hypre_ParCSRCommPkgNumSends(P_comm_pkg);
+      for (j = 0; j < hypre_ParCSRCommPkgSendMapStart(P_comm_pkg, num_sends); j++)
+      {
+         f_c_data[hypre_ParCSRCommPkgSendMapElmt(P_comm_pkg, j)] += y_recv_data[j];
+      }
+
+      if (!A_use_persistent)
+      {
+         hypre_TFree(u_buf_data, HYPRE_MEMORY_HOST);
+         hypre_TFree(u_ext_data, HYPRE_MEMORY_HOST);
+      }
+      if (!P_use_persistent)
+      {
+         hypre_TFree(y_offd_data, HYPRE_MEMORY_HOST);
+         hypre_TFree(y_recv_data, HYPRE_MEMORY_HOST);
+      }
+   }
+   if (thr_data != work)
+   {
+      hypre_TFree(thr_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixInterpCorrect
+ *
+ * Fused interpolation and correction, u = u + P e_c, on the host.
+ *
+ * The diag and offd parts of P are applied in a single pass over u, and
+ * the halo exchange of e_c is overlapped with the rows of P that have no
+ * off-processor entries.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixInterpCorrect( hypre_ParCSRMatrix *P,
+                                 hypre_ParVector    *e_c,
+                                 hypre_ParVector    *u )
+{
+   MPI_Comm             comm          = hypre_ParCSRMatrixComm(P);
+   hypre_CSRMatrix     *P_diag        = hypre_ParCSRMatrixDiag(P);
+   HYPRE_Int           *P_diag_i      = hypre_CSRMatrixI(P_diag);
+   HYPRE_Int           *P_diag_j      = hypre_CSRMatrixJ(P_diag);
+   HYPRE_Complex       *P_diag_data   = hypre_CSRMatrixData(P_diag);
+   hypre_CSRMatrix     *P_offd        = hypre_ParCSRMatrixOffd(P);
+   HYPRE_Int           *P_offd_i      = hypre_CSRMatrixI(P_offd);
+   HYPRE_Int           *P_offd_j      = hypre_CSRMatrixJ(P_offd);
+   HYPRE_Complex       *P_offd_data   = hypre_CSRMatrixData(P_offd);
+   HYPRE_Int            num_rows      = hypre_CSRMatrixNumRows(P_diag);
+   HYPRE_Complex       *e_c_data      = hypre_VectorData(hypre_ParVectorLocalVector(e_c));
+   HYPRE_Complex       *u_data        = hypre_VectorData(hypre_ParVectorLocalVector(u));
+
+   hypre_ParCSRCommPkg              *comm_pkg;
+   hypre_ParCSRCommHandle           *comm_handle = NULL;
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
+   HYPRE_Int                         use_persistent_comm = 0;
+
+   HYPRE_Complex *e_buf_data = NULL;
+   HYPRE_Complex *e_ext_data = NULL;
+   HYPRE_Complex  sum;
+   HYPRE_Int      num_procs, num_sends, phase, i, jj;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   if (!hypre_ParCSRMatrixCommPkg(P))
+   {
+      hypre_MatvecCommPkgCreate(P);
+   }
+   comm_pkg = hypre_ParCSRMatrixCommPkg(P);
+
+   if (num_procs > 1)
+   {
+      num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      use_persistent_comm = hypre_ParCSRCommPkgUsePersistent(comm_pkg);
+      if (use_persistent_comm)
+      {
+         persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
+         e_buf_data = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
+         e_ext_data = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
+      }
+      else
+      {
+         e_buf_data = hypre_TAlloc(HYPRE_Complex,
+                                   hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                                   HYPRE_MEMORY_HOST);
+         e_ext_data = hypre_TAlloc(HYPRE_Complex, hypre_CSRMatrixNumCols(P_offd),
+                                   HYPRE_MEMORY_HOST);
+      }
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends); i++)
+      {
+         e_buf_data[i] = e_c_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+      }
+
+      if (use_persistent_comm)
+      {
+         hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, e_buf_data);
+      }
+      else
+      {
+         comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, e_buf_data, e_ext_data);
+      }
+   }
+
+   for (phase = 0; phase < 2; phase++)
+   {
+      if (phase == 1 && num_procs > 1)
+      {
+         if (use_persistent_comm)
+         {
+            hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, e_ext_data);
+         }
+         else
+         {
+            hypre_ParCSRCommHandleDestroy(comm_handle);
+            comm_handle = NULL;
+         }
+      }
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i,jj,sum) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         if ((P_offd_i[i + 1] > P_offd_i[i]) != phase)
+         {
+            continue;
+         }
+
+         sum = u_data[i];
+         for (jj = P_diag_i[i]; jj < P_diag_i[i + 1]; jj++)
+         {
+            sum += P_diag_data[jj] * e_c_data[P_diag_j[jj]];
+         }
+         for (jj = P_offd_i[i]; jj < P_offd_i[i + 1]; jj++)
+         {
+            sum += P_offd_data[jj] * e_ext_data[P_offd_j[jj]];
+         }
+         u_data[i] = sum;
+      }
+   }
+
+   if (num_procs > 1 && !use_persistent_comm)
+   {
+      hypre_TFree(e_buf_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(e_ext_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
 HYPRE_Int
 hypre_ParCSRMatrixMatvecT_unpack( HYPRE_Complex       *locl_data,
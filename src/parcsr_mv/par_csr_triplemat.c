@@ -485,11 +485,125 @@ hypre_ParCSRTMatMat( hypre_ParCSRMatrix  *A,
    return hypre_ParCSRTMatMatKT( A, B, 0);
 }
 
-hypre_ParCSRMatrix*
-hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
-                             hypre_ParCSRMatrix *A,
-                             hypre_ParCSRMatrix *P,
-                             HYPRE_Int           keep_transpose )
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPSymbolicPattern
+ *
+ * Returns a copy of the sparsity pattern of A (no values).
+ *--------------------------------------------------------------------------*/
+
+static hypre_CSRMatrix*
+hypre_ParCSRRAPSymbolicPattern( hypre_CSRMatrix *A )
+{
+   hypre_CSRMatrix *B = hypre_CSRMatrixClone(A, 0);
+
+   hypre_TFree(hypre_CSRMatrixData(B), hypre_CSRMatrixMemoryLocation(B));
+   hypre_CSRMatrixData(B) = NULL;
+
+   return B;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPSymbolicSamePattern
+ *
+ * Returns 1 if A has the sparsity pattern stored in B.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRRAPSymbolicSamePattern( hypre_CSRMatrix *A,
+                                    hypre_CSRMatrix *B )
+{
+   HYPRE_Int num_rows     = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int num_nonzeros = hypre_CSRMatrixNumNonzeros(A);
+
+   if (num_rows != hypre_CSRMatrixNumRows(B) ||
+       hypre_CSRMatrixNumCols(A) != hypre_CSRMatrixNumCols(B) ||
+       num_nonzeros != hypre_CSRMatrixNumNonzeros(B))
+   {
+      return 0;
+   }
+
+   if (memcmp(hypre_CSRMatrixI(A), hypre_CSRMatrixI(B), (size_t) (num_rows + 1) * sizeof(HYPRE_Int)))
+   {
+      return 0;
+   }
+
+   if (num_nonzeros &&
+       memcmp(hypre_CSRMatrixJ(A), hypre_CSRMatrixJ(B), (size_t) num_nonzeros * sizeof(HYPRE_Int)))
+   {
+      return 0;
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPSymbolicDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRRAPSymbolicDestroy( hypre_ParCSRRAPSymbolic *symbolic )
+{
+   HYPRE_Int i;
+
+   if (symbolic)
+   {
+      for (i = 0; i < 6; i++)
+      {
+         hypre_CSRMatrixDestroy(symbolic -> inputs[i]);
+      }
+      for (i = 0; i < 3; i++)
+      {
+         hypre_TFree(symbolic -> col_map_offd[i], HYPRE_MEMORY_HOST);
+      }
+      for (i = 0; i < HYPRE_RAP_SYMBOLIC_NUM_PRODUCTS; i++)
+      {
+         hypre_CSRMatrixDestroy(symbolic -> products[i]);
+      }
+      hypre_TFree(symbolic, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPSymbolicMultiply
+ *
+ * Local product C = A * B, number k of the Galerkin product. If symbolic
+ * holds the pattern of this product, only the numeric phase is run;
+ * otherwise the product is computed in full and its pattern is recorded.
+ *--------------------------------------------------------------------------*/
+
+static hypre_CSRMatrix*
+hypre_ParCSRRAPSymbolicMultiply( hypre_ParCSRRAPSymbolic *symbolic,
+                                 HYPRE_Int                k,
+                                 hypre_CSRMatrix         *A,
+                                 hypre_CSRMatrix         *B )
+{
+   hypre_CSRMatrix *C;
+
+   if (symbolic && symbolic -> products[k])
+   {
+      C = hypre_CSRMatrixClone(symbolic -> products[k], 0);
+      hypre_CSRMatrixMultiplyNumericHost(A, B, C);
+   }
+   else
+   {
+      C = hypre_CSRMatrixMultiplyHost(A, B);
+      if (symbolic)
+      {
+         symbolic -> products[k] = hypre_ParCSRRAPSymbolicPattern(C);
+      }
+   }
+
+   return C;
+}
+
+static hypre_ParCSRMatrix*
+hypre_ParCSRMatrixRAPKTHostSymbolic( hypre_ParCSRMatrix      *R,
+                                     hypre_ParCSRMatrix      *A,
+                                     hypre_ParCSRMatrix      *P,
+                                     HYPRE_Int                keep_transpose,
+                                     hypre_ParCSRRAPSymbolic *symbolic )
 {
    MPI_Comm         comm = hypre_ParCSRMatrixComm(A);
 
@@ -621,8 +735,8 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
          hypre_CSRMatrixSplit(Ps_ext, first_col_diag_P, last_col_diag_P, num_cols_offd_P, col_map_offd_P,
                               &num_cols_offd_Q, &col_map_offd_Q, &Pext_diag, &Pext_offd);
          /* These require data from other processes */
-         APext_diag = hypre_CSRMatrixMultiplyHost(A_offd, Pext_diag);
-         APext_offd = hypre_CSRMatrixMultiplyHost(A_offd, Pext_offd);
+         APext_diag = hypre_ParCSRRAPSymbolicMultiply(symbolic, 0, A_offd, Pext_diag);
+         APext_offd = hypre_ParCSRRAPSymbolicMultiply(symbolic, 1, A_offd, Pext_offd);
 
          hypre_CSRMatrixDestroy(Pext_diag);
          hypre_CSRMatrixDestroy(Pext_offd);
@@ -638,12 +752,12 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
       }
       hypre_CSRMatrixDestroy(Ps_ext);
       /* These are local and could be overlapped with communication */
-      AP_diag = hypre_CSRMatrixMultiplyHost(A_diag, P_diag);
+      AP_diag = hypre_ParCSRRAPSymbolicMultiply(symbolic, 2, A_diag, P_diag);
 
       if (num_cols_offd_P)
       {
          HYPRE_Int i;
-         AP_offd = hypre_CSRMatrixMultiplyHost(A_diag, P_offd);
+         AP_offd = hypre_ParCSRRAPSymbolicMultiply(symbolic, 3, A_diag, P_offd);
          if (num_cols_offd_Q > num_cols_offd_P)
          {
             map_P_to_Q = hypre_CTAlloc(HYPRE_Int, num_cols_offd_P, HYPRE_MEMORY_HOST);
@@ -713,10 +827,10 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
       hypre_ParCSRMatrixColMapOffd(Q) = col_map_offd_Q;
 
       hypre_CSRMatrixTranspose(R_diag, &RT_diag, 1);
-      C_tmp_diag = hypre_CSRMatrixMultiplyHost(RT_diag, Q_diag);
+      C_tmp_diag = hypre_ParCSRRAPSymbolicMultiply(symbolic, 4, RT_diag, Q_diag);
       if (num_cols_offd_Q)
       {
-         C_tmp_offd = hypre_CSRMatrixMultiplyHost(RT_diag, Q_offd);
+         C_tmp_offd = hypre_ParCSRRAPSymbolicMultiply(symbolic, 5, RT_diag, Q_offd);
       }
       else
       {
@@ -736,8 +850,8 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
       if (num_cols_offd_R)
       {
          hypre_CSRMatrixTranspose(R_offd, &RT_offd, 1);
-         C_int_diag = hypre_CSRMatrixMultiplyHost(RT_offd, Q_diag);
-         C_int_offd = hypre_CSRMatrixMultiplyHost(RT_offd, Q_offd);
+         C_int_diag = hypre_ParCSRRAPSymbolicMultiply(symbolic, 6, RT_offd, Q_diag);
+         C_int_offd = hypre_ParCSRRAPSymbolicMultiply(symbolic, 7, RT_offd, Q_offd);
 
          hypre_ParCSRMatrixDiag(Q) = C_int_diag;
          hypre_ParCSRMatrixOffd(Q) = C_int_offd;
@@ -849,9 +963,9 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
    }
    else
    {
-      Q_diag = hypre_CSRMatrixMultiplyHost(A_diag, P_diag);
+      Q_diag = hypre_ParCSRRAPSymbolicMultiply(symbolic, 0, A_diag, P_diag);
       hypre_CSRMatrixTranspose(R_diag, &RT_diag, 1);
-      C_diag = hypre_CSRMatrixMultiplyHost(RT_diag, Q_diag);
+      C_diag = hypre_ParCSRRAPSymbolicMultiply(symbolic, 1, RT_diag, Q_diag);
       C_offd = hypre_CSRMatrixCreate(num_cols_diag_R, 0, 0);
       hypre_CSRMatrixInitialize_v2(C_offd, 0, hypre_CSRMatrixMemoryLocation(C_diag));
       if (keep_transpose)
@@ -894,6 +1008,97 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
    return C;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixRAPKTHost
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRMatrix*
+hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
+                             hypre_ParCSRMatrix *A,
+                             hypre_ParCSRMatrix *P,
+                             HYPRE_Int           keep_transpose )
+{
+   return hypre_ParCSRMatrixRAPKTHostSymbolic(R, A, P, keep_transpose, NULL);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixRAPKTReuse
+ *
+ * Computes R^T A P like hypre_ParCSRMatrixRAPKT and keeps its symbolic
+ * structure in *symbolic_ptr. If *symbolic_ptr holds the structure of a
+ * previous product whose inputs had the same sparsity patterns on all
+ * processes, the local products only run their numeric phases; otherwise
+ * the old structure is replaced. The communication and the additions of
+ * the local products are always done. On the device, *symbolic_ptr is
+ * destroyed and the product is computed by hypre_ParCSRMatrixRAPKT.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRMatrix*
+hypre_ParCSRMatrixRAPKTReuse( hypre_ParCSRMatrix       *R,
+                              hypre_ParCSRMatrix       *A,
+                              hypre_ParCSRMatrix       *P,
+                              HYPRE_Int                 keep_transpose,
+                              hypre_ParCSRRAPSymbolic **symbolic_ptr )
+{
+   MPI_Comm                 comm     = hypre_ParCSRMatrixComm(A);
+   hypre_ParCSRRAPSymbolic *symbolic = *symbolic_ptr;
+   hypre_ParCSRMatrix      *M[3];
+   HYPRE_Int                same, all_same, i;
+
+#if defined(HYPRE_USING_GPU)
+   if (hypre_GetExecPolicy2( hypre_ParCSRMatrixMemoryLocation(R),
+                             hypre_ParCSRMatrixMemoryLocation(A) ) == HYPRE_EXEC_DEVICE)
+   {
+      hypre_ParCSRRAPSymbolicDestroy(symbolic);
+      *symbolic_ptr = NULL;
+
+      return hypre_ParCSRMatrixRAPKT(R, A, P, keep_transpose);
+   }
+#endif
+
+   M[0] = R; M[1] = A; M[2] = P;
+
+   /* The local products depend on the patterns of the rows received from
+      other processes, so the structure is reused only if all agree */
+   same = (symbolic != NULL);
+   for (i = 0; i < 3 && same; i++)
+   {
+      same = hypre_ParCSRRAPSymbolicSamePattern(hypre_ParCSRMatrixDiag(M[i]),
+                                                symbolic -> inputs[2 * i]) &&
+             hypre_ParCSRRAPSymbolicSamePattern(hypre_ParCSRMatrixOffd(M[i]),
+                                                symbolic -> inputs[2 * i + 1]) &&
+             (hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(M[i])) == 0 ||
+              !memcmp(hypre_ParCSRMatrixColMapOffd(M[i]), symbolic -> col_map_offd[i],
+                      (size_t) hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(M[i])) *
+                      sizeof(HYPRE_BigInt)));
+   }
+   hypre_MPI_Allreduce(&same, &all_same, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+
+   if (!all_same)
+   {
+      HYPRE_Int num_cols_offd;
+
+      hypre_ParCSRRAPSymbolicDestroy(symbolic);
+      symbolic = hypre_CTAlloc(hypre_ParCSRRAPSymbolic, 1, HYPRE_MEMORY_HOST);
+      for (i = 0; i < 3; i++)
+      {
+         num_cols_offd = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(M[i]));
+
+         symbolic -> inputs[2 * i]     = hypre_ParCSRRAPSymbolicPattern(hypre_ParCSRMatrixDiag(M[i]));
+         symbolic -> inputs[2 * i + 1] = hypre_ParCSRRAPSymbolicPattern(hypre_ParCSRMatrixOffd(M[i]));
+         if (num_cols_offd)
+         {
+            symbolic -> col_map_offd[i] = hypre_TAlloc(HYPRE_BigInt, num_cols_offd, HYPRE_MEMORY_HOST);
+            hypre_TMemcpy(symbolic -> col_map_offd[i], hypre_ParCSRMatrixColMapOffd(M[i]),
+                          HYPRE_BigInt, num_cols_offd, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+         }
+      }
+      *symbolic_ptr = symbolic;
+   }
+
+   return hypre_ParCSRMatrixRAPKTHostSymbolic(R, A, P, keep_transpose, symbolic);
+}
+
 hypre_ParCSRMatrix*
 hypre_ParCSRMatrixRAPKT( hypre_ParCSRMatrix  *R,
                          hypre_ParCSRMatrix  *A,
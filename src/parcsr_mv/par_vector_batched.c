@@ -136,3 +136,114 @@ hypre_ParVectorMassDotpTwo ( hypre_ParVector  *x,
    return hypre_error_flag;
 }
 
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorBlockInnerProd
+ *
+ * result[ix + iy * ld] = <x[ix], y[iy]> for 0 <= ix < nx, 0 <= iy < ny,
+ * computed with a single global reduction.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorBlockInnerProd( HYPRE_Int          nx,
+                               hypre_ParVector  **x,
+                               HYPRE_Int          ny,
+                               hypre_ParVector  **y,
+                               HYPRE_Int          ld,
+                               HYPRE_Complex     *result )
+{
+   MPI_Comm        comm;
+   hypre_Vector  **x_local, **y_local;
+   HYPRE_Complex  *local_result, *global_result;
+   HYPRE_Int       ix, iy;
+
+   if (nx <= 0 || ny <= 0)
+   {
+      return hypre_error_flag;
+   }
+
+   comm    = hypre_ParVectorComm(x[0]);
+   x_local = hypre_TAlloc(hypre_Vector *, nx, HYPRE_MEMORY_HOST);
+   y_local = hypre_TAlloc(hypre_Vector *, ny, HYPRE_MEMORY_HOST);
+
+   for (ix = 0; ix < nx; ix++)
+   {
+      x_local[ix] = hypre_ParVectorLocalVector(x[ix]);
+   }
+   for (iy = 0; iy < ny; iy++)
+   {
+      y_local[iy] = hypre_ParVectorLocalVector(y[iy]);
+   }
+
+   local_result  = hypre_TAlloc(HYPRE_Complex, nx * ny, HYPRE_MEMORY_HOST);
+   global_result = hypre_TAlloc(HYPRE_Complex, nx * ny, HYPRE_MEMORY_HOST);
+
+   hypre_SeqVectorBlockInnerProd(nx, x_local, ny, y_local, nx, local_result);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Allreduce(local_result, global_result, nx * ny, HYPRE_MPI_COMPLEX,
+                       hypre_MPI_SUM, comm);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   for (iy = 0; iy < ny; iy++)
+   {
+      for (ix = 0; ix < nx; ix++)
+      {
+         result[ix + iy * ld] = global_result[ix + iy * nx];
+      }
+   }
+
+   hypre_TFree(x_local, HYPRE_MEMORY_HOST);
+   hypre_TFree(y_local, HYPRE_MEMORY_HOST);
+   hypre_TFree(local_result, HYPRE_MEMORY_HOST);
+   hypre_TFree(global_result, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorBlockAxpy
+ *
+ * y[iy] = beta * y[iy] + sum_ix coef[ix + iy * ld] * x[ix] for 0 <= iy < ny.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorBlockAxpy( HYPRE_Int          nx,
+                          hypre_ParVector  **x,
+                          HYPRE_Int          ny,
+                          hypre_ParVector  **y,
+                          HYPRE_Int          ld,
+                          HYPRE_Complex     *coef,
+                          HYPRE_Complex      beta )
+{
+   hypre_Vector  **x_local, **y_local;
+   HYPRE_Int       ix, iy;
+
+   if (ny <= 0)
+   {
+      return hypre_error_flag;
+   }
+
+   x_local = hypre_TAlloc(hypre_Vector *, nx, HYPRE_MEMORY_HOST);
+   y_local = hypre_TAlloc(hypre_Vector *, ny, HYPRE_MEMORY_HOST);
+
+   for (ix = 0; ix < nx; ix++)
+   {
+      x_local[ix] = hypre_ParVectorLocalVector(x[ix]);
+   }
+   for (iy = 0; iy < ny; iy++)
+   {
+      y_local[iy] = hypre_ParVectorLocalVector(y[iy]);
+   }
+
+   hypre_SeqVectorBlockAxpy(nx, x_local, ny, y_local, ld, coef, beta);
+
+   hypre_TFree(x_local, HYPRE_MEMORY_HOST);
+   hypre_TFree(y_local, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
@@ -173,6 +173,14 @@ HYPRE_Int hypre_GetAssumedPartitionRowRange ( MPI_Comm comm, HYPRE_Int proc_id,
                                               HYPRE_BigInt *row_end );
 HYPRE_Int hypre_ParVectorCreateAssumedPartition ( hypre_ParVector *vector );
 
+/* par_csr_binary.c */
+HYPRE_Int hypre_ParCSRMatrixPrintBinary ( hypre_ParCSRMatrix *matrix, const char *file_name );
+HYPRE_Int hypre_ParCSRMatrixReadBinary ( MPI_Comm comm, const char *file_name,
+                                         hypre_ParCSRMatrix **matrix_ptr );
+HYPRE_Int hypre_ParVectorPrintBinary ( hypre_ParVector *vector, const char *file_name );
+HYPRE_Int hypre_ParVectorReadBinary ( MPI_Comm comm, const char *file_name,
+                                      hypre_ParVector **vector_ptr );
+
 /* par_csr_bool_matop.c */
 hypre_ParCSRBooleanMatrix *hypre_ParBooleanMatmul ( hypre_ParCSRBooleanMatrix *A,
                                                     hypre_ParCSRBooleanMatrix *B );
@@ -336,7 +344,6 @@ HYPRE_Int hypre_ParCSRMatrixDropSmallEntriesHost( hypre_ParCSRMatrix *A, HYPRE_R
 HYPRE_Int hypre_ParCSRMatrixDropSmallEntriesDevice( hypre_ParCSRMatrix *A, HYPRE_Complex tol,
                                                     HYPRE_Int type);
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 hypre_ParCSRPersistentCommHandle* hypre_ParCSRPersistentCommHandleCreate(HYPRE_Int job,
                                                                          hypre_ParCSRCommPkg *comm_pkg);
 hypre_ParCSRPersistentCommHandle* hypre_ParCSRCommPkgGetPersistentCommHandle(HYPRE_Int job,
@@ -346,7 +353,8 @@ void hypre_ParCSRPersistentCommHandleStart(hypre_ParCSRPersistentCommHandle *com
                                            HYPRE_MemoryLocation send_memory_location, void *send_data);
 void hypre_ParCSRPersistentCommHandleWait(hypre_ParCSRPersistentCommHandle *comm_handle,
                                           HYPRE_MemoryLocation recv_memory_location, void *recv_data);
-#endif
+HYPRE_Int hypre_ParCSRCommPkgUsePersistent(hypre_ParCSRCommPkg *comm_pkg);
+HYPRE_Int hypre_ParCSRMatrixSetPersistentComm(hypre_ParCSRMatrix *A, HYPRE_Int use_persistent_comm);
 
 HYPRE_Int hypre_ParcsrGetExternalRowsInit( hypre_ParCSRMatrix *A, HYPRE_Int indices_len,
                                            HYPRE_BigInt *indices, hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int want_data, void **request_ptr);
@@ -435,6 +443,8 @@ hypre_ParCSRMatrix* hypre_ParCSRMatrixClone_v2 ( hypre_ParCSRMatrix *A, HYPRE_In
                                                  HYPRE_MemoryLocation memory_location );
 HYPRE_Int hypre_ParCSRMatrixMigrate(hypre_ParCSRMatrix *A, HYPRE_MemoryLocation memory_location);
 HYPRE_Int hypre_ParCSRMatrixSetConstantValues( hypre_ParCSRMatrix *A, HYPRE_Complex value );
+HYPRE_Int hypre_ParCSRMatrixConvertToFloat( hypre_ParCSRMatrix *A );
+HYPRE_Int hypre_ParCSRMatrixConvertFromFloat( hypre_ParCSRMatrix *A );
 void hypre_ParCSRMatrixCopyColMapOffdToDevice(hypre_ParCSRMatrix *A);
 
 /* par_csr_matvec.c */
@@ -450,6 +460,11 @@ HYPRE_Int hypre_ParCSRMatrixMatvecT_unpack( HYPRE_Complex *locl_data, HYPRE_Comp
                                             hypre_ParCSRCommPkg *comm_pkg );
 HYPRE_Int hypre_ParCSRMatrixMatvec_FF ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
                                         hypre_ParVector *x, HYPRE_Complex beta, hypre_ParVector *y, HYPRE_Int *CF_marker, HYPRE_Int fpt );
+HYPRE_Int hypre_ParCSRMatrixResidualRestrict ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *P,
+                                               hypre_ParVector *u, hypre_ParVector *f, hypre_ParVector *f_c,
+                                               HYPRE_Complex *work, HYPRE_Int work_size );
+HYPRE_Int hypre_ParCSRMatrixInterpCorrect ( hypre_ParCSRMatrix *P, hypre_ParVector *e_c,
+                                            hypre_ParVector *u );
 
 /* par_csr_triplemat.c */
 hypre_ParCSRMatrix *hypre_ParCSRMatMat( hypre_ParCSRMatrix  *A, hypre_ParCSRMatrix  *B );
@@ -471,6 +486,10 @@ hypre_ParCSRMatrix* hypre_ParCSRMatrixRAPKTDevice( hypre_ParCSRMatrix *R, hypre_
                                                    hypre_ParCSRMatrix *P, HYPRE_Int keep_transpose );
 hypre_ParCSRMatrix* hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix *A,
                                                  hypre_ParCSRMatrix *P, HYPRE_Int keep_transpose );
+hypre_ParCSRMatrix* hypre_ParCSRMatrixRAPKTReuse( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix *A,
+                                                  hypre_ParCSRMatrix *P, HYPRE_Int keep_transpose,
+                                                  hypre_ParCSRRAPSymbolic **symbolic_ptr );
+HYPRE_Int hypre_ParCSRRAPSymbolicDestroy( hypre_ParCSRRAPSymbolic *symbolic );
 
 /* par_make_system.c */
 HYPRE_ParCSR_System_Problem *HYPRE_Generate2DSystem ( HYPRE_ParCSRMatrix H_L1,
@@ -507,6 +526,11 @@ HYPRE_Int hypre_ParVectorMassInnerProd ( hypre_ParVector *x, hypre_ParVector **y
                                          HYPRE_Int unroll, HYPRE_Real *prod );
 HYPRE_Int hypre_ParVectorMassDotpTwo ( hypre_ParVector *x, hypre_ParVector *y, hypre_ParVector **z,
                                        HYPRE_Int k, HYPRE_Int unroll, HYPRE_Real *prod_x, HYPRE_Real *prod_y );
+HYPRE_Int hypre_ParVectorBlockInnerProd ( HYPRE_Int nx, hypre_ParVector **x, HYPRE_Int ny,
+                                          hypre_ParVector **y, HYPRE_Int ld, HYPRE_Complex *result );
+HYPRE_Int hypre_ParVectorBlockAxpy ( HYPRE_Int nx, hypre_ParVector **x, HYPRE_Int ny,
+                                     hypre_ParVector **y, HYPRE_Int ld, HYPRE_Complex *coef,
+                                     HYPRE_Complex beta );
 hypre_ParVector *hypre_VectorToParVector ( MPI_Comm comm, hypre_Vector *v,
                                            HYPRE_BigInt *vec_starts );
 hypre_Vector *hypre_ParVectorToVectorAll ( hypre_ParVector *par_v );
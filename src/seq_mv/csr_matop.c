@@ -645,6 +645,7 @@ hypre_CSRMatrixBigAdd( hypre_CSRMatrix *A,
  * hypre_CSRMatrixMultiplyHost
  *
  * Multiplies two CSR Matrices A and B and returns a CSR Matrix C;
+ * See csr_spgemm_host.c for the symbolic and numeric phases.
  *
  * Note: The routine does not check for 0-elements which might be generated
  *       through cancellation of elements in A and B or already contained
@@ -655,264 +656,14 @@ hypre_CSRMatrix*
 hypre_CSRMatrixMultiplyHost( hypre_CSRMatrix *A,
                              hypre_CSRMatrix *B )
 {
-   HYPRE_Complex        *A_data    = hypre_CSRMatrixData(A);
-   HYPRE_Int            *A_i       = hypre_CSRMatrixI(A);
-   HYPRE_Int            *A_j       = hypre_CSRMatrixJ(A);
-   HYPRE_Int            *rownnz_A  = hypre_CSRMatrixRownnz(A);
-   HYPRE_Int             nrows_A   = hypre_CSRMatrixNumRows(A);
-   HYPRE_Int             ncols_A   = hypre_CSRMatrixNumCols(A);
-   HYPRE_Int             nnzrows_A = hypre_CSRMatrixNumRownnz(A);
-   HYPRE_Int             num_nnz_A = hypre_CSRMatrixNumNonzeros(A);
-
-   HYPRE_Complex        *B_data    = hypre_CSRMatrixData(B);
-   HYPRE_Int            *B_i       = hypre_CSRMatrixI(B);
-   HYPRE_Int            *B_j       = hypre_CSRMatrixJ(B);
-   HYPRE_Int             nrows_B   = hypre_CSRMatrixNumRows(B);
-   HYPRE_Int             ncols_B   = hypre_CSRMatrixNumCols(B);
-   HYPRE_Int             num_nnz_B = hypre_CSRMatrixNumNonzeros(B);
-
-   HYPRE_MemoryLocation  memory_location_A = hypre_CSRMatrixMemoryLocation(A);
-   HYPRE_MemoryLocation  memory_location_B = hypre_CSRMatrixMemoryLocation(B);
-
-   hypre_CSRMatrix      *C;
-   HYPRE_Complex        *C_data;
-   HYPRE_Int            *C_i;
-   HYPRE_Int            *C_j;
-
-   HYPRE_Int             ia, ib, ic, ja, jb, num_nonzeros;
-   HYPRE_Int             counter;
-   HYPRE_Complex         a_entry, b_entry;
-   HYPRE_Int             allsquare = 0;
-   HYPRE_Int            *twspace;
+   hypre_CSRMatrix *C;
 
-   /* RL: TODO cannot guarantee, maybe should never assert
-   hypre_assert(memory_location_A == memory_location_B);
-   */
-
-   /* RL: in the case of A=H, B=D, or A=D, B=H, let C = D,
-    * not sure if this is the right thing to do.
-    * Also, need something like this in other places
-    * TODO */
-   HYPRE_MemoryLocation memory_location_C = hypre_max(memory_location_A, memory_location_B);
-
-   if (ncols_A != nrows_B)
-   {
-      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Warning! incompatible matrix dimensions!\n");
-      return NULL;
-   }
-
-   if (nrows_A == ncols_B)
-   {
-      allsquare = 1;
-   }
-
-   if ((num_nnz_A == 0) || (num_nnz_B == 0))
+   hypre_CSRMatrixMultiplySymbolicHost(A, B, &C);
+   if (C)
    {
-      C = hypre_CSRMatrixCreate(nrows_A, ncols_B, 0);
-      hypre_CSRMatrixNumRownnz(C) = 0;
-      hypre_CSRMatrixInitialize_v2(C, 0, memory_location_C);
-
-      return C;
+      hypre_CSRMatrixMultiplyNumericHost(A, B, C);
    }
 
-   /* Allocate memory */
-   twspace = hypre_TAlloc(HYPRE_Int, hypre_NumThreads(), HYPRE_MEMORY_HOST);
-   C_i = hypre_CTAlloc(HYPRE_Int, nrows_A + 1, memory_location_C);
-
-#ifdef HYPRE_USING_OPENMP
-   #pragma omp parallel private(ia, ib, ic, ja, jb, num_nonzeros, counter, a_entry, b_entry)
-#endif
-   {
-      HYPRE_Int  *B_marker = NULL;
-      HYPRE_Int   ns, ne, ii, jj;
-      HYPRE_Int   num_threads;
-      HYPRE_Int   i1, iic;
-
-      ii = hypre_GetThreadNum();
-      num_threads = hypre_NumActiveThreads();
-      hypre_partition1D(nnzrows_A, num_threads, ii, &ns, &ne);
-
-      B_marker = hypre_CTAlloc(HYPRE_Int, ncols_B, HYPRE_MEMORY_HOST);
-      for (ib = 0; ib < ncols_B; ib++)
-      {
-         B_marker[ib] = -1;
-      }
-
-      HYPRE_ANNOTATE_REGION_BEGIN("%s", "First pass");
-
-      /* First pass: compute sizes of C rows. */
-      num_nonzeros = 0;
-      for (ic = ns; ic < ne; ic++)
-      {
-         if (rownnz_A)
-         {
-            iic = rownnz_A[ic];
-            C_i[iic] = num_nonzeros;
-         }
-         else
-         {
-            iic = ic;
-            C_i[iic] = num_nonzeros;
-            if (allsquare)
-            {
-               B_marker[iic] = iic;
-               num_nonzeros++;
-            }
-         }
-
-         for (ia = A_i[iic]; ia < A_i[iic + 1]; ia++)
-         {
-            ja = A_j[ia];
-            for (ib = B_i[ja]; ib < B_i[ja + 1]; ib++)
-            {
-               jb = B_j[ib];
-               if (B_marker[jb] != iic)
-               {
-                  B_marker[jb] = iic;
-                  num_nonzeros++;
-               }
-            }
-         }
-      }
-      twspace[ii] = num_nonzeros;
-
-#ifdef HYPRE_USING_OPENMP
-      #pragma omp barrier
-#endif
-
-      /* Correct C_i - phase 1 */
-      if (ii)
-      {
-         jj = twspace[0];
-         for (i1 = 1; i1 < ii; i1++)
-         {
-            jj += twspace[i1];
-         }
-
-         for (i1 = ns; i1 < ne; i1++)
-         {
-            iic = rownnz_A ? rownnz_A[i1] : i1;
-            C_i[iic] += jj;
-         }
-      }
-      else
-      {
-         C_i[nrows_A] = 0;
-         for (i1 = 0; i1 < num_threads; i1++)
-         {
-            C_i[nrows_A] += twspace[i1];
-         }
-
-         C = hypre_CSRMatrixCreate(nrows_A, ncols_B, C_i[nrows_A]);
-         hypre_CSRMatrixI(C) = C_i;
-         hypre_CSRMatrixInitialize_v2(C, 0, memory_location_C);
-         C_j = hypre_CSRMatrixJ(C);
-         C_data = hypre_CSRMatrixData(C);
-      }
-
-      /* Correct C_i - phase 2 */
-      if (rownnz_A != NULL)
-      {
-#ifdef HYPRE_USING_OPENMP
-         #pragma omp barrier
-#endif
-         for (ic = ns; ic < (ne - 1); ic++)
-         {
-            for (iic = rownnz_A[ic] + 1; iic < rownnz_A[ic + 1]; iic++)
-            {
-               C_i[iic] = C_i[rownnz_A[ic + 1]];
-            }
-         }
-
-         if (ii < (num_threads - 1))
-         {
-            for (iic = rownnz_A[ne - 1] + 1; iic < rownnz_A[ne]; iic++)
-            {
-               C_i[iic] = C_i[rownnz_A[ne]];
-            }
-         }
-         else
-         {
-            for (iic = rownnz_A[ne - 1] + 1; iic < nrows_A; iic++)
-            {
-               C_i[iic] = C_i[nrows_A];
-            }
-         }
-      }
-      /* End of First Pass */
-      HYPRE_ANNOTATE_REGION_END("%s", "First pass");
-
-#ifdef HYPRE_USING_OPENMP
-      #pragma omp barrier
-#endif
-
-      /* Second pass: Fill in C_data and C_j. */
-      HYPRE_ANNOTATE_REGION_BEGIN("%s", "Second pass");
-      for (ib = 0; ib < ncols_B; ib++)
-      {
-         B_marker[ib] = -1;
-      }
-
-      counter = rownnz_A ? C_i[rownnz_A[ns]] : C_i[ns];
-      for (ic = ns; ic < ne; ic++)
-      {
-         if (rownnz_A)
-         {
-            iic = rownnz_A[ic];
-         }
-         else
-         {
-            iic = ic;
-            if (allsquare)
-            {
-               B_marker[ic] = counter;
-               C_data[counter] = 0;
-               C_j[counter] = ic;
-               counter++;
-            }
-         }
-
-         for (ia = A_i[iic]; ia < A_i[iic + 1]; ia++)
-         {
-            ja = A_j[ia];
-            a_entry = A_data[ia];
-            for (ib = B_i[ja]; ib < B_i[ja + 1]; ib++)
-            {
-               jb = B_j[ib];
-               b_entry = B_data[ib];
-               if (B_marker[jb] < C_i[iic])
-               {
-                  B_marker[jb] = counter;
-                  C_j[B_marker[jb]] = jb;
-                  C_data[B_marker[jb]] = a_entry * b_entry;
-                  counter++;
-               }
-               else
-               {
-                  C_data[B_marker[jb]] += a_entry * b_entry;
-               }
-            }
-         }
-      }
-      HYPRE_ANNOTATE_REGION_END("%s", "Second pass");
-
-      /* End of Second Pass */
-      hypre_TFree(B_marker, HYPRE_MEMORY_HOST);
-   } /*end parallel region */
-
-#ifdef HYPRE_DEBUG
-   for (ic = 0; ic < nrows_A; ic++)
-   {
-      hypre_assert(C_i[ic] <= C_i[ic + 1]);
-   }
-#endif
-
-   // Set rownnz and num_rownnz
-   hypre_CSRMatrixSetRownnz(C);
-
-   /* Free memory */
-   hypre_TFree(twspace, HYPRE_MEMORY_HOST);
-
    return C;
 }
 
@@ -1573,6 +1324,8 @@ hypre_CSRMatrixReorder(hypre_CSRMatrix *A)
 {
    HYPRE_Int ierr = 0;
 
+   hypre_CSRMatrixInvalidateCopies(A);
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP) || defined(HYPRE_USING_SYCL)
    HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1( hypre_CSRMatrixMemoryLocation(A) );
 
@@ -1985,6 +1738,8 @@ hypre_CSRMatrixScale( hypre_CSRMatrix *A,
    HYPRE_Int      i;
    HYPRE_Int      k = hypre_CSRMatrixNumNonzeros(A);
 
+   hypre_CSRMatrixInvalidateCopies(A);
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
    HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1( hypre_CSRMatrixMemoryLocation(A) );
 
@@ -2013,6 +1768,8 @@ hypre_CSRMatrixDiagScale( hypre_CSRMatrix *A,
    HYPRE_Complex *ldata  = ld ? hypre_VectorData(ld) : NULL;
    HYPRE_Complex *rdata  = rd ? hypre_VectorData(rd) : NULL;
 
+   hypre_CSRMatrixInvalidateCopies(A);
+
    if (!ldata && !rdata)
    {
       return hypre_error_flag;
@@ -2056,6 +1813,8 @@ hypre_CSRMatrixSetConstantValues( hypre_CSRMatrix *A,
    HYPRE_Int i;
    HYPRE_Int nnz = hypre_CSRMatrixNumNonzeros(A);
 
+   hypre_CSRMatrixInvalidateCopies(A);
+
    if (!hypre_CSRMatrixData(A))
    {
       hypre_CSRMatrixData(A) = hypre_TAlloc(HYPRE_Complex, nnz, hypre_CSRMatrixMemoryLocation(A));
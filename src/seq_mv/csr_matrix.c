@@ -40,6 +40,9 @@ hypre_CSRMatrixCreate( HYPRE_Int num_rows,
    hypre_CSRMatrixNumCols(matrix)        = num_cols;
    hypre_CSRMatrixNumNonzeros(matrix)    = num_nonzeros;
    hypre_CSRMatrixMemoryLocation(matrix) = hypre_HandleMemoryLocation(hypre_handle());
+   hypre_CSRMatrixSellData(matrix)       = NULL;
+   hypre_CSRMatrixDataFloat(matrix)      = NULL;
+   hypre_CSRMatrixGeneration(matrix)     = 0;
 
    /* set defaults */
    hypre_CSRMatrixOwnsData(matrix)       = 1;
@@ -66,6 +69,8 @@ hypre_CSRMatrixDestroy( hypre_CSRMatrix *matrix )
 
       hypre_TFree(hypre_CSRMatrixI(matrix),      memory_location);
       hypre_TFree(hypre_CSRMatrixRownnz(matrix), HYPRE_MEMORY_HOST);
+      hypre_CSRSellDataDestroy(hypre_CSRMatrixSellData(matrix));
+      hypre_TFree(hypre_CSRMatrixDataFloat(matrix), HYPRE_MEMORY_HOST);
 
       if ( hypre_CSRMatrixOwnsData(matrix) )
       {
@@ -179,6 +184,7 @@ hypre_CSRMatrixResize( hypre_CSRMatrix *matrix, HYPRE_Int new_num_rows, HYPRE_In
       return 1;
    }
 
+   hypre_CSRMatrixInvalidateCopies(matrix);
    hypre_CSRMatrixNumCols(matrix) = new_num_cols;
 
    if (new_num_nonzeros != hypre_CSRMatrixNumNonzeros(matrix))
@@ -754,6 +760,9 @@ hypre_CSRMatrixCopy( hypre_CSRMatrix *A, hypre_CSRMatrix *B, HYPRE_Int copy_data
    HYPRE_MemoryLocation memory_location_A = hypre_CSRMatrixMemoryLocation(A);
    HYPRE_MemoryLocation memory_location_B = hypre_CSRMatrixMemoryLocation(B);
 
+   /* B's pattern and values are overwritten, its SELL and float copies are stale */
+   hypre_CSRMatrixInvalidateCopies(B);
+
    hypre_TMemcpy(B_i, A_i, HYPRE_Int, num_rows + 1, memory_location_B, memory_location_A);
 
    if (A_rownnz)
@@ -785,7 +794,21 @@ hypre_CSRMatrixCopy( hypre_CSRMatrix *A, hypre_CSRMatrix *B, HYPRE_Int copy_data
    {
       A_data = hypre_CSRMatrixData(A);
       B_data = hypre_CSRMatrixData(B);
-      hypre_TMemcpy(B_data, A_data, HYPRE_Complex, num_nonzeros, memory_location_B, memory_location_A);
+      if (!A_data && hypre_CSRMatrixDataFloat(A))
+      {
+         /* A is stored in single precision */
+         hypre_float *A_data_float = hypre_CSRMatrixDataFloat(A);
+         HYPRE_Int    i;
+
+         for (i = 0; i < num_nonzeros; i++)
+         {
+            B_data[i] = (HYPRE_Complex) A_data_float[i];
+         }
+      }
+      else
+      {
+         hypre_TMemcpy(B_data, A_data, HYPRE_Complex, num_nonzeros, memory_location_B, memory_location_A);
+      }
    }
 
    return hypre_error_flag;
@@ -1111,6 +1134,334 @@ hypre_CSRMatrixPrefetch( hypre_CSRMatrix *A, HYPRE_MemoryLocation memory_locatio
    return ierr;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_CSRSellDataCreate
+ *
+ * Build the SELL-C-sigma copy of a host CSR matrix. Rows are sorted by
+ * decreasing length inside each window of HYPRE_SELL_SIGMA rows (stable, so
+ * rows of equal length keep their original order and x is still accessed
+ * with good locality). Padding entries carry a zero value and repeat a
+ * valid column index of the same row, so no masking is needed in the matvec.
+ *--------------------------------------------------------------------------*/
+
+hypre_CSRSellData *
+hypre_CSRSellDataCreate( hypre_CSRMatrix *A )
+{
+   HYPRE_Int          *A_i          = hypre_CSRMatrixI(A);
+   HYPRE_Int          *A_j          = hypre_CSRMatrixJ(A);
+   HYPRE_Complex      *A_data       = hypre_CSRMatrixData(A);
+   HYPRE_Int           num_rows     = hypre_CSRMatrixNumRows(A);
+
+   hypre_CSRSellData  *data;
+   HYPRE_Int           num_chunks, num_slots;
+   HYPRE_Int          *chunk_ptr, *chunk_len, *row_perm, *row_len;
+   HYPRE_Int          *S_j;
+   HYPRE_Complex      *S_data;
+   HYPRE_Int           c, i, k, r, p, row, len, end;
+
+   num_chunks = (num_rows + HYPRE_SELL_C - 1) / HYPRE_SELL_C;
+   num_slots  = num_chunks * HYPRE_SELL_C;
+
+   chunk_ptr = hypre_TAlloc(HYPRE_Int, num_chunks + 1, HYPRE_MEMORY_HOST);
+   chunk_len = hypre_TAlloc(HYPRE_Int, num_chunks, HYPRE_MEMORY_HOST);
+   row_perm  = hypre_TAlloc(HYPRE_Int, num_slots, HYPRE_MEMORY_HOST);
+   row_len   = hypre_TAlloc(HYPRE_Int, num_slots, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < num_rows; i++)
+   {
+      row_perm[i] = i;
+      row_len[i]  = A_i[i + 1] - A_i[i];
+   }
+   for (i = num_rows; i < num_slots; i++)
+   {
+      row_perm[i] = -1;
+      row_len[i]  = 0;
+   }
+
+   /* stable insertion sort by decreasing row length inside each sigma-window */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(c, i, k, row, len, end) HYPRE_SMP_SCHEDULE
+#endif
+   for (c = 0; c < num_rows; c += HYPRE_SELL_SIGMA)
+   {
+      end = hypre_min(c + HYPRE_SELL_SIGMA, num_rows);
+      for (i = c + 1; i < end; i++)
+      {
+         row = row_perm[i];
+         len = row_len[i];
+         for (k = i - 1; k >= c && row_len[k] < len; k--)
+         {
+            row_perm[k + 1] = row_perm[k];
+            row_len[k + 1]  = row_len[k];
+         }
+         row_perm[k + 1] = row;
+         row_len[k + 1]  = len;
+      }
+   }
+
+   /* chunk widths and offsets */
+   chunk_ptr[0] = 0;
+   for (c = 0; c < num_chunks; c++)
+   {
+      len = 0;
+      for (r = 0; r < HYPRE_SELL_C; r++)
+      {
+         len = hypre_max(len, row_len[c * HYPRE_SELL_C + r]);
+      }
+      chunk_len[c] = len;
+      chunk_ptr[c + 1] = chunk_ptr[c] + len * HYPRE_SELL_C;
+   }
+
+   S_j    = hypre_TAlloc(HYPRE_Int, chunk_ptr[num_chunks], HYPRE_MEMORY_HOST);
+   S_data = hypre_TAlloc(HYPRE_Complex, chunk_ptr[num_chunks], HYPRE_MEMORY_HOST);
+
+   /* fill chunks column by column */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(c, k, r, p, row, len) HYPRE_SMP_SCHEDULE
+#endif
+   for (c = 0; c < num_chunks; c++)
+   {
+      for (r = 0; r < HYPRE_SELL_C; r++)
+      {
+         row = row_perm[c * HYPRE_SELL_C + r];
+         len = row_len[c * HYPRE_SELL_C + r];
+         p   = chunk_ptr[c] + r;
+         for (k = 0; k < chunk_len[c]; k++, p += HYPRE_SELL_C)
+         {
+            if (k < len)
+            {
+               S_j[p]    = A_j[A_i[row] + k];
+               S_data[p] = A_data[A_i[row] + k];
+            }
+            else
+            {
+               S_j[p]    = len > 0 ? A_j[A_i[row] + len - 1] : 0;
+               S_data[p] = 0.0;
+            }
+         }
+      }
+   }
+
+   hypre_TFree(row_len, HYPRE_MEMORY_HOST);
+
+   data = hypre_CTAlloc(hypre_CSRSellData, 1, HYPRE_MEMORY_HOST);
+
+   hypre_CSRSellDataNumRows(data)         = num_rows;
+   hypre_CSRSellDataNumChunks(data)       = num_chunks;
+   hypre_CSRSellDataChunkPtr(data)        = chunk_ptr;
+   hypre_CSRSellDataChunkLen(data)        = chunk_len;
+   hypre_CSRSellDataRowPerm(data)         = row_perm;
+   hypre_CSRSellDataJ(data)               = S_j;
+   hypre_CSRSellDataData(data)            = S_data;
+   hypre_CSRSellDataCSRJ(data)            = A_j;
+   hypre_CSRSellDataCSRData(data)         = A_data;
+   hypre_CSRSellDataCSRNumNonzeros(data)  = hypre_CSRMatrixNumNonzeros(A);
+   hypre_CSRSellDataCSRGeneration(data)   = hypre_CSRMatrixGeneration(A);
+
+   return data;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRSellDataDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRSellDataDestroy( hypre_CSRSellData *data )
+{
+   if (data)
+   {
+      hypre_TFree(hypre_CSRSellDataChunkPtr(data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRSellDataChunkLen(data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRSellDataRowPerm(data),  HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRSellDataJ(data),        HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRSellDataData(data),     HYPRE_MEMORY_HOST);
+      hypre_TFree(data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixGetSellData
+ *
+ * Return the SELL-C-sigma copy of the matrix, (re)building it if it does not
+ * exist or if the matrix changed since it was built. Returns NULL for
+ * matrices the SELL kernels do not handle (empty matrices).
+ *
+ * Note: code that changes the values or the pattern in place through the CSR
+ * arrays must call hypre_CSRMatrixInvalidateCopies.
+ *--------------------------------------------------------------------------*/
+
+hypre_CSRSellData *
+hypre_CSRMatrixGetSellData( hypre_CSRMatrix *matrix )
+{
+   hypre_CSRSellData *data;
+
+   if (!matrix)
+   {
+      return NULL;
+   }
+
+   data = hypre_CSRMatrixSellData(matrix);
+   if ( data &&
+        ( hypre_CSRSellDataCSRGeneration(data)  != hypre_CSRMatrixGeneration(matrix)  ||
+          hypre_CSRSellDataCSRJ(data)           != hypre_CSRMatrixJ(matrix)           ||
+          hypre_CSRSellDataCSRData(data)        != hypre_CSRMatrixData(matrix)        ||
+          hypre_CSRSellDataCSRNumNonzeros(data) != hypre_CSRMatrixNumNonzeros(matrix) ||
+          hypre_CSRSellDataNumRows(data)        != hypre_CSRMatrixNumRows(matrix) ) )
+   {
+      hypre_CSRMatrixResetSellData(matrix);
+   }
+
+   if ( !hypre_CSRMatrixSellData(matrix)    &&
+        hypre_CSRMatrixNumRows(matrix) > 0  &&
+        hypre_CSRMatrixNumNonzeros(matrix) > 0 &&
+        hypre_CSRMatrixJ(matrix)            &&
+        hypre_CSRMatrixData(matrix) )
+   {
+      hypre_CSRMatrixSellData(matrix) = hypre_CSRSellDataCreate(matrix);
+   }
+
+   return hypre_CSRMatrixSellData(matrix);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixResetSellData
+ *
+ * Drop the SELL-C-sigma copy, e.g., after the values of the matrix changed.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixResetSellData( hypre_CSRMatrix *matrix )
+{
+   if (matrix)
+   {
+      hypre_CSRSellDataDestroy(hypre_CSRMatrixSellData(matrix));
+      hypre_CSRMatrixSellData(matrix) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixInvalidateCopies
+ *
+ * Must be called before the values or the pattern of a matrix are changed in
+ * place.  Drops the SELL-C-sigma copy read by the host matvecs, converts
+ * values stored in single precision back to HYPRE_Complex, and advances the
+ * generation of the matrix, so that no copy built earlier is reused, even if
+ * the CSR arrays are reallocated at the same addresses.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixInvalidateCopies( hypre_CSRMatrix *matrix )
+{
+   if (matrix)
+   {
+      hypre_CSRMatrixResetSellData(matrix);
+      hypre_CSRMatrixConvertFromFloat(matrix);
+      hypre_CSRMatrixGeneration(matrix)++;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixConvertToFloat
+ *
+ * Store the values of a host matrix in single precision.  The HYPRE_Complex
+ * array is freed and hypre_CSRMatrixData is NULL afterwards, so the matrix
+ * can only be used in host matvecs (which accumulate in HYPRE_Complex) and
+ * copies.  Code that reads or writes the values must first call
+ * hypre_CSRMatrixConvertFromFloat (or hypre_CSRMatrixInvalidateCopies, which
+ * in-place writers already do).  Matrices that do not own their data or that
+ * live on the device are left unchanged.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixConvertToFloat( hypre_CSRMatrix *matrix )
+{
+   HYPRE_Int      num_nonzeros;
+   HYPRE_Complex *data;
+   hypre_float   *data_float;
+   HYPRE_Int      i;
+
+   if (!matrix || hypre_CSRMatrixDataFloat(matrix) || !hypre_CSRMatrixOwnsData(matrix))
+   {
+      return hypre_error_flag;
+   }
+
+#if defined(HYPRE_COMPLEX)
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Single precision storage not supported for complex!\n");
+   return hypre_error_flag;
+#endif
+
+#if defined(HYPRE_USING_GPU)
+   if (hypre_GetExecPolicy1(hypre_CSRMatrixMemoryLocation(matrix)) == HYPRE_EXEC_DEVICE)
+   {
+      return hypre_error_flag;
+   }
+#endif
+
+   num_nonzeros = hypre_CSRMatrixNumNonzeros(matrix);
+   data         = hypre_CSRMatrixData(matrix);
+   data_float   = hypre_TAlloc(hypre_float, num_nonzeros, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_nonzeros; i++)
+   {
+      data_float[i] = (hypre_float) data[i];
+   }
+
+   hypre_CSRMatrixResetSellData(matrix);
+   hypre_TFree(data, hypre_CSRMatrixMemoryLocation(matrix));
+   hypre_CSRMatrixData(matrix)      = NULL;
+   hypre_CSRMatrixDataFloat(matrix) = data_float;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixConvertFromFloat
+ *
+ * Restore the HYPRE_Complex values of a matrix stored in single precision by
+ * hypre_CSRMatrixConvertToFloat (the rounding is not undone).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixConvertFromFloat( hypre_CSRMatrix *matrix )
+{
+   HYPRE_Int      num_nonzeros;
+   HYPRE_Complex *data;
+   hypre_float   *data_float;
+   HYPRE_Int      i;
+
+   if (!matrix || !hypre_CSRMatrixDataFloat(matrix))
+   {
+      return hypre_error_flag;
+   }
+
+   num_nonzeros = hypre_CSRMatrixNumNonzeros(matrix);
+   data_float   = hypre_CSRMatrixDataFloat(matrix);
+   data         = hypre_TAlloc(HYPRE_Complex, num_nonzeros, hypre_CSRMatrixMemoryLocation(matrix));
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_nonzeros; i++)
+   {
+      data[i] = (HYPRE_Complex) data_float[i];
+   }
+
+   hypre_TFree(data_float, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixDataFloat(matrix) = NULL;
+   hypre_CSRMatrixData(matrix)      = data;
+
+   return hypre_error_flag;
+}
+
 #if defined(HYPRE_USING_CUSPARSE) || defined(HYPRE_USING_ROCSPARSE) || defined(HYPRE_USING_ONEMKLSPARSE)
 hypre_GpuMatData *
 hypre_CSRMatrixGetGPUMatData(hypre_CSRMatrix *matrix)
@@ -26,6 +26,47 @@ struct hypre_GpuMatData;
 typedef struct hypre_GpuMatData hypre_GpuMatData;
 #endif
 
+/*--------------------------------------------------------------------------
+ * SELL-C-sigma copy of a CSR Matrix, used by the host matvec
+ *
+ * Rows are sorted by decreasing length inside windows of sigma rows and
+ * grouped into chunks of HYPRE_SELL_C rows.  Each chunk is padded to its
+ * longest row and stored column-major, so the inner loop of the matvec runs
+ * over HYPRE_SELL_C independent rows with unit stride.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_SELL_C     8
+#define HYPRE_SELL_SIGMA 256
+
+typedef struct
+{
+   HYPRE_Int            num_rows;
+   HYPRE_Int            num_chunks;
+   HYPRE_Int           *chunk_ptr;        /* start of each chunk in j and data */
+   HYPRE_Int           *chunk_len;        /* width (longest row) of each chunk */
+   HYPRE_Int           *row_perm;         /* CSR row stored in each SELL slot, -1 for padding */
+   HYPRE_Int           *j;
+   HYPRE_Complex       *data;
+
+   /* CSR arrays the copy was built from, used to detect reallocation */
+   HYPRE_Int           *csr_j;
+   HYPRE_Complex       *csr_data;
+   HYPRE_Int            csr_num_nonzeros;
+   hypre_uint           csr_generation;
+} hypre_CSRSellData;
+
+#define hypre_CSRSellDataNumRows(sell)              ((sell) -> num_rows)
+#define hypre_CSRSellDataNumChunks(sell)            ((sell) -> num_chunks)
+#define hypre_CSRSellDataChunkPtr(sell)             ((sell) -> chunk_ptr)
+#define hypre_CSRSellDataChunkLen(sell)             ((sell) -> chunk_len)
+#define hypre_CSRSellDataRowPerm(sell)              ((sell) -> row_perm)
+#define hypre_CSRSellDataJ(sell)                    ((sell) -> j)
+#define hypre_CSRSellDataData(sell)                 ((sell) -> data)
+#define hypre_CSRSellDataCSRJ(sell)                 ((sell) -> csr_j)
+#define hypre_CSRSellDataCSRData(sell)              ((sell) -> csr_data)
+#define hypre_CSRSellDataCSRNumNonzeros(sell)       ((sell) -> csr_num_nonzeros)
+#define hypre_CSRSellDataCSRGeneration(sell)        ((sell) -> csr_generation)
+
 /*--------------------------------------------------------------------------
  * CSR Matrix
  *--------------------------------------------------------------------------*/
@@ -45,6 +86,9 @@ typedef struct
    HYPRE_Int            *rownnz;          /* for compressing rows in matrix multiplication  */
    HYPRE_Int             num_rownnz;
    HYPRE_MemoryLocation  memory_location; /* memory location of arrays i, j, data */
+   hypre_CSRSellData    *sell_data;       /* SELL-C-sigma copy for host matvecs, built on demand */
+   hypre_float          *data_float;      /* single precision copy of `data' read by host matvecs */
+   hypre_uint            generation;      /* advanced whenever values or pattern change in place */
 #if defined(HYPRE_USING_CUSPARSE) || defined(HYPRE_USING_ROCSPARSE) || defined(HYPRE_USING_ONEMKLSPARSE)
    HYPRE_Int            *sorted_j;        /* some cusparse routines require sorted CSR */
    HYPRE_Complex        *sorted_data;
@@ -68,6 +112,9 @@ typedef struct
 #define hypre_CSRMatrixNumRownnz(matrix)            ((matrix) -> num_rownnz)
 #define hypre_CSRMatrixOwnsData(matrix)             ((matrix) -> owns_data)
 #define hypre_CSRMatrixMemoryLocation(matrix)       ((matrix) -> memory_location)
+#define hypre_CSRMatrixSellData(matrix)             ((matrix) -> sell_data)
+#define hypre_CSRMatrixDataFloat(matrix)            ((matrix) -> data_float)
+#define hypre_CSRMatrixGeneration(matrix)           ((matrix) -> generation)
 
 #if defined(HYPRE_USING_CUSPARSE) || defined(HYPRE_USING_ROCSPARSE) || defined(HYPRE_USING_ONEMKLSPARSE)
 #define hypre_CSRMatrixSortedJ(matrix)              ((matrix) -> sorted_j)
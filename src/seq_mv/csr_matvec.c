@@ -695,6 +695,382 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
    return ierr;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecSell
+ *
+ * y = alpha*A*x + beta*b using the SELL-C-sigma copy of A.  Single vector
+ * only, x must not alias y (b may).  Each chunk accumulates HYPRE_SELL_C rows
+ * at once with unit-stride loads of the values and column indices, which
+ * lets the compiler vectorize the inner loop.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecSell( HYPRE_Complex    alpha,
+                           hypre_CSRMatrix *A,
+                           hypre_Vector    *x,
+                           HYPRE_Complex    beta,
+                           hypre_Vector    *b,
+                           hypre_Vector    *y )
+{
+   hypre_CSRSellData *sell       = hypre_CSRMatrixGetSellData(A);
+   HYPRE_Int          num_chunks = hypre_CSRSellDataNumChunks(sell);
+   HYPRE_Int         *chunk_ptr  = hypre_CSRSellDataChunkPtr(sell);
+   HYPRE_Int         *chunk_len  = hypre_CSRSellDataChunkLen(sell);
+   HYPRE_Int         *row_perm   = hypre_CSRSellDataRowPerm(sell);
+   HYPRE_Int         *S_j        = hypre_CSRSellDataJ(sell);
+   HYPRE_Complex     *S_data     = hypre_CSRSellDataData(sell);
+
+   HYPRE_Complex     *x_data     = hypre_VectorData(x);
+   HYPRE_Complex     *b_data     = hypre_VectorData(b);
+   HYPRE_Complex     *y_data     = hypre_VectorData(y);
+
+   HYPRE_Int          c, k, r, p, row;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(c, k, r, p, row) HYPRE_SMP_SCHEDULE
+#endif
+   for (c = 0; c < num_chunks; c++)
+   {
+      HYPRE_Complex tempx[HYPRE_SELL_C];
+
+      for (r = 0; r < HYPRE_SELL_C; r++)
+      {
+         tempx[r] = 0.0;
+      }
+
+      p = chunk_ptr[c];
+      for (k = 0; k < chunk_len[c]; k++, p += HYPRE_SELL_C)
+      {
+         for (r = 0; r < HYPRE_SELL_C; r++)
+         {
+            tempx[r] += S_data[p + r] * x_data[S_j[p + r]];
+         }
+      }
+
+      for (r = 0; r < HYPRE_SELL_C; r++)
+      {
+         row = row_perm[c * HYPRE_SELL_C + r];
+         if (row < 0)
+         {
+            continue;
+         }
+         if (beta == 0.0)
+         {
+            y_data[row] = alpha * tempx[r];
+         }
+         else
+         {
+            y_data[row] = alpha * tempx[r] + beta * b_data[row];
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecTSell
+ *
+ * y = alpha*A^T*x + beta*y using the SELL-C-sigma copy of A.  Single vector
+ * only, x must not alias y.  With threads, each thread scatters into its own
+ * copy of y as in hypre_CSRMatrixMatvecTHost.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecTSell( HYPRE_Complex    alpha,
+                            hypre_CSRMatrix *A,
+                            hypre_Vector    *x,
+                            HYPRE_Complex    beta,
+                            hypre_Vector    *y )
+{
+   hypre_CSRSellData *sell       = hypre_CSRMatrixGetSellData(A);
+   HYPRE_Int          num_chunks = hypre_CSRSellDataNumChunks(sell);
+   HYPRE_Int         *chunk_ptr  = hypre_CSRSellDataChunkPtr(sell);
+   HYPRE_Int         *chunk_len  = hypre_CSRSellDataChunkLen(sell);
+   HYPRE_Int         *row_perm   = hypre_CSRSellDataRowPerm(sell);
+   HYPRE_Int         *S_j        = hypre_CSRSellDataJ(sell);
+   HYPRE_Complex     *S_data     = hypre_CSRSellDataData(sell);
+
+   HYPRE_Complex     *x_data     = hypre_VectorData(x);
+   HYPRE_Complex     *y_data     = hypre_VectorData(y);
+   HYPRE_Int          y_size     = hypre_CSRMatrixNumCols(A);
+
+   HYPRE_Complex     *y_data_expand = NULL;
+   HYPRE_Int          num_threads   = hypre_NumThreads();
+   HYPRE_Int          c, i, j, k, r, p, row, my_thread_num;
+
+   /*-----------------------------------------------------------------------
+    * y = beta*y
+    *-----------------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < y_size; i++)
+   {
+      y_data[i] = (beta == 0.0) ? 0.0 : beta * y_data[i];
+   }
+
+   if (num_threads > 1)
+   {
+      y_data_expand = hypre_CTAlloc(HYPRE_Complex, num_threads * y_size, HYPRE_MEMORY_HOST);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(c, i, j, k, r, p, row, my_thread_num)
+#endif
+   {
+      HYPRE_Complex  xr[HYPRE_SELL_C];
+      HYPRE_Complex *y_local;
+
+      my_thread_num = hypre_GetThreadNum();
+      y_local = (num_threads > 1) ? y_data_expand + my_thread_num * y_size : y_data;
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (c = 0; c < num_chunks; c++)
+      {
+         for (r = 0; r < HYPRE_SELL_C; r++)
+         {
+            row = row_perm[c * HYPRE_SELL_C + r];
+            xr[r] = (row < 0) ? 0.0 : alpha * x_data[row];
+         }
+
+         p = chunk_ptr[c];
+         for (k = 0; k < chunk_len[c]; k++, p += HYPRE_SELL_C)
+         {
+            for (r = 0; r < HYPRE_SELL_C; r++)
+            {
+               y_local[S_j[p + r]] += S_data[p + r] * xr[r];
+            }
+         }
+      }
+
+      if (num_threads > 1)
+      {
+         /* implied barrier (for threads) */
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < y_size; i++)
+         {
+            for (j = 0; j < num_threads; j++)
+            {
+               y_data[i] += y_data_expand[j * y_size + i];
+            }
+         }
+      }
+   } /* end parallel threaded region */
+
+   hypre_TFree(y_data_expand, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecFloat
+ *
+ * y[offset:end] = alpha*A[offset:end,:]*x + beta*b[offset:end] for a matrix
+ * whose values are stored in single precision (see
+ * hypre_CSRMatrixConvertToFloat).  The vectors and the row sums stay in
+ * HYPRE_Complex, only the matrix values are read in reduced precision.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecFloat( HYPRE_Complex    alpha,
+                            hypre_CSRMatrix *A,
+                            hypre_Vector    *x,
+                            HYPRE_Complex    beta,
+                            hypre_Vector    *b,
+                            hypre_Vector    *y,
+                            HYPRE_Int        offset )
+{
+   hypre_float      *A_data      = hypre_CSRMatrixDataFloat(A);
+   HYPRE_Int        *A_i         = hypre_CSRMatrixI(A);
+   HYPRE_Int        *A_j         = hypre_CSRMatrixJ(A);
+   HYPRE_Int         num_rows    = hypre_CSRMatrixNumRows(A);
+
+   HYPRE_Complex    *x_data      = hypre_VectorData(x);
+   HYPRE_Complex    *b_data      = hypre_VectorData(b);
+   HYPRE_Complex    *y_data      = hypre_VectorData(y);
+   HYPRE_Int         num_vectors = hypre_VectorNumVectors(x);
+   HYPRE_Int         idxstride_x = hypre_VectorIndexStride(x);
+   HYPRE_Int         vecstride_x = hypre_VectorVectorStride(x);
+   HYPRE_Int         idxstride_b = hypre_VectorIndexStride(b);
+   HYPRE_Int         vecstride_b = hypre_VectorVectorStride(b);
+   HYPRE_Int         idxstride_y = hypre_VectorIndexStride(y);
+   HYPRE_Int         vecstride_y = hypre_VectorVectorStride(y);
+
+   hypre_Vector     *x_tmp = NULL;
+   HYPRE_Complex     tempx;
+   HYPRE_Int         i, j, jj;
+
+   if (x == y)
+   {
+      x_tmp = hypre_SeqVectorCloneDeep(x);
+      x_data = hypre_VectorData(x_tmp);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, j, jj, tempx) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = offset; i < num_rows; i++)
+   {
+      for (j = 0; j < num_vectors; j++)
+      {
+         tempx = 0.0;
+         for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+         {
+            tempx += (HYPRE_Complex) A_data[jj] * x_data[j * vecstride_x + A_j[jj] * idxstride_x];
+         }
+
+         if (beta == 0.0)
+         {
+            y_data[j * vecstride_y + i * idxstride_y] = alpha * tempx;
+         }
+         else
+         {
+            y_data[j * vecstride_y + i * idxstride_y] = alpha * tempx +
+                                                        beta * b_data[j * vecstride_b + i * idxstride_b];
+         }
+      }
+   }
+
+   if (x == y)
+   {
+      hypre_SeqVectorDestroy(x_tmp);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecTFloat
+ *
+ * y = alpha*A^T*x + beta*y for a matrix whose values are stored in single
+ * precision.  With threads, each thread scatters into its own copy of y as
+ * in hypre_CSRMatrixMatvecTHost.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecTFloat( HYPRE_Complex    alpha,
+                             hypre_CSRMatrix *A,
+                             hypre_Vector    *x,
+                             HYPRE_Complex    beta,
+                             hypre_Vector    *y )
+{
+   hypre_float      *A_data      = hypre_CSRMatrixDataFloat(A);
+   HYPRE_Int        *A_i         = hypre_CSRMatrixI(A);
+   HYPRE_Int        *A_j         = hypre_CSRMatrixJ(A);
+   HYPRE_Int         num_rows    = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int         num_cols    = hypre_CSRMatrixNumCols(A);
+
+   HYPRE_Complex    *x_data      = hypre_VectorData(x);
+   HYPRE_Complex    *y_data      = hypre_VectorData(y);
+   HYPRE_Int         num_vectors = hypre_VectorNumVectors(x);
+   HYPRE_Int         idxstride_x = hypre_VectorIndexStride(x);
+   HYPRE_Int         vecstride_x = hypre_VectorVectorStride(x);
+   HYPRE_Int         idxstride_y = hypre_VectorIndexStride(y);
+   HYPRE_Int         vecstride_y = hypre_VectorVectorStride(y);
+   HYPRE_Int         y_size      = num_cols * num_vectors;
+
+   hypre_Vector     *x_tmp = NULL;
+   HYPRE_Complex    *y_data_expand = NULL;
+   HYPRE_Int         num_threads   = hypre_NumThreads();
+   HYPRE_Int         i, j, jj, k, my_thread_num;
+
+   if (x == y)
+   {
+      x_tmp = hypre_SeqVectorCloneDeep(x);
+      x_data = hypre_VectorData(x_tmp);
+   }
+
+   /*-----------------------------------------------------------------------
+    * y = beta*y
+    *-----------------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, k) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_cols; i++)
+   {
+      for (k = 0; k < num_vectors; k++)
+      {
+         y_data[k * vecstride_y + i * idxstride_y] = (beta == 0.0) ? 0.0 :
+                                                     beta * y_data[k * vecstride_y + i * idxstride_y];
+      }
+   }
+
+   if (num_threads > 1)
+   {
+      y_data_expand = hypre_CTAlloc(HYPRE_Complex, num_threads * y_size, HYPRE_MEMORY_HOST);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(i, j, jj, k, my_thread_num)
+#endif
+   {
+      HYPRE_Complex  xk;
+      HYPRE_Complex *y_local;
+
+      my_thread_num = hypre_GetThreadNum();
+
+      /* the thread-local copies of y are stored unstrided, vector after vector */
+      y_local = (num_threads > 1) ? y_data_expand + my_thread_num * y_size : NULL;
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         for (k = 0; k < num_vectors; k++)
+         {
+            xk = alpha * x_data[k * vecstride_x + i * idxstride_x];
+            for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+            {
+               j = A_j[jj];
+               if (y_local)
+               {
+                  y_local[k * num_cols + j] += (HYPRE_Complex) A_data[jj] * xk;
+               }
+               else
+               {
+                  y_data[k * vecstride_y + j * idxstride_y] += (HYPRE_Complex) A_data[jj] * xk;
+               }
+            }
+         }
+      }
+
+      if (num_threads > 1)
+      {
+         /* implied barrier (for threads) */
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_cols; i++)
+         {
+            for (k = 0; k < num_vectors; k++)
+            {
+               for (j = 0; j < num_threads; j++)
+               {
+                  y_data[k * vecstride_y + i * idxstride_y] += y_data_expand[j * y_size + k * num_cols + i];
+               }
+            }
+         }
+      }
+   } /* end parallel threaded region */
+
+   hypre_TFree(y_data_expand, HYPRE_MEMORY_HOST);
+
+   if (x == y)
+   {
+      hypre_SeqVectorDestroy(x_tmp);
+   }
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_CSRMatrixMatvecOutOfPlace( HYPRE_Complex    alpha,
                                  hypre_CSRMatrix *A,
@@ -718,6 +1094,16 @@ hypre_CSRMatrixMatvecOutOfPlace( HYPRE_Complex    alpha,
    }
    else
 #endif
+   if ( hypre_CSRMatrixDataFloat(A) )
+   {
+      ierr = hypre_CSRMatrixMatvecFloat(alpha, A, x, beta, b, y, offset);
+   }
+   else if ( hypre_HandleSpMVUseSell(hypre_handle()) && offset == 0 && x != y &&
+        hypre_VectorNumVectors(x) == 1 && hypre_CSRMatrixGetSellData(A) )
+   {
+      ierr = hypre_CSRMatrixMatvecSell(alpha, A, x, beta, b, y);
+   }
+   else
    {
       ierr = hypre_CSRMatrixMatvecOutOfPlaceHost(alpha, A, x, beta, b, y, offset);
    }
@@ -998,6 +1384,16 @@ hypre_CSRMatrixMatvecT( HYPRE_Complex    alpha,
    }
    else
 #endif
+   if ( hypre_CSRMatrixDataFloat(A) )
+   {
+      ierr = hypre_CSRMatrixMatvecTFloat(alpha, A, x, beta, y);
+   }
+   else if ( hypre_HandleSpMVUseSell(hypre_handle()) && x != y &&
+        hypre_VectorNumVectors(x) == 1 && hypre_CSRMatrixGetSellData(A) )
+   {
+      ierr = hypre_CSRMatrixMatvecTSell(alpha, A, x, beta, y);
+   }
+   else
    {
       ierr = hypre_CSRMatrixMatvecTHost(alpha, A, x, beta, y);
    }
@@ -0,0 +1,532 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Host sparse matrix-matrix multiplication C = A * B
+ *
+ * The product is split into a symbolic phase, which computes the sparsity
+ * pattern (C_i, C_j) of C, and a numeric phase, which fills in C_data for a
+ * given pattern. The pattern returned by the symbolic phase can be kept by
+ * the caller and passed again to the numeric phase whenever A and B change
+ * their values but not their sparsity patterns.
+ *
+ * Rows are handled with per-thread accumulators that adapt to the row width.
+ * Rows with at most HYPRE_SPGEMM_HOST_SORTED_MAX candidate entries are merged
+ * in a small sorted buffer; wider rows use a dense marker array of length
+ * ncols_B, which is only allocated by threads that meet such a row.
+ *
+ * Column indices of C are sorted within each row. When A has as many rows
+ * as B has columns and A has no rownnz array, every row of C also gets a
+ * diagonal entry, stored first, even if it is structurally zero. When A has
+ * a rownnz array, no diagonal entry is inserted. This matches the previous
+ * host implementation, whose "allsquare" diagonal insertion was on the
+ * branch for matrices without rownnz only; it differs from it in that the
+ * remaining columns are now sorted.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+#define HYPRE_SPGEMM_HOST_SORTED_MAX 32
+
+/*--------------------------------------------------------------------------
+ * hypre_SpGemmHostSortUnique
+ *
+ * Sorts the n entries of v with insertion sort and removes duplicates.
+ * Returns the number of distinct entries.
+ *--------------------------------------------------------------------------*/
+
+static inline HYPRE_Int
+hypre_SpGemmHostSortUnique( HYPRE_Int *v,
+                            HYPRE_Int  n )
+{
+   HYPRE_Int i, j, k, tmp;
+
+   for (i = 1; i < n; i++)
+   {
+      tmp = v[i];
+      for (j = i; j > 0 && v[j - 1] > tmp; j--)
+      {
+         v[j] = v[j - 1];
+      }
+      v[j] = tmp;
+   }
+
+   for (i = 1, k = (n > 0); i < n; i++)
+   {
+      if (v[i] != v[k - 1])
+      {
+         v[k++] = v[i];
+      }
+   }
+
+   return k;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SpGemmHostFindColumn
+ *
+ * Returns the position of column col in C_j[start:end). The first entry of
+ * the row is checked separately (it may be the diagonal); the remaining
+ * entries are sorted and searched by bisection.
+ *--------------------------------------------------------------------------*/
+
+static inline HYPRE_Int
+hypre_SpGemmHostFindColumn( HYPRE_Int *C_j,
+                            HYPRE_Int  start,
+                            HYPRE_Int  end,
+                            HYPRE_Int  col )
+{
+   HYPRE_Int lo, hi, mid;
+
+   if (C_j[start] == col)
+   {
+      return start;
+   }
+
+   lo = start + 1;
+   hi = end - 1;
+   while (lo < hi)
+   {
+      mid = (lo + hi) >> 1;
+      if (C_j[mid] < col)
+      {
+         lo = mid + 1;
+      }
+      else
+      {
+         hi = mid;
+      }
+   }
+
+   return lo;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SpGemmHostRowSymbolic
+ *
+ * Computes the column indices of row "row" of A * B. If row_j is NULL, only
+ * the number of entries is returned; otherwise the columns are also written
+ * to row_j. buffer must hold HYPRE_SPGEMM_HOST_SORTED_MAX entries. The dense
+ * marker is allocated on first use and stamped with "stamp".
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_SpGemmHostRowSymbolic( HYPRE_Int   row,
+                             HYPRE_Int   stamp,
+                             HYPRE_Int   diag_first,
+                             HYPRE_Int  *A_i,
+                             HYPRE_Int  *A_j,
+                             HYPRE_Int  *B_i,
+                             HYPRE_Int  *B_j,
+                             HYPRE_Int   ncols_B,
+                             HYPRE_Int  *buffer,
+                             HYPRE_Int **marker_ptr,
+                             HYPRE_Int  *row_j )
+{
+   HYPRE_Int  *marker = *marker_ptr;
+   HYPRE_Int   ia, ib, ja, jb, k;
+   HYPRE_Int   width = 0, cnt = 0;
+
+   for (ia = A_i[row]; ia < A_i[row + 1]; ia++)
+   {
+      ja = A_j[ia];
+      width += B_i[ja + 1] - B_i[ja];
+   }
+
+   if (width <= HYPRE_SPGEMM_HOST_SORTED_MAX)
+   {
+      /* Narrow row: merge candidates in a small sorted buffer */
+      for (ia = A_i[row]; ia < A_i[row + 1]; ia++)
+      {
+         ja = A_j[ia];
+         for (ib = B_i[ja]; ib < B_i[ja + 1]; ib++)
+         {
+            buffer[cnt++] = B_j[ib];
+         }
+      }
+      width = hypre_SpGemmHostSortUnique(buffer, cnt);
+
+      cnt = 0;
+      if (diag_first)
+      {
+         if (row_j)
+         {
+            row_j[0] = row;
+         }
+         cnt++;
+      }
+      for (k = 0; k < width; k++)
+      {
+         if (diag_first && buffer[k] == row)
+         {
+            continue;
+         }
+         if (row_j)
+         {
+            row_j[cnt] = buffer[k];
+         }
+         cnt++;
+      }
+
+      return cnt;
+   }
+
+   /* Wide row: dense marker over the columns of B */
+   if (!marker)
+   {
+      marker = hypre_TAlloc(HYPRE_Int, ncols_B, HYPRE_MEMORY_HOST);
+      for (k = 0; k < ncols_B; k++)
+      {
+         marker[k] = -1;
+      }
+      *marker_ptr = marker;
+   }
+
+   if (diag_first)
+   {
+      marker[row] = stamp;
+      if (row_j)
+      {
+         row_j[0] = row;
+      }
+      cnt++;
+   }
+
+   for (ia = A_i[row]; ia < A_i[row + 1]; ia++)
+   {
+      ja = A_j[ia];
+      for (ib = B_i[ja]; ib < B_i[ja + 1]; ib++)
+      {
+         jb = B_j[ib];
+         if (marker[jb] != stamp)
+         {
+            marker[jb] = stamp;
+            if (row_j)
+            {
+               row_j[cnt] = jb;
+            }
+            cnt++;
+         }
+      }
+   }
+
+   if (row_j)
+   {
+      hypre_qsort0(row_j, diag_first, cnt - 1);
+   }
+
+   return cnt;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMultiplySymbolicHost
+ *
+ * Computes the sparsity pattern of C = A * B. C_data is allocated but not
+ * set; use hypre_CSRMatrixMultiplyNumericHost to compute the values.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMultiplySymbolicHost( hypre_CSRMatrix  *A,
+                                     hypre_CSRMatrix  *B,
+                                     hypre_CSRMatrix **C_ptr )
+{
+   HYPRE_Int            *A_i       = hypre_CSRMatrixI(A);
+   HYPRE_Int            *A_j       = hypre_CSRMatrixJ(A);
+   HYPRE_Int            *rownnz_A  = hypre_CSRMatrixRownnz(A);
+   HYPRE_Int             nrows_A   = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int             ncols_A   = hypre_CSRMatrixNumCols(A);
+   HYPRE_Int             nnzrows_A = hypre_CSRMatrixNumRownnz(A);
+   HYPRE_Int             num_nnz_A = hypre_CSRMatrixNumNonzeros(A);
+
+   HYPRE_Int            *B_i       = hypre_CSRMatrixI(B);
+   HYPRE_Int            *B_j       = hypre_CSRMatrixJ(B);
+   HYPRE_Int             nrows_B   = hypre_CSRMatrixNumRows(B);
+   HYPRE_Int             ncols_B   = hypre_CSRMatrixNumCols(B);
+   HYPRE_Int             num_nnz_B = hypre_CSRMatrixNumNonzeros(B);
+
+   HYPRE_MemoryLocation  memory_location_C = hypre_max(hypre_CSRMatrixMemoryLocation(A),
+                                                       hypre_CSRMatrixMemoryLocation(B));
+
+   hypre_CSRMatrix      *C = NULL;
+   HYPRE_Int            *C_i;
+   HYPRE_Int            *C_j = NULL;
+   HYPRE_Int            *twspace;
+   HYPRE_Int             diag_first;
+
+   *C_ptr = NULL;
+
+   if (ncols_A != nrows_B)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Warning! incompatible matrix dimensions!\n");
+      return hypre_error_flag;
+   }
+
+   if ((num_nnz_A == 0) || (num_nnz_B == 0))
+   {
+      C = hypre_CSRMatrixCreate(nrows_A, ncols_B, 0);
+      hypre_CSRMatrixNumRownnz(C) = 0;
+      hypre_CSRMatrixInitialize_v2(C, 0, memory_location_C);
+      *C_ptr = C;
+
+      return hypre_error_flag;
+   }
+
+   diag_first = (nrows_A == ncols_B) && (rownnz_A == NULL);
+
+   twspace = hypre_TAlloc(HYPRE_Int, hypre_NumThreads(), HYPRE_MEMORY_HOST);
+   C_i = hypre_CTAlloc(HYPRE_Int, nrows_A + 1, memory_location_C);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel
+#endif
+   {
+      HYPRE_Int  *marker = NULL;
+      HYPRE_Int  *buffer;
+      HYPRE_Int   ns, ne, ii, ic, iic, i1, jj;
+      HYPRE_Int   num_threads, num_nonzeros;
+
+      ii = hypre_GetThreadNum();
+      num_threads = hypre_NumActiveThreads();
+      hypre_partition1D(nnzrows_A, num_threads, ii, &ns, &ne);
+
+      buffer = hypre_TAlloc(HYPRE_Int, HYPRE_SPGEMM_HOST_SORTED_MAX, HYPRE_MEMORY_HOST);
+
+      /* First pass: compute sizes of C rows */
+      HYPRE_ANNOTATE_REGION_BEGIN("%s", "First pass");
+      num_nonzeros = 0;
+      for (ic = ns; ic < ne; ic++)
+      {
+         iic = rownnz_A ? rownnz_A[ic] : ic;
+         C_i[iic] = num_nonzeros;
+         num_nonzeros += hypre_SpGemmHostRowSymbolic(iic, iic, diag_first, A_i, A_j, B_i, B_j,
+                                                     ncols_B, buffer, &marker, NULL);
+      }
+      twspace[ii] = num_nonzeros;
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+#endif
+
+      /* Correct C_i - phase 1 */
+      if (ii)
+      {
+         jj = twspace[0];
+         for (i1 = 1; i1 < ii; i1++)
+         {
+            jj += twspace[i1];
+         }
+
+         for (i1 = ns; i1 < ne; i1++)
+         {
+            iic = rownnz_A ? rownnz_A[i1] : i1;
+            C_i[iic] += jj;
+         }
+      }
+      else
+      {
+         C_i[nrows_A] = 0;
+         for (i1 = 0; i1 < num_threads; i1++)
+         {
+            C_i[nrows_A] += twspace[i1];
+         }
+
+         C = hypre_CSRMatrixCreate(nrows_A, ncols_B, C_i[nrows_A]);
+         hypre_CSRMatrixI(C) = C_i;
+         hypre_CSRMatrixInitialize_v2(C, 0, memory_location_C);
+         C_j = hypre_CSRMatrixJ(C);
+      }
+
+      /* Correct C_i - phase 2 */
+      if (rownnz_A != NULL)
+      {
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp barrier
+#endif
+         for (ic = ns; ic < (ne - 1); ic++)
+         {
+            for (iic = rownnz_A[ic] + 1; iic < rownnz_A[ic + 1]; iic++)
+            {
+               C_i[iic] = C_i[rownnz_A[ic + 1]];
+            }
+         }
+
+         if (ii < (num_threads - 1))
+         {
+            for (iic = rownnz_A[ne - 1] + 1; iic < rownnz_A[ne]; iic++)
+            {
+               C_i[iic] = C_i[rownnz_A[ne]];
+            }
+         }
+         else
+         {
+            for (iic = rownnz_A[ne - 1] + 1; iic < nrows_A; iic++)
+            {
+               C_i[iic] = C_i[nrows_A];
+            }
+         }
+      }
+      HYPRE_ANNOTATE_REGION_END("%s", "First pass");
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+#endif
+
+      /* Second pass: fill in C_j */
+      HYPRE_ANNOTATE_REGION_BEGIN("%s", "Second pass");
+      if (marker)
+      {
+         for (i1 = 0; i1 < ncols_B; i1++)
+         {
+            marker[i1] = -1;
+         }
+      }
+
+      for (ic = ns; ic < ne; ic++)
+      {
+         iic = rownnz_A ? rownnz_A[ic] : ic;
+         hypre_SpGemmHostRowSymbolic(iic, iic, diag_first, A_i, A_j, B_i, B_j,
+                                     ncols_B, buffer, &marker, C_j + C_i[iic]);
+      }
+      HYPRE_ANNOTATE_REGION_END("%s", "Second pass");
+
+      hypre_TFree(buffer, HYPRE_MEMORY_HOST);
+      hypre_TFree(marker, HYPRE_MEMORY_HOST);
+   } /* end parallel region */
+
+#ifdef HYPRE_DEBUG
+   {
+      HYPRE_Int ic;
+
+      for (ic = 0; ic < nrows_A; ic++)
+      {
+         hypre_assert(C_i[ic] <= C_i[ic + 1]);
+      }
+   }
+#endif
+
+   /* Set rownnz and num_rownnz */
+   hypre_CSRMatrixSetRownnz(C);
+
+   hypre_TFree(twspace, HYPRE_MEMORY_HOST);
+
+   *C_ptr = C;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMultiplyNumericHost
+ *
+ * Computes the values of C = A * B, where the pattern of C was computed by
+ * hypre_CSRMatrixMultiplySymbolicHost for matrices with the same sparsity
+ * patterns as A and B. The values of A and B may differ from those seen by
+ * the symbolic phase.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMultiplyNumericHost( hypre_CSRMatrix *A,
+                                    hypre_CSRMatrix *B,
+                                    hypre_CSRMatrix *C )
+{
+   HYPRE_Complex        *A_data    = hypre_CSRMatrixData(A);
+   HYPRE_Int            *A_i       = hypre_CSRMatrixI(A);
+   HYPRE_Int            *A_j       = hypre_CSRMatrixJ(A);
+   HYPRE_Int            *rownnz_A  = hypre_CSRMatrixRownnz(A);
+   HYPRE_Int             nnzrows_A = hypre_CSRMatrixNumRownnz(A);
+
+   HYPRE_Complex        *B_data    = hypre_CSRMatrixData(B);
+   HYPRE_Int            *B_i       = hypre_CSRMatrixI(B);
+   HYPRE_Int            *B_j       = hypre_CSRMatrixJ(B);
+   HYPRE_Int             ncols_B   = hypre_CSRMatrixNumCols(B);
+
+   HYPRE_Complex        *C_data    = hypre_CSRMatrixData(C);
+   HYPRE_Int            *C_i       = hypre_CSRMatrixI(C);
+   HYPRE_Int            *C_j       = hypre_CSRMatrixJ(C);
+
+   if (hypre_CSRMatrixNumNonzeros(C) == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   if (hypre_CSRMatrixNumRows(A) != hypre_CSRMatrixNumRows(C) ||
+       ncols_B != hypre_CSRMatrixNumCols(C))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Incompatible pattern for C = A * B!\n");
+      return hypre_error_flag;
+   }
+
+   HYPRE_ANNOTATE_REGION_BEGIN("%s", "Numeric pass");
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel
+#endif
+   {
+      HYPRE_Int      *marker = NULL;
+      HYPRE_Int       ns, ne, ii, ic, iic;
+      HYPRE_Int       ia, ib, ja, ic_start, ic_end;
+      HYPRE_Complex   a_entry;
+
+      ii = hypre_GetThreadNum();
+      hypre_partition1D(nnzrows_A, hypre_NumActiveThreads(), ii, &ns, &ne);
+
+      for (ic = ns; ic < ne; ic++)
+      {
+         iic = rownnz_A ? rownnz_A[ic] : ic;
+         ic_start = C_i[iic];
+         ic_end   = C_i[iic + 1];
+
+         for (ib = ic_start; ib < ic_end; ib++)
+         {
+            C_data[ib] = 0.0;
+         }
+
+         if (ic_end - ic_start <= HYPRE_SPGEMM_HOST_SORTED_MAX)
+         {
+            /* Narrow row: locate the columns by bisection */
+            for (ia = A_i[iic]; ia < A_i[iic + 1]; ia++)
+            {
+               ja = A_j[ia];
+               a_entry = A_data[ia];
+               for (ib = B_i[ja]; ib < B_i[ja + 1]; ib++)
+               {
+                  C_data[hypre_SpGemmHostFindColumn(C_j, ic_start, ic_end, B_j[ib])] +=
+                     a_entry * B_data[ib];
+               }
+            }
+         }
+         else
+         {
+            /* Wide row: scatter the positions of the row into a dense marker */
+            if (!marker)
+            {
+               marker = hypre_TAlloc(HYPRE_Int, ncols_B, HYPRE_MEMORY_HOST);
+            }
+
+            for (ib = ic_start; ib < ic_end; ib++)
+            {
+               marker[C_j[ib]] = ib;
+            }
+
+            for (ia = A_i[iic]; ia < A_i[iic + 1]; ia++)
+            {
+               ja = A_j[ia];
+               a_entry = A_data[ia];
+               for (ib = B_i[ja]; ib < B_i[ja + 1]; ib++)
+               {
+                  C_data[marker[B_j[ib]]] += a_entry * B_data[ib];
+               }
+            }
+         }
+      }
+
+      hypre_TFree(marker, HYPRE_MEMORY_HOST);
+   } /* end parallel region */
+   HYPRE_ANNOTATE_REGION_END("%s", "Numeric pass");
+
+   return hypre_error_flag;
+}
@@ -120,6 +120,13 @@ HYPRE_Int hypre_CSRMatrixPrefetch( hypre_CSRMatrix *A, HYPRE_MemoryLocation memo
 HYPRE_Int hypre_CSRMatrixCheckSetNumNonzeros( hypre_CSRMatrix *matrix );
 HYPRE_Int hypre_CSRMatrixResize( hypre_CSRMatrix *matrix, HYPRE_Int new_num_rows,
                                  HYPRE_Int new_num_cols, HYPRE_Int new_num_nonzeros );
+hypre_CSRSellData *hypre_CSRSellDataCreate( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRSellDataDestroy( hypre_CSRSellData *data );
+hypre_CSRSellData *hypre_CSRMatrixGetSellData( hypre_CSRMatrix *matrix );
+HYPRE_Int hypre_CSRMatrixResetSellData( hypre_CSRMatrix *matrix );
+HYPRE_Int hypre_CSRMatrixInvalidateCopies( hypre_CSRMatrix *matrix );
+HYPRE_Int hypre_CSRMatrixConvertToFloat( hypre_CSRMatrix *matrix );
+HYPRE_Int hypre_CSRMatrixConvertFromFloat( hypre_CSRMatrix *matrix );
 
 /* csr_matvec.c */
 // y[offset:end] = alpha*A[offset:end,:]*x + beta*b[offset:end]
@@ -133,6 +140,14 @@ HYPRE_Int hypre_CSRMatrixMatvecT ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypr
 HYPRE_Int hypre_CSRMatrixMatvec_FF ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x,
                                      HYPRE_Complex beta, hypre_Vector *y, HYPRE_Int *CF_marker_x, HYPRE_Int *CF_marker_y,
                                      HYPRE_Int fpt );
+HYPRE_Int hypre_CSRMatrixMatvecSell ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x,
+                                      HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y );
+HYPRE_Int hypre_CSRMatrixMatvecTSell ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x,
+                                       HYPRE_Complex beta, hypre_Vector *y );
+HYPRE_Int hypre_CSRMatrixMatvecFloat ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x,
+                                       HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y, HYPRE_Int offset );
+HYPRE_Int hypre_CSRMatrixMatvecTFloat ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x,
+                                        HYPRE_Complex beta, hypre_Vector *y );
 
 /* csr_matvec_device.c */
 HYPRE_Int hypre_CSRMatrixMatvecDevice(HYPRE_Int trans, HYPRE_Complex alpha, hypre_CSRMatrix *A,
@@ -151,6 +166,12 @@ HYPRE_Int hypre_CSRMatrixMatvecOnemklsparse (HYPRE_Int trans, HYPRE_Complex alph
                                              hypre_CSRMatrix *A,
                                              hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *y, HYPRE_Int offset );
 
+/* csr_spgemm_host.c */
+HYPRE_Int hypre_CSRMatrixMultiplySymbolicHost ( hypre_CSRMatrix *A, hypre_CSRMatrix *B,
+                                                hypre_CSRMatrix **C_ptr );
+HYPRE_Int hypre_CSRMatrixMultiplyNumericHost ( hypre_CSRMatrix *A, hypre_CSRMatrix *B,
+                                               hypre_CSRMatrix *C );
+
 /* genpart.c */
 HYPRE_Int hypre_GeneratePartitioning ( HYPRE_BigInt length, HYPRE_Int num_procs,
                                        HYPRE_BigInt **part_ptr );
@@ -263,6 +284,10 @@ HYPRE_Int hypre_SeqVectorMassAxpy4(HYPRE_Complex *alpha, hypre_Vector **x, hypre
                                    HYPRE_Int k);
 HYPRE_Int hypre_SeqVectorMassAxpy8(HYPRE_Complex *alpha, hypre_Vector **x, hypre_Vector *y,
                                    HYPRE_Int k);
+HYPRE_Int hypre_SeqVectorBlockInnerProd(HYPRE_Int nx, hypre_Vector **x, HYPRE_Int ny,
+                                        hypre_Vector **y, HYPRE_Int ld, HYPRE_Complex *result);
+HYPRE_Int hypre_SeqVectorBlockAxpy(HYPRE_Int nx, hypre_Vector **x, HYPRE_Int ny, hypre_Vector **y,
+                                   HYPRE_Int ld, HYPRE_Complex *coef, HYPRE_Complex beta);
 HYPRE_Complex hypre_SeqVectorSumElts ( hypre_Vector *vector );
 HYPRE_Int hypre_SeqVectorPrefetch(hypre_Vector *x, HYPRE_MemoryLocation memory_location);
 //HYPRE_Int hypre_SeqVectorMax( HYPRE_Complex alpha, hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *y );
@@ -46,6 +46,47 @@ struct hypre_GpuMatData;
 typedef struct hypre_GpuMatData hypre_GpuMatData;
 #endif
 
+/*--------------------------------------------------------------------------
+ * SELL-C-sigma copy of a CSR Matrix, used by the host matvec
+ *
+ * Rows are sorted by decreasing length inside windows of sigma rows and
+ * grouped into chunks of HYPRE_SELL_C rows.  Each chunk is padded to its
+ * longest row and stored column-major, so the inner loop of the matvec runs
+ * over HYPRE_SELL_C independent rows with unit stride.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_SELL_C     8
+#define HYPRE_SELL_SIGMA 256
+
+typedef struct
+{
+   HYPRE_Int            num_rows;
+   HYPRE_Int            num_chunks;
+   HYPRE_Int           *chunk_ptr;        /* start of each chunk in j and data */
+   HYPRE_Int           *chunk_len;        /* width (longest row) of each chunk */
+   HYPRE_Int           *row_perm;         /* CSR row stored in each SELL slot, -1 for padding */
+   HYPRE_Int           *j;
+   HYPRE_Complex       *data;
+
+   /* CSR arrays the copy was built from, used to detect reallocation */
+   HYPRE_Int           *csr_j;
+   HYPRE_Complex       *csr_data;
+   HYPRE_Int            csr_num_nonzeros;
+   hypre_uint           csr_generation;
+} hypre_CSRSellData;
+
+#define hypre_CSRSellDataNumRows(sell)              ((sell) -> num_rows)
+#define hypre_CSRSellDataNumChunks(sell)            ((sell) -> num_chunks)
+#define hypre_CSRSellDataChunkPtr(sell)             ((sell) -> chunk_ptr)
+#define hypre_CSRSellDataChunkLen(sell)             ((sell) -> chunk_len)
+#define hypre_CSRSellDataRowPerm(sell)              ((sell) -> row_perm)
+#define hypre_CSRSellDataJ(sell)                    ((sell) -> j)
+#define hypre_CSRSellDataData(sell)                 ((sell) -> data)
+#define hypre_CSRSellDataCSRJ(sell)                 ((sell) -> csr_j)
+#define hypre_CSRSellDataCSRData(sell)              ((sell) -> csr_data)
+#define hypre_CSRSellDataCSRNumNonzeros(sell)       ((sell) -> csr_num_nonzeros)
+#define hypre_CSRSellDataCSRGeneration(sell)        ((sell) -> csr_generation)
+
 /*--------------------------------------------------------------------------
  * CSR Matrix
  *--------------------------------------------------------------------------*/
@@ -65,6 +106,9 @@ typedef struct
    HYPRE_Int            *rownnz;          /* for compressing rows in matrix multiplication  */
    HYPRE_Int             num_rownnz;
    HYPRE_MemoryLocation  memory_location; /* memory location of arrays i, j, data */
+   hypre_CSRSellData    *sell_data;       /* SELL-C-sigma copy for host matvecs, built on demand */
+   hypre_float          *data_float;      /* single precision copy of `data' read by host matvecs */
+   hypre_uint            generation;      /* advanced whenever values or pattern change in place */
 #if defined(HYPRE_USING_CUSPARSE) || defined(HYPRE_USING_ROCSPARSE) || defined(HYPRE_USING_ONEMKLSPARSE)
    HYPRE_Int            *sorted_j;        /* some cusparse routines require sorted CSR */
    HYPRE_Complex        *sorted_data;
@@ -88,6 +132,9 @@ typedef struct
 #define hypre_CSRMatrixNumRownnz(matrix)            ((matrix) -> num_rownnz)
 #define hypre_CSRMatrixOwnsData(matrix)             ((matrix) -> owns_data)
 #define hypre_CSRMatrixMemoryLocation(matrix)       ((matrix) -> memory_location)
+#define hypre_CSRMatrixSellData(matrix)             ((matrix) -> sell_data)
+#define hypre_CSRMatrixDataFloat(matrix)            ((matrix) -> data_float)
+#define hypre_CSRMatrixGeneration(matrix)           ((matrix) -> generation)
 
 #if defined(HYPRE_USING_CUSPARSE) || defined(HYPRE_USING_ROCSPARSE) || defined(HYPRE_USING_ONEMKLSPARSE)
 #define hypre_CSRMatrixSortedJ(matrix)              ((matrix) -> sorted_j)
@@ -392,6 +439,13 @@ HYPRE_Int hypre_CSRMatrixPrefetch( hypre_CSRMatrix *A, HYPRE_MemoryLocation memo
 HYPRE_Int hypre_CSRMatrixCheckSetNumNonzeros( hypre_CSRMatrix *matrix );
 HYPRE_Int hypre_CSRMatrixResize( hypre_CSRMatrix *matrix, HYPRE_Int new_num_rows,
                                  HYPRE_Int new_num_cols, HYPRE_Int new_num_nonzeros );
+hypre_CSRSellData *hypre_CSRSellDataCreate( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRSellDataDestroy( hypre_CSRSellData *data );
+hypre_CSRSellData *hypre_CSRMatrixGetSellData( hypre_CSRMatrix *matrix );
+HYPRE_Int hypre_CSRMatrixResetSellData( hypre_CSRMatrix *matrix );
+HYPRE_Int hypre_CSRMatrixInvalidateCopies( hypre_CSRMatrix *matrix );
+HYPRE_Int hypre_CSRMatrixConvertToFloat( hypre_CSRMatrix *matrix );
+HYPRE_Int hypre_CSRMatrixConvertFromFloat( hypre_CSRMatrix *matrix );
 
 /* csr_matvec.c */
 // y[offset:end] = alpha*A[offset:end,:]*x + beta*b[offset:end]
@@ -405,6 +459,14 @@ HYPRE_Int hypre_CSRMatrixMatvecT ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypr
 HYPRE_Int hypre_CSRMatrixMatvec_FF ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x,
                                      HYPRE_Complex beta, hypre_Vector *y, HYPRE_Int *CF_marker_x, HYPRE_Int *CF_marker_y,
                                      HYPRE_Int fpt );
+HYPRE_Int hypre_CSRMatrixMatvecSell ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x,
+                                      HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y );
+HYPRE_Int hypre_CSRMatrixMatvecTSell ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x,
+                                       HYPRE_Complex beta, hypre_Vector *y );
+HYPRE_Int hypre_CSRMatrixMatvecFloat ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x,
+                                       HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y, HYPRE_Int offset );
+HYPRE_Int hypre_CSRMatrixMatvecTFloat ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x,
+                                        HYPRE_Complex beta, hypre_Vector *y );
 
 /* csr_matvec_device.c */
 HYPRE_Int hypre_CSRMatrixMatvecDevice(HYPRE_Int trans, HYPRE_Complex alpha, hypre_CSRMatrix *A,
@@ -423,6 +485,12 @@ HYPRE_Int hypre_CSRMatrixMatvecOnemklsparse (HYPRE_Int trans, HYPRE_Complex alph
                                              hypre_CSRMatrix *A,
                                              hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *y, HYPRE_Int offset );
 
+/* csr_spgemm_host.c */
+HYPRE_Int hypre_CSRMatrixMultiplySymbolicHost ( hypre_CSRMatrix *A, hypre_CSRMatrix *B,
+                                                hypre_CSRMatrix **C_ptr );
+HYPRE_Int hypre_CSRMatrixMultiplyNumericHost ( hypre_CSRMatrix *A, hypre_CSRMatrix *B,
+                                               hypre_CSRMatrix *C );
+
 /* genpart.c */
 HYPRE_Int hypre_GeneratePartitioning ( HYPRE_BigInt length, HYPRE_Int num_procs,
                                        HYPRE_BigInt **part_ptr );
@@ -535,6 +603,10 @@ HYPRE_Int hypre_SeqVectorMassAxpy4(HYPRE_Complex *alpha, hypre_Vector **x, hypre
                                    HYPRE_Int k);
 HYPRE_Int hypre_SeqVectorMassAxpy8(HYPRE_Complex *alpha, hypre_Vector **x, hypre_Vector *y,
                                    HYPRE_Int k);
+HYPRE_Int hypre_SeqVectorBlockInnerProd(HYPRE_Int nx, hypre_Vector **x, HYPRE_Int ny,
+                                        hypre_Vector **y, HYPRE_Int ld, HYPRE_Complex *result);
+HYPRE_Int hypre_SeqVectorBlockAxpy(HYPRE_Int nx, hypre_Vector **x, HYPRE_Int ny, hypre_Vector **y,
+                                   HYPRE_Int ld, HYPRE_Complex *coef, HYPRE_Complex beta);
 HYPRE_Complex hypre_SeqVectorSumElts ( hypre_Vector *vector );
 HYPRE_Int hypre_SeqVectorPrefetch(hypre_Vector *x, HYPRE_MemoryLocation memory_location);
 //HYPRE_Int hypre_SeqVectorMax( HYPRE_Complex alpha, hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *y );
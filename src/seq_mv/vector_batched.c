@@ -1207,3 +1207,253 @@ HYPRE_Int hypre_SeqVectorMassDotpTwo( hypre_Vector *x, hypre_Vector *y,
    return hypre_error_flag;
 }
 
+
+/*--------------------------------------------------------------------------
+ * Block kernels on sets of vectors
+ *
+ * The vectors of a block need not be stored contiguously. The rows are
+ * processed in tiles of HYPRE_VECTOR_BLOCK_TILE entries so that the tiles of
+ * all vectors of the block stay in cache while every pair is processed.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_VECTOR_BLOCK_TILE 512
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorBlockInnerProd
+ *
+ * result[ix + iy * ld] = <x[ix], y[iy]> for 0 <= ix < nx, 0 <= iy < ny.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SeqVectorBlockInnerProd( HYPRE_Int       nx,
+                               hypre_Vector  **x,
+                               HYPRE_Int       ny,
+                               hypre_Vector  **y,
+                               HYPRE_Int       ld,
+                               HYPRE_Complex  *result )
+{
+   HYPRE_Int       ix, iy;
+
+   if (nx <= 0 || ny <= 0)
+   {
+      return hypre_error_flag;
+   }
+
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP) || defined(HYPRE_USING_SYCL)
+   for (iy = 0; iy < ny; iy++)
+   {
+      for (ix = 0; ix < nx; ix++)
+      {
+         result[ix + iy * ld] = hypre_SeqVectorInnerProd(x[ix], y[iy]);
+      }
+   }
+
+   return hypre_error_flag;
+#else
+   HYPRE_Int       size, num_threads, nxy, t;
+   HYPRE_Complex  *work;
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] -= hypre_MPI_Wtime();
+#endif
+
+   size        = hypre_VectorSize(x[0]);
+   num_threads = hypre_NumThreads();
+   nxy         = nx * ny;
+   work        = hypre_CTAlloc(HYPRE_Complex, num_threads * nxy, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel
+#endif
+   {
+      HYPRE_Int       my_thread = hypre_GetThreadNum();
+      HYPRE_Complex  *local     = work + my_thread * nxy;
+      HYPRE_Complex  *x0, *x1, *x2, *x3, *y_data;
+      HYPRE_Complex   s0, s1, s2, s3, yc;
+      HYPRE_Int       ns, ne, ts, te, i, jx, jy;
+
+      hypre_partition1D(size, hypre_NumActiveThreads(), my_thread, &ns, &ne);
+
+      for (ts = ns; ts < ne; ts += HYPRE_VECTOR_BLOCK_TILE)
+      {
+         te = hypre_min(ts + HYPRE_VECTOR_BLOCK_TILE, ne);
+
+         for (jy = 0; jy < ny; jy++)
+         {
+            y_data = hypre_VectorData(y[jy]);
+
+            for (jx = 0; jx + 3 < nx; jx += 4)
+            {
+               x0 = hypre_VectorData(x[jx]);
+               x1 = hypre_VectorData(x[jx + 1]);
+               x2 = hypre_VectorData(x[jx + 2]);
+               x3 = hypre_VectorData(x[jx + 3]);
+               s0 = s1 = s2 = s3 = 0.0;
+               for (i = ts; i < te; i++)
+               {
+                  yc  = hypre_conj(y_data[i]);
+                  s0 += yc * x0[i];
+                  s1 += yc * x1[i];
+                  s2 += yc * x2[i];
+                  s3 += yc * x3[i];
+               }
+               local[jx     + jy * nx] += s0;
+               local[jx + 1 + jy * nx] += s1;
+               local[jx + 2 + jy * nx] += s2;
+               local[jx + 3 + jy * nx] += s3;
+            }
+
+            for (; jx < nx; jx++)
+            {
+               x0 = hypre_VectorData(x[jx]);
+               s0 = 0.0;
+               for (i = ts; i < te; i++)
+               {
+                  s0 += hypre_conj(y_data[i]) * x0[i];
+               }
+               local[jx + jy * nx] += s0;
+            }
+         }
+      }
+   } /* end parallel region */
+
+   /* Sum the thread contributions in a fixed order */
+   for (iy = 0; iy < ny; iy++)
+   {
+      for (ix = 0; ix < nx; ix++)
+      {
+         result[ix + iy * ld] = work[ix + iy * nx];
+         for (t = 1; t < num_threads; t++)
+         {
+            result[ix + iy * ld] += work[t * nxy + ix + iy * nx];
+         }
+      }
+   }
+
+   hypre_TFree(work, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorBlockAxpy
+ *
+ * y[iy] = beta * y[iy] + sum_ix coef[ix + iy * ld] * x[ix] for 0 <= iy < ny.
+ * If beta is zero, y is not read.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SeqVectorBlockAxpy( HYPRE_Int       nx,
+                          hypre_Vector  **x,
+                          HYPRE_Int       ny,
+                          hypre_Vector  **y,
+                          HYPRE_Int       ld,
+                          HYPRE_Complex  *coef,
+                          HYPRE_Complex   beta )
+{
+   HYPRE_Int  ix, iy;
+
+   if (ny <= 0)
+   {
+      return hypre_error_flag;
+   }
+
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP) || defined(HYPRE_USING_SYCL)
+   for (iy = 0; iy < ny; iy++)
+   {
+      if (beta == 0.0)
+      {
+         hypre_SeqVectorSetConstantValues(y[iy], 0.0);
+      }
+      else if (beta != 1.0)
+      {
+         hypre_SeqVectorScale(beta, y[iy]);
+      }
+
+      for (ix = 0; ix < nx; ix++)
+      {
+         hypre_SeqVectorAxpy(coef[ix + iy * ld], x[ix], y[iy]);
+      }
+   }
+
+   return hypre_error_flag;
+#else
+   HYPRE_Int  size, num_tiles, t;
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] -= hypre_MPI_Wtime();
+#endif
+
+   size      = hypre_VectorSize(y[0]);
+   num_tiles = (size + HYPRE_VECTOR_BLOCK_TILE - 1) / HYPRE_VECTOR_BLOCK_TILE;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(t, ix, iy) HYPRE_SMP_SCHEDULE
+#endif
+   for (t = 0; t < num_tiles; t++)
+   {
+      HYPRE_Int       ts = t * HYPRE_VECTOR_BLOCK_TILE;
+      HYPRE_Int       te = hypre_min(ts + HYPRE_VECTOR_BLOCK_TILE, size);
+      HYPRE_Int       i;
+      HYPRE_Complex  *x0, *x1, *x2, *x3, *y_data;
+      HYPRE_Complex   c0, c1, c2, c3;
+
+      for (iy = 0; iy < ny; iy++)
+      {
+         y_data = hypre_VectorData(y[iy]);
+
+         if (beta == 0.0)
+         {
+            for (i = ts; i < te; i++)
+            {
+               y_data[i] = 0.0;
+            }
+         }
+         else if (beta != 1.0)
+         {
+            for (i = ts; i < te; i++)
+            {
+               y_data[i] *= beta;
+            }
+         }
+
+         for (ix = 0; ix + 3 < nx; ix += 4)
+         {
+            x0 = hypre_VectorData(x[ix]);
+            x1 = hypre_VectorData(x[ix + 1]);
+            x2 = hypre_VectorData(x[ix + 2]);
+            x3 = hypre_VectorData(x[ix + 3]);
+            c0 = coef[ix     + iy * ld];
+            c1 = coef[ix + 1 + iy * ld];
+            c2 = coef[ix + 2 + iy * ld];
+            c3 = coef[ix + 3 + iy * ld];
+            for (i = ts; i < te; i++)
+            {
+               y_data[i] += c0 * x0[i] + c1 * x1[i] + c2 * x2[i] + c3 * x3[i];
+            }
+         }
+
+         for (; ix < nx; ix++)
+         {
+            x0 = hypre_VectorData(x[ix]);
+            c0 = coef[ix + iy * ld];
+            for (i = ts; i < te; i++)
+            {
+               y_data[i] += c0 * x0[i];
+            }
+         }
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+#endif
+}
@@ -165,6 +165,22 @@ hypre_F90_IFACE(hypre_sstructgmressetmaxiter, HYPRE_SSTRUCTGMRESSETMAXITER)
                hypre_F90_PassInt (max_iter) ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_SStructGMRESSetPipelined
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_F90_IFACE(hypre_sstructgmressetpipelined, HYPRE_SSTRUCTGMRESSETPIPELINED)
+(hypre_F90_Obj *solver,
+ hypre_F90_Int *pipelined,
+ hypre_F90_Int *ierr)
+{
+   *ierr = (hypre_F90_Int)
+           (HYPRE_SStructGMRESSetPipelined(
+               hypre_F90_PassObj (HYPRE_SStructSolver, solver),
+               hypre_F90_PassInt (pipelined) ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_SStructGMRESSetStopCrit
  *--------------------------------------------------------------------------*/
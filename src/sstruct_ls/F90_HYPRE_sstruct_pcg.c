@@ -166,6 +166,22 @@ hypre_F90_IFACE(hypre_sstructpcgsetrelchange, HYPRE_SSTRUCTPCGSETRELCHANGE)
                hypre_F90_PassInt (rel_change) ) );
 }
 
+/*--------------------------------------------------------------------------
+ *  HYPRE_SStructPCGSetPipelined
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_F90_IFACE(hypre_sstructpcgsetpipelined, HYPRE_SSTRUCTPCGSETPIPELINED)
+(hypre_F90_Obj *solver,
+ hypre_F90_Int *pipelined,
+ hypre_F90_Int *ierr)
+{
+   *ierr = (hypre_F90_Int)
+           (HYPRE_SStructPCGSetPipelined(
+               hypre_F90_PassObj (HYPRE_SStructSolver, solver),
+               hypre_F90_PassInt (pipelined) ) );
+}
+
 /*--------------------------------------------------------------------------
  *  HYPRE_SStructPCGSetPrecond
  *--------------------------------------------------------------------------*/
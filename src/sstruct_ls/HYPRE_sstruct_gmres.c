@@ -25,6 +25,8 @@ HYPRE_SStructGMRESCreate( MPI_Comm             comm,
          hypre_SStructKrylovClearVector,
          hypre_SStructKrylovScaleVector, hypre_SStructKrylovAxpy,
          hypre_SStructKrylovIdentitySetup, hypre_SStructKrylovIdentity );
+   hypre_GMRESFunctionsSetAsyncInnerProd(gmres_functions, hypre_SStructKrylovInnerProdLocal,
+                                        hypre_SStructKrylovIAllreduce);
 
    *solver = ( (HYPRE_SStructSolver) hypre_GMRESCreate( gmres_functions ) );
 
@@ -118,6 +120,16 @@ HYPRE_SStructGMRESSetMaxIter( HYPRE_SStructSolver solver,
    return ( HYPRE_GMRESSetMaxIter( (HYPRE_Solver) solver, max_iter ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructGMRESSetPipelined( HYPRE_SStructSolver solver,
+                                HYPRE_Int           pipelined )
+{
+   return ( HYPRE_GMRESSetPipelined( (HYPRE_Solver) solver, pipelined ) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -87,6 +87,8 @@ HYPRE_SStructSetupInterpreter( mv_InterfaceInterpreter *i )
    i->MultiAxpy = mv_TempMultiVectorAxpy;
    i->MultiXapy = mv_TempMultiVectorXapy;
    i->Eval = mv_TempMultiVectorEval;
+   i->BlockInnerProd = NULL;
+   i->BlockAxpy = NULL;
 
    return 0;
 }
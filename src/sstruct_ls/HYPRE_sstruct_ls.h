@@ -793,6 +793,10 @@ HYPRE_Int
 HYPRE_SStructPCGSetRelChange(HYPRE_SStructSolver solver,
                              HYPRE_Int           rel_change);
 
+HYPRE_Int
+HYPRE_SStructPCGSetPipelined(HYPRE_SStructSolver solver,
+                             HYPRE_Int           pipelined);
+
 HYPRE_Int
 HYPRE_SStructPCGSetPrecond(HYPRE_SStructSolver          solver,
                            HYPRE_PtrToSStructSolverFcn  precond,
@@ -901,6 +905,10 @@ HYPRE_Int
 HYPRE_SStructGMRESSetMaxIter(HYPRE_SStructSolver solver,
                              HYPRE_Int           max_iter);
 
+HYPRE_Int
+HYPRE_SStructGMRESSetPipelined(HYPRE_SStructSolver solver,
+                               HYPRE_Int           pipelined);
+
 HYPRE_Int
 HYPRE_SStructGMRESSetKDim(HYPRE_SStructSolver solver,
                           HYPRE_Int           k_dim);
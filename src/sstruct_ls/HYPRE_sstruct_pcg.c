@@ -24,6 +24,8 @@ HYPRE_SStructPCGCreate( MPI_Comm             comm,
          hypre_SStructKrylovClearVector,
          hypre_SStructKrylovScaleVector, hypre_SStructKrylovAxpy,
          hypre_SStructKrylovIdentitySetup, hypre_SStructKrylovIdentity );
+   hypre_PCGFunctionsSetAsyncInnerProd(pcg_functions, hypre_SStructKrylovInnerProdLocal,
+                                      hypre_SStructKrylovIAllreduce);
 
    *solver = ( (HYPRE_SStructSolver) hypre_PCGCreate( pcg_functions ) );
 
@@ -118,6 +120,16 @@ HYPRE_SStructPCGSetRelChange( HYPRE_SStructSolver solver,
    return ( HYPRE_PCGSetRelChange( (HYPRE_Solver) solver, rel_change ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructPCGSetPipelined( HYPRE_SStructSolver solver,
+                              HYPRE_Int           pipelined )
+{
+   return ( HYPRE_PCGSetPipelined( (HYPRE_Solver) solver, pipelined ) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -390,6 +390,7 @@ HYPRE_Int HYPRE_SStructGMRESSetTol ( HYPRE_SStructSolver solver, HYPRE_Real tol
 HYPRE_Int HYPRE_SStructGMRESSetAbsoluteTol ( HYPRE_SStructSolver solver, HYPRE_Real atol );
 HYPRE_Int HYPRE_SStructGMRESSetMinIter ( HYPRE_SStructSolver solver, HYPRE_Int min_iter );
 HYPRE_Int HYPRE_SStructGMRESSetMaxIter ( HYPRE_SStructSolver solver, HYPRE_Int max_iter );
+HYPRE_Int HYPRE_SStructGMRESSetPipelined ( HYPRE_SStructSolver solver, HYPRE_Int pipelined );
 HYPRE_Int HYPRE_SStructGMRESSetStopCrit ( HYPRE_SStructSolver solver, HYPRE_Int stop_crit );
 HYPRE_Int HYPRE_SStructGMRESSetPrecond ( HYPRE_SStructSolver solver,
                                          HYPRE_PtrToSStructSolverFcn precond, HYPRE_PtrToSStructSolverFcn precond_setup,
@@ -519,6 +520,7 @@ HYPRE_Int HYPRE_SStructPCGSetAbsoluteTol ( HYPRE_SStructSolver solver, HYPRE_Rea
 HYPRE_Int HYPRE_SStructPCGSetMaxIter ( HYPRE_SStructSolver solver, HYPRE_Int max_iter );
 HYPRE_Int HYPRE_SStructPCGSetTwoNorm ( HYPRE_SStructSolver solver, HYPRE_Int two_norm );
 HYPRE_Int HYPRE_SStructPCGSetRelChange ( HYPRE_SStructSolver solver, HYPRE_Int rel_change );
+HYPRE_Int HYPRE_SStructPCGSetPipelined ( HYPRE_SStructSolver solver, HYPRE_Int pipelined );
 HYPRE_Int HYPRE_SStructPCGSetPrecond ( HYPRE_SStructSolver solver,
                                        HYPRE_PtrToSStructSolverFcn precond, HYPRE_PtrToSStructSolverFcn precond_setup,
                                        void *precond_data );
@@ -593,6 +595,9 @@ HYPRE_Int hypre_SStructKrylovMatvec ( void *matvec_data, HYPRE_Complex alpha, vo
                                       HYPRE_Complex beta, void *y );
 HYPRE_Int hypre_SStructKrylovMatvecDestroy ( void *matvec_data );
 HYPRE_Real hypre_SStructKrylovInnerProd ( void *x, void *y );
+HYPRE_Real hypre_SStructKrylovInnerProdLocal ( void *x, void *y );
+HYPRE_Int hypre_SStructKrylovIAllreduce ( void *x, HYPRE_Real *sendbuf, HYPRE_Real *recvbuf,
+                                          HYPRE_Int count, hypre_MPI_Request *request );
 HYPRE_Int hypre_SStructKrylovCopyVector ( void *x, void *y );
 HYPRE_Int hypre_SStructKrylovClearVector ( void *x );
 HYPRE_Int hypre_SStructKrylovScaleVector ( HYPRE_Complex alpha, void *x );
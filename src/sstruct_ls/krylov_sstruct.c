@@ -215,6 +215,35 @@ hypre_SStructKrylovInnerProd( void *x,
    return result;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_SStructKrylovInnerProdLocal( void *x,
+                                   void *y )
+{
+   HYPRE_Real result;
+
+   hypre_SStructInnerProdLocal( (hypre_SStructVector *) x,
+                                (hypre_SStructVector *) y, &result );
+
+   return result;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructKrylovIAllreduce( void              *x,
+                               HYPRE_Real        *sendbuf,
+                               HYPRE_Real        *recvbuf,
+                               HYPRE_Int          count,
+                               hypre_MPI_Request *request )
+{
+   return hypre_MPI_Iallreduce(sendbuf, recvbuf, count, HYPRE_MPI_REAL, hypre_MPI_SUM,
+                               hypre_SStructVectorComm((hypre_SStructVector *) x), request);
+}
+
 
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
@@ -298,6 +298,22 @@ hypre_F90_IFACE(hypre_sstructmatrixsetnssymmetr, HYPRE_SSTRUCTMATRIXSETNSSYMMETR
                hypre_F90_PassInt (symmetric) ));
 }
 
+/*--------------------------------------------------------------------------
+ *  HYPRE_SStructMatrixSetDirectParCSR
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_F90_IFACE(hypre_sstructmatrixsetdirectpar, HYPRE_SSTRUCTMATRIXSETDIRECTPAR)
+(hypre_F90_Obj *matrix,
+ hypre_F90_Int *direct,
+ hypre_F90_Int *ierr)
+{
+   *ierr = (hypre_F90_Int)
+           (HYPRE_SStructMatrixSetDirectParCSR(
+               hypre_F90_PassObj (HYPRE_SStructMatrix, matrix),
+               hypre_F90_PassInt (direct) ));
+}
+
 /*--------------------------------------------------------------------------
  *  HYPRE_SStructMatrixSetObjectType
  *--------------------------------------------------------------------------*/
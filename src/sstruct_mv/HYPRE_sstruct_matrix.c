@@ -136,6 +136,7 @@ HYPRE_SStructMatrixCreate( MPI_Comm              comm,
 
    hypre_SStructMatrixNSSymmetric(matrix) = 0;
    hypre_SStructMatrixGlobalSize(matrix)  = 0;
+   hypre_SStructMatrixDirectParCSR(matrix) = 0;
    hypre_SStructMatrixRefCount(matrix)    = 1;
 
    /* GEC0902 setting the default of the object_type to HYPRE_SSTRUCT */
@@ -189,6 +190,11 @@ HYPRE_SStructMatrixDestroy( HYPRE_SStructMatrix matrix )
          hypre_TFree(splits, HYPRE_MEMORY_HOST);
          hypre_TFree(pmatrices, HYPRE_MEMORY_HOST);
          hypre_TFree(symmetric, HYPRE_MEMORY_HOST);
+         if (hypre_SStructMatrixDirectParCSR(matrix))
+         {
+            /* not owned by the IJ matrix in this case */
+            hypre_ParCSRMatrixDestroy(hypre_SStructMatrixParCSRMatrix(matrix));
+         }
          HYPRE_IJMatrixDestroy(hypre_SStructMatrixIJMatrix(matrix));
          hypre_TFree(hypre_SStructMatrixSEntries(matrix), HYPRE_MEMORY_HOST);
          hypre_TFree(hypre_SStructMatrixUEntries(matrix), HYPRE_MEMORY_HOST);
@@ -237,6 +243,64 @@ HYPRE_SStructMatrixInitialize( HYPRE_SStructMatrix matrix )
    HYPRE_Int               ilower, iupper, jlower, jupper;
    HYPRE_Int               matrix_type = hypre_SStructMatrixObjectType(matrix);
 
+   /* Direct ParCSR conversion: keep same-type stencil couplings in the
+    * S-matrix, as for HYPRE_SSTRUCT, and convert them box-wise in Assemble */
+   if (hypre_SStructMatrixDirectParCSR(matrix))
+   {
+      hypre_SStructMatrixDirectParCSR(matrix) = 0;
+#if !defined(HYPRE_USING_GPU)
+      if (matrix_type == HYPRE_PARCSR &&
+          hypre_SStructGraphGrid(graph) == hypre_SStructGraphDomainGrid(graph))
+      {
+         hypre_SStructMatrixDirectParCSR(matrix) = 1;
+         for (part = 0; part < nparts; part++)
+         {
+            pgrid = hypre_SStructGraphPGrid(graph, part);
+            nvars = hypre_SStructPGridNVars(pgrid);
+            for (var = 0; var < nvars; var++)
+            {
+               for (i = 0; i < nvars; i++)
+               {
+                  if (symmetric[part][var][i])
+                  {
+                     hypre_SStructMatrixDirectParCSR(matrix) = 0;
+                  }
+               }
+            }
+         }
+      }
+#endif
+   }
+
+   if (hypre_SStructMatrixDirectParCSR(matrix))
+   {
+      for (part = 0; part < nparts; part++)
+      {
+         pgrid = hypre_SStructGraphPGrid(graph, part);
+         nvars = hypre_SStructPGridNVars(pgrid);
+         for (var = 0; var < nvars; var++)
+         {
+            split = hypre_SStructMatrixSplit(matrix, part, var);
+            stencil_size = hypre_SStructStencilSize(stencils[part][var]);
+            stencil_vars = hypre_SStructStencilVars(stencils[part][var]);
+            pstencil_size = 0;
+            for (i = 0; i < stencil_size; i++)
+            {
+               if (hypre_SStructPGridVarType(pgrid, stencil_vars[i]) ==
+                   hypre_SStructPGridVarType(pgrid, var))
+               {
+                  split[i] = pstencil_size;
+                  pstencil_size++;
+               }
+               else
+               {
+                  split[i] = -1;
+               }
+            }
+         }
+      }
+   }
+
    /* S-matrix */
    for (part = 0; part < nparts; part++)
    {
@@ -845,6 +909,26 @@ HYPRE_SStructMatrixSetNSSymmetric( HYPRE_SStructMatrix matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructMatrixSetDirectParCSR( HYPRE_SStructMatrix matrix,
+                                    HYPRE_Int           direct )
+{
+   /* the IJ matrix and the ParCSR ownership are set up in Initialize */
+   if (hypre_SStructMatrixIJMatrix(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "SetDirectParCSR must be called before Initialize");
+      return hypre_error_flag;
+   }
+
+   hypre_SStructMatrixDirectParCSR(matrix) = direct;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
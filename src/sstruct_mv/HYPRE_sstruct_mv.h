@@ -774,6 +774,22 @@ HYPRE_Int
 HYPRE_SStructMatrixSetObjectType(HYPRE_SStructMatrix  matrix,
                                  HYPRE_Int            type);
 
+/**
+ * (Optional) Build the \c HYPRE_PARCSR matrix object directly from the
+ * stencil coefficients instead of passing them through the IJ interface.  With
+ * \e direct set to 1, stencil couplings are stored in structured form and
+ * converted box by box to ParCSR in \c Assemble, and only non-stencil graph
+ * entries and inter-part couplings go through IJ.  Must be called before \c
+ * Initialize; an error is returned otherwise.  Ignored unless the object type
+ * is \c HYPRE_PARCSR; also ignored for rectangular matrices and when symmetric
+ * stencil storage is requested.  The default is 0.
+ *
+ * @see HYPRE_SStructMatrixSetObjectType
+ **/
+HYPRE_Int
+HYPRE_SStructMatrixSetDirectParCSR(HYPRE_SStructMatrix  matrix,
+                                   HYPRE_Int            direct);
+
 /**
  * Get a reference to the constructed matrix object.
  *
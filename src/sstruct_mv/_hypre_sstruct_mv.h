@@ -607,6 +607,7 @@ typedef struct hypre_SStructMatrix_struct
 
    HYPRE_Int               ns_symmetric; /* Non-stencil entries symmetric? */
    HYPRE_Int               global_size;  /* Total number of nonzero coeffs */
+   HYPRE_Int               direct_parcsr; /* Convert S-matrix to ParCSR box-wise? */
 
    HYPRE_Int               ref_count;
 
@@ -642,6 +643,7 @@ typedef struct hypre_SStructMatrix_struct
 #define hypre_SStructMatrixTmpCoeffsDevice(mat)      ((mat) -> d_tmp_coeffs)
 #define hypre_SStructMatrixNSSymmetric(mat)          ((mat) -> ns_symmetric)
 #define hypre_SStructMatrixGlobalSize(mat)           ((mat) -> global_size)
+#define hypre_SStructMatrixDirectParCSR(mat)         ((mat) -> direct_parcsr)
 #define hypre_SStructMatrixRefCount(mat)             ((mat) -> ref_count)
 #define hypre_SStructMatrixObjectType(mat)           ((mat) -> object_type)
 
@@ -860,6 +862,7 @@ HYPRE_Int HYPRE_SStructMatrixAssemble ( HYPRE_SStructMatrix matrix );
 HYPRE_Int HYPRE_SStructMatrixSetSymmetric ( HYPRE_SStructMatrix matrix, HYPRE_Int part,
                                             HYPRE_Int var, HYPRE_Int to_var, HYPRE_Int symmetric );
 HYPRE_Int HYPRE_SStructMatrixSetNSSymmetric ( HYPRE_SStructMatrix matrix, HYPRE_Int symmetric );
+HYPRE_Int HYPRE_SStructMatrixSetDirectParCSR ( HYPRE_SStructMatrix matrix, HYPRE_Int direct );
 HYPRE_Int HYPRE_SStructMatrixSetObjectType ( HYPRE_SStructMatrix matrix, HYPRE_Int type );
 HYPRE_Int HYPRE_SStructMatrixGetObject ( HYPRE_SStructMatrix matrix, void **object );
 HYPRE_Int HYPRE_SStructMatrixPrint ( const char *filename, HYPRE_SStructMatrix matrix,
@@ -1003,6 +1006,10 @@ HYPRE_Int hypre_SStructPInnerProd ( hypre_SStructPVector *px, hypre_SStructPVect
                                     HYPRE_Real *presult_ptr );
 HYPRE_Int hypre_SStructInnerProd ( hypre_SStructVector *x, hypre_SStructVector *y,
                                    HYPRE_Real *result_ptr );
+HYPRE_Int hypre_SStructPInnerProdLocal ( hypre_SStructPVector *px, hypre_SStructPVector *py,
+                                        HYPRE_Real *presult_ptr );
+HYPRE_Int hypre_SStructInnerProdLocal ( hypre_SStructVector *x, hypre_SStructVector *y,
+                                       HYPRE_Real *result_ptr );
 
 /* sstruct_matrix.c */
 HYPRE_Int hypre_SStructPMatrixRef ( hypre_SStructPMatrix *matrix,
@@ -1029,6 +1036,7 @@ HYPRE_Int hypre_SStructUMatrixSetValues ( hypre_SStructMatrix *matrix, HYPRE_Int
 HYPRE_Int hypre_SStructUMatrixSetBoxValues( hypre_SStructMatrix *matrix, HYPRE_Int part,
                                             hypre_Box *set_box, HYPRE_Int var, HYPRE_Int nentries, HYPRE_Int *entries, hypre_Box *value_box,
                                             HYPRE_Complex *values, HYPRE_Int action );
+HYPRE_Int hypre_SStructMatrixBoxesToParCSR ( hypre_SStructMatrix *matrix, hypre_ParCSRMatrix *parcsr_U, hypre_ParCSRMatrix **parcsr_S_ptr );
 HYPRE_Int hypre_SStructUMatrixAssemble ( hypre_SStructMatrix *matrix );
 HYPRE_Int hypre_SStructMatrixRef ( hypre_SStructMatrix *matrix, hypre_SStructMatrix **matrix_ref );
 HYPRE_Int hypre_SStructMatrixSplitEntries ( hypre_SStructMatrix *matrix, HYPRE_Int part,
@@ -1264,16 +1264,427 @@ hypre_SStructUMatrixSetBoxValues( hypre_SStructMatrix *matrix,
 }
 
 /*--------------------------------------------------------------------------
+ * Convert the S-matrix of a HYPRE_PARCSR matrix to ParCSR box by box.  The
+ * row structure follows from the stencils and the box managers, so diag, offd
+ * and col_map_offd are filled directly, without the IJ interface.  The row and
+ * column partitioning is taken from the assembled U-matrix 'parcsr_U'.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructMatrixBoxesToParCSR( hypre_SStructMatrix  *matrix,
+                                  hypre_ParCSRMatrix   *parcsr_U,
+                                  hypre_ParCSRMatrix  **parcsr_S_ptr )
+{
+   HYPRE_Int              ndim      = hypre_SStructMatrixNDim(matrix);
+   HYPRE_Int              nparts    = hypre_SStructMatrixNParts(matrix);
+   hypre_SStructGraph    *graph     = hypre_SStructMatrixGraph(matrix);
+   hypre_SStructGrid     *dom_grid  = hypre_SStructGraphDomainGrid(graph);
+   HYPRE_BigInt           first_col = hypre_ParCSRMatrixFirstColDiag(parcsr_U);
+   HYPRE_Int              nrows     = hypre_ParCSRMatrixNumRows(parcsr_U);
+   HYPRE_Int              ncols     = hypre_ParCSRMatrixNumCols(parcsr_U);
+
+   hypre_ParCSRMatrix    *parcsr_S;
+   hypre_CSRMatrix       *diag, *offd;
+   HYPRE_Int             *diag_i, *diag_j, *offd_i, *offd_j;
+   HYPRE_Complex         *diag_data, *offd_data;
+   HYPRE_BigInt          *offd_big_j, *col_map_offd;
+   HYPRE_Int             *diag_pos, *offd_pos;
+   HYPRE_Int              nnz_diag = 0, nnz_offd = 0, num_cols_offd = 0;
+
+   hypre_SStructPMatrix  *pmatrix;
+   hypre_SStructPGrid    *pgrid;
+   hypre_SStructStencil  *stencil;
+   hypre_StructMatrix    *smatrix;
+   hypre_BoxArray        *boxes;
+   hypre_Box             *box, *data_box;
+   hypre_Box             *to_box, *map_box, *int_box;
+   hypre_BoxManEntry    **boxman_entries;
+   hypre_SStructBoxManInfo *info;
+   hypre_Index           *shape;
+   hypre_IndexRef         offset, start;
+   hypre_Index            stride, loop_size, cs, index;
+   HYPRE_BigInt           col_base;
+   HYPRE_Complex         *values;
+   HYPRE_Int             *vars, *smap, *order;
+   HYPRE_Int              nboxman_entries, nvars, size, diag_entry, topart;
+   HYPRE_Int              pass, part, var, b, ei, entry, jj, i, m, box_start;
+
+   to_box  = hypre_BoxCreate(ndim);
+   map_box = hypre_BoxCreate(ndim);
+   int_box = hypre_BoxCreate(ndim);
+   hypre_SetIndex(stride, 1);
+
+   diag_i = hypre_CTAlloc(HYPRE_Int, nrows + 1, HYPRE_MEMORY_HOST);
+   offd_i = hypre_CTAlloc(HYPRE_Int, nrows + 1, HYPRE_MEMORY_HOST);
+   diag_pos = hypre_TAlloc(HYPRE_Int, nrows, HYPRE_MEMORY_HOST);
+   offd_pos = hypre_TAlloc(HYPRE_Int, nrows, HYPRE_MEMORY_HOST);
+   diag_j = NULL;
+   diag_data = NULL;
+   offd_big_j = NULL;
+   offd_data = NULL;
+
+   /* Pass 0 counts the couplings of each row, pass 1 fills them in.  Local
+    * rows are numbered consecutively by part, variable and box, and each
+    * stencil entry contributes at most one coupling per row, so the box loops
+    * below never touch the same row concurrently. */
+   for (pass = 0; pass < 2; pass++)
+   {
+      m = 0;
+      for (part = 0; part < nparts; part++)
+      {
+         pmatrix = hypre_SStructMatrixPMatrix(matrix, part);
+         pgrid   = hypre_SStructPMatrixPGrid(pmatrix);
+         nvars   = hypre_SStructPMatrixNVars(pmatrix);
+         for (var = 0; var < nvars; var++)
+         {
+            stencil = hypre_SStructPMatrixStencil(pmatrix, var);
+            size    = hypre_SStructStencilSize(stencil);
+            shape   = hypre_SStructStencilShape(stencil);
+            vars    = hypre_SStructStencilVars(stencil);
+            smap    = hypre_SStructPMatrixSMap(pmatrix, var);
+
+            /* visit the diagonal entry first so that it leads its row */
+            order = hypre_TAlloc(HYPRE_Int, size, HYPRE_MEMORY_HOST);
+            diag_entry = -1;
+            for (entry = 0; entry < size; entry++)
+            {
+               if (vars[entry] == var && hypre_IndexEqual(shape[entry], 0, ndim))
+               {
+                  diag_entry = entry;
+               }
+            }
+            ei = 0;
+            if (diag_entry > -1)
+            {
+               order[ei++] = diag_entry;
+            }
+            for (entry = 0; entry < size; entry++)
+            {
+               if (entry != diag_entry)
+               {
+                  order[ei++] = entry;
+               }
+            }
+
+            boxes = hypre_StructGridBoxes(hypre_SStructPGridSGrid(pgrid, var));
+            hypre_ForBoxI(b, boxes)
+            {
+               box = hypre_BoxArrayBox(boxes, b);
+               box_start = m;
+
+               for (ei = 0; ei < size; ei++)
+               {
+                  entry   = order[ei];
+                  offset  = shape[entry];
+                  smatrix = hypre_SStructPMatrixSMatrix(pmatrix, var, vars[entry]);
+                  values  = hypre_StructMatrixBoxData(smatrix, b, smap[entry]);
+                  data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(smatrix), b);
+
+                  hypre_CopyBox(box, to_box);
+                  hypre_BoxShiftPos(to_box, offset);
+
+                  hypre_SStructGridIntersect(dom_grid, part, vars[entry], to_box, -1,
+                                             &boxman_entries, &nboxman_entries);
+
+                  for (jj = 0; jj < nboxman_entries; jj++)
+                  {
+                     /* Skip the inter-part couplings that were moved to the
+                      * U-matrix in hypre_SStructMatrixSetInterPartValues().
+                      * Periodic images keep the default info type and stay. */
+                     hypre_BoxManEntryGetInfo(boxman_entries[jj], (void **) &info);
+                     if (hypre_SStructBoxManInfoType(info) == hypre_SSTRUCT_BOXMAN_INFO_NEIGHBOR)
+                     {
+                        hypre_SStructBoxManEntryGetPart(boxman_entries[jj], part, &topart);
+                        if ( (topart != part) ||
+                             ((hypre_SStructPGridVarType(pgrid, var) ==
+                               HYPRE_SSTRUCT_VARIABLE_CELL) &&
+                              (hypre_SStructPGridVarType(pgrid, vars[entry]) ==
+                               HYPRE_SSTRUCT_VARIABLE_CELL)) )
+                        {
+                           continue;
+                        }
+                     }
+
+                     hypre_BoxManEntryGetExtents(boxman_entries[jj],
+                                                 hypre_BoxIMin(map_box),
+                                                 hypre_BoxIMax(map_box));
+                     hypre_IntersectBoxes(to_box, map_box, int_box);
+                     if (hypre_BoxVolume(int_box) == 0)
+                     {
+                        continue;
+                     }
+
+                     hypre_SStructBoxManEntryGetStrides(boxman_entries[jj], cs, HYPRE_PARCSR);
+                     hypre_CopyIndex(hypre_BoxIMin(int_box), index);
+                     hypre_SStructBoxManEntryGetGlobalRank(boxman_entries[jj], index,
+                                                           &col_base, HYPRE_PARCSR);
+
+                     hypre_BoxShiftNeg(int_box, offset);
+                     start = hypre_BoxIMin(int_box);
+                     hypre_BoxGetSize(int_box, loop_size);
+
+                     if (pass == 0)
+                     {
+                        zypre_BoxLoop1Begin(ndim, loop_size,
+                                            box, start, stride, ri);
+#ifdef HYPRE_USING_OPENMP
+                        #pragma omp parallel for private(HYPRE_BOX_PRIVATE,ri) HYPRE_SMP_SCHEDULE
+#endif
+                        zypre_BoxLoop1For(ri)
+                        {
+                           hypre_Index   lindex;
+                           HYPRE_BigInt  col = col_base;
+                           HYPRE_Int     d, row = box_start + ri;
+
+                           zypre_BoxLoopGetIndex(lindex);
+                           for (d = 0; d < ndim; d++)
+                           {
+                              col += lindex[d] * cs[d];
+                           }
+                           if (col >= first_col && col < first_col + ncols)
+                           {
+                              diag_i[row + 1]++;
+                           }
+                           else
+                           {
+                              offd_i[row + 1]++;
+                           }
+                        }
+                        zypre_BoxLoop1End(ri);
+                     }
+                     else
+                     {
+                        zypre_BoxLoop2Begin(ndim, loop_size,
+                                            box, start, stride, ri,
+                                            data_box, start, stride, ai);
+#ifdef HYPRE_USING_OPENMP
+                        #pragma omp parallel for private(HYPRE_BOX_PRIVATE,ri,ai) HYPRE_SMP_SCHEDULE
+#endif
+                        zypre_BoxLoop2For(ri, ai)
+                        {
+                           hypre_Index   lindex;
+                           HYPRE_BigInt  col = col_base;
+                           HYPRE_Int     d, k, row = box_start + ri;
+
+                           zypre_BoxLoopGetIndex(lindex);
+                           for (d = 0; d < ndim; d++)
+                           {
+                              col += lindex[d] * cs[d];
+                           }
+                           if (col >= first_col && col < first_col + ncols)
+                           {
+                              k = diag_pos[row]++;
+                              diag_j[k] = (HYPRE_Int) (col - first_col);
+                              diag_data[k] = values[ai];
+                           }
+                           else
+                           {
+                              k = offd_pos[row]++;
+                              offd_big_j[k] = col;
+                              offd_data[k] = values[ai];
+                           }
+                        }
+                        zypre_BoxLoop2End(ri, ai);
+                     }
+                  }
+                  hypre_TFree(boxman_entries, HYPRE_MEMORY_HOST);
+               }
+
+               m += hypre_BoxVolume(box);
+            }
+
+            hypre_TFree(order, HYPRE_MEMORY_HOST);
+         }
+      }
+      hypre_assert(m == nrows);
+
+      if (pass == 0)
+      {
+         for (i = 0; i < nrows; i++)
+         {
+            diag_i[i + 1] += diag_i[i];
+            offd_i[i + 1] += offd_i[i];
+         }
+         hypre_TMemcpy(diag_pos, diag_i, HYPRE_Int, nrows,
+                       HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+         hypre_TMemcpy(offd_pos, offd_i, HYPRE_Int, nrows,
+                       HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+         nnz_diag   = diag_i[nrows];
+         nnz_offd   = offd_i[nrows];
+         diag_j     = hypre_TAlloc(HYPRE_Int,     nnz_diag, HYPRE_MEMORY_HOST);
+         diag_data  = hypre_TAlloc(HYPRE_Complex, nnz_diag, HYPRE_MEMORY_HOST);
+         offd_big_j = hypre_TAlloc(HYPRE_BigInt,  nnz_offd, HYPRE_MEMORY_HOST);
+         offd_data  = hypre_TAlloc(HYPRE_Complex, nnz_offd, HYPRE_MEMORY_HOST);
+      }
+   }
+
+   hypre_TFree(diag_pos, HYPRE_MEMORY_HOST);
+   hypre_TFree(offd_pos, HYPRE_MEMORY_HOST);
+   hypre_BoxDestroy(to_box);
+   hypre_BoxDestroy(map_box);
+   hypre_BoxDestroy(int_box);
+
+   /* Compress the off-processor columns into col_map_offd */
+   col_map_offd = hypre_TAlloc(HYPRE_BigInt, nnz_offd, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(col_map_offd, offd_big_j, HYPRE_BigInt, nnz_offd,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_BigQsort0(col_map_offd, 0, nnz_offd - 1);
+   num_cols_offd = 0;
+   for (i = 0; i < nnz_offd; i++)
+   {
+      if (num_cols_offd == 0 || col_map_offd[i] != col_map_offd[num_cols_offd - 1])
+      {
+         col_map_offd[num_cols_offd++] = col_map_offd[i];
+      }
+   }
+   col_map_offd = hypre_TReAlloc(col_map_offd, HYPRE_BigInt, num_cols_offd,
+                                 HYPRE_MEMORY_HOST);
+
+   offd_j = hypre_TAlloc(HYPRE_Int, nnz_offd, HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < nnz_offd; i++)
+   {
+      offd_j[i] = hypre_BigBinarySearch(col_map_offd, offd_big_j[i], num_cols_offd);
+   }
+   hypre_TFree(offd_big_j, HYPRE_MEMORY_HOST);
+
+   parcsr_S = hypre_ParCSRMatrixCreate(hypre_ParCSRMatrixComm(parcsr_U),
+                                       hypre_ParCSRMatrixGlobalNumRows(parcsr_U),
+                                       hypre_ParCSRMatrixGlobalNumCols(parcsr_U),
+                                       hypre_ParCSRMatrixRowStarts(parcsr_U),
+                                       hypre_ParCSRMatrixColStarts(parcsr_U),
+                                       num_cols_offd, nnz_diag, nnz_offd);
+
+   diag = hypre_ParCSRMatrixDiag(parcsr_S);
+   hypre_CSRMatrixI(diag)    = diag_i;
+   hypre_CSRMatrixJ(diag)    = diag_j;
+   hypre_CSRMatrixData(diag) = diag_data;
+   hypre_CSRMatrixMemoryLocation(diag) = HYPRE_MEMORY_HOST;
+
+   offd = hypre_ParCSRMatrixOffd(parcsr_S);
+   hypre_CSRMatrixI(offd)    = offd_i;
+   hypre_CSRMatrixJ(offd)    = offd_j;
+   hypre_CSRMatrixData(offd) = offd_data;
+   hypre_CSRMatrixMemoryLocation(offd) = HYPRE_MEMORY_HOST;
+
+   hypre_ParCSRMatrixColMapOffd(parcsr_S) = col_map_offd;
+
+   *parcsr_S_ptr = parcsr_S;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Returns 1 if the two ParCSR matrices have identical local nonzero patterns.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_SStructUMatrixSamePattern( hypre_ParCSRMatrix *A,
+                                 hypre_ParCSRMatrix *B )
+{
+   hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix *A_offd = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix *B_diag = hypre_ParCSRMatrixDiag(B);
+   hypre_CSRMatrix *B_offd = hypre_ParCSRMatrixOffd(B);
+   HYPRE_Int        num_rows = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int        num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   HYPRE_Int        i;
+
+   if (num_rows != hypre_CSRMatrixNumRows(B_diag) ||
+       num_cols_offd != hypre_CSRMatrixNumCols(B_offd) ||
+       hypre_CSRMatrixNumNonzeros(A_diag) != hypre_CSRMatrixNumNonzeros(B_diag) ||
+       hypre_CSRMatrixNumNonzeros(A_offd) != hypre_CSRMatrixNumNonzeros(B_offd))
+   {
+      return 0;
+   }
+
+   for (i = 0; i <= num_rows; i++)
+   {
+      if (hypre_CSRMatrixI(A_diag)[i] != hypre_CSRMatrixI(B_diag)[i] ||
+          hypre_CSRMatrixI(A_offd)[i] != hypre_CSRMatrixI(B_offd)[i])
+      {
+         return 0;
+      }
+   }
+   for (i = 0; i < hypre_CSRMatrixNumNonzeros(A_diag); i++)
+   {
+      if (hypre_CSRMatrixJ(A_diag)[i] != hypre_CSRMatrixJ(B_diag)[i])
+      {
+         return 0;
+      }
+   }
+   for (i = 0; i < hypre_CSRMatrixNumNonzeros(A_offd); i++)
+   {
+      if (hypre_CSRMatrixJ(A_offd)[i] != hypre_CSRMatrixJ(B_offd)[i])
+      {
+         return 0;
+      }
+   }
+   for (i = 0; i < num_cols_offd; i++)
+   {
+      if (hypre_ParCSRMatrixColMapOffd(A)[i] != hypre_ParCSRMatrixColMapOffd(B)[i])
+      {
+         return 0;
+      }
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * With direct ParCSR conversion, the IJ matrix only holds the non-stencil and
+ * inter-part couplings, and the ParCSR matrix is the sum of that matrix and
+ * the box-wise conversion of the S-matrix.  The sum is owned by 'matrix' and
+ * is recomputed on every assemble; when its nonzero pattern is unchanged, the
+ * new values are copied into the existing ParCSR matrix.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
 hypre_SStructUMatrixAssemble( hypre_SStructMatrix *matrix )
 {
-   HYPRE_IJMatrix ijmatrix = hypre_SStructMatrixIJMatrix(matrix);
+   HYPRE_IJMatrix      ijmatrix = hypre_SStructMatrixIJMatrix(matrix);
+   hypre_ParCSRMatrix *parcsr_U;
+   hypre_ParCSRMatrix *parcsr_S;
+   hypre_ParCSRMatrix *parcsr_A;
+   hypre_ParCSRMatrix *parcsr_old;
 
    HYPRE_IJMatrixAssemble(ijmatrix);
-   HYPRE_IJMatrixGetObject(
-      ijmatrix, (void **) &hypre_SStructMatrixParCSRMatrix(matrix));
+
+   if (hypre_SStructMatrixDirectParCSR(matrix))
+   {
+      HYPRE_IJMatrixGetObject(ijmatrix, (void **) &parcsr_U);
+      hypre_SStructMatrixBoxesToParCSR(matrix, parcsr_U, &parcsr_S);
+
+      hypre_ParCSRMatrixAdd(1.0, parcsr_S, 1.0, parcsr_U, &parcsr_A);
+      hypre_ParCSRMatrixDestroy(parcsr_S);
+
+      /* keep the diagonal first also for rows without an S-matrix diagonal */
+      hypre_CSRMatrixReorder(hypre_ParCSRMatrixDiag(parcsr_A));
+
+      /* refill the existing matrix in place so that references obtained
+       * through GetObject remain valid across assembles */
+      parcsr_old = hypre_SStructMatrixParCSRMatrix(matrix);
+      if (parcsr_old && hypre_SStructUMatrixSamePattern(parcsr_old, parcsr_A))
+      {
+         hypre_CSRMatrixCopy(hypre_ParCSRMatrixDiag(parcsr_A),
+                             hypre_ParCSRMatrixDiag(parcsr_old), 1);
+         hypre_CSRMatrixCopy(hypre_ParCSRMatrixOffd(parcsr_A),
+                             hypre_ParCSRMatrixOffd(parcsr_old), 1);
+         hypre_ParCSRMatrixDestroy(parcsr_A);
+      }
+      else
+      {
+         hypre_ParCSRMatrixDestroy(parcsr_old);
+         hypre_SStructMatrixParCSRMatrix(matrix) = parcsr_A;
+      }
+   }
+   else
+   {
+      HYPRE_IJMatrixGetObject(
+         ijmatrix, (void **) &hypre_SStructMatrixParCSRMatrix(matrix));
+   }
 
    return hypre_error_flag;
 }
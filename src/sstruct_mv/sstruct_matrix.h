@@ -73,6 +73,7 @@ typedef struct hypre_SStructMatrix_struct
 
    HYPRE_Int               ns_symmetric; /* Non-stencil entries symmetric? */
    HYPRE_Int               global_size;  /* Total number of nonzero coeffs */
+   HYPRE_Int               direct_parcsr; /* Convert S-matrix to ParCSR box-wise? */
 
    HYPRE_Int               ref_count;
 
@@ -108,6 +109,7 @@ typedef struct hypre_SStructMatrix_struct
 #define hypre_SStructMatrixTmpCoeffsDevice(mat)      ((mat) -> d_tmp_coeffs)
 #define hypre_SStructMatrixNSSymmetric(mat)          ((mat) -> ns_symmetric)
 #define hypre_SStructMatrixGlobalSize(mat)           ((mat) -> global_size)
+#define hypre_SStructMatrixDirectParCSR(mat)         ((mat) -> direct_parcsr)
 #define hypre_SStructMatrixRefCount(mat)             ((mat) -> ref_count)
 #define hypre_SStructMatrixObjectType(mat)           ((mat) -> object_type)
 
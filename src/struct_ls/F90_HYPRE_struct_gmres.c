@@ -123,6 +123,21 @@ hypre_F90_IFACE(hypre_structgmressetmaxiter, HYPRE_STRUCTGMRESSETMAXITER)
                 hypre_F90_PassInt (max_iter) ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_F90_IFACE(hypre_structgmressetpipelined, HYPRE_STRUCTGMRESSETPIPELINED)
+( hypre_F90_Obj *solver,
+  hypre_F90_Int *pipelined,
+  hypre_F90_Int *ierr      )
+{
+   *ierr = (hypre_F90_Int)
+           ( HYPRE_StructGMRESSetPipelined(
+                hypre_F90_PassObj (HYPRE_StructSolver, solver),
+                hypre_F90_PassInt (pipelined) ) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
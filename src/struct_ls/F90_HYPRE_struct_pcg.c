@@ -153,6 +153,21 @@ hypre_F90_IFACE(hypre_structpcgsetrelchange, HYPRE_STRUCTPCGSETRELCHANGE)
                 hypre_F90_PassInt (rel_change) ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_F90_IFACE(hypre_structpcgsetpipelined, HYPRE_STRUCTPCGSETPIPELINED)
+( hypre_F90_Obj *solver,
+  hypre_F90_Int *pipelined,
+  hypre_F90_Int *ierr       )
+{
+   *ierr = (hypre_F90_Int)
+           ( HYPRE_StructPCGSetPipelined(
+                hypre_F90_PassObj (HYPRE_StructSolver, solver),
+                hypre_F90_PassInt (pipelined) ) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -24,6 +24,8 @@ HYPRE_StructGMRESCreate( MPI_Comm comm, HYPRE_StructSolver *solver )
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
+   hypre_GMRESFunctionsSetAsyncInnerProd(gmres_functions, hypre_StructKrylovInnerProdLocal,
+                                        hypre_StructKrylovIAllreduce);
 
    *solver = ( (HYPRE_StructSolver) hypre_GMRESCreate( gmres_functions ) );
 
@@ -95,6 +97,15 @@ HYPRE_StructGMRESSetMaxIter( HYPRE_StructSolver solver,
 
 /*==========================================================================*/
 
+HYPRE_Int
+HYPRE_StructGMRESSetPipelined( HYPRE_StructSolver solver,
+                               HYPRE_Int          pipelined )
+{
+   return ( HYPRE_GMRESSetPipelined( (HYPRE_Solver) solver, pipelined ) );
+}
+
+/*==========================================================================*/
+
 HYPRE_Int
 HYPRE_StructGMRESSetKDim( HYPRE_StructSolver solver,
                           HYPRE_Int          k_dim )
@@ -125,6 +125,8 @@ HYPRE_StructSetupInterpreter( mv_InterfaceInterpreter *i )
    i->MultiAxpy = mv_TempMultiVectorAxpy;
    i->MultiXapy = mv_TempMultiVectorXapy;
    i->Eval = mv_TempMultiVectorEval;
+   i->BlockInnerProd = NULL;
+   i->BlockAxpy = NULL;
 
    return hypre_error_flag;
 }
@@ -630,6 +630,9 @@ HYPRE_Int HYPRE_StructPCGSetTwoNorm(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructPCGSetRelChange(HYPRE_StructSolver solver,
                                       HYPRE_Int          rel_change);
 
+HYPRE_Int HYPRE_StructPCGSetPipelined(HYPRE_StructSolver solver,
+                                      HYPRE_Int          pipelined);
+
 HYPRE_Int HYPRE_StructPCGSetPrecond(HYPRE_StructSolver         solver,
                                     HYPRE_PtrToStructSolverFcn precond,
                                     HYPRE_PtrToStructSolverFcn precond_setup,
@@ -711,6 +714,9 @@ HYPRE_Int HYPRE_StructGMRESSetAbsoluteTol(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructGMRESSetMaxIter(HYPRE_StructSolver solver,
                                       HYPRE_Int          max_iter);
 
+HYPRE_Int HYPRE_StructGMRESSetPipelined(HYPRE_StructSolver solver,
+                                        HYPRE_Int          pipelined);
+
 HYPRE_Int HYPRE_StructGMRESSetKDim(HYPRE_StructSolver solver,
                                    HYPRE_Int          k_dim);
 
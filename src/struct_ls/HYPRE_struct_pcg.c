@@ -29,6 +29,8 @@ HYPRE_StructPCGCreate( MPI_Comm comm, HYPRE_StructSolver *solver )
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
+   hypre_PCGFunctionsSetAsyncInnerProd(pcg_functions, hypre_StructKrylovInnerProdLocal,
+                                      hypre_StructKrylovIAllreduce);
 
    *solver = ( (HYPRE_StructSolver) hypre_PCGCreate( pcg_functions ) );
 
@@ -118,6 +120,15 @@ HYPRE_StructPCGSetRelChange( HYPRE_StructSolver solver,
 
 /*==========================================================================*/
 
+HYPRE_Int
+HYPRE_StructPCGSetPipelined( HYPRE_StructSolver solver,
+                             HYPRE_Int          pipelined )
+{
+   return ( HYPRE_PCGSetPipelined( (HYPRE_Solver) solver, pipelined ) );
+}
+
+/*==========================================================================*/
+
 HYPRE_Int
 HYPRE_StructPCGSetPrecond( HYPRE_StructSolver         solver,
                            HYPRE_PtrToStructSolverFcn precond,
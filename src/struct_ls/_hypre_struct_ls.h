@@ -118,6 +118,9 @@ HYPRE_Int hypre_StructKrylovMatvec ( void *matvec_data, HYPRE_Complex alpha, voi
                                      HYPRE_Complex beta, void *y );
 HYPRE_Int hypre_StructKrylovMatvecDestroy ( void *matvec_data );
 HYPRE_Real hypre_StructKrylovInnerProd ( void *x, void *y );
+HYPRE_Real hypre_StructKrylovInnerProdLocal ( void *x, void *y );
+HYPRE_Int hypre_StructKrylovIAllreduce ( void *x, HYPRE_Real *sendbuf, HYPRE_Real *recvbuf,
+                                         HYPRE_Int count, hypre_MPI_Request *request );
 HYPRE_Int hypre_StructKrylovCopyVector ( void *x, void *y );
 HYPRE_Int hypre_StructKrylovClearVector ( void *x );
 HYPRE_Int hypre_StructKrylovScaleVector ( HYPRE_Complex alpha, void *x );
@@ -369,6 +372,10 @@ HYPRE_Int hypre_PointRelax_core12 ( void *relax_vdata, hypre_StructMatrix *A,
                                     HYPRE_Int constant_coefficient, hypre_Box *compute_box, HYPRE_Real *bp, HYPRE_Real *xp,
                                     HYPRE_Real *tp, HYPRE_Int boxarray_id, hypre_Box *A_data_box, hypre_Box *b_data_box,
                                     hypre_Box *x_data_box, hypre_Box *t_data_box, hypre_IndexRef stride );
+HYPRE_Int hypre_PointRelax_coreCC1 ( void *relax_vdata, hypre_StructMatrix *A, hypre_Box *compute_box,
+                                     HYPRE_Real *bp, HYPRE_Real *xp, HYPRE_Real *tp, HYPRE_Int boxarray_id,
+                                     hypre_Box *b_data_box, hypre_Box *x_data_box, hypre_Box *t_data_box,
+                                     hypre_IndexRef stride );
 HYPRE_Int hypre_PointRelaxSetTol ( void *relax_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_PointRelaxGetTol ( void *relax_vdata, HYPRE_Real *tol );
 HYPRE_Int hypre_PointRelaxSetMaxIter ( void *relax_vdata, HYPRE_Int max_iter );
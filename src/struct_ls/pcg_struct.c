@@ -138,6 +138,31 @@ hypre_StructKrylovInnerProd( void *x,
                                    (hypre_StructVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_StructKrylovInnerProdLocal( void *x,
+                                  void *y )
+{
+   return ( hypre_StructInnerProdLocal( (hypre_StructVector *) x,
+                                        (hypre_StructVector *) y ) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructKrylovIAllreduce( void              *x,
+                              HYPRE_Real        *sendbuf,
+                              HYPRE_Real        *recvbuf,
+                              HYPRE_Int          count,
+                              hypre_MPI_Request *request )
+{
+   return hypre_MPI_Iallreduce(sendbuf, recvbuf, count, HYPRE_MPI_REAL, hypre_MPI_SUM,
+                               hypre_StructVectorComm((hypre_StructVector *) x), request);
+}
+
 
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
@@ -969,6 +969,15 @@ hypre_PointRelax_core12( void               *relax_vdata,
    start  = hypre_BoxIMin(compute_box);
    hypre_BoxGetStrideSize(compute_box, stride, loop_size);
 
+#if !defined(HYPRE_USING_GPU) && !defined(HYPRE_USING_DEVICE_OPENMP)
+   if (constant_coefficient == 1 && stencil_size <= HYPRE_CC_STENCIL_MAX)
+   {
+      return hypre_PointRelax_coreCC1(relax_vdata, A, compute_box, bp, xp, tp,
+                                      boxarray_id, b_data_box, x_data_box,
+                                      t_data_box, stride);
+   }
+#endif
+
    /* The standard (variable coefficient) algorithm initializes
       tp=bp.  Do it here, but for constant diagonal, also
       divide by the diagonal (and set up AApd for other
@@ -1202,6 +1211,108 @@ hypre_PointRelax_core12( void               *relax_vdata,
    return hypre_error_flag;
 }
 
+/* for constant_coefficient==1 on the host: single pass over the box,
+   tp = (bp - sum of offdiagonal A*x) / diagonal, with the stencil sums
+   unrolled for the common stencil sizes */
+
+#define hypre_PointRelaxCC1Loop(SUM)                                    \
+   hypre_BoxLoop3Begin(ndim, loop_size,                                 \
+                       b_data_box, start, stride, bi,                   \
+                       x_data_box, start, stride, xi,                   \
+                       t_data_box, start, stride, ti);                  \
+   {                                                                    \
+      tp[ti] = AApd * bp[bi] - SUM;                                     \
+   }                                                                    \
+   hypre_BoxLoop3End(bi, xi, ti)
+
+HYPRE_Int
+hypre_PointRelax_coreCC1( void               *relax_vdata,
+                          hypre_StructMatrix *A,
+                          hypre_Box          *compute_box,
+                          HYPRE_Real         *bp,
+                          HYPRE_Real         *xp,
+                          HYPRE_Real         *tp,
+                          HYPRE_Int           boxarray_id,
+                          hypre_Box          *b_data_box,
+                          hypre_Box          *x_data_box,
+                          hypre_Box          *t_data_box,
+                          hypre_IndexRef      stride
+                        )
+{
+   hypre_PointRelaxData  *relax_data = (hypre_PointRelaxData *)relax_vdata;
+
+   hypre_StructStencil   *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index           *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int              stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int              ndim          = hypre_StructMatrixNDim(A);
+   HYPRE_Int              diag_rank     = (relax_data -> diag_rank);
+
+   HYPRE_Real             cc[HYPRE_CC_STENCIL_MAX];
+   HYPRE_Int              co[HYPRE_CC_STENCIL_MAX];
+   HYPRE_Real             AApd;
+   hypre_IndexRef         start;
+   hypre_Index            loop_size;
+   HYPRE_Int              si;
+
+   start = hypre_BoxIMin(compute_box);
+   hypre_BoxGetStrideSize(compute_box, stride, loop_size);
+
+   /* Constant coefficients are stored once per box.  The diagonal entry gets
+      a zero weight so that the unrolled sums cover the whole stencil. */
+   AApd = 1 / hypre_StructMatrixBoxData(A, boxarray_id, diag_rank)[0];
+   for (si = 0; si < stencil_size; si++)
+   {
+      cc[si] = (si == diag_rank) ? 0.0 :
+               AApd * hypre_StructMatrixBoxData(A, boxarray_id, si)[0];
+      co[si] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
+   }
+
+   switch (stencil_size)
+   {
+      case 5:
+         hypre_PointRelaxCC1Loop(hypre_CCStencilSum5(cc, co, xp, xi));
+         break;
+
+      case 7:
+         hypre_PointRelaxCC1Loop(hypre_CCStencilSum7(cc, co, xp, xi));
+         break;
+
+      case 9:
+         hypre_PointRelaxCC1Loop(hypre_CCStencilSum9(cc, co, xp, xi));
+         break;
+
+      case 19:
+         hypre_PointRelaxCC1Loop(hypre_CCStencilSum19(cc, co, xp, xi));
+         break;
+
+      case 27:
+         hypre_PointRelaxCC1Loop(hypre_CCStencilSum27(cc, co, xp, xi));
+         break;
+
+      default:
+         hypre_BoxLoop3Begin(ndim, loop_size,
+                             b_data_box, start, stride, bi,
+                             x_data_box, start, stride, xi,
+                             t_data_box, start, stride, ti);
+         {
+            HYPRE_Real  sum = AApd * bp[bi];
+            HYPRE_Int   sk;
+
+            for (sk = 0; sk < stencil_size; sk++)
+            {
+               sum -= cc[sk] * xp[xi + co[sk]];
+            }
+            tp[ti] = sum;
+         }
+         hypre_BoxLoop3End(bi, xi, ti);
+         break;
+   }
+
+   return hypre_error_flag;
+}
+
+#undef hypre_PointRelaxCC1Loop
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
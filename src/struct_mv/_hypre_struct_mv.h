@@ -303,6 +303,11 @@ if (hypre__num_blocks > 0)\
 {\
    hypre__div = hypre__tot / hypre__num_blocks;\
    hypre__mod = hypre__tot % hypre__num_blocks;\
+}\
+else\
+{\
+   hypre__div = 0;\
+   hypre__mod = 0;\
 }
 
 #define zypre_BoxLoopInitK(k, dboxk, startk, stridek, ik) \
@@ -1527,6 +1532,40 @@ hypre_BoxArrayBox(hypre_StructMatrixDataSpace(matrix), b)
 (hypre_StructMatrixBoxData(matrix, b, s) + \
  hypre_CCBoxIndexRank(hypre_StructMatrixBox(matrix, b), index))
 
+/*--------------------------------------------------------------------------
+ * Unrolled stencil sums for constant-coefficient host kernels.  The stencil
+ * weights c[] and data offsets o[] are loop invariant, so a fixed stencil
+ * size lets the compiler keep them in registers across the box loop.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_CCStencilSum5(c, o, xp, xi)                             \
+( c[0] * xp[xi + o[0]] + c[1] * xp[xi + o[1]] + c[2] * xp[xi + o[2]] + \
+  c[3] * xp[xi + o[3]] + c[4] * xp[xi + o[4]] )
+
+#define hypre_CCStencilSum7(c, o, xp, xi)                             \
+( hypre_CCStencilSum5(c, o, xp, xi) +                                 \
+  c[5] * xp[xi + o[5]] + c[6] * xp[xi + o[6]] )
+
+#define hypre_CCStencilSum9(c, o, xp, xi)                             \
+( hypre_CCStencilSum7(c, o, xp, xi) +                                 \
+  c[7] * xp[xi + o[7]] + c[8] * xp[xi + o[8]] )
+
+#define hypre_CCStencilSum19(c, o, xp, xi)                               \
+( hypre_CCStencilSum9(c, o, xp, xi) +                                    \
+  c[9]  * xp[xi + o[9]]  + c[10] * xp[xi + o[10]] + c[11] * xp[xi + o[11]] + \
+  c[12] * xp[xi + o[12]] + c[13] * xp[xi + o[13]] + c[14] * xp[xi + o[14]] + \
+  c[15] * xp[xi + o[15]] + c[16] * xp[xi + o[16]] + c[17] * xp[xi + o[17]] + \
+  c[18] * xp[xi + o[18]] )
+
+#define hypre_CCStencilSum27(c, o, xp, xi)                               \
+( hypre_CCStencilSum19(c, o, xp, xi) +                                   \
+  c[19] * xp[xi + o[19]] + c[20] * xp[xi + o[20]] + c[21] * xp[xi + o[21]] + \
+  c[22] * xp[xi + o[22]] + c[23] * xp[xi + o[23]] + c[24] * xp[xi + o[24]] + \
+  c[25] * xp[xi + o[25]] + c[26] * xp[xi + o[26]] )
+
+/* Largest stencil handled by the unrolled sums above */
+#define HYPRE_CC_STENCIL_MAX 27
+
 #endif
 /******************************************************************************
  * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
@@ -1782,6 +1821,8 @@ HYPRE_Int hypre_ComputeInfoProjectComp ( hypre_ComputeInfo *compute_info, hypre_
 HYPRE_Int hypre_ComputeInfoDestroy ( hypre_ComputeInfo *compute_info );
 HYPRE_Int hypre_CreateComputeInfo ( hypre_StructGrid *grid, hypre_StructStencil *stencil,
                                     hypre_ComputeInfo **compute_info_ptr );
+HYPRE_Int hypre_CreateComputeInfo_v2 ( hypre_StructGrid *grid, hypre_StructStencil *stencil,
+                                        HYPRE_Int overlap, hypre_ComputeInfo **compute_info_ptr );
 HYPRE_Int hypre_ComputePkgCreate ( hypre_ComputeInfo *compute_info, hypre_BoxArray *data_space,
                                    HYPRE_Int num_values, hypre_StructGrid *grid, hypre_ComputePkg **compute_pkg_ptr );
 HYPRE_Int hypre_ComputePkgDestroy ( hypre_ComputePkg *compute_pkg );
@@ -1931,6 +1972,7 @@ HYPRE_Int hypre_StructGridSetDataLocation( HYPRE_StructGrid grid,
                                            HYPRE_MemoryLocation data_location );
 #endif
 /* struct_innerprod.c */
+HYPRE_Real hypre_StructInnerProdLocal ( hypre_StructVector *x, hypre_StructVector *y );
 HYPRE_Real hypre_StructInnerProd ( hypre_StructVector *x, hypre_StructVector *y );
 
 /* struct_io.c */
@@ -2000,8 +2042,14 @@ HYPRE_Int hypre_StructMatvecCompute ( void *matvec_vdata, HYPRE_Complex alpha,
                                       hypre_StructMatrix *A, hypre_StructVector *x, HYPRE_Complex beta, hypre_StructVector *y );
 HYPRE_Int hypre_StructMatvecCC0 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecTiledCC0 ( HYPRE_Complex alpha, hypre_StructMatrix *A,
+                                       hypre_StructVector *x, HYPRE_Complex beta, hypre_StructVector *y,
+                                       hypre_BoxArrayArray *compute_box_aa );
 HYPRE_Int hypre_StructMatvecCC1 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecStencilCC1 ( HYPRE_Complex alpha, hypre_StructMatrix *A,
+                                         hypre_StructVector *x, HYPRE_Complex beta, hypre_StructVector *y,
+                                         hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecCC2 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecDestroy ( void *matvec_vdata );
@@ -104,6 +104,29 @@ HYPRE_Int
 hypre_CreateComputeInfo( hypre_StructGrid      *grid,
                          hypre_StructStencil   *stencil,
                          hypre_ComputeInfo    **compute_info_ptr )
+{
+#ifdef HYPRE_OVERLAP_COMM_COMP
+   return hypre_CreateComputeInfo_v2(grid, stencil, 1, compute_info_ptr);
+#else
+   return hypre_CreateComputeInfo_v2(grid, stencil, 0, compute_info_ptr);
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * Same as hypre_CreateComputeInfo, but the caller chooses whether the
+ * patterns allow for overlapping communications and computations.  With
+ * overlap, each grid box is split into an independent interior box that
+ * does not touch ghost data and up to 2*ndim dependent boundary slabs.
+ * Without overlap, all grid boxes are dependent.
+ *
+ * Note: This routine assumes that the grid boxes do not overlap.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CreateComputeInfo_v2( hypre_StructGrid      *grid,
+                            hypre_StructStencil   *stencil,
+                            HYPRE_Int              overlap,
+                            hypre_ComputeInfo    **compute_info_ptr )
 {
    HYPRE_Int                ndim = hypre_StructGridNDim(grid);
    hypre_CommInfo          *comm_info;
@@ -117,13 +140,11 @@ hypre_CreateComputeInfo( hypre_StructGrid      *grid,
 
    HYPRE_Int                i;
 
-#ifdef HYPRE_OVERLAP_COMM_COMP
    hypre_Box               *rembox;
    hypre_Index             *stencil_shape;
    hypre_Index              lborder, rborder;
    HYPRE_Int                cbox_array_size;
    HYPRE_Int                s, d;
-#endif
 
    /*------------------------------------------------------
     * Extract needed grid info
@@ -137,122 +158,121 @@ hypre_CreateComputeInfo( hypre_StructGrid      *grid,
 
    hypre_CreateCommInfoFromStencil(grid, stencil, &comm_info);
 
-#ifdef HYPRE_OVERLAP_COMM_COMP
-
-   /*------------------------------------------------------
-    * Compute border info
-    *------------------------------------------------------*/
-
-   hypre_SetIndex(lborder, 0);
-   hypre_SetIndex(rborder, 0);
-   stencil_shape = hypre_StructStencilShape(stencil);
-   for (s = 0; s < hypre_StructStencilSize(stencil); s++)
+   if (overlap)
    {
-      for (d = 0; d < ndim; d++)
+      /*------------------------------------------------------
+       * Compute border info
+       *------------------------------------------------------*/
+
+      hypre_SetIndex(lborder, 0);
+      hypre_SetIndex(rborder, 0);
+      stencil_shape = hypre_StructStencilShape(stencil);
+      for (s = 0; s < hypre_StructStencilSize(stencil); s++)
       {
-         i = hypre_IndexD(stencil_shape[s], d);
-         if (i < 0)
+         for (d = 0; d < ndim; d++)
          {
-            lborder[d] = hypre_max(lborder[d], -i);
-         }
-         else if (i > 0)
-         {
-            rborder[d] = hypre_max(rborder[d], i);
+            i = hypre_IndexD(stencil_shape[s], d);
+            if (i < 0)
+            {
+               lborder[d] = hypre_max(lborder[d], -i);
+            }
+            else if (i > 0)
+            {
+               rborder[d] = hypre_max(rborder[d], i);
+            }
          }
       }
-   }
-
-   /*------------------------------------------------------
-    * Set up the dependent boxes
-    *------------------------------------------------------*/
 
-   dept_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
+      /*------------------------------------------------------
+       * Set up the dependent boxes
+       *------------------------------------------------------*/
 
-   rembox = hypre_BoxCreate(hypre_StructGridNDim(grid));
-   hypre_ForBoxI(i, boxes)
-   {
-      cbox_array = hypre_BoxArrayArrayBoxArray(dept_boxes, i);
-      hypre_BoxArraySetSize(cbox_array, 2 * ndim);
+      dept_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
 
-      hypre_CopyBox(hypre_BoxArrayBox(boxes, i), rembox);
-      cbox_array_size = 0;
-      for (d = 0; d < ndim; d++)
+      rembox = hypre_BoxCreate(hypre_StructGridNDim(grid));
+      hypre_ForBoxI(i, boxes)
       {
-         if ( (hypre_BoxVolume(rembox)) && lborder[d] )
-         {
-            cbox = hypre_BoxArrayBox(cbox_array, cbox_array_size);
-            hypre_CopyBox(rembox, cbox);
-            hypre_BoxIMaxD(cbox, d) =
-               hypre_BoxIMinD(cbox, d) + lborder[d] - 1;
-            hypre_BoxIMinD(rembox, d) =
-               hypre_BoxIMinD(cbox, d) + lborder[d];
-            cbox_array_size++;
-         }
-         if ( (hypre_BoxVolume(rembox)) && rborder[d] )
+         cbox_array = hypre_BoxArrayArrayBoxArray(dept_boxes, i);
+         hypre_BoxArraySetSize(cbox_array, 2 * ndim);
+
+         hypre_CopyBox(hypre_BoxArrayBox(boxes, i), rembox);
+         cbox_array_size = 0;
+         for (d = 0; d < ndim; d++)
          {
-            cbox = hypre_BoxArrayBox(cbox_array, cbox_array_size);
-            hypre_CopyBox(rembox, cbox);
-            hypre_BoxIMinD(cbox, d) =
-               hypre_BoxIMaxD(cbox, d) - rborder[d] + 1;
-            hypre_BoxIMaxD(rembox, d) =
-               hypre_BoxIMaxD(cbox, d) - rborder[d];
-            cbox_array_size++;
+            if ( (hypre_BoxVolume(rembox)) && lborder[d] )
+            {
+               cbox = hypre_BoxArrayBox(cbox_array, cbox_array_size);
+               hypre_CopyBox(rembox, cbox);
+               hypre_BoxIMaxD(cbox, d) =
+                  hypre_BoxIMinD(cbox, d) + lborder[d] - 1;
+               hypre_BoxIMinD(rembox, d) =
+                  hypre_BoxIMinD(cbox, d) + lborder[d];
+               cbox_array_size++;
+            }
+            if ( (hypre_BoxVolume(rembox)) && rborder[d] )
+            {
+               cbox = hypre_BoxArrayBox(cbox_array, cbox_array_size);
+               hypre_CopyBox(rembox, cbox);
+               hypre_BoxIMinD(cbox, d) =
+                  hypre_BoxIMaxD(cbox, d) - rborder[d] + 1;
+               hypre_BoxIMaxD(rembox, d) =
+                  hypre_BoxIMaxD(cbox, d) - rborder[d];
+               cbox_array_size++;
+            }
          }
+         hypre_BoxArraySetSize(cbox_array, cbox_array_size);
       }
-      hypre_BoxArraySetSize(cbox_array, cbox_array_size);
-   }
-   hypre_BoxDestroy(rembox);
+      hypre_BoxDestroy(rembox);
 
-   /*------------------------------------------------------
-    * Set up the independent boxes
-    *------------------------------------------------------*/
+      /*------------------------------------------------------
+       * Set up the independent boxes
+       *------------------------------------------------------*/
 
-   indt_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
+      indt_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
 
-   hypre_ForBoxI(i, boxes)
-   {
-      cbox_array = hypre_BoxArrayArrayBoxArray(indt_boxes, i);
-      hypre_BoxArraySetSize(cbox_array, 1);
-      cbox = hypre_BoxArrayBox(cbox_array, 0);
-      hypre_CopyBox(hypre_BoxArrayBox(boxes, i), cbox);
-
-      for (d = 0; d < ndim; d++)
+      hypre_ForBoxI(i, boxes)
       {
-         if ( lborder[d] )
-         {
-            hypre_BoxIMinD(cbox, d) += lborder[d];
-         }
-         if ( rborder[d] )
+         cbox_array = hypre_BoxArrayArrayBoxArray(indt_boxes, i);
+         hypre_BoxArraySetSize(cbox_array, 1);
+         cbox = hypre_BoxArrayBox(cbox_array, 0);
+         hypre_CopyBox(hypre_BoxArrayBox(boxes, i), cbox);
+
+         for (d = 0; d < ndim; d++)
          {
-            hypre_BoxIMaxD(cbox, d) -= rborder[d];
+            if ( lborder[d] )
+            {
+               hypre_BoxIMinD(cbox, d) += lborder[d];
+            }
+            if ( rborder[d] )
+            {
+               hypre_BoxIMaxD(cbox, d) -= rborder[d];
+            }
          }
       }
    }
+   else
+   {
+      /*------------------------------------------------------
+       * Set up the independent boxes
+       *------------------------------------------------------*/
 
-#else
-
-   /*------------------------------------------------------
-    * Set up the independent boxes
-    *------------------------------------------------------*/
-
-   indt_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
+      indt_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
 
-   /*------------------------------------------------------
-    * Set up the dependent boxes
-    *------------------------------------------------------*/
+      /*------------------------------------------------------
+       * Set up the dependent boxes
+       *------------------------------------------------------*/
 
-   dept_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
+      dept_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
 
-   hypre_ForBoxI(i, boxes)
-   {
-      cbox_array = hypre_BoxArrayArrayBoxArray(dept_boxes, i);
-      hypre_BoxArraySetSize(cbox_array, 1);
-      cbox = hypre_BoxArrayBox(cbox_array, 0);
-      hypre_CopyBox(hypre_BoxArrayBox(boxes, i), cbox);
+      hypre_ForBoxI(i, boxes)
+      {
+         cbox_array = hypre_BoxArrayArrayBoxArray(dept_boxes, i);
+         hypre_BoxArraySetSize(cbox_array, 1);
+         cbox = hypre_BoxArrayBox(cbox_array, 0);
+         hypre_CopyBox(hypre_BoxArrayBox(boxes, i), cbox);
+      }
    }
 
-#endif
-
    /*------------------------------------------------------
     * Return
     *------------------------------------------------------*/
@@ -99,4 +99,38 @@ hypre_BoxArrayBox(hypre_StructMatrixDataSpace(matrix), b)
 (hypre_StructMatrixBoxData(matrix, b, s) + \
  hypre_CCBoxIndexRank(hypre_StructMatrixBox(matrix, b), index))
 
+/*--------------------------------------------------------------------------
+ * Unrolled stencil sums for constant-coefficient host kernels.  The stencil
+ * weights c[] and data offsets o[] are loop invariant, so a fixed stencil
+ * size lets the compiler keep them in registers across the box loop.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_CCStencilSum5(c, o, xp, xi)                             \
+( c[0] * xp[xi + o[0]] + c[1] * xp[xi + o[1]] + c[2] * xp[xi + o[2]] + \
+  c[3] * xp[xi + o[3]] + c[4] * xp[xi + o[4]] )
+
+#define hypre_CCStencilSum7(c, o, xp, xi)                             \
+( hypre_CCStencilSum5(c, o, xp, xi) +                                 \
+  c[5] * xp[xi + o[5]] + c[6] * xp[xi + o[6]] )
+
+#define hypre_CCStencilSum9(c, o, xp, xi)                             \
+( hypre_CCStencilSum7(c, o, xp, xi) +                                 \
+  c[7] * xp[xi + o[7]] + c[8] * xp[xi + o[8]] )
+
+#define hypre_CCStencilSum19(c, o, xp, xi)                               \
+( hypre_CCStencilSum9(c, o, xp, xi) +                                    \
+  c[9]  * xp[xi + o[9]]  + c[10] * xp[xi + o[10]] + c[11] * xp[xi + o[11]] + \
+  c[12] * xp[xi + o[12]] + c[13] * xp[xi + o[13]] + c[14] * xp[xi + o[14]] + \
+  c[15] * xp[xi + o[15]] + c[16] * xp[xi + o[16]] + c[17] * xp[xi + o[17]] + \
+  c[18] * xp[xi + o[18]] )
+
+#define hypre_CCStencilSum27(c, o, xp, xi)                               \
+( hypre_CCStencilSum19(c, o, xp, xi) +                                   \
+  c[19] * xp[xi + o[19]] + c[20] * xp[xi + o[20]] + c[21] * xp[xi + o[21]] + \
+  c[22] * xp[xi + o[22]] + c[23] * xp[xi + o[23]] + c[24] * xp[xi + o[24]] + \
+  c[25] * xp[xi + o[25]] + c[26] * xp[xi + o[26]] )
+
+/* Largest stencil handled by the unrolled sums above */
+#define HYPRE_CC_STENCIL_MAX 27
+
 #endif
@@ -20,6 +20,20 @@
 #endif
 #define MAX_DEPTH 7
 
+/* The single-pass host kernel for variable coefficients is used when the
+ * matrix and vectors live in host memory.  It processes grid lines in chunks
+ * of HYPRE_MATVEC_CHUNK points and groups lines into tiles whose x-vector
+ * working set is about HYPRE_MATVEC_TILE_BYTES */
+#if !defined(HYPRE_USING_GPU) && !defined(HYPRE_USING_DEVICE_OPENMP)
+#define HYPRE_MATVEC_TILED_HOST
+#endif
+#define HYPRE_MATVEC_CHUNK      256
+#define HYPRE_MATVEC_TILE_BYTES (256 * 1024)
+
+#ifdef HYPRE_MATVEC_TILED_HOST
+static const HYPRE_Complex zeros[HYPRE_MATVEC_CHUNK] = { 0.0 };
+#endif
+
 /*--------------------------------------------------------------------------
  * hypre_StructMatvecData data structure
  *--------------------------------------------------------------------------*/
@@ -61,6 +75,9 @@ hypre_StructMatvecSetup( void               *matvec_vdata,
    hypre_StructStencil     *stencil;
    hypre_ComputeInfo       *compute_info;
    hypre_ComputePkg        *compute_pkg;
+#ifdef HYPRE_MATVEC_TILED_HOST
+   HYPRE_Int                num_procs;
+#endif
 
    /*----------------------------------------------------------
     * Set up the compute package
@@ -69,7 +86,21 @@ hypre_StructMatvecSetup( void               *matvec_vdata,
    grid    = hypre_StructMatrixGrid(A);
    stencil = hypre_StructMatrixStencil(A);
 
-   hypre_CreateComputeInfo(grid, stencil, &compute_info);
+#ifdef HYPRE_MATVEC_TILED_HOST
+   /* The host kernel overlaps the interior computation with the ghost
+    * exchange, independent of HYPRE_OVERLAP_COMM_COMP.  On a single process
+    * there is nothing to overlap, and splitting off the boundary layers would
+    * only add short loops. */
+   hypre_MPI_Comm_size(hypre_StructMatrixComm(A), &num_procs);
+   if (hypre_StructMatrixConstantCoefficient(A) == 0 && num_procs > 1)
+   {
+      hypre_CreateComputeInfo_v2(grid, stencil, 1, &compute_info);
+   }
+   else
+#endif
+   {
+      hypre_CreateComputeInfo(grid, stencil, &compute_info);
+   }
    hypre_ComputePkgCreate(compute_info, hypre_StructVectorDataSpace(x), 1,
                           grid, &compute_pkg);
 
@@ -118,6 +149,8 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
 
    HYPRE_Complex            temp;
    HYPRE_Int                compute_i, i;
+   HYPRE_Int                tiled = 0;
+   HYPRE_Int                fused = 0;
 
    hypre_StructVector      *x_tmp = NULL;
 
@@ -167,6 +200,12 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
       x_tmp = hypre_StructVectorClone(y);
       x = x_tmp;
    }
+
+#ifdef HYPRE_MATVEC_TILED_HOST
+   tiled = (constant_coefficient == 0 && hypre_IndexEqual(stride, 1, hypre_StructVectorNDim(x)));
+   fused = (constant_coefficient == 1 &&
+            hypre_StructStencilSize(hypre_StructMatrixStencil(A)) <= HYPRE_CC_STENCIL_MAX);
+#endif
    /*-----------------------------------------------------------------------
     * Do (alpha != 0.0) computation
     *-----------------------------------------------------------------------*/
@@ -195,7 +234,8 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
             {
                temp = beta / alpha;
             }
-            if (temp != 1.0)
+            /* the tiled and fused kernels apply beta themselves */
+            if (temp != 1.0 && !tiled && !fused)
             {
                boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(A));
                hypre_ForBoxI(i, boxes)
@@ -252,12 +292,26 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
       {
          case 0:
          {
-            hypre_StructMatvecCC0( alpha, A, x, y, compute_box_aa, stride );
+            if (tiled)
+            {
+               hypre_StructMatvecTiledCC0( alpha, A, x, beta, y, compute_box_aa );
+            }
+            else
+            {
+               hypre_StructMatvecCC0( alpha, A, x, y, compute_box_aa, stride );
+            }
             break;
          }
          case 1:
          {
-            hypre_StructMatvecCC1( alpha, A, x, y, compute_box_aa, stride );
+            if (fused)
+            {
+               hypre_StructMatvecStencilCC1( alpha, A, x, beta, y, compute_box_aa, stride );
+            }
+            else
+            {
+               hypre_StructMatvecCC1( alpha, A, x, y, compute_box_aa, stride );
+            }
             break;
          }
          case 2:
@@ -597,6 +651,191 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
 }
 
 
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecTiledCC0
+ * single-pass host kernel for the case constant_coefficient==0, computing
+ * y = alpha*A*x + beta*y on the compute boxes with unit stride.
+ *
+ * Unlike hypre_StructMatvecCC0, which sweeps y once per MAX_DEPTH stencil
+ * entries and once more to apply alpha, every point of y is read and
+ * written exactly once for any stencil size.  Each grid line is processed
+ * in chunks of HYPRE_MATVEC_CHUNK points: groups of four stencil entries
+ * are accumulated into a small buffer with unit-stride (vectorizable)
+ * loops, and the last group is combined with y directly.  Lines are grouped
+ * into tiles of consecutive rows, which are traversed plane by plane so
+ * that the x rows shared by neighboring lines stay in cache.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecTiledCC0( HYPRE_Complex        alpha,
+                            hypre_StructMatrix  *A,
+                            hypre_StructVector  *x,
+                            HYPRE_Complex        beta,
+                            hypre_StructVector  *y,
+                            hypre_BoxArrayArray *compute_box_aa )
+{
+   hypre_StructStencil     *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index             *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int                stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int                ndim          = hypre_StructVectorNDim(x);
+
+   hypre_BoxArray          *compute_box_a;
+   hypre_Box               *compute_box;
+   hypre_Box               *A_data_box;
+   hypre_Box               *x_data_box;
+   hypre_Box               *y_data_box;
+
+   HYPRE_Complex          **Ap;
+   HYPRE_Int               *xoff;
+   HYPRE_Complex           *xp;
+   HYPRE_Complex           *yp;
+
+   hypre_Index              loop_size;
+   HYPRE_Int                Astride[3], xstride[3], ystride[3], n[3];
+   HYPRE_Int                Astart, xstart, ystart;
+   HYPRE_Int                tile_ny, num_tiles, num_work;
+   HYPRE_Int                num_entries = hypre_max(stencil_size, 1);
+   HYPRE_Int                i, j, d, si, w;
+
+   Ap   = hypre_TAlloc(HYPRE_Complex *, stencil_size, HYPRE_MEMORY_HOST);
+   xoff = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+
+   hypre_ForBoxArrayI(i, compute_box_aa)
+   {
+      compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+      A_data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+      xp = hypre_StructVectorBoxData(x, i);
+      yp = hypre_StructVectorBoxData(y, i);
+
+      for (si = 0; si < stencil_size; si++)
+      {
+         Ap[si]   = hypre_StructMatrixBoxData(A, i, si);
+         xoff[si] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
+      }
+
+      /* Data strides of the first three dimensions */
+      Astride[0] = xstride[0] = ystride[0] = 1;
+      for (d = 1; d < 3; d++)
+      {
+         Astride[d] = xstride[d] = ystride[d] = 0;
+         if (d < ndim)
+         {
+            Astride[d] = Astride[d - 1] * hypre_BoxSizeD(A_data_box, d - 1);
+            xstride[d] = xstride[d - 1] * hypre_BoxSizeD(x_data_box, d - 1);
+            ystride[d] = ystride[d - 1] * hypre_BoxSizeD(y_data_box, d - 1);
+         }
+      }
+
+      hypre_ForBoxI(j, compute_box_a)
+      {
+         compute_box = hypre_BoxArrayBox(compute_box_a, j);
+         if (hypre_BoxVolume(compute_box) == 0)
+         {
+            continue;
+         }
+
+         hypre_BoxGetSize(compute_box, loop_size);
+         for (d = 0; d < 3; d++)
+         {
+            n[d] = (d < ndim) ? hypre_IndexD(loop_size, d) : 1;
+         }
+
+         Astart = hypre_BoxIndexRank(A_data_box, hypre_BoxIMin(compute_box));
+         xstart = hypre_BoxIndexRank(x_data_box, hypre_BoxIMin(compute_box));
+         ystart = hypre_BoxIndexRank(y_data_box, hypre_BoxIMin(compute_box));
+
+         /* Rows per tile, keeping three planes of x rows in cache */
+         tile_ny   = HYPRE_MATVEC_TILE_BYTES / (3 * n[0] * (HYPRE_Int) sizeof(HYPRE_Complex));
+         tile_ny   = hypre_max(1, hypre_min(tile_ny, n[1]));
+         num_tiles = (n[1] + tile_ny - 1) / tile_ny;
+         num_work  = num_tiles * n[2];
+
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(si) HYPRE_SMP_SCHEDULE
+#endif
+         for (w = 0; w < num_work; w++)
+         {
+            HYPRE_Complex  acc[HYPRE_MATVEC_CHUNK];
+            HYPRE_Int      k     = w % n[2];
+            HYPRE_Int      jbeg  = (w / n[2]) * tile_ny;
+            HYPRE_Int      jend  = hypre_min(jbeg + tile_ny, n[1]);
+            HYPRE_Int      jj, ii, ib, nb;
+
+            for (jj = jbeg; jj < jend; jj++)
+            {
+               HYPRE_Int  Ai = Astart + k * Astride[2] + jj * Astride[1];
+               HYPRE_Int  xi = xstart + k * xstride[2] + jj * xstride[1];
+               HYPRE_Int  yi = ystart + k * ystride[2] + jj * ystride[1];
+
+               for (ib = 0; ib < n[0]; ib += HYPRE_MATVEC_CHUNK)
+               {
+                  HYPRE_Complex  *yc = yp + yi + ib;
+
+                  nb = hypre_min(HYPRE_MATVEC_CHUNK, n[0] - ib);
+
+                  /* Four stencil entries per pass over the chunk.  The first
+                   * pass initializes acc and the last one updates y; missing
+                   * entries of the last group get zero coefficients. */
+                  for (si = 0; si < num_entries; si += 4)
+                  {
+                     HYPRE_Int            first = (si == 0);
+                     const HYPRE_Complex *a0, *a1, *a2, *a3;
+                     const HYPRE_Complex *x0, *x1, *x2, *x3;
+
+                     a0 = (si     < stencil_size) ? Ap[si]     + Ai + ib : zeros;
+                     a1 = (si + 1 < stencil_size) ? Ap[si + 1] + Ai + ib : zeros;
+                     a2 = (si + 2 < stencil_size) ? Ap[si + 2] + Ai + ib : zeros;
+                     a3 = (si + 3 < stencil_size) ? Ap[si + 3] + Ai + ib : zeros;
+                     x0 = xp + xi + ib + ((si     < stencil_size) ? xoff[si]     : 0);
+                     x1 = xp + xi + ib + ((si + 1 < stencil_size) ? xoff[si + 1] : 0);
+                     x2 = xp + xi + ib + ((si + 2 < stencil_size) ? xoff[si + 2] : 0);
+                     x3 = xp + xi + ib + ((si + 3 < stencil_size) ? xoff[si + 3] : 0);
+
+                     if (si + 4 < num_entries)
+                     {
+                        for (ii = 0; ii < nb; ii++)
+                        {
+                           acc[ii] = (first ? 0.0 : acc[ii]) +
+                                     a0[ii] * x0[ii] + a1[ii] * x1[ii] +
+                                     a2[ii] * x2[ii] + a3[ii] * x3[ii];
+                        }
+                     }
+                     else if (beta == 0.0)
+                     {
+                        for (ii = 0; ii < nb; ii++)
+                        {
+                           yc[ii] = alpha * ((first ? 0.0 : acc[ii]) +
+                                             a0[ii] * x0[ii] + a1[ii] * x1[ii] +
+                                             a2[ii] * x2[ii] + a3[ii] * x3[ii]);
+                        }
+                     }
+                     else
+                     {
+                        for (ii = 0; ii < nb; ii++)
+                        {
+                           yc[ii] = alpha * ((first ? 0.0 : acc[ii]) +
+                                             a0[ii] * x0[ii] + a1[ii] * x1[ii] +
+                                             a2[ii] * x2[ii] + a3[ii] * x3[ii]) +
+                                    beta * yc[ii];
+                        }
+                     }
+                  }
+               }
+            }
+         }
+      }
+   }
+
+   hypre_TFree(Ap, HYPRE_MEMORY_HOST);
+   hypre_TFree(xoff, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_StructMatvecCC1
  * core of struct matvec computation, for the case constant_coefficient==1
@@ -925,6 +1164,144 @@ HYPRE_Int hypre_StructMatvecCC1( HYPRE_Complex       alpha,
 }
 
 
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecStencilCC1
+ * single-pass host kernel for the case constant_coefficient==1, computing
+ * y = alpha*A*x + beta*y on the compute boxes.
+ *
+ * The stencil weights (scaled by alpha) are gathered once per box, and the
+ * 5, 7, 9, 19 and 27-point stencils use fully unrolled sums.  Other stencil
+ * sizes up to HYPRE_CC_STENCIL_MAX use a short loop over the entries.
+ * Unlike hypre_StructMatvecCC1, y is read and written once per point.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_StructMatvecCC1Loop(SUM)                                  \
+   if (beta == 0.0)                                                     \
+   {                                                                    \
+      hypre_BoxLoop2Begin(ndim, loop_size,                              \
+                          x_data_box, start, stride, xi,                \
+                          y_data_box, start, stride, yi);               \
+      {                                                                 \
+         yp[yi] = SUM;                                                  \
+      }                                                                 \
+      hypre_BoxLoop2End(xi, yi);                                        \
+   }                                                                    \
+   else                                                                 \
+   {                                                                    \
+      hypre_BoxLoop2Begin(ndim, loop_size,                              \
+                          x_data_box, start, stride, xi,                \
+                          y_data_box, start, stride, yi);               \
+      {                                                                 \
+         yp[yi] = SUM + beta * yp[yi];                                  \
+      }                                                                 \
+      hypre_BoxLoop2End(xi, yi);                                        \
+   }
+
+HYPRE_Int
+hypre_StructMatvecStencilCC1( HYPRE_Complex        alpha,
+                              hypre_StructMatrix  *A,
+                              hypre_StructVector  *x,
+                              HYPRE_Complex        beta,
+                              hypre_StructVector  *y,
+                              hypre_BoxArrayArray *compute_box_aa,
+                              hypre_IndexRef       stride )
+{
+   hypre_StructStencil     *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index             *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int                stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int                ndim          = hypre_StructVectorNDim(x);
+
+   hypre_BoxArray          *compute_box_a;
+   hypre_Box               *compute_box;
+   hypre_Box               *x_data_box;
+   hypre_Box               *y_data_box;
+
+   HYPRE_Complex            cc[HYPRE_CC_STENCIL_MAX];
+   HYPRE_Int                co[HYPRE_CC_STENCIL_MAX];
+   HYPRE_Complex           *xp;
+   HYPRE_Complex           *yp;
+
+   hypre_Index              loop_size;
+   hypre_IndexRef           start;
+   HYPRE_Int                i, j, si;
+
+   if (stencil_size > HYPRE_CC_STENCIL_MAX)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Stencil too large for hypre_StructMatvecStencilCC1");
+      return hypre_error_flag;
+   }
+
+   hypre_ForBoxArrayI(i, compute_box_aa)
+   {
+      compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+      xp = hypre_StructVectorBoxData(x, i);
+      yp = hypre_StructVectorBoxData(y, i);
+
+      /* constant coefficients are stored once per box, at index 0 */
+      for (si = 0; si < stencil_size; si++)
+      {
+         cc[si] = alpha * hypre_StructMatrixBoxData(A, i, si)[0];
+         co[si] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
+      }
+
+      hypre_ForBoxI(j, compute_box_a)
+      {
+         compute_box = hypre_BoxArrayBox(compute_box_a, j);
+
+         hypre_BoxGetSize(compute_box, loop_size);
+         start = hypre_BoxIMin(compute_box);
+
+         switch (stencil_size)
+         {
+            case 5:
+               hypre_StructMatvecCC1Loop(hypre_CCStencilSum5(cc, co, xp, xi));
+               break;
+
+            case 7:
+               hypre_StructMatvecCC1Loop(hypre_CCStencilSum7(cc, co, xp, xi));
+               break;
+
+            case 9:
+               hypre_StructMatvecCC1Loop(hypre_CCStencilSum9(cc, co, xp, xi));
+               break;
+
+            case 19:
+               hypre_StructMatvecCC1Loop(hypre_CCStencilSum19(cc, co, xp, xi));
+               break;
+
+            case 27:
+               hypre_StructMatvecCC1Loop(hypre_CCStencilSum27(cc, co, xp, xi));
+               break;
+
+            default:
+               hypre_BoxLoop2Begin(ndim, loop_size,
+                                   x_data_box, start, stride, xi,
+                                   y_data_box, start, stride, yi);
+               {
+                  HYPRE_Complex  sum = (beta == 0.0) ? 0.0 : beta * yp[yi];
+                  HYPRE_Int      sk;
+
+                  for (sk = 0; sk < stencil_size; sk++)
+                  {
+                     sum += cc[sk] * xp[xi + co[sk]];
+                  }
+                  yp[yi] = sum;
+               }
+               hypre_BoxLoop2End(xi, yi);
+               break;
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+#undef hypre_StructMatvecCC1Loop
+
 /*--------------------------------------------------------------------------
  * hypre_StructMatvecCC2
  * core of struct matvec computation, for the case constant_coefficient==2
@@ -0,0 +1,48 @@
+#!/bin/sh
+# Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+# HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+#
+# SPDX-License-Identifier: (Apache-2.0 OR MIT)
+
+TNAME=`basename $0 .sh`
+RTOL=$1
+ATOL=$2
+
+#=============================================================================
+# compare with baseline case
+#=============================================================================
+
+FILES="\
+ ${TNAME}.out.0\
+ ${TNAME}.out.1\
+ ${TNAME}.out.2\
+ ${TNAME}.out.3\
+ ${TNAME}.out.4\
+ ${TNAME}.out.5\
+"
+
+for i in $FILES
+do
+  echo "# Output file: $i"
+  tail -3 $i
+done > ${TNAME}.out
+
+# Make sure that the output file is reasonable
+RUNCOUNT=`echo $FILES | wc -w`
+OUTCOUNT=`grep "Iterations" ${TNAME}.out | wc -l`
+if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
+   echo "Incorrect number of runs in ${TNAME}.out" >&2
+fi
+
+# The colored sweep visits the domains in a different order, so its iteration
+# count may differ, but not by more than half of the sequential count
+for i in 0 2 4
+do
+  j=`expr $i + 1`
+  SEQ=`grep "Iterations" ${TNAME}.out.$i | awk '{print $3}'`
+  COL=`grep "Iterations" ${TNAME}.out.$j | awk '{print $3}'`
+  if [ -z "$SEQ" ] || [ -z "$COL" ] || [ `expr 2 \* $COL` -gt `expr 3 \* $SEQ` ]; then
+     echo "Colored Schwarz sweep ${TNAME}.out.$j needs too many iterations" >&2
+  fi
+done
+
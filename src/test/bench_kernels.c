@@ -0,0 +1,885 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/*--------------------------------------------------------------------------
+ * Micro-benchmarks for the seq_mv/parcsr_mv/struct_mv kernels.
+ * Do `bench_kernels -help' for usage info.
+ *
+ * Each kernel is run on generated 3D problems (a 7-point Laplacian and a
+ * 3-component coupled system with the sparsity of 3D elasticity) for a list
+ * of per-process problem sizes and thread counts.  One CSV line is printed
+ * per (problem, size, threads, kernel) with the time per call and the rates
+ * implied by a simple model of the bytes moved and the flops done by one
+ * call.  Bytes and flops are summed over all processes, and the time is the
+ * maximum over all processes.
+ *
+ * The commpkg_* kernels time the creation of the matvec communication
+ * package with the binary-tree and NBX sparse data exchanges.  They matter
+ * at large process counts and can be tried with oversubscribed local runs
+ * and tiny problems, e.g.
+ *
+ *    mpirun -np 1024 --oversubscribe bench_kernels -sizes 1 2 -laplace -kernel commpkg
+ *--------------------------------------------------------------------------*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "_hypre_utilities.h"
+#include "HYPRE.h"
+#include "HYPRE_parcsr_ls.h"
+#include "_hypre_parcsr_ls.h"
+#include "HYPRE_struct_mv.h"
+#include "_hypre_struct_mv.h"
+
+#define BENCH_MAX_LIST 16
+
+typedef struct
+{
+   /* ParCSR problem */
+   hypre_ParCSRMatrix  *A;
+   hypre_ParCSRMatrix  *P;
+   hypre_ParVector     *x;
+   hypre_ParVector     *y;
+   hypre_ParVector     *f;
+   hypre_ParVector     *u;
+   hypre_ParVector     *v;
+   hypre_ParVector     *z;
+
+   /* multivectors for the mass kernels */
+   HYPRE_Int            num_mass;
+   HYPRE_Int            unroll;
+   hypre_Vector       **mass;
+   HYPRE_Complex       *mass_data;
+   HYPRE_Complex       *alpha;
+   HYPRE_Real          *result;
+
+   /* relaxation */
+   HYPRE_Int            relax_type;
+   HYPRE_Real          *l1_norms;
+   HYPRE_Real          *l1_norms_4;
+
+   /* struct problem */
+   HYPRE_StructMatrix   sA;
+   HYPRE_StructVector   sx;
+   HYPRE_StructVector   sy;
+
+} BenchData;
+
+typedef HYPRE_Int (*BenchKernel)( BenchData *data );
+
+/*--------------------------------------------------------------------------
+ * Kernels
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+BenchCSRMatvec( BenchData *data )
+{
+   return hypre_CSRMatrixMatvec(1.0, hypre_ParCSRMatrixDiag(data -> A),
+                                hypre_ParVectorLocalVector(data -> x), 0.0,
+                                hypre_ParVectorLocalVector(data -> y));
+}
+
+static HYPRE_Int
+BenchCSRMatvecT( BenchData *data )
+{
+   return hypre_CSRMatrixMatvecT(1.0, hypre_ParCSRMatrixDiag(data -> A),
+                                 hypre_ParVectorLocalVector(data -> y), 0.0,
+                                 hypre_ParVectorLocalVector(data -> x));
+}
+
+static HYPRE_Int
+BenchParCSRMatvec( BenchData *data )
+{
+   return hypre_ParCSRMatrixMatvec(1.0, data -> A, data -> x, 0.0, data -> y);
+}
+
+static HYPRE_Int
+BenchParCSRMatvecT( BenchData *data )
+{
+   return hypre_ParCSRMatrixMatvecT(1.0, data -> A, data -> y, 0.0, data -> x);
+}
+
+static HYPRE_Int
+BenchParMatmul( BenchData *data )
+{
+   hypre_ParCSRMatrix *C = hypre_ParMatmul(data -> A, data -> A);
+
+   return hypre_ParCSRMatrixDestroy(C);
+}
+
+static HYPRE_Int
+BenchRAPKT( BenchData *data )
+{
+   hypre_ParCSRMatrix *RAP = hypre_ParCSRMatrixRAPKT(data -> P, data -> A, data -> P, 0);
+
+   return hypre_ParCSRMatrixDestroy(RAP);
+}
+
+static HYPRE_Int
+BenchTranspose( BenchData *data )
+{
+   hypre_ParCSRMatrix *AT;
+
+   hypre_ParCSRMatrixTranspose(data -> A, &AT, 1);
+
+   return hypre_ParCSRMatrixDestroy(AT);
+}
+
+static HYPRE_Int
+BenchCommPkgCreate( BenchData *data,
+                    HYPRE_Int  algorithm )
+{
+   hypre_ParCSRMatrix *A = data -> A;
+
+   HYPRE_SetDataExchangeAlgorithm(algorithm);
+   hypre_MatvecCommPkgDestroy(hypre_ParCSRMatrixCommPkg(A));
+   hypre_ParCSRMatrixCommPkg(A) = NULL;
+   hypre_MatvecCommPkgCreate(A);
+   HYPRE_SetDataExchangeAlgorithm(0);
+
+   return hypre_error_flag;
+}
+
+static HYPRE_Int
+BenchCommPkgTree( BenchData *data )
+{
+   return BenchCommPkgCreate(data, 0);
+}
+
+static HYPRE_Int
+BenchCommPkgNBX( BenchData *data )
+{
+   return BenchCommPkgCreate(data, 1);
+}
+
+static HYPRE_Int
+BenchMassAxpy( BenchData *data )
+{
+   return hypre_SeqVectorMassAxpy(data -> alpha, data -> mass,
+                                  hypre_ParVectorLocalVector(data -> y),
+                                  data -> num_mass, data -> unroll);
+}
+
+static HYPRE_Int
+BenchMassInnerProd( BenchData *data )
+{
+   return hypre_SeqVectorMassInnerProd(hypre_ParVectorLocalVector(data -> y), data -> mass,
+                                       data -> num_mass, data -> unroll, data -> result);
+}
+
+static HYPRE_Int
+BenchRelax( BenchData *data )
+{
+   HYPRE_Int   relax_type = data -> relax_type;
+   HYPRE_Real *l1_norms;
+
+   l1_norms = (relax_type == 8 || relax_type == 13 || relax_type == 14) ?
+              data -> l1_norms_4 : data -> l1_norms;
+
+   return hypre_BoomerAMGRelax(data -> A, data -> f, NULL, relax_type, 0, 1.0, 1.0,
+                               l1_norms, data -> u, data -> v, data -> z);
+}
+
+static HYPRE_Int
+BenchStructMatvec( BenchData *data )
+{
+   return hypre_StructMatvec(1.0, (hypre_StructMatrix *) data -> sA,
+                             (hypre_StructVector *) data -> sx, 0.0,
+                             (hypre_StructVector *) data -> sy);
+}
+
+/*--------------------------------------------------------------------------
+ * BenchTime
+ *
+ * Returns the time per call, taken as the maximum over all processes.  The
+ * number of calls is chosen from a first timed call so that the measurement
+ * lasts at least 'min_time' seconds, and is the same on all processes.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Real
+BenchTime( MPI_Comm     comm,
+           BenchKernel  kernel,
+           BenchData   *data,
+           HYPRE_Real   min_time,
+           HYPRE_Int   *num_calls_ptr )
+{
+   HYPRE_Real  t, tmax;
+   HYPRE_Int   i, num_calls;
+
+   /* warm up, then time one call */
+   kernel(data);
+   hypre_MPI_Barrier(comm);
+   t = hypre_MPI_Wtime();
+   kernel(data);
+   t = hypre_MPI_Wtime() - t;
+   hypre_MPI_Allreduce(&t, &tmax, 1, HYPRE_MPI_REAL, hypre_MPI_MAX, comm);
+
+   num_calls = (tmax > 0.0) ? (HYPRE_Int) ceil(min_time / tmax) : 1000;
+   num_calls = hypre_max(hypre_min(num_calls, 100000), 1);
+
+   hypre_MPI_Barrier(comm);
+   t = hypre_MPI_Wtime();
+   for (i = 0; i < num_calls; i++)
+   {
+      kernel(data);
+   }
+   t = (hypre_MPI_Wtime() - t) / num_calls;
+   hypre_MPI_Allreduce(&t, &tmax, 1, HYPRE_MPI_REAL, hypre_MPI_MAX, comm);
+
+   *num_calls_ptr = num_calls;
+
+   return tmax;
+}
+
+/*--------------------------------------------------------------------------
+ * BenchSpGEMMFlops
+ *
+ * Flops of the local part of A*B, i.e. twice the number of products
+ * a_ik * b_kj.  The lengths of the rows of B owned by other processes are
+ * brought in with the comm package of A.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Real
+BenchSpGEMMFlops( hypre_ParCSRMatrix *A,
+                  hypre_ParCSRMatrix *B )
+{
+   hypre_CSRMatrix        *A_diag = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix        *A_offd = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix        *B_diag = hypre_ParCSRMatrixDiag(B);
+   hypre_CSRMatrix        *B_offd = hypre_ParCSRMatrixOffd(B);
+   HYPRE_Int               num_rows_B = hypre_CSRMatrixNumRows(B_diag);
+   HYPRE_Int               num_cols_offd_A = hypre_CSRMatrixNumCols(A_offd);
+   hypre_ParCSRCommPkg    *comm_pkg;
+   hypre_ParCSRCommHandle *comm_handle;
+   HYPRE_Int              *row_nnz, *send_nnz, *ext_nnz;
+   HYPRE_Int               i, num_sends, num_elmts;
+   HYPRE_Real              flops = 0.0;
+
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+   comm_pkg  = hypre_ParCSRMatrixCommPkg(A);
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   num_elmts = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+
+   row_nnz  = hypre_CTAlloc(HYPRE_Int, num_rows_B, HYPRE_MEMORY_HOST);
+   send_nnz = hypre_CTAlloc(HYPRE_Int, num_elmts, HYPRE_MEMORY_HOST);
+   ext_nnz  = hypre_CTAlloc(HYPRE_Int, num_cols_offd_A, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < num_rows_B; i++)
+   {
+      row_nnz[i] = hypre_CSRMatrixI(B_diag)[i + 1] - hypre_CSRMatrixI(B_diag)[i] +
+                   hypre_CSRMatrixI(B_offd)[i + 1] - hypre_CSRMatrixI(B_offd)[i];
+   }
+   for (i = 0; i < num_elmts; i++)
+   {
+      send_nnz[i] = row_nnz[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+   }
+   comm_handle = hypre_ParCSRCommHandleCreate(11, comm_pkg, send_nnz, ext_nnz);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   for (i = 0; i < hypre_CSRMatrixNumNonzeros(A_diag); i++)
+   {
+      flops += (HYPRE_Real) row_nnz[hypre_CSRMatrixJ(A_diag)[i]];
+   }
+   for (i = 0; i < hypre_CSRMatrixNumNonzeros(A_offd); i++)
+   {
+      flops += (HYPRE_Real) ext_nnz[hypre_CSRMatrixJ(A_offd)[i]];
+   }
+
+   hypre_TFree(row_nnz, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_nnz, HYPRE_MEMORY_HOST);
+   hypre_TFree(ext_nnz, HYPRE_MEMORY_HOST);
+
+   return 2.0 * flops;
+}
+
+/*--------------------------------------------------------------------------
+ * BenchReport
+ *--------------------------------------------------------------------------*/
+
+static void
+BenchReport( MPI_Comm     comm,
+             FILE        *file,
+             const char  *kernel_name,
+             const char  *problem_name,
+             HYPRE_Int    n,
+             HYPRE_BigInt global_rows,
+             HYPRE_BigInt global_nnz,
+             BenchKernel  kernel,
+             BenchData   *data,
+             HYPRE_Real   bytes,
+             HYPRE_Real   flops,
+             HYPRE_Real   min_time,
+             const char  *filter )
+{
+   HYPRE_Real  local[2], global[2], t;
+   HYPRE_Int   myid, num_procs, num_calls;
+
+   if (filter && !strstr(kernel_name, filter))
+   {
+      return;
+   }
+
+   hypre_MPI_Comm_rank(comm, &myid);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   t = BenchTime(comm, kernel, data, min_time, &num_calls);
+
+   local[0] = bytes;
+   local[1] = flops;
+   hypre_MPI_Allreduce(local, global, 2, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+
+   if (myid == 0)
+   {
+      hypre_fprintf(file, "%s,%s,%d,%d,%d,%b,%b,%d,%.6e,%.4f,%.4f\n",
+                    kernel_name, problem_name, n, num_procs, hypre_NumThreads(),
+                    global_rows, global_nnz, num_calls, t,
+                    (t > 0.0) ? 1.0e-9 * global[0] / t : 0.0,
+                    (t > 0.0) ? 1.0e-9 * global[1] / t : 0.0);
+      fflush(file);
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * BenchStructProblem
+ *
+ * Sets up a 7-point Laplacian on an n^3 box per process in the struct
+ * interface, with the same process topology as the ParCSR problems.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+BenchStructProblem( MPI_Comm            comm,
+                    HYPRE_Int           n,
+                    HYPRE_Int           p,
+                    HYPRE_Int           q,
+                    HYPRE_Int           r,
+                    HYPRE_StructGrid   *grid_ptr,
+                    HYPRE_StructStencil *stencil_ptr,
+                    BenchData          *data )
+{
+   HYPRE_StructGrid     grid;
+   HYPRE_StructStencil  stencil;
+   HYPRE_Int            offsets[7][3] = {{0, 0, 0}, {-1, 0, 0}, {1, 0, 0}, {0, -1, 0},
+                                         {0, 1, 0}, {0, 0, -1}, {0, 0, 1}};
+   HYPRE_Int            stencil_indices[7] = {0, 1, 2, 3, 4, 5, 6};
+   HYPRE_Int            ilower[3], iupper[3];
+   HYPRE_Int            i, volume = n * n * n;
+   HYPRE_Real          *values;
+
+   ilower[0] = p * n;  iupper[0] = ilower[0] + n - 1;
+   ilower[1] = q * n;  iupper[1] = ilower[1] + n - 1;
+   ilower[2] = r * n;  iupper[2] = ilower[2] + n - 1;
+
+   HYPRE_StructGridCreate(comm, 3, &grid);
+   HYPRE_StructGridSetExtents(grid, ilower, iupper);
+   HYPRE_StructGridAssemble(grid);
+
+   HYPRE_StructStencilCreate(3, 7, &stencil);
+   for (i = 0; i < 7; i++)
+   {
+      HYPRE_StructStencilSetElement(stencil, i, offsets[i]);
+   }
+
+   values = hypre_CTAlloc(HYPRE_Real, 7 * volume, HYPRE_MEMORY_HOST);
+   for (i = 0; i < volume; i++)
+   {
+      values[7 * i] = 6.0;
+      values[7 * i + 1] = values[7 * i + 2] = values[7 * i + 3] = -1.0;
+      values[7 * i + 4] = values[7 * i + 5] = values[7 * i + 6] = -1.0;
+   }
+
+   HYPRE_StructMatrixCreate(comm, grid, stencil, &(data -> sA));
+   HYPRE_StructMatrixInitialize(data -> sA);
+   HYPRE_StructMatrixSetBoxValues(data -> sA, ilower, iupper, 7, stencil_indices, values);
+   HYPRE_StructMatrixAssemble(data -> sA);
+
+   HYPRE_StructVectorCreate(comm, grid, &(data -> sx));
+   HYPRE_StructVectorInitialize(data -> sx);
+   HYPRE_StructVectorSetConstantValues(data -> sx, 1.0);
+   HYPRE_StructVectorAssemble(data -> sx);
+
+   HYPRE_StructVectorCreate(comm, grid, &(data -> sy));
+   HYPRE_StructVectorInitialize(data -> sy);
+   HYPRE_StructVectorAssemble(data -> sy);
+
+   hypre_TFree(values, HYPRE_MEMORY_HOST);
+
+   *grid_ptr    = grid;
+   *stencil_ptr = stencil;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * BenchProblem
+ *
+ * Runs all kernels on one ParCSR problem with n^3 grid points per process.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+BenchProblem( MPI_Comm     comm,
+              FILE        *file,
+              HYPRE_Int    problem,
+              HYPRE_Int    n,
+              HYPRE_Int    P,
+              HYPRE_Int    Q,
+              HYPRE_Int    R,
+              HYPRE_Int   *relax_types,
+              HYPRE_Int    num_relax_types,
+              HYPRE_Int    num_mass,
+              HYPRE_Int    unroll,
+              HYPRE_Real   min_time,
+              const char  *filter )
+{
+   const char          *problem_name = (problem == 0) ? "laplace" : "elasticity";
+   BenchData            data;
+   HYPRE_Solver         amg;
+   HYPRE_StructGrid     grid;
+   HYPRE_StructStencil  stencil;
+   hypre_ParCSRMatrix  *A;
+   hypre_CSRMatrix     *A_diag, *A_offd;
+   HYPRE_Real           values[4] = {6.0, -1.0, -1.0, -1.0};
+   HYPRE_Real           mtrx[9] = {2.0, 1.0, 1.0, 1.0, 2.0, 1.0, 1.0, 1.0, 2.0};
+   HYPRE_Real           C = (HYPRE_Real) sizeof(HYPRE_Complex);
+   HYPRE_Real           I = (HYPRE_Real) sizeof(HYPRE_Int);
+   HYPRE_Real           nnz, nnz_diag, bytes, flops, sweeps;
+   HYPRE_Real           local[2], global[2];
+   HYPRE_BigInt         global_rows, global_nnz;
+   HYPRE_Int            num_rows, num_cols_offd, num_levels, i, j;
+   HYPRE_Int            myid, p, q, r;
+   char                 kernel_name[64];
+
+   hypre_MPI_Comm_rank(comm, &myid);
+   p = myid % P;
+   q = ((myid - p) / P) % Q;
+   r = (myid - p - P * q) / (P * Q);
+
+   memset(&data, 0, sizeof(BenchData));
+   if (problem == 0)
+   {
+      A = (hypre_ParCSRMatrix *) GenerateLaplacian(comm, P * n, Q * n, R * n,
+                                                   P, Q, R, p, q, r, values);
+   }
+   else
+   {
+      A = (hypre_ParCSRMatrix *) GenerateSysLaplacian(comm, P * n, Q * n, R * n,
+                                                      P, Q, R, p, q, r, 3, mtrx, values);
+   }
+   hypre_MatvecCommPkgCreate(A);
+   data.A = A;
+
+   A_diag        = hypre_ParCSRMatrixDiag(A);
+   A_offd        = hypre_ParCSRMatrixOffd(A);
+   num_rows      = hypre_CSRMatrixNumRows(A_diag);
+   num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   nnz_diag      = (HYPRE_Real) hypre_CSRMatrixNumNonzeros(A_diag);
+   nnz           = nnz_diag + (HYPRE_Real) hypre_CSRMatrixNumNonzeros(A_offd);
+   global_rows   = hypre_ParCSRMatrixGlobalNumRows(A);
+   local[0]      = nnz;
+   hypre_MPI_Allreduce(local, global, 1, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+   global_nnz    = (HYPRE_BigInt) global[0];
+
+   data.x = hypre_ParVectorCreate(comm, global_rows, hypre_ParCSRMatrixRowStarts(A));
+   data.y = hypre_ParVectorCreate(comm, global_rows, hypre_ParCSRMatrixRowStarts(A));
+   data.f = hypre_ParVectorCreate(comm, global_rows, hypre_ParCSRMatrixRowStarts(A));
+   data.u = hypre_ParVectorCreate(comm, global_rows, hypre_ParCSRMatrixRowStarts(A));
+   data.v = hypre_ParVectorCreate(comm, global_rows, hypre_ParCSRMatrixRowStarts(A));
+   data.z = hypre_ParVectorCreate(comm, global_rows, hypre_ParCSRMatrixRowStarts(A));
+   hypre_ParVectorInitialize(data.x);
+   hypre_ParVectorInitialize(data.y);
+   hypre_ParVectorInitialize(data.f);
+   hypre_ParVectorInitialize(data.u);
+   hypre_ParVectorInitialize(data.v);
+   hypre_ParVectorInitialize(data.z);
+   hypre_ParVectorSetConstantValues(data.x, 1.0);
+   hypre_ParVectorSetConstantValues(data.f, 1.0);
+   hypre_ParVectorSetRandomValues(data.u, 1);
+
+   /* Sparse matrix-vector products */
+   bytes = nnz_diag * (C + I) + (num_rows + 1) * I + 2.0 * num_rows * C;
+   BenchReport(comm, file, "csr_matvec", problem_name, n, global_rows, global_nnz,
+               BenchCSRMatvec, &data, bytes, 2.0 * nnz_diag, min_time, filter);
+   BenchReport(comm, file, "csr_matvecT", problem_name, n, global_rows, global_nnz,
+               BenchCSRMatvecT, &data, bytes, 2.0 * nnz_diag, min_time, filter);
+
+   bytes = nnz * (C + I) + 2.0 * (num_rows + 1) * I + (2.0 * num_rows + num_cols_offd) * C;
+   BenchReport(comm, file, "parcsr_matvec", problem_name, n, global_rows, global_nnz,
+               BenchParCSRMatvec, &data, bytes, 2.0 * nnz, min_time, filter);
+   BenchReport(comm, file, "parcsr_matvecT", problem_name, n, global_rows, global_nnz,
+               BenchParCSRMatvecT, &data, bytes, 2.0 * nnz, min_time, filter);
+
+   /* Transpose: read and write every nonzero once */
+   bytes = 2.0 * (nnz * (C + I) + 2.0 * (num_rows + 1) * I);
+   BenchReport(comm, file, "parcsr_transpose", problem_name, n, global_rows, global_nnz,
+               BenchTranspose, &data, bytes, 0.0, min_time, filter);
+
+   /* Matvec comm package creation with both sparse data exchange algorithms */
+   BenchReport(comm, file, "commpkg_tree", problem_name, n, global_rows, global_nnz,
+               BenchCommPkgTree, &data, 0.0, 0.0, min_time, filter);
+   BenchReport(comm, file, "commpkg_nbx", problem_name, n, global_rows, global_nnz,
+               BenchCommPkgNBX, &data, 0.0, 0.0, min_time, filter);
+
+   /* Sparse matrix-matrix products: inputs and result are streamed once */
+   if (!filter || strstr("parcsr_matmul", filter))
+   {
+      hypre_ParCSRMatrix *C_mat = hypre_ParMatmul(A, A);
+
+      flops = BenchSpGEMMFlops(A, A);
+      bytes = (2.0 * nnz + hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(C_mat)) +
+               hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(C_mat))) * (C + I);
+      hypre_ParCSRMatrixDestroy(C_mat);
+      BenchReport(comm, file, "parcsr_matmul", problem_name, n, global_rows, global_nnz,
+                  BenchParMatmul, &data, bytes, flops, min_time, filter);
+   }
+
+   /* Galerkin product with the first BoomerAMG interpolation operator */
+   if (!filter || strstr("parcsr_rapkt", filter))
+   {
+      HYPRE_BoomerAMGCreate(&amg);
+      HYPRE_BoomerAMGSetMaxLevels(amg, 2);
+      HYPRE_BoomerAMGSetPrintLevel(amg, 0);
+      if (problem == 1)
+      {
+         HYPRE_BoomerAMGSetNumFunctions(amg, 3);
+      }
+      HYPRE_BoomerAMGSetup(amg, (HYPRE_ParCSRMatrix) A, (HYPRE_ParVector) data.f,
+                           (HYPRE_ParVector) data.u);
+      num_levels = hypre_ParAMGDataNumLevels((hypre_ParAMGData *) amg);
+      if (num_levels > 1)
+      {
+         hypre_ParCSRMatrix *P_mat, *AP, *PT, *RAP;
+
+         P_mat  = hypre_ParAMGDataPArray((hypre_ParAMGData *) amg)[0];
+         data.P = P_mat;
+         AP     = hypre_ParMatmul(A, P_mat);
+         RAP    = hypre_ParCSRMatrixRAPKT(P_mat, A, P_mat, 0);
+         hypre_ParCSRMatrixTranspose(P_mat, &PT, 1);
+         hypre_MatvecCommPkgCreate(PT);
+
+         flops = BenchSpGEMMFlops(A, P_mat) + BenchSpGEMMFlops(PT, AP);
+         bytes = (nnz + 2.0 * (hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(P_mat)) +
+                               hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(P_mat))) +
+                  hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(AP)) +
+                  hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(AP)) +
+                  hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(RAP)) +
+                  hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(RAP))) * (C + I);
+         hypre_ParCSRMatrixDestroy(RAP);
+         hypre_ParCSRMatrixDestroy(AP);
+         hypre_ParCSRMatrixDestroy(PT);
+
+         BenchReport(comm, file, "parcsr_rapkt", problem_name, n, global_rows, global_nnz,
+                     BenchRAPKT, &data, bytes, flops, min_time, filter);
+      }
+      HYPRE_BoomerAMGDestroy(amg);
+   }
+
+   /* Mass vector kernels on contiguous multivectors, as used by GMRES */
+   data.num_mass  = num_mass;
+   data.unroll    = unroll;
+   data.mass      = hypre_CTAlloc(hypre_Vector *, num_mass, HYPRE_MEMORY_HOST);
+   data.mass_data = hypre_CTAlloc(HYPRE_Complex, (size_t) num_mass * num_rows,
+                                  HYPRE_MEMORY_HOST);
+   data.alpha     = hypre_CTAlloc(HYPRE_Complex, num_mass, HYPRE_MEMORY_HOST);
+   data.result    = hypre_CTAlloc(HYPRE_Real, num_mass, HYPRE_MEMORY_HOST);
+   for (j = 0; j < num_mass; j++)
+   {
+      data.mass[j] = hypre_SeqVectorCreate(num_rows);
+      hypre_VectorData(data.mass[j]) = data.mass_data + (size_t) j * num_rows;
+      hypre_SeqVectorSetDataOwner(data.mass[j], 0);
+      data.alpha[j] = 1.0 / (j + 1);
+      for (i = 0; i < num_rows; i++)
+      {
+         data.mass_data[(size_t) j * num_rows + i] = 1.0;
+      }
+   }
+
+   flops = 2.0 * num_mass * num_rows;
+   BenchReport(comm, file, "mass_axpy", problem_name, n, global_rows, global_nnz,
+               BenchMassAxpy, &data, (num_mass + 2.0) * num_rows * C, flops, min_time, filter);
+   BenchReport(comm, file, "mass_innerprod", problem_name, n, global_rows, global_nnz,
+               BenchMassInnerProd, &data, (num_mass + 1.0) * num_rows * C, flops, min_time, filter);
+
+   /* Relaxation: one (or two, for the symmetric variants) sweeps over A */
+   hypre_ParCSRComputeL1Norms(A, 1, NULL, &data.l1_norms);
+   hypre_ParCSRComputeL1Norms(A, 4, NULL, &data.l1_norms_4);
+   for (j = 0; j < num_relax_types; j++)
+   {
+      data.relax_type = relax_types[j];
+      sweeps = (relax_types[j] == 6 || relax_types[j] == 8 || relax_types[j] == 11) ? 2.0 :
+               (relax_types[j] == 12) ? 3.0 : 1.0;
+      bytes  = sweeps * (nnz * (C + I) + 2.0 * (num_rows + 1) * I + 4.0 * num_rows * C);
+      flops  = sweeps * (2.0 * nnz + 2.0 * num_rows);
+      hypre_sprintf(kernel_name, "relax_%d", relax_types[j]);
+      BenchReport(comm, file, kernel_name, problem_name, n, global_rows, global_nnz,
+                  BenchRelax, &data, bytes, flops, min_time, filter);
+   }
+
+   /* Struct matvec on the same grid (scalar problem only) */
+   if (problem == 0 && (!filter || strstr("struct_matvec", filter)))
+   {
+      HYPRE_Real volume = (HYPRE_Real) n * n * n;
+
+      BenchStructProblem(comm, n, p, q, r, &grid, &stencil, &data);
+      BenchReport(comm, file, "struct_matvec", problem_name, n, global_rows, global_nnz,
+                  BenchStructMatvec, &data, volume * (7.0 * C + 2.0 * C), 14.0 * volume,
+                  min_time, filter);
+      HYPRE_StructMatrixDestroy(data.sA);
+      HYPRE_StructVectorDestroy(data.sx);
+      HYPRE_StructVectorDestroy(data.sy);
+      HYPRE_StructStencilDestroy(stencil);
+      HYPRE_StructGridDestroy(grid);
+   }
+
+   /* Clean up */
+   for (j = 0; j < num_mass; j++)
+   {
+      hypre_SeqVectorDestroy(data.mass[j]);
+   }
+   hypre_TFree(data.mass, HYPRE_MEMORY_HOST);
+   hypre_TFree(data.mass_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(data.alpha, HYPRE_MEMORY_HOST);
+   hypre_TFree(data.result, HYPRE_MEMORY_HOST);
+   hypre_TFree(data.l1_norms, hypre_ParCSRMatrixMemoryLocation(A));
+   hypre_TFree(data.l1_norms_4, hypre_ParCSRMatrixMemoryLocation(A));
+   hypre_ParVectorDestroy(data.x);
+   hypre_ParVectorDestroy(data.y);
+   hypre_ParVectorDestroy(data.f);
+   hypre_ParVectorDestroy(data.u);
+   hypre_ParVectorDestroy(data.v);
+   hypre_ParVectorDestroy(data.z);
+   hypre_ParCSRMatrixDestroy(A);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Main
+ *--------------------------------------------------------------------------*/
+
+hypre_int
+main( hypre_int argc,
+      char *argv[] )
+{
+   MPI_Comm    comm = hypre_MPI_COMM_WORLD;
+   FILE       *file = stdout;
+   char       *out_name = NULL;
+   char       *filter = NULL;
+   HYPRE_Int   arg_index, print_usage = 0;
+   HYPRE_Int   myid, num_procs;
+   HYPRE_Int   P, Q, R;
+   HYPRE_Int   sizes[BENCH_MAX_LIST] = {24, 48};
+   HYPRE_Int   num_sizes = 2;
+   HYPRE_Int   threads[BENCH_MAX_LIST];
+   HYPRE_Int   num_threads = 0;
+   HYPRE_Int   relax_types[BENCH_MAX_LIST] = {0, 3, 4, 5, 6, 7, 8, 11, 12, 13, 14, 18};
+   HYPRE_Int   num_relax_types = 12;
+   HYPRE_Int   problems[2] = {1, 1};
+   HYPRE_Int   num_mass = 10;
+   HYPRE_Int   unroll = 0;
+   HYPRE_Real  min_time = 0.2;
+   HYPRE_Int   i, j, k, s, t;
+
+   /* Initialize MPI */
+   hypre_MPI_Init(&argc, &argv);
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   HYPRE_Init();
+
+   P = num_procs;
+   Q = 1;
+   R = 1;
+
+   /*-----------------------------------------------------------
+    * Parse command line
+    *-----------------------------------------------------------*/
+
+   arg_index = 1;
+   while (arg_index < argc)
+   {
+      if ( strcmp(argv[arg_index], "-sizes") == 0 )
+      {
+         arg_index++;
+         num_sizes = atoi(argv[arg_index++]);
+         num_sizes = hypre_min(num_sizes, BENCH_MAX_LIST);
+         for (i = 0; i < num_sizes; i++)
+         {
+            sizes[i] = atoi(argv[arg_index++]);
+         }
+      }
+      else if ( strcmp(argv[arg_index], "-threads") == 0 )
+      {
+         arg_index++;
+         num_threads = atoi(argv[arg_index++]);
+         num_threads = hypre_min(num_threads, BENCH_MAX_LIST);
+         for (i = 0; i < num_threads; i++)
+         {
+            threads[i] = atoi(argv[arg_index++]);
+         }
+      }
+      else if ( strcmp(argv[arg_index], "-relax") == 0 )
+      {
+         arg_index++;
+         num_relax_types = atoi(argv[arg_index++]);
+         num_relax_types = hypre_min(num_relax_types, BENCH_MAX_LIST);
+         for (i = 0; i < num_relax_types; i++)
+         {
+            relax_types[i] = atoi(argv[arg_index++]);
+         }
+      }
+      else if ( strcmp(argv[arg_index], "-P") == 0 )
+      {
+         arg_index++;
+         P = atoi(argv[arg_index++]);
+         Q = atoi(argv[arg_index++]);
+         R = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-laplace") == 0 )
+      {
+         arg_index++;
+         problems[0] = 1;
+         problems[1] = 0;
+      }
+      else if ( strcmp(argv[arg_index], "-elasticity") == 0 )
+      {
+         arg_index++;
+         problems[0] = 0;
+         problems[1] = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-kernel") == 0 )
+      {
+         arg_index++;
+         filter = argv[arg_index++];
+      }
+      else if ( strcmp(argv[arg_index], "-k") == 0 )
+      {
+         arg_index++;
+         num_mass = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-unroll") == 0 )
+      {
+         arg_index++;
+         unroll = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-mintime") == 0 )
+      {
+         arg_index++;
+         min_time = atof(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-o") == 0 )
+      {
+         arg_index++;
+         out_name = argv[arg_index++];
+      }
+      else if ( strcmp(argv[arg_index], "-help") == 0 )
+      {
+         print_usage = 1;
+         break;
+      }
+      else
+      {
+         arg_index++;
+      }
+   }
+
+   if (P * Q * R != num_procs)
+   {
+      if (myid == 0)
+      {
+         hypre_printf("Error: Invalid number of processors or processor topology\n");
+      }
+      print_usage = 1;
+   }
+
+   if (print_usage)
+   {
+      if (myid == 0)
+      {
+         hypre_printf("\n");
+         hypre_printf("Usage: %s [<options>]\n", argv[0]);
+         hypre_printf("\n");
+         hypre_printf("  -sizes <k> <n1> .. <nk>   : n^3 grid points per process (default 24 48)\n");
+         hypre_printf("  -threads <k> <t1> .. <tk> : thread counts (default: current)\n");
+         hypre_printf("  -P <Px> <Py> <Pz>         : processor topology (default num_procs 1 1)\n");
+         hypre_printf("  -laplace                  : only the 7-point Laplacian\n");
+         hypre_printf("  -elasticity               : only the 3-component system\n");
+         hypre_printf("  -kernel <name>            : only kernels whose name contains <name>\n");
+         hypre_printf("  -relax <k> <t1> .. <tk>   : relaxation types for BoomerAMGRelax\n");
+         hypre_printf("  -k <val>                  : number of vectors in the mass kernels (10)\n");
+         hypre_printf("  -unroll <val>             : unrolling of the mass kernels (0, 4 or 8)\n");
+         hypre_printf("  -mintime <val>            : minimum time per measurement in s (0.2)\n");
+         hypre_printf("  -o <file>                 : write the CSV output to <file>\n");
+         hypre_printf("\n");
+      }
+      HYPRE_Finalize();
+      hypre_MPI_Finalize();
+      exit(1);
+   }
+
+   if (num_threads == 0)
+   {
+      threads[0]  = hypre_NumThreads();
+      num_threads = 1;
+   }
+
+   if (myid == 0 && out_name)
+   {
+      if ((file = fopen(out_name, "w")) == NULL)
+      {
+         hypre_printf("Error: can't open output file %s\n", out_name);
+         file = stdout;
+      }
+   }
+
+   /*-----------------------------------------------------------
+    * Run the benchmarks
+    *-----------------------------------------------------------*/
+
+   if (myid == 0)
+   {
+      hypre_fprintf(file, "# hypre kernel benchmarks: time is the max over processes,\n");
+      hypre_fprintf(file, "# GB/s and GFLOP/s use modeled bytes and flops summed over processes\n");
+      hypre_fprintf(file, "kernel,problem,n,procs,threads,rows,nnz,calls,"
+                    "seconds_per_call,gbytes_per_second,gflops_per_second\n");
+   }
+
+   for (k = 0; k < 2; k++)
+   {
+      if (!problems[k])
+      {
+         continue;
+      }
+      for (s = 0; s < num_sizes; s++)
+      {
+         for (t = 0; t < num_threads; t++)
+         {
+            hypre_SetNumThreads(threads[t]);
+            BenchProblem(comm, file, k, sizes[s], P, Q, R, relax_types, num_relax_types,
+                         num_mass, unroll, min_time, filter);
+         }
+      }
+   }
+
+   if (file != stdout)
+   {
+      fclose(file);
+   }
+
+   j = hypre_error_flag;
+
+   /* Finalize Hypre */
+   HYPRE_Finalize();
+
+   /* Finalize MPI */
+   hypre_MPI_Finalize();
+
+   return (j != 0);
+}
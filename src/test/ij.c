@@ -112,6 +112,7 @@ main( hypre_int argc,
    HYPRE_Int           check_constant = 0;
    HYPRE_Int           off_proc = 0;
    HYPRE_Int           chunk = 0;
+   HYPRE_Int           coo = 0;
    HYPRE_Int           omp_flag = 0;
    HYPRE_Int           build_matrix_type;
    HYPRE_Int           build_matrix_arg_index;
@@ -131,6 +132,7 @@ main( hypre_int argc,
    HYPRE_Int           solver_id;
    HYPRE_Int           solver_type = 1;
    HYPRE_Int           recompute_res = 0;   /* What should be the default here? */
+   HYPRE_Int           pipelined = 0;
    HYPRE_Int           ioutdat;
    HYPRE_Int           poutdat;
    HYPRE_Int           poutusr = 0; /* if user selects pout */
@@ -262,6 +264,10 @@ main( hypre_int argc,
    HYPRE_Int    rap2     = 0;
    HYPRE_Int    mod_rap2 = 0;
    HYPRE_Int    keepTranspose = 0;
+   HYPRE_Int    persistent_comm = 0;
+   HYPRE_Int    fuse_grid_transfer = 0;
+   HYPRE_Int    mixed_precision = 0;
+   HYPRE_Int    reuse_cf_rap_structure = 0;
 #ifdef HYPRE_USING_DSUPERLU
    HYPRE_Int    dslu_threshold = -1;
 #endif
@@ -281,6 +287,9 @@ main( hypre_int argc,
    HYPRE_Int  cheby_scale = 1;
    HYPRE_Real cheby_fraction = .3;
 
+   HYPRE_Int  spmv_use_sell = 0;
+   HYPRE_Int  data_exchange = 0;
+
 #if defined(HYPRE_USING_GPU)
    keepTranspose = 1;
    coarsen_type  = 8;
@@ -345,6 +354,10 @@ main( hypre_int argc,
    HYPRE_Real   agg_P12_trunc_factor  = 0; /* default value */
 
    HYPRE_Int    print_system = 0;
+   HYPRE_Int    print_binary = 0;
+   HYPRE_Int    trace_level = 0;
+   HYPRE_Int    nthreads = 0;
+   HYPRE_Int    read_binary = 0;
    HYPRE_Int    rel_change = 0;
    HYPRE_Int    second_time = 0;
    HYPRE_Int    benchmark = 0;
@@ -423,6 +436,7 @@ main( hypre_int argc,
    HYPRE_Real ilu_droptol = 1.0e-02;
    HYPRE_Int ilu_max_row_nnz = 1000;
    HYPRE_Int ilu_schur_max_iter = 3;
+   HYPRE_Int ilu_iter_setup_max_iter = 5;
    HYPRE_Real ilu_nsh_droptol = 1.0e-02;
    /* end hypre ILU options */
 
@@ -521,6 +535,13 @@ main( hypre_int argc,
          build_matrix_type      = -1;
          build_matrix_arg_index = arg_index;
       }
+      else if ( strcmp(argv[arg_index], "-frombinaryfile") == 0 )
+      {
+         arg_index++;
+         build_matrix_type      = -1;
+         build_matrix_arg_index = arg_index;
+         read_binary            = 1;
+      }
       else if ( strcmp(argv[arg_index], "-auxfromfile") == 0 )
       {
          arg_index++;
@@ -617,6 +638,11 @@ main( hypre_int argc,
          arg_index++;
          off_proc = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-coo") == 0 )
+      {
+         arg_index++;
+         coo = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-omp") == 0 )
       {
          arg_index++;
@@ -1184,6 +1210,12 @@ main( hypre_int argc,
          arg_index++;
          ilu_schur_max_iter = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-ilu_iter_setup_max_iter") == 0 )
+      {
+         /* Number of sweeps for the iterative ILU(k) setup */
+         arg_index++;
+         ilu_iter_setup_max_iter = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-ilu_nsh_droptol") == 0 )
       {
          /* Max number of iterations for schur system solver */
@@ -1218,6 +1250,16 @@ main( hypre_int argc,
          fsai_kap_tolerance = atof(argv[arg_index++]);
       }
       /* end FSAI options */
+      else if ( strcmp(argv[arg_index], "-mv_sell") == 0 )
+      {
+         arg_index++;
+         spmv_use_sell = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-data_exchange") == 0 )
+      {
+         arg_index++;
+         data_exchange = atoi(argv[arg_index++]);
+      }
 #if defined(HYPRE_USING_GPU)
       else if ( strcmp(argv[arg_index], "-exec_host") == 0 )
       {
@@ -1623,6 +1665,11 @@ main( hypre_int argc,
          arg_index++;
          recompute_res = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-pipelined") == 0 )
+      {
+         arg_index++;
+         pipelined = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-iout") == 0 )
       {
          arg_index++;
@@ -1812,6 +1859,26 @@ main( hypre_int argc,
          arg_index++;
          keepTranspose  = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-persistent_comm") == 0 )
+      {
+         arg_index++;
+         persistent_comm = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-fuse_transfer") == 0 )
+      {
+         arg_index++;
+         fuse_grid_transfer = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-mixed_prec") == 0 )
+      {
+         arg_index++;
+         mixed_precision = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-reuse_cf_rap") == 0 )
+      {
+         arg_index++;
+         reuse_cf_rap_structure = atoi(argv[arg_index++]);
+      }
 #ifdef HYPRE_USING_DSUPERLU
       else if ( strcmp(argv[arg_index], "-dslu_th") == 0 )
       {
@@ -1834,6 +1901,21 @@ main( hypre_int argc,
          arg_index++;
          print_system = 1;
       }
+      else if ( strcmp(argv[arg_index], "-printbinary") == 0 )
+      {
+         arg_index++;
+         print_binary = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-trace") == 0 )
+      {
+         arg_index++;
+         trace_level = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-nthreads") == 0 )
+      {
+         arg_index++;
+         nthreads = atoi(argv[arg_index++]);
+      }
       /* BM Oct 23, 2006 */
       else if ( strcmp(argv[arg_index], "-plot_grids") == 0 )
       {
@@ -1951,6 +2033,8 @@ main( hypre_int argc,
          hypre_printf("\n");
          hypre_printf("  -fromfile <filename>       : ");
          hypre_printf("matrix read from multiple files (IJ format)\n");
+         hypre_printf("  -frombinaryfile <filename> : ");
+         hypre_printf("matrix read from multiple files (binary format)\n");
          hypre_printf("  -fromparcsrfile <filename> : ");
          hypre_printf("matrix read from multiple files (ParCSR format)\n");
          hypre_printf("  -fromonecsrfile <filename> : ");
@@ -2143,6 +2227,7 @@ main( hypre_int argc,
 
          hypre_printf("  -w   <val>             : set Jacobi relax weight = val\n");
          hypre_printf("  -k   <val>             : dimension Krylov space for GMRES\n");
+         hypre_printf("  -pipelined <val>       : pipelined PCG/GMRES with one overlapped reduction per iteration\n");
          hypre_printf("  -aug   <val>           : number of augmentation vectors for LGMRES (-k indicates total approx space size)\n");
 
          hypre_printf("  -mxl  <val>            : maximum number of levels (AMG, ParaSAILS)\n");
@@ -2174,6 +2259,13 @@ main( hypre_int argc,
          hypre_printf("       0=no debugging\n       1=internal timing\n       2=interpolation truncation\n       3=more detailed timing in coarsening routine\n");
          hypre_printf("\n");
          hypre_printf("  -print                 : print out the system\n");
+         hypre_printf("  -printbinary           : print out the matrix in binary format\n");
+         hypre_printf("  -trace <val>           : trace regions (1=totals, 2=timeline)\n");
+         hypre_printf("                           written to ij.trace.<rank as %%05d>\n");
+         hypre_printf("  -nthreads <val>        : number of OpenMP threads (default from environment)\n");
+         hypre_printf("\n");
+         hypre_printf("  -mv_sell <val>         : use SELL-C-sigma host matvecs (1) or plain CSR (0)\n");
+         hypre_printf("  -data_exchange <val>   : comm package exchanges with binary tree (0) or NBX (1)\n");
          hypre_printf("\n");
          /* begin lobpcg */
 
@@ -2240,6 +2332,10 @@ main( hypre_int argc,
 
          hypre_printf("  -plot_grids            : print out information for plotting the grids\n");
          hypre_printf("  -plot_file_name <val>  : file name for plotting output\n");
+         hypre_printf("  -persistent_comm <val> : reuse persistent MPI requests in the AMG cycle\n");
+         hypre_printf("  -fuse_transfer <val>   : fused residual-restriction/interpolation in the AMG cycle\n");
+         hypre_printf("  -mixed_prec <val>      : store AMG interpolation/restriction in single precision\n");
+         hypre_printf("  -reuse_cf_rap <val>    : keep the AMG C/F splittings and RAP structure on repeated setups\n");
          hypre_printf("\n");
          hypre_printf("  -smtype <val>      :smooth type\n");
          hypre_printf("  -smlv <val>        :smooth num levels\n");
@@ -2271,6 +2367,7 @@ main( hypre_int argc,
          hypre_printf("  -ilu_type   <val>                : set ILU factorization type = val\n");
          hypre_printf("  -ilu_type   0                    : Block Jacobi with ILU(k) variants \n");
          hypre_printf("  -ilu_type   1                    : Block Jacobi with ILUT \n");
+         hypre_printf("  -ilu_type   2                    : Block Jacobi with iterative ILU(k) \n");
          hypre_printf("  -ilu_type   10                   : GMRES with ILU(k) variants \n");
          hypre_printf("  -ilu_type   11                   : GMRES with ILUT \n");
          hypre_printf("  -ilu_type   20                   : NSH with ILU(k) variants \n");
@@ -2285,6 +2382,7 @@ main( hypre_int argc,
          hypre_printf("  -ilu_max_row_nnz   <val>         : set max. num of nonzeros to keep per row = val \n");
          hypre_printf("  -ilu_schur_max_iter   <val>      : set max. num of iteration for GMRES/NSH Schur = val \n");
          hypre_printf("  -ilu_nsh_droptol   <val>         : set drop tolerance threshold for NSH = val \n");
+         hypre_printf("  -ilu_iter_setup_max_iter   <val> : set num of sweeps for iterative ILU(k) setup = val \n");
          hypre_printf("  -ilu_sm_max_iter   <val>         : set number of iterations when applied as a smmother in AMG = val \n");
          /* end ILU options */
          /* hypre FSAI options */
@@ -2352,6 +2450,16 @@ main( hypre_int argc,
    hypre_FinalizeTiming(time_index);
    hypre_ClearTiming();
 
+   if (trace_level)
+   {
+      HYPRE_SetTraceLevel(trace_level);
+   }
+
+   if (nthreads > 0)
+   {
+      hypre_SetNumThreads(nthreads);
+   }
+
 #ifdef HYPRE_USING_DEVICE_POOL
    /* To be effective, hypre_SetCubMemPoolSize must immediately follow HYPRE_Init */
    HYPRE_SetGPUMemoryPoolSize( mempool_bin_growth, mempool_min_bin,
@@ -2376,6 +2484,12 @@ main( hypre_int argc,
    /* default execution policy */
    HYPRE_SetExecutionPolicy(default_exec_policy);
 
+   /* host SpMV kernel */
+   HYPRE_SetSpMVUseSell(spmv_use_sell);
+
+   /* sparse data exchange algorithm */
+   HYPRE_SetDataExchangeAlgorithm(data_exchange);
+
 #if defined(HYPRE_USING_GPU)
    ierr = HYPRE_SetSpMVUseVendor(spmv_use_vendor); hypre_assert(ierr == 0);
    /* use vendor implementation for SpGEMM */
@@ -2401,7 +2515,17 @@ main( hypre_int argc,
 
    time_index = hypre_InitializeTiming("Spatial Operator");
    hypre_BeginTiming(time_index);
-   if ( build_matrix_type == -1 )
+   if ( build_matrix_type == -1 && read_binary )
+   {
+      ierr = HYPRE_IJMatrixReadBinary( argv[build_matrix_arg_index], comm,
+                                       HYPRE_PARCSR, &ij_A );
+      if (ierr)
+      {
+         hypre_printf("ERROR: Problem reading in the system matrix!\n");
+         exit(1);
+      }
+   }
+   else if ( build_matrix_type == -1 )
    {
       ierr = HYPRE_IJMatrixRead( argv[build_matrix_arg_index], comm,
                                  HYPRE_PARCSR, &ij_A );
@@ -2686,7 +2810,65 @@ main( hypre_int argc,
                        HYPRE_MEMORY_HOST);
       }
 
-      if (chunk)
+      if (coo)
+      {
+         /* Add every entry twice with half its value, the second time in
+            reverse order, so that the COO assembly has to sort the triples
+            and sum the duplicates. The result equals the matrix built with
+            "-add 1". */
+         HYPRE_Int      nnz = 0;
+         HYPRE_BigInt  *coo_rows, *coo_cols;
+         HYPRE_Real    *coo_data;
+
+         for (i = 0; i < num_rows; i++)
+         {
+            nnz += num_cols_h[i];
+         }
+         coo_rows = hypre_TAlloc(HYPRE_BigInt, 2 * nnz, HYPRE_MEMORY_HOST);
+         coo_cols = hypre_TAlloc(HYPRE_BigInt, 2 * nnz, HYPRE_MEMORY_HOST);
+         coo_data = hypre_TAlloc(HYPRE_Real,   2 * nnz, HYPRE_MEMORY_HOST);
+
+         j_indx = 0;
+         for (i = 0; i < num_rows; i++)
+         {
+            for (j = 0; j < num_cols_h[i]; j++)
+            {
+               coo_rows[j_indx] = coo_rows[2 * nnz - 1 - j_indx] = row_nums_h[i];
+               coo_cols[j_indx] = coo_cols[2 * nnz - 1 - j_indx] = col_nums_h[j_indx];
+               coo_data[j_indx] = coo_data[2 * nnz - 1 - j_indx] = 0.5 * data_h[j_indx];
+               j_indx++;
+            }
+         }
+
+         if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
+         {
+            HYPRE_BigInt  *coo_rows_h = coo_rows;
+            HYPRE_BigInt  *coo_cols_h = coo_cols;
+            HYPRE_Real    *coo_data_h = coo_data;
+
+            coo_rows = hypre_TAlloc(HYPRE_BigInt, 2 * nnz, memory_location);
+            coo_cols = hypre_TAlloc(HYPRE_BigInt, 2 * nnz, memory_location);
+            coo_data = hypre_TAlloc(HYPRE_Real,   2 * nnz, memory_location);
+            hypre_TMemcpy(coo_rows, coo_rows_h, HYPRE_BigInt, 2 * nnz, memory_location,
+                          HYPRE_MEMORY_HOST);
+            hypre_TMemcpy(coo_cols, coo_cols_h, HYPRE_BigInt, 2 * nnz, memory_location,
+                          HYPRE_MEMORY_HOST);
+            hypre_TMemcpy(coo_data, coo_data_h, HYPRE_Real,   2 * nnz, memory_location,
+                          HYPRE_MEMORY_HOST);
+            hypre_TFree(coo_rows_h, HYPRE_MEMORY_HOST);
+            hypre_TFree(coo_cols_h, HYPRE_MEMORY_HOST);
+            hypre_TFree(coo_data_h, HYPRE_MEMORY_HOST);
+         }
+
+         ierr += HYPRE_IJMatrixAddToValuesCOO(ij_A, nnz, coo_rows, coo_cols, coo_data);
+         ierr += HYPRE_IJMatrixAddToValuesCOO(ij_A, nnz, coo_rows + nnz, coo_cols + nnz,
+                                              coo_data + nnz);
+
+         hypre_TFree(coo_rows, memory_location);
+         hypre_TFree(coo_cols, memory_location);
+         hypre_TFree(coo_data, memory_location);
+      }
+      else if (chunk)
       {
          if (add)
          {
@@ -3455,6 +3637,18 @@ main( hypre_int argc,
       hypre_ParCSRMatrixScale(parcsr_A, -1);
    }
 
+   if (print_binary)
+   {
+      if (ij_A)
+      {
+         HYPRE_IJMatrixPrintBinary(ij_A, "IJ.out.A");
+      }
+      else if (parcsr_A)
+      {
+         hypre_ParCSRMatrixPrintBinary(parcsr_A, "IJ.out.A");
+      }
+   }
+
    if (print_system)
    {
       if (ij_A)
@@ -3878,6 +4072,10 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetModuleRAP2(amg_solver, mod_rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetPersistentComm(amg_solver, persistent_comm);
+      HYPRE_BoomerAMGSetFuseGridTransfer(amg_solver, fuse_grid_transfer);
+      HYPRE_BoomerAMGSetMixedPrecision(amg_solver, mixed_precision);
+      HYPRE_BoomerAMGSetReuseCFRAPStructure(amg_solver, reuse_cf_rap_structure);
 #ifdef HYPRE_USING_DSUPERLU
       HYPRE_BoomerAMGSetDSLUThreshold(amg_solver, dslu_threshold);
 #endif
@@ -4181,6 +4379,10 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetModuleRAP2(amg_solver, mod_rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetPersistentComm(amg_solver, persistent_comm);
+      HYPRE_BoomerAMGSetFuseGridTransfer(amg_solver, fuse_grid_transfer);
+      HYPRE_BoomerAMGSetMixedPrecision(amg_solver, mixed_precision);
+      HYPRE_BoomerAMGSetReuseCFRAPStructure(amg_solver, reuse_cf_rap_structure);
       if (nongalerk_tol)
       {
          HYPRE_BoomerAMGSetNonGalerkinTol(amg_solver, nongalerk_tol[nongalerk_num_tol - 1]);
@@ -4269,6 +4471,7 @@ main( hypre_int argc,
       HYPRE_PCGSetPrintLevel(pcg_solver, ioutdat);
       HYPRE_PCGSetAbsoluteTol(pcg_solver, atol);
       HYPRE_PCGSetRecomputeResidual(pcg_solver, recompute_res);
+      HYPRE_PCGSetPipelined(pcg_solver, pipelined);
 
       if (solver_id == 1)
       {
@@ -4382,6 +4585,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetPersistentComm(pcg_precond, persistent_comm);
+         HYPRE_BoomerAMGSetFuseGridTransfer(pcg_precond, fuse_grid_transfer);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetReuseCFRAPStructure(pcg_precond, reuse_cf_rap_structure);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -4566,6 +4773,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetPersistentComm(pcg_precond, persistent_comm);
+         HYPRE_BoomerAMGSetFuseGridTransfer(pcg_precond, fuse_grid_transfer);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetReuseCFRAPStructure(pcg_precond, reuse_cf_rap_structure);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -5919,6 +6130,7 @@ main( hypre_int argc,
       HYPRE_GMRESSetLogging(pcg_solver, 1);
       HYPRE_GMRESSetPrintLevel(pcg_solver, ioutdat);
       HYPRE_GMRESSetRelChange(pcg_solver, rel_change);
+      HYPRE_GMRESSetPipelined(pcg_solver, pipelined);
 
       if (solver_id == 3 || solver_id == 91)
       {
@@ -6070,6 +6282,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(amg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(amg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(amg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetPersistentComm(amg_precond, persistent_comm);
+         HYPRE_BoomerAMGSetFuseGridTransfer(amg_precond, fuse_grid_transfer);
+         HYPRE_BoomerAMGSetMixedPrecision(amg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetReuseCFRAPStructure(amg_precond, reuse_cf_rap_structure);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(amg_precond, dslu_threshold);
 #endif
@@ -6257,6 +6473,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetPersistentComm(pcg_precond, persistent_comm);
+         HYPRE_BoomerAMGSetFuseGridTransfer(pcg_precond, fuse_grid_transfer);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetReuseCFRAPStructure(pcg_precond, reuse_cf_rap_structure);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -6331,6 +6551,7 @@ main( hypre_int argc,
          HYPRE_ILUSetDropThreshold(pcg_precond, ilu_droptol);
          /* set max iterations for Schur system solve */
          HYPRE_ILUSetSchurMaxIter( pcg_precond, ilu_schur_max_iter );
+         HYPRE_ILUSetIterativeSetupMaxIter( pcg_precond, ilu_iter_setup_max_iter );
          if (ilu_type == 20 || ilu_type == 21)
          {
             HYPRE_ILUSetNSHDropThreshold( pcg_precond, ilu_nsh_droptol);
@@ -6603,6 +6824,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetPersistentComm(pcg_precond, persistent_comm);
+         HYPRE_BoomerAMGSetFuseGridTransfer(pcg_precond, fuse_grid_transfer);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetReuseCFRAPStructure(pcg_precond, reuse_cf_rap_structure);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -6808,6 +7033,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetPersistentComm(pcg_precond, persistent_comm);
+         HYPRE_BoomerAMGSetFuseGridTransfer(pcg_precond, fuse_grid_transfer);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetReuseCFRAPStructure(pcg_precond, reuse_cf_rap_structure);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -6971,6 +7200,7 @@ main( hypre_int argc,
          HYPRE_ILUSetDropThreshold(pcg_precond, ilu_droptol);
          /* set max iterations for Schur system solve */
          HYPRE_ILUSetSchurMaxIter( pcg_precond, ilu_schur_max_iter );
+         HYPRE_ILUSetIterativeSetupMaxIter( pcg_precond, ilu_iter_setup_max_iter );
          HYPRE_ILUSetNSHDropThreshold( pcg_precond, ilu_nsh_droptol);
 
          /* setup MGR-PCG solver */
@@ -7212,6 +7442,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetPersistentComm(pcg_precond, persistent_comm);
+         HYPRE_BoomerAMGSetFuseGridTransfer(pcg_precond, fuse_grid_transfer);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetReuseCFRAPStructure(pcg_precond, reuse_cf_rap_structure);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7609,6 +7843,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetPersistentComm(pcg_precond, persistent_comm);
+         HYPRE_BoomerAMGSetFuseGridTransfer(pcg_precond, fuse_grid_transfer);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetReuseCFRAPStructure(pcg_precond, reuse_cf_rap_structure);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7941,6 +8179,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetPersistentComm(pcg_precond, persistent_comm);
+         HYPRE_BoomerAMGSetFuseGridTransfer(pcg_precond, fuse_grid_transfer);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
+         HYPRE_BoomerAMGSetReuseCFRAPStructure(pcg_precond, reuse_cf_rap_structure);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -8246,6 +8488,7 @@ main( hypre_int argc,
       HYPRE_ILUSetTol(ilu_solver, tol);
       /* set max iterations for Schur system solve */
       HYPRE_ILUSetSchurMaxIter( ilu_solver, ilu_schur_max_iter );
+      HYPRE_ILUSetIterativeSetupMaxIter( ilu_solver, ilu_iter_setup_max_iter );
 
       /* setting for NSH */
       if (ilu_type == 20 || ilu_type == 21)
@@ -8378,6 +8621,11 @@ final:
       hypre_FinalizeMemoryDebug();
    */
 
+   if (trace_level)
+   {
+      HYPRE_PrintTrace("ij.trace");
+   }
+
    /* Finalize Hypre */
    HYPRE_Finalize();
 
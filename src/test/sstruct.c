@@ -2239,6 +2239,7 @@ PrintUsage( char *progname,
       hypre_printf("                        248- Struct BiCGSTAB with diagonal scaling\n");
       hypre_printf("                        249- Struct BiCGSTAB\n");
       hypre_printf("  -print             : print out the system\n");
+      hypre_printf("  -direct_parcsr     : convert stencil entries to ParCSR box-wise\n");
       hypre_printf("  -rhsfromcosine     : solution is cosine function (default)\n");
       hypre_printf("  -rhsone            : rhs is vector with unit components\n");
       hypre_printf("  -tol <val>         : convergence tolerance (default 1e-6)\n");
@@ -2333,6 +2334,7 @@ main( hypre_int argc,
    Index                *block;
    HYPRE_Int             solver_id, object_type;
    HYPRE_Int             print_system;
+   HYPRE_Int             direct_parcsr;
    HYPRE_Int             cosine;
    HYPRE_Real            scale;
    HYPRE_Int             read_fromfile_flag = 0;
@@ -2483,6 +2485,7 @@ main( hypre_int argc,
 
    solver_id = 39;
    print_system = 0;
+   direct_parcsr = 0;
    cosine = 1;
    skip = 0;
    n_pre  = 1;
@@ -2674,6 +2677,11 @@ main( hypre_int argc,
          arg_index++;
          print_system = 1;
       }
+      else if ( strcmp(argv[arg_index], "-direct_parcsr") == 0 )
+      {
+         arg_index++;
+         direct_parcsr = 1;
+      }
       else if ( strcmp(argv[arg_index], "-rhsfromcosine") == 0 )
       {
          arg_index++;
@@ -3140,6 +3148,7 @@ main( hypre_int argc,
       {
          HYPRE_SStructMatrixSetObjectType(A, object_type);
       }
+      HYPRE_SStructMatrixSetDirectParCSR(A, direct_parcsr);
 
       HYPRE_SStructMatrixInitialize(A);
 
@@ -31,6 +31,24 @@ HYPRE_SetSpMVUseVendor( HYPRE_Int use_vendor )
    return hypre_SetSpMVUseVendor(use_vendor);
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_SetSpMVUseSell
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetSpMVUseSell( HYPRE_Int use_sell )
+{
+   return hypre_SetSpMVUseSell(use_sell);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetDataExchangeAlgorithm
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetDataExchangeAlgorithm( HYPRE_Int value )
+{
+   return hypre_SetDataExchangeAlgorithm(value);
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_SetSpGemmUseVendor
  *--------------------------------------------------------------------------*/
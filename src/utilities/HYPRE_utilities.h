@@ -231,11 +231,32 @@ HYPRE_Int HYPRE_SetGPUMemoryPoolSize(HYPRE_Int bin_growth, HYPRE_Int min_bin, HY
 
 HYPRE_Int HYPRE_SetSpTransUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int HYPRE_SetSpMVUseVendor( HYPRE_Int use_vendor );
+/* Use SELL-C-sigma copies of the CSR blocks in host matvecs (off by default).
+ * The copies are built on first use and dropped whenever the matrix changes
+ * through the IJ interface.  Code writing hypre_CSRMatrixData directly must
+ * call hypre_CSRMatrixInvalidateCopies first. */
+HYPRE_Int HYPRE_SetSpMVUseSell( HYPRE_Int use_sell );
+/* Termination algorithm of the sparse data exchanges used to build
+ * communication packages: 0 = binary tree (default), 1 = NBX (synchronous
+ * sends plus a nonblocking barrier; needs MPI-3, otherwise 0 is used) */
+HYPRE_Int HYPRE_SetDataExchangeAlgorithm( HYPRE_Int value );
 /* Backwards compatibility with HYPRE_SetSpGemmUseCusparse() */
 #define HYPRE_SetSpGemmUseCusparse(use_vendor) HYPRE_SetSpGemmUseVendor(use_vendor)
 HYPRE_Int HYPRE_SetSpGemmUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int HYPRE_SetUseGpuRand( HYPRE_Int use_curand );
 
+/*--------------------------------------------------------------------------
+ * HYPRE tracing
+ *--------------------------------------------------------------------------*/
+
+/* Set the trace level: 0 = off (default), 1 = per-region totals of time,
+ * bytes, nonzeros, messages and MPI wait time, 2 = also record a timeline.
+ * Setting the level discards any trace collected so far */
+HYPRE_Int HYPRE_SetTraceLevel( HYPRE_Int level );
+
+/* Write the trace of this rank to 'filename.<rank as %05d>' in Chrome trace format */
+HYPRE_Int HYPRE_PrintTrace( const char *filename );
+
 #ifdef __cplusplus
 }
 #endif
@@ -39,6 +39,7 @@ typedef unsigned long long int hypre_ulonglongint;
 
 /* This allows us to consistently avoid 'double' throughout hypre */
 typedef double                 hypre_double;
+typedef float                  hypre_float;
 
 /*--------------------------------------------------------------------------
  * Define various functions
@@ -229,6 +230,7 @@ extern "C" {
 #define MPI_Wtime           hypre_MPI_Wtime
 #define MPI_Wtick           hypre_MPI_Wtick
 #define MPI_Barrier         hypre_MPI_Barrier
+#define MPI_Ibarrier        hypre_MPI_Ibarrier
 #define MPI_Comm_create     hypre_MPI_Comm_create
 #define MPI_Comm_dup        hypre_MPI_Comm_dup
 #define MPI_Comm_f2c        hypre_MPI_Comm_f2c
@@ -253,6 +255,7 @@ extern "C" {
 #define MPI_Send            hypre_MPI_Send
 #define MPI_Recv            hypre_MPI_Recv
 #define MPI_Isend           hypre_MPI_Isend
+#define MPI_Issend          hypre_MPI_Issend
 #define MPI_Irecv           hypre_MPI_Irecv
 #define MPI_Send_init       hypre_MPI_Send_init
 #define MPI_Recv_init       hypre_MPI_Recv_init
@@ -266,6 +269,7 @@ extern "C" {
 #define MPI_Waitall         hypre_MPI_Waitall
 #define MPI_Waitany         hypre_MPI_Waitany
 #define MPI_Allreduce       hypre_MPI_Allreduce
+#define MPI_Iallreduce      hypre_MPI_Iallreduce
 #define MPI_Reduce          hypre_MPI_Reduce
 #define MPI_Scan            hypre_MPI_Scan
 #define MPI_Request_free    hypre_MPI_Request_free
@@ -402,6 +406,7 @@ HYPRE_Int hypre_MPI_Abort( hypre_MPI_Comm comm, HYPRE_Int errorcode );
 HYPRE_Real hypre_MPI_Wtime( void );
 HYPRE_Real hypre_MPI_Wtick( void );
 HYPRE_Int hypre_MPI_Barrier( hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Ibarrier( hypre_MPI_Comm comm, hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Comm_create( hypre_MPI_Comm comm, hypre_MPI_Group group,
                                  hypre_MPI_Comm *newcomm );
 HYPRE_Int hypre_MPI_Comm_dup( hypre_MPI_Comm comm, hypre_MPI_Comm *newcomm );
@@ -445,6 +450,8 @@ HYPRE_Int hypre_MPI_Recv( void *buf, HYPRE_Int count, hypre_MPI_Datatype datatyp
                           HYPRE_Int tag, hypre_MPI_Comm comm, hypre_MPI_Status *status );
 HYPRE_Int hypre_MPI_Isend( void *buf, HYPRE_Int count, hypre_MPI_Datatype datatype, HYPRE_Int dest,
                            HYPRE_Int tag, hypre_MPI_Comm comm, hypre_MPI_Request *request );
+HYPRE_Int hypre_MPI_Issend( void *buf, HYPRE_Int count, hypre_MPI_Datatype datatype, HYPRE_Int dest,
+                            HYPRE_Int tag, hypre_MPI_Comm comm, hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Irecv( void *buf, HYPRE_Int count, hypre_MPI_Datatype datatype,
                            HYPRE_Int source, HYPRE_Int tag, hypre_MPI_Comm comm, hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Send_init( void *buf, HYPRE_Int count, hypre_MPI_Datatype datatype,
@@ -468,6 +475,9 @@ HYPRE_Int hypre_MPI_Waitany( HYPRE_Int count, hypre_MPI_Request *array_of_reques
                              HYPRE_Int *index, hypre_MPI_Status *status );
 HYPRE_Int hypre_MPI_Allreduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
                                hypre_MPI_Datatype datatype, hypre_MPI_Op op, hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Iallreduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
+                                hypre_MPI_Datatype datatype, hypre_MPI_Op op, hypre_MPI_Comm comm,
+                                hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Reduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
                             hypre_MPI_Datatype datatype, hypre_MPI_Op op, HYPRE_Int root, hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Scan( void *sendbuf, void *recvbuf, HYPRE_Int count,
@@ -1202,9 +1212,67 @@ HYPRE_Int hypre_DataExchangeList(HYPRE_Int num_contacts, HYPRE_Int *contact_proc
                                  void *contact_send_buf, HYPRE_Int *contact_send_buf_starts, HYPRE_Int contact_obj_size,
                                  HYPRE_Int response_obj_size, hypre_DataExchangeResponse *response_obj, HYPRE_Int max_response_size,
                                  HYPRE_Int rnum, MPI_Comm comm, void **p_response_recv_buf, HYPRE_Int **p_response_recv_buf_starts);
+HYPRE_Int hypre_DataExchangeListNBX(HYPRE_Int num_contacts, HYPRE_Int *contact_proc_list,
+                                    void *contact_send_buf, HYPRE_Int *contact_send_buf_starts, HYPRE_Int contact_obj_size,
+                                    HYPRE_Int response_obj_size, hypre_DataExchangeResponse *response_obj, HYPRE_Int max_response_size,
+                                    HYPRE_Int rnum, MPI_Comm comm, void **p_response_recv_buf, HYPRE_Int **p_response_recv_buf_starts);
 
 #endif /* end of header */
 
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Header file for hierarchical region tracing
+ *
+ * The tracer is always compiled in and switched on at runtime with
+ * HYPRE_SetTraceLevel().  Regions are opened and closed through the
+ * HYPRE_ANNOTATE_* macros (see caliper_instrumentation.h), so everything that
+ * is already annotated for Caliper is traced as well.  Regions are keyed by
+ * name and multigrid level and accumulate call counts, inclusive and
+ * exclusive wall time, and a small set of counters (bytes moved, nonzeros
+ * touched, messages and message bytes sent, and time spent waiting in MPI).
+ *
+ *    level 0 : off (default); every hook reduces to a single branch
+ *    level 1 : per-region aggregates only
+ *    level 2 : aggregates plus a timeline of region instances
+ *
+ * Only the master thread outside of OpenMP parallel regions records data.
+ *
+ *****************************************************************************/
+
+#ifndef hypre_TRACE_HEADER
+#define hypre_TRACE_HEADER
+
+#define HYPRE_TRACE_BYTES            0   /* bytes moved by kernels */
+#define HYPRE_TRACE_NNZ              1   /* matrix nonzeros touched by kernels */
+#define HYPRE_TRACE_MSGS             2   /* point-to-point messages sent */
+#define HYPRE_TRACE_MSG_BYTES        3   /* point-to-point bytes sent */
+#define HYPRE_TRACE_MPI_WAIT         4   /* seconds spent in MPI waits/reductions */
+#define HYPRE_TRACE_NUM_COUNTERS     5
+
+#define HYPRE_TRACE_NAME_MAX       256
+#define HYPRE_TRACE_MAX_DEPTH       64
+#define HYPRE_TRACE_LEVEL_INHERIT   -1
+
+extern HYPRE_Int hypre__trace_level;
+
+#define hypre_TraceEnabled()  (hypre__trace_level > 0)
+
+#define hypre_TraceCounter(counter, value)\
+{\
+   if (hypre_TraceEnabled())\
+   {\
+      hypre_TraceAddCounter(counter, (HYPRE_Real) (value));\
+   }\
+}
+
+#endif
 /******************************************************************************
  * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
  * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
@@ -1223,6 +1291,57 @@ HYPRE_Int hypre_DataExchangeList(HYPRE_Int num_contacts, HYPRE_Int *contact_proc
 
 #include "HYPRE_config.h"
 
+/*--------------------------------------------------------------------------
+ * Tracing hooks (see trace.h); each one is a single branch when tracing is off
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_TRACE_FUNC_BEGIN \
+{\
+   if (hypre_TraceEnabled())\
+   {\
+      hypre_TraceRegionBegin(__func__, HYPRE_TRACE_LEVEL_INHERIT);\
+   }\
+}
+#define HYPRE_TRACE_FUNC_END \
+{\
+   if (hypre_TraceEnabled())\
+   {\
+      hypre_TraceRegionEnd(__func__);\
+   }\
+}
+#define HYPRE_TRACE_REGION_BEGIN(...)\
+{\
+   if (hypre_TraceEnabled())\
+   {\
+      char hypre__tracename[HYPRE_TRACE_NAME_MAX];\
+      hypre_sprintf(hypre__tracename, __VA_ARGS__);\
+      hypre_TraceRegionBegin(hypre__tracename, HYPRE_TRACE_LEVEL_INHERIT);\
+   }\
+}
+#define HYPRE_TRACE_REGION_END(...)\
+{\
+   if (hypre_TraceEnabled())\
+   {\
+      char hypre__tracename[HYPRE_TRACE_NAME_MAX];\
+      hypre_sprintf(hypre__tracename, __VA_ARGS__);\
+      hypre_TraceRegionEnd(hypre__tracename);\
+   }\
+}
+#define HYPRE_TRACE_MGLEVEL_BEGIN(lvl)\
+{\
+   if (hypre_TraceEnabled())\
+   {\
+      hypre_TraceRegionBegin("MG level", (HYPRE_Int) (lvl));\
+   }\
+}
+#define HYPRE_TRACE_MGLEVEL_END(lvl)\
+{\
+   if (hypre_TraceEnabled())\
+   {\
+      hypre_TraceRegionEnd("MG level");\
+   }\
+}
+
 #ifdef HYPRE_USING_CALIPER
 
 #ifdef __cplusplus
@@ -1239,8 +1358,16 @@ extern "C++"
 static char hypre__levelname[16];
 static char hypre__markname[1024];
 
-#define HYPRE_ANNOTATE_FUNC_BEGIN          CALI_MARK_FUNCTION_BEGIN
-#define HYPRE_ANNOTATE_FUNC_END            CALI_MARK_FUNCTION_END
+#define HYPRE_ANNOTATE_FUNC_BEGIN \
+{\
+   CALI_MARK_FUNCTION_BEGIN;\
+   HYPRE_TRACE_FUNC_BEGIN;\
+}
+#define HYPRE_ANNOTATE_FUNC_END \
+{\
+   HYPRE_TRACE_FUNC_END;\
+   CALI_MARK_FUNCTION_END;\
+}
 #define HYPRE_ANNOTATE_LOOP_BEGIN(id, str) CALI_MARK_LOOP_BEGIN(id, str)
 #define HYPRE_ANNOTATE_LOOP_END(id)        CALI_MARK_LOOP_END(id)
 #define HYPRE_ANNOTATE_ITER_BEGIN(id, it)  CALI_MARK_ITERATION_BEGIN(id, it)
@@ -1249,9 +1376,11 @@ static char hypre__markname[1024];
 {\
    hypre_sprintf(hypre__markname, __VA_ARGS__);\
    CALI_MARK_BEGIN(hypre__markname);\
+   HYPRE_TRACE_REGION_BEGIN(__VA_ARGS__);\
 }
 #define HYPRE_ANNOTATE_REGION_END(...)\
 {\
+   HYPRE_TRACE_REGION_END(__VA_ARGS__);\
    hypre_sprintf(hypre__markname, __VA_ARGS__);\
    CALI_MARK_END(hypre__markname);\
 }
@@ -1259,26 +1388,28 @@ static char hypre__markname[1024];
 {\
    hypre_sprintf(hypre__levelname, "MG level %d", lvl);\
    CALI_MARK_BEGIN(hypre__levelname);\
+   HYPRE_TRACE_MGLEVEL_BEGIN(lvl);\
 }
 #define HYPRE_ANNOTATE_MGLEVEL_END(lvl)\
 {\
+   HYPRE_TRACE_MGLEVEL_END(lvl);\
    hypre_sprintf(hypre__levelname, "MG level %d", lvl);\
    CALI_MARK_END(hypre__levelname);\
 }
 
 #else
 
-#define HYPRE_ANNOTATE_FUNC_BEGIN
-#define HYPRE_ANNOTATE_FUNC_END
+#define HYPRE_ANNOTATE_FUNC_BEGIN          HYPRE_TRACE_FUNC_BEGIN
+#define HYPRE_ANNOTATE_FUNC_END            HYPRE_TRACE_FUNC_END
 #define HYPRE_ANNOTATE_LOOP_BEGIN(id, str)
 #define HYPRE_ANNOTATE_LOOP_END(id)
 #define HYPRE_ANNOTATE_ITER_BEGIN(id, it)
 #define HYPRE_ANNOTATE_ITER_END(id)
-#define HYPRE_ANNOTATE_REGION_BEGIN(...)
-#define HYPRE_ANNOTATE_REGION_END(...)
+#define HYPRE_ANNOTATE_REGION_BEGIN(...)   HYPRE_TRACE_REGION_BEGIN(__VA_ARGS__)
+#define HYPRE_ANNOTATE_REGION_END(...)     HYPRE_TRACE_REGION_END(__VA_ARGS__)
 #define HYPRE_ANNOTATE_MAX_MGLEVEL(lvl)
-#define HYPRE_ANNOTATE_MGLEVEL_BEGIN(lvl)
-#define HYPRE_ANNOTATE_MGLEVEL_END(lvl)
+#define HYPRE_ANNOTATE_MGLEVEL_BEGIN(lvl)  HYPRE_TRACE_MGLEVEL_BEGIN(lvl)
+#define HYPRE_ANNOTATE_MGLEVEL_END(lvl)    HYPRE_TRACE_MGLEVEL_END(lvl)
 
 #endif
 
@@ -1308,6 +1439,10 @@ typedef struct
    HYPRE_MemoryLocation   memory_location;
    HYPRE_ExecutionPolicy  default_exec_policy;
    HYPRE_ExecutionPolicy  struct_exec_policy;
+   /* host SpMV options */
+   HYPRE_Int              spmv_use_sell;
+   /* sparse data exchange algorithm (see exchange_data.c) */
+   HYPRE_Int              data_exchange_algorithm;
 #if defined(HYPRE_USING_GPU)
    hypre_DeviceData      *device_data;
    /* device G-S options */
@@ -1338,6 +1473,8 @@ typedef struct
 #define hypre_HandleMemoryLocation(hypre_handle)                 ((hypre_handle) -> memory_location)
 #define hypre_HandleDefaultExecPolicy(hypre_handle)              ((hypre_handle) -> default_exec_policy)
 #define hypre_HandleStructExecPolicy(hypre_handle)               ((hypre_handle) -> struct_exec_policy)
+#define hypre_HandleSpMVUseSell(hypre_handle)                    ((hypre_handle) -> spmv_use_sell)
+#define hypre_HandleDataExchangeAlgorithm(hypre_handle)          ((hypre_handle) -> data_exchange_algorithm)
 #define hypre_HandleDeviceData(hypre_handle)                     ((hypre_handle) -> device_data)
 #define hypre_HandleDeviceGSMethod(hypre_handle)                 ((hypre_handle) -> device_gs_method)
 
@@ -1643,6 +1780,10 @@ void hypre_prefix_sum_triple(HYPRE_Int *in_out1, HYPRE_Int *sum1, HYPRE_Int *in_
 void hypre_prefix_sum_multiple(HYPRE_Int *in_out, HYPRE_Int *sum, HYPRE_Int n,
                                HYPRE_Int *workspace);
 
+/* dense_batched.c */
+HYPRE_Int hypre_DenseInverseBatched ( HYPRE_Int n, HYPRE_Int lda, HYPRE_Int stride,
+                                      HYPRE_Int num_blocks, HYPRE_Complex *A );
+
 /* hopscotch_hash.c */
 
 #ifdef HYPRE_USING_OPENMP
@@ -1842,6 +1983,8 @@ HYPRE_Int hypre_ForceSyncComputeStream(hypre_Handle *hypre_handle);
 /* handle.c */
 HYPRE_Int hypre_SetSpTransUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int hypre_SetSpMVUseVendor( HYPRE_Int use_vendor );
+HYPRE_Int hypre_SetSpMVUseSell( HYPRE_Int use_sell );
+HYPRE_Int hypre_SetDataExchangeAlgorithm( HYPRE_Int value );
 HYPRE_Int hypre_SetSpGemmUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int hypre_SetSpGemmAlgorithm( HYPRE_Int value );
 HYPRE_Int hypre_SetSpGemmRownnzEstimateMethod( HYPRE_Int value );
@@ -1853,6 +1996,15 @@ HYPRE_Int hypre_SetGaussSeidelMethod( HYPRE_Int gs_method );
 HYPRE_Int hypre_SetUserDeviceMalloc(GPUMallocFunc func);
 HYPRE_Int hypre_SetUserDeviceMfree(GPUMfreeFunc func);
 
+/* trace.c */
+HYPRE_Int hypre_TraceRegionBegin( const char *name, HYPRE_Int level );
+HYPRE_Int hypre_TraceRegionEnd( const char *name );
+HYPRE_Int hypre_TraceAddCounter( HYPRE_Int counter, HYPRE_Real value );
+HYPRE_Int hypre_TraceAddMatvec( HYPRE_Int num_rows, HYPRE_Int num_cols, HYPRE_Int num_nonzeros,
+                                HYPRE_Int num_vectors );
+HYPRE_Int hypre_TraceDestroy( void );
+HYPRE_Int hypre_TracePrint( const char *filename );
+
 /* int_array.c */
 hypre_IntArray* hypre_IntArrayCreate( HYPRE_Int size );
 HYPRE_Int hypre_IntArrayDestroy( hypre_IntArray *array );
@@ -16,6 +16,57 @@
 
 #include "HYPRE_config.h"
 
+/*--------------------------------------------------------------------------
+ * Tracing hooks (see trace.h); each one is a single branch when tracing is off
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_TRACE_FUNC_BEGIN \
+{\
+   if (hypre_TraceEnabled())\
+   {\
+      hypre_TraceRegionBegin(__func__, HYPRE_TRACE_LEVEL_INHERIT);\
+   }\
+}
+#define HYPRE_TRACE_FUNC_END \
+{\
+   if (hypre_TraceEnabled())\
+   {\
+      hypre_TraceRegionEnd(__func__);\
+   }\
+}
+#define HYPRE_TRACE_REGION_BEGIN(...)\
+{\
+   if (hypre_TraceEnabled())\
+   {\
+      char hypre__tracename[HYPRE_TRACE_NAME_MAX];\
+      hypre_sprintf(hypre__tracename, __VA_ARGS__);\
+      hypre_TraceRegionBegin(hypre__tracename, HYPRE_TRACE_LEVEL_INHERIT);\
+   }\
+}
+#define HYPRE_TRACE_REGION_END(...)\
+{\
+   if (hypre_TraceEnabled())\
+   {\
+      char hypre__tracename[HYPRE_TRACE_NAME_MAX];\
+      hypre_sprintf(hypre__tracename, __VA_ARGS__);\
+      hypre_TraceRegionEnd(hypre__tracename);\
+   }\
+}
+#define HYPRE_TRACE_MGLEVEL_BEGIN(lvl)\
+{\
+   if (hypre_TraceEnabled())\
+   {\
+      hypre_TraceRegionBegin("MG level", (HYPRE_Int) (lvl));\
+   }\
+}
+#define HYPRE_TRACE_MGLEVEL_END(lvl)\
+{\
+   if (hypre_TraceEnabled())\
+   {\
+      hypre_TraceRegionEnd("MG level");\
+   }\
+}
+
 #ifdef HYPRE_USING_CALIPER
 
 #ifdef __cplusplus
@@ -32,8 +83,16 @@ extern "C++"
 static char hypre__levelname[16];
 static char hypre__markname[1024];
 
-#define HYPRE_ANNOTATE_FUNC_BEGIN          CALI_MARK_FUNCTION_BEGIN
-#define HYPRE_ANNOTATE_FUNC_END            CALI_MARK_FUNCTION_END
+#define HYPRE_ANNOTATE_FUNC_BEGIN \
+{\
+   CALI_MARK_FUNCTION_BEGIN;\
+   HYPRE_TRACE_FUNC_BEGIN;\
+}
+#define HYPRE_ANNOTATE_FUNC_END \
+{\
+   HYPRE_TRACE_FUNC_END;\
+   CALI_MARK_FUNCTION_END;\
+}
 #define HYPRE_ANNOTATE_LOOP_BEGIN(id, str) CALI_MARK_LOOP_BEGIN(id, str)
 #define HYPRE_ANNOTATE_LOOP_END(id)        CALI_MARK_LOOP_END(id)
 #define HYPRE_ANNOTATE_ITER_BEGIN(id, it)  CALI_MARK_ITERATION_BEGIN(id, it)
@@ -42,9 +101,11 @@ static char hypre__markname[1024];
 {\
    hypre_sprintf(hypre__markname, __VA_ARGS__);\
    CALI_MARK_BEGIN(hypre__markname);\
+   HYPRE_TRACE_REGION_BEGIN(__VA_ARGS__);\
 }
 #define HYPRE_ANNOTATE_REGION_END(...)\
 {\
+   HYPRE_TRACE_REGION_END(__VA_ARGS__);\
    hypre_sprintf(hypre__markname, __VA_ARGS__);\
    CALI_MARK_END(hypre__markname);\
 }
@@ -52,26 +113,28 @@ static char hypre__markname[1024];
 {\
    hypre_sprintf(hypre__levelname, "MG level %d", lvl);\
    CALI_MARK_BEGIN(hypre__levelname);\
+   HYPRE_TRACE_MGLEVEL_BEGIN(lvl);\
 }
 #define HYPRE_ANNOTATE_MGLEVEL_END(lvl)\
 {\
+   HYPRE_TRACE_MGLEVEL_END(lvl);\
    hypre_sprintf(hypre__levelname, "MG level %d", lvl);\
    CALI_MARK_END(hypre__levelname);\
 }
 
 #else
 
-#define HYPRE_ANNOTATE_FUNC_BEGIN
-#define HYPRE_ANNOTATE_FUNC_END
+#define HYPRE_ANNOTATE_FUNC_BEGIN          HYPRE_TRACE_FUNC_BEGIN
+#define HYPRE_ANNOTATE_FUNC_END            HYPRE_TRACE_FUNC_END
 #define HYPRE_ANNOTATE_LOOP_BEGIN(id, str)
 #define HYPRE_ANNOTATE_LOOP_END(id)
 #define HYPRE_ANNOTATE_ITER_BEGIN(id, it)
 #define HYPRE_ANNOTATE_ITER_END(id)
-#define HYPRE_ANNOTATE_REGION_BEGIN(...)
-#define HYPRE_ANNOTATE_REGION_END(...)
+#define HYPRE_ANNOTATE_REGION_BEGIN(...)   HYPRE_TRACE_REGION_BEGIN(__VA_ARGS__)
+#define HYPRE_ANNOTATE_REGION_END(...)     HYPRE_TRACE_REGION_END(__VA_ARGS__)
 #define HYPRE_ANNOTATE_MAX_MGLEVEL(lvl)
-#define HYPRE_ANNOTATE_MGLEVEL_BEGIN(lvl)
-#define HYPRE_ANNOTATE_MGLEVEL_END(lvl)
+#define HYPRE_ANNOTATE_MGLEVEL_BEGIN(lvl)  HYPRE_TRACE_MGLEVEL_BEGIN(lvl)
+#define HYPRE_ANNOTATE_MGLEVEL_END(lvl)    HYPRE_TRACE_MGLEVEL_END(lvl)
 
 #endif
 
@@ -0,0 +1,178 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Batched kernels for many small dense matrices
+ *
+ * These routines work on a sequence of equally sized column-major blocks
+ * stored with a fixed stride, as found in block-diagonal smoothers and
+ * block-Jacobi scalings. Calling LAPACK once per block is dominated by call
+ * and workspace overhead when the blocks are small, so the blocks are
+ * processed here in a single threaded loop without auxiliary workspace.
+ *
+ *****************************************************************************/
+
+#include <math.h>
+#include "_hypre_utilities.h"
+
+#define HYPRE_DENSE_BATCHED_STACK_MAX 64
+
+/*--------------------------------------------------------------------------
+ * hypre_DenseInverseBlock
+ *
+ * In-place inversion of the n x n column-major matrix A (leading dimension
+ * lda) by Gauss-Jordan elimination with partial pivoting. piv must hold n
+ * entries. Returns 1 if A is singular, 0 otherwise.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_DenseInverseBlock( HYPRE_Int      n,
+                         HYPRE_Int      lda,
+                         HYPRE_Complex *A,
+                         HYPRE_Int     *piv )
+{
+   HYPRE_Int      i, j, k, p;
+   HYPRE_Real     amax, aval;
+   HYPRE_Complex  tmp, pinv, factor;
+
+   for (k = 0; k < n; k++)
+   {
+      /* Find pivot in column k */
+      p    = k;
+      amax = hypre_cabs(A[k + k * lda]);
+      for (i = k + 1; i < n; i++)
+      {
+         aval = hypre_cabs(A[i + k * lda]);
+         if (aval > amax)
+         {
+            amax = aval;
+            p = i;
+         }
+      }
+
+      if (amax == 0.0)
+      {
+         return 1;
+      }
+
+      piv[k] = p;
+      if (p != k)
+      {
+         for (j = 0; j < n; j++)
+         {
+            tmp              = A[k + j * lda];
+            A[k + j * lda]   = A[p + j * lda];
+            A[p + j * lda]   = tmp;
+         }
+      }
+
+      /* Scale pivot row */
+      pinv = 1.0 / A[k + k * lda];
+      A[k + k * lda] = 1.0;
+      for (j = 0; j < n; j++)
+      {
+         A[k + j * lda] *= pinv;
+      }
+
+      /* Eliminate column k from all other rows */
+      for (i = 0; i < n; i++)
+      {
+         if (i == k)
+         {
+            continue;
+         }
+
+         factor = A[i + k * lda];
+         A[i + k * lda] = 0.0;
+         for (j = 0; j < n; j++)
+         {
+            A[i + j * lda] -= factor * A[k + j * lda];
+         }
+      }
+   }
+
+   /* Undo the row interchanges by swapping columns in reverse order */
+   for (k = n - 1; k >= 0; k--)
+   {
+      p = piv[k];
+      if (p != k)
+      {
+         for (i = 0; i < n; i++)
+         {
+            tmp              = A[i + k * lda];
+            A[i + k * lda]   = A[i + p * lda];
+            A[i + p * lda]   = tmp;
+         }
+      }
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_DenseInverseBatched
+ *
+ * Inverts in place num_blocks dense n x n column-major matrices with leading
+ * dimension lda. Block b starts at A + b * stride. A singular block is left
+ * partially overwritten and reported through the error flag.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_DenseInverseBatched( HYPRE_Int      n,
+                           HYPRE_Int      lda,
+                           HYPRE_Int      stride,
+                           HYPRE_Int      num_blocks,
+                           HYPRE_Complex *A )
+{
+   HYPRE_Int  num_singular = 0;
+
+   if (n <= 0 || num_blocks <= 0)
+   {
+      return hypre_error_flag;
+   }
+
+   if (lda < n)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel reduction(+:num_singular)
+#endif
+   {
+      HYPRE_Int   piv_stack[HYPRE_DENSE_BATCHED_STACK_MAX];
+      HYPRE_Int  *piv = piv_stack;
+      HYPRE_Int   b;
+
+      if (n > HYPRE_DENSE_BATCHED_STACK_MAX)
+      {
+         piv = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+      }
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (b = 0; b < num_blocks; b++)
+      {
+         num_singular += hypre_DenseInverseBlock(n, lda, A + (size_t) b * stride, piv);
+      }
+
+      if (piv != piv_stack)
+      {
+         hypre_TFree(piv, HYPRE_MEMORY_HOST);
+      }
+   }
+
+   if (num_singular)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Singular block in hypre_DenseInverseBatched!\n");
+   }
+
+   return hypre_error_flag;
+}
@@ -14,6 +14,13 @@
 
 #include "_hypre_utilities.h"
 
+/* The NBX exchange needs nonblocking barriers, i.e. MPI-3 */
+#if !defined(HYPRE_SEQUENTIAL) && defined(MPI_VERSION)
+#if MPI_VERSION >= 3
+#define hypre_DATA_EXCHANGE_HAVE_NBX
+#endif
+#endif
+
 /*---------------------------------------------------
  * hypre_CreateBinaryTree()
  * Get the processors position in the binary tree (i.e.,
@@ -184,6 +191,17 @@ HYPRE_Int hypre_DataExchangeList(HYPRE_Int num_contacts,
    const HYPRE_Int term_tag =  1004 * rnum;
    const HYPRE_Int post_tag = 1006 * rnum;
 
+#if defined(hypre_DATA_EXCHANGE_HAVE_NBX)
+   if (hypre_HandleDataExchangeAlgorithm(hypre_handle()) == 1)
+   {
+      return hypre_DataExchangeListNBX(num_contacts, contact_proc_list,
+                                       contact_send_buf, contact_send_buf_starts,
+                                       contact_obj_size, response_obj_size,
+                                       response_obj, max_response_size, rnum, comm,
+                                       p_response_recv_buf, p_response_recv_buf_starts);
+   }
+#endif
+
    hypre_MPI_Comm_size(comm, &num_procs );
    hypre_MPI_Comm_rank(comm, &myid );
 
@@ -580,3 +598,308 @@ HYPRE_Int hypre_DataExchangeList(HYPRE_Int num_contacts,
 
    return hypre_error_flag;
 }
+
+/*---------------------------------------------------
+ * hypre_DataExchangeListNBX()
+ * Same arguments, callbacks and output as hypre_DataExchangeList(),
+ * but termination is detected with the nonblocking consensus
+ * ("NBX") algorithm of Hoefler, Siebert and Lumsdaine (PPoPP'10):
+ * contacts go out with synchronous-mode sends, and once all of them
+ * have been matched the process enters a nonblocking barrier.  When
+ * the barrier completes, every contact in the communicator has been
+ * received and answered, so a process is done as soon as it also has
+ * all of its own responses.  A final barrier separates consecutive
+ * exchanges, which use the same tags.  This replaces the O(log P)
+ * rounds of point-to-point termination messages with two barriers.
+ *
+ * Each response is sent as one message of exactly its own length and
+ * received into a single buffer after a probe, so there is no size
+ * overhead appended to the message and no second "post" message when
+ * a response is larger than max_response_size.  max_response_size is
+ * only used for the initial size of the buffer handed to
+ * fill_response().
+ *----------------------------------------------------*/
+
+HYPRE_Int hypre_DataExchangeListNBX(HYPRE_Int num_contacts,
+                                    HYPRE_Int *contact_proc_list,
+                                    void *contact_send_buf,
+                                    HYPRE_Int *contact_send_buf_starts,
+                                    HYPRE_Int contact_obj_size,
+                                    HYPRE_Int response_obj_size,
+                                    hypre_DataExchangeResponse *response_obj,
+                                    HYPRE_Int max_response_size,
+                                    HYPRE_Int rnum, MPI_Comm comm,
+                                    void **p_response_recv_buf,
+                                    HYPRE_Int **p_response_recv_buf_starts)
+{
+   HYPRE_Int  i, j, k;
+   HYPRE_Int  proc, size, contact_size;
+   HYPRE_Int  contact_flag, response_flag;
+   HYPRE_Int  contacts_complete, barrier_active, barrier_complete;
+   HYPRE_Int  num_responses;
+   HYPRE_Int  overhead;
+   HYPRE_Int  response_message_size = 0;
+
+   void      *start_ptr = NULL, *index_ptr = NULL;
+   void      *send_response_buf = NULL;
+   void      *recv_contact_buf = NULL;
+   HYPRE_Int  recv_contact_buf_size = 0;
+
+   /* all responses are received back to back into one buffer */
+   char      *recv_pool = NULL;
+   HYPRE_Int  recv_pool_size = 0, recv_pool_storage = 0;
+   HYPRE_Int *response_offsets, *response_sizes;
+   HYPRE_Int *sorted_procs, *sorted_index;
+
+   void      *response_recv_buf = NULL;
+   HYPRE_Int *response_recv_buf_starts = NULL;
+
+   /* copies of the responses we send, kept until the sends complete */
+   void     **send_array = NULL;
+   HYPRE_Int  send_array_storage = 0;
+   HYPRE_Int  send_array_size = 0;
+
+   hypre_MPI_Request *contact_requests = NULL;
+   hypre_MPI_Request *send_requests = NULL;
+   hypre_MPI_Request  barrier_request;
+   hypre_MPI_Status   status, fill_status;
+
+   const HYPRE_Int contact_tag = 1000 * rnum;
+   const HYPRE_Int response_tag = 1002 * rnum;
+
+   /* ---------initializations ----------------*/
+
+   if (!response_obj_size) { response_obj_size = sizeof(HYPRE_Int); }
+   if (!contact_obj_size) { contact_obj_size = sizeof(HYPRE_Int); }
+
+   /* fill_response() may rely on this when it has to grow the buffer */
+   overhead = ceil((HYPRE_Real) sizeof(HYPRE_Int) / response_obj_size);
+
+   response_obj->send_response_overhead = overhead;
+   response_obj->send_response_storage = max_response_size;
+
+   send_response_buf = hypre_CTAlloc(char, (max_response_size + overhead) * response_obj_size,
+                                     HYPRE_MEMORY_HOST);
+
+   response_offsets = hypre_TAlloc(HYPRE_Int, num_contacts, HYPRE_MEMORY_HOST);
+   response_sizes   = hypre_TAlloc(HYPRE_Int, num_contacts, HYPRE_MEMORY_HOST);
+   sorted_procs     = hypre_TAlloc(HYPRE_Int, num_contacts, HYPRE_MEMORY_HOST);
+   sorted_index     = hypre_TAlloc(HYPRE_Int, num_contacts, HYPRE_MEMORY_HOST);
+   contact_requests = hypre_TAlloc(hypre_MPI_Request, num_contacts, HYPRE_MEMORY_HOST);
+
+   /* responses are matched to contacts by the source process */
+   for (i = 0; i < num_contacts; i++)
+   {
+      response_sizes[i] = -1;
+      sorted_procs[i]   = contact_proc_list[i];
+      sorted_index[i]   = i;
+   }
+   hypre_qsort2i(sorted_procs, sorted_index, 0, num_contacts - 1);
+
+   /*-------------SEND CONTACTS--------------------------------*/
+
+   start_ptr = contact_send_buf;
+   for (i = 0; i < num_contacts; i++)
+   {
+      size = contact_send_buf_starts[i + 1] - contact_send_buf_starts[i];
+      hypre_MPI_Issend(start_ptr, size * contact_obj_size, hypre_MPI_BYTE,
+                       contact_proc_list[i], contact_tag, comm, &contact_requests[i]);
+      start_ptr = (void *) ((char *) start_ptr + (size * contact_obj_size));
+   }
+
+   /*---------PROBE LOOP-----------------------------------------*/
+
+   contacts_complete = (num_contacts == 0);
+   barrier_active    = 0;
+   barrier_complete  = 0;
+   num_responses     = 0;
+
+   while (!barrier_complete || num_responses < num_contacts)
+   {
+      /* answer any contacts that have arrived */
+      hypre_MPI_Iprobe(hypre_MPI_ANY_SOURCE, contact_tag, comm,
+                       &contact_flag, &status);
+
+      while (contact_flag)
+      {
+         proc = status.hypre_MPI_SOURCE;
+         hypre_MPI_Get_count(&status, hypre_MPI_BYTE, &contact_size);
+         contact_size = contact_size / contact_obj_size;
+
+         if (contact_size > recv_contact_buf_size)
+         {
+            recv_contact_buf = hypre_TReAlloc((char*)recv_contact_buf,
+                                              char, contact_obj_size * contact_size, HYPRE_MEMORY_HOST);
+            recv_contact_buf_size = contact_size;
+         }
+
+         /* blocking: the response is filled and sent before we look at the
+            barrier again, which is what makes the termination check valid */
+         hypre_MPI_Recv(recv_contact_buf, contact_size * contact_obj_size,
+                        hypre_MPI_BYTE, proc, contact_tag, comm, &fill_status);
+
+         response_obj->fill_response(recv_contact_buf, contact_size, proc,
+                                     response_obj, comm, &send_response_buf,
+                                     &response_message_size);
+
+         if (send_array_size == send_array_storage)
+         {
+            send_array_storage += 20;
+            send_array = hypre_TReAlloc(send_array, void *, send_array_storage,
+                                        HYPRE_MEMORY_HOST);
+            send_requests = hypre_TReAlloc(send_requests, hypre_MPI_Request,
+                                           send_array_storage, HYPRE_MEMORY_HOST);
+         }
+
+         /* send_response_buf is reused for the next contact, so send a copy */
+         size = response_message_size * response_obj_size;
+         send_array[send_array_size] = NULL;
+         if (size > 0)
+         {
+            send_array[send_array_size] = hypre_TAlloc(char, size, HYPRE_MEMORY_HOST);
+            hypre_TMemcpy(send_array[send_array_size], send_response_buf, char, size,
+                          HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+         }
+         hypre_MPI_Isend(send_array[send_array_size], size, hypre_MPI_BYTE, proc,
+                         response_tag, comm, &send_requests[send_array_size]);
+         send_array_size++;
+
+         hypre_MPI_Iprobe(hypre_MPI_ANY_SOURCE, contact_tag, comm,
+                          &contact_flag, &status);
+      }
+
+      /* receive any responses that have arrived */
+      response_flag = 0;
+      if (num_responses < num_contacts)
+      {
+         hypre_MPI_Iprobe(hypre_MPI_ANY_SOURCE, response_tag, comm,
+                          &response_flag, &status);
+      }
+
+      while (response_flag)
+      {
+         proc = status.hypre_MPI_SOURCE;
+         hypre_MPI_Get_count(&status, hypre_MPI_BYTE, &size);
+
+         /* the first contact to proc that has no response yet; messages
+            between two processes are not overtaken, so repeated contacts
+            to the same process are answered in order */
+         j = hypre_BinarySearch(sorted_procs, proc, num_contacts);
+         while (j > 0 && sorted_procs[j - 1] == proc)
+         {
+            j--;
+         }
+         k = -1;
+         for (; j < num_contacts && sorted_procs[j] == proc; j++)
+         {
+            if (response_sizes[sorted_index[j]] < 0 &&
+                (k < 0 || sorted_index[j] < k))
+            {
+               k = sorted_index[j];
+            }
+         }
+
+         if (recv_pool_size + size > recv_pool_storage)
+         {
+            recv_pool_storage = hypre_max(2 * recv_pool_storage, recv_pool_size + size);
+            recv_pool = hypre_TReAlloc(recv_pool, char, recv_pool_storage, HYPRE_MEMORY_HOST);
+         }
+         hypre_MPI_Recv(recv_pool + recv_pool_size, size, hypre_MPI_BYTE, proc,
+                        response_tag, comm, &fill_status);
+
+         if (k < 0)
+         {
+            /* a response from a process we did not contact (or one too many):
+               the message is consumed and dropped */
+            hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                              "Unexpected response in hypre_DataExchangeListNBX\n");
+         }
+         else
+         {
+            response_offsets[k] = recv_pool_size;
+            response_sizes[k]   = size / response_obj_size;
+            recv_pool_size     += size;
+            num_responses++;
+         }
+
+         response_flag = 0;
+         if (num_responses < num_contacts)
+         {
+            hypre_MPI_Iprobe(hypre_MPI_ANY_SOURCE, response_tag, comm,
+                             &response_flag, &status);
+         }
+      }
+
+      /* once all of our contacts have been matched, enter the barrier */
+      if (!barrier_active)
+      {
+         if (!contacts_complete)
+         {
+            hypre_MPI_Testall(num_contacts, contact_requests, &contacts_complete,
+                              hypre_MPI_STATUSES_IGNORE);
+         }
+         if (contacts_complete)
+         {
+            hypre_MPI_Ibarrier(comm, &barrier_request);
+            barrier_active = 1;
+         }
+      }
+      else if (!barrier_complete)
+      {
+         hypre_MPI_Test(&barrier_request, &barrier_complete, &status);
+      }
+   }
+
+   /* The tags are the same in every call with the same rnum.  A process
+      that returns early could otherwise start the next exchange while
+      another one is still probing for contacts of this one, which would
+      then answer a contact it does not belong to. */
+   hypre_MPI_Barrier(comm);
+
+   /*-----------------POST PROCESSING------------------------------*/
+
+   /* put the responses in the order of contact_proc_list */
+   response_recv_buf_starts = hypre_CTAlloc(HYPRE_Int, num_contacts + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_contacts; i++)
+   {
+      response_recv_buf_starts[i + 1] = response_recv_buf_starts[i] + response_sizes[i];
+   }
+
+   response_recv_buf = hypre_TAlloc(char, recv_pool_size, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_contacts; i++)
+   {
+      index_ptr = (void *) ((char *) response_recv_buf +
+                            response_recv_buf_starts[i] * response_obj_size);
+      hypre_TMemcpy(index_ptr, recv_pool + response_offsets[i], char,
+                    response_sizes[i] * response_obj_size,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+
+   /*--------------CLEAN UP------------------- */
+
+   if (send_array_size)
+   {
+      hypre_MPI_Waitall(send_array_size, send_requests, hypre_MPI_STATUSES_IGNORE);
+      for (i = 0; i < send_array_size; i++)
+      {
+         hypre_TFree(send_array[i], HYPRE_MEMORY_HOST);
+      }
+   }
+   hypre_TFree(send_array, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_requests, HYPRE_MEMORY_HOST);
+
+   hypre_TFree(recv_contact_buf, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_response_buf, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_pool, HYPRE_MEMORY_HOST);
+   hypre_TFree(response_offsets, HYPRE_MEMORY_HOST);
+   hypre_TFree(response_sizes, HYPRE_MEMORY_HOST);
+   hypre_TFree(sorted_procs, HYPRE_MEMORY_HOST);
+   hypre_TFree(sorted_index, HYPRE_MEMORY_HOST);
+   hypre_TFree(contact_requests, HYPRE_MEMORY_HOST);
+
+   /* output  */
+   *p_response_recv_buf = response_recv_buf;
+   *p_response_recv_buf_starts = response_recv_buf_starts;
+
+   return hypre_error_flag;
+}
@@ -353,6 +353,8 @@ HYPRE_Init()
 HYPRE_Int
 HYPRE_Finalize()
 {
+   hypre_TraceDestroy();
+
 #if defined(HYPRE_USING_UMPIRE)
    hypre_UmpireFinalize(_hypre_handle);
 #endif
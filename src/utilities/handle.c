@@ -34,6 +34,29 @@ hypre_SetSpMVUseVendor( HYPRE_Int use_vendor )
    return hypre_error_flag;
 }
 
+/* Host SpMV with SELL-C-sigma copies of the CSR matrices */
+HYPRE_Int
+hypre_SetSpMVUseSell( HYPRE_Int use_sell )
+{
+   hypre_HandleSpMVUseSell(hypre_handle()) = use_sell;
+   return hypre_error_flag;
+}
+
+/* Sparse data exchange: 0 = binary-tree termination, 1 = NBX */
+HYPRE_Int
+hypre_SetDataExchangeAlgorithm( HYPRE_Int value )
+{
+   if (value == 0 || value == 1)
+   {
+      hypre_HandleDataExchangeAlgorithm(hypre_handle()) = value;
+   }
+   else
+   {
+      hypre_error_in_arg(1);
+   }
+   return hypre_error_flag;
+}
+
 /* GPU SpGemm */
 HYPRE_Int
 hypre_SetSpGemmUseVendor( HYPRE_Int use_vendor )
@@ -68,6 +68,13 @@ hypre_MPI_Barrier( hypre_MPI_Comm comm )
    return (0);
 }
 
+HYPRE_Int
+hypre_MPI_Ibarrier( hypre_MPI_Comm     comm,
+                    hypre_MPI_Request *request )
+{
+   return (0);
+}
+
 HYPRE_Int
 hypre_MPI_Comm_create( hypre_MPI_Comm   comm,
                        hypre_MPI_Group  group,
@@ -404,6 +411,18 @@ hypre_MPI_Isend( void               *buf,
    return (0);
 }
 
+HYPRE_Int
+hypre_MPI_Issend( void               *buf,
+                  HYPRE_Int           count,
+                  hypre_MPI_Datatype  datatype,
+                  HYPRE_Int           dest,
+                  HYPRE_Int           tag,
+                  hypre_MPI_Comm      comm,
+                  hypre_MPI_Request  *request )
+{
+   return (0);
+}
+
 HYPRE_Int
 hypre_MPI_Irecv( void               *buf,
                  HYPRE_Int           count,
@@ -642,6 +661,19 @@ hypre_MPI_Allreduce( void              *sendbuf,
    return 0;
 }
 
+HYPRE_Int
+hypre_MPI_Iallreduce( void              *sendbuf,
+                      void              *recvbuf,
+                      HYPRE_Int          count,
+                      hypre_MPI_Datatype datatype,
+                      hypre_MPI_Op       op,
+                      hypre_MPI_Comm     comm,
+                      hypre_MPI_Request *request )
+{
+   *request = hypre_MPI_REQUEST_NULL;
+   return hypre_MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
+}
+
 HYPRE_Int
 hypre_MPI_Reduce( void               *sendbuf,
                   void               *recvbuf,
@@ -797,6 +829,19 @@ hypre_MPI_Barrier( hypre_MPI_Comm comm )
    return (HYPRE_Int) MPI_Barrier(comm);
 }
 
+HYPRE_Int
+hypre_MPI_Ibarrier( hypre_MPI_Comm     comm,
+                    hypre_MPI_Request *request )
+{
+#if MPI_VERSION >= 3
+   return (HYPRE_Int) MPI_Ibarrier(comm, request);
+#else
+   /* No nonblocking collectives before MPI-3; complete the barrier here */
+   *request = hypre_MPI_REQUEST_NULL;
+   return (HYPRE_Int) MPI_Barrier(comm);
+#endif
+}
+
 HYPRE_Int
 hypre_MPI_Comm_create( hypre_MPI_Comm   comm,
                        hypre_MPI_Group  group,
@@ -1118,6 +1163,19 @@ hypre_MPI_Isend( void               *buf,
                                 (hypre_int)dest, (hypre_int)tag, comm, request);
 }
 
+HYPRE_Int
+hypre_MPI_Issend( void               *buf,
+                  HYPRE_Int           count,
+                  hypre_MPI_Datatype  datatype,
+                  HYPRE_Int           dest,
+                  HYPRE_Int           tag,
+                  hypre_MPI_Comm      comm,
+                  hypre_MPI_Request  *request )
+{
+   return (HYPRE_Int) MPI_Issend(buf, (hypre_int)count, datatype,
+                                 (hypre_int)dest, (hypre_int)tag, comm, request);
+}
+
 HYPRE_Int
 hypre_MPI_Irecv( void               *buf,
                  HYPRE_Int           count,
@@ -1233,7 +1291,14 @@ HYPRE_Int
 hypre_MPI_Wait( hypre_MPI_Request *request,
                 hypre_MPI_Status  *status )
 {
-   return (HYPRE_Int) MPI_Wait(request, status);
+   HYPRE_Int  ierr;
+   HYPRE_Real t0 = hypre_TraceEnabled() ? MPI_Wtime() : 0.0;
+
+   ierr = (HYPRE_Int) MPI_Wait(request, status);
+
+   hypre_TraceCounter(HYPRE_TRACE_MPI_WAIT, MPI_Wtime() - t0);
+
+   return ierr;
 }
 
 HYPRE_Int
@@ -1241,8 +1306,15 @@ hypre_MPI_Waitall( HYPRE_Int          count,
                    hypre_MPI_Request *array_of_requests,
                    hypre_MPI_Status  *array_of_statuses )
 {
-   return (HYPRE_Int) MPI_Waitall((hypre_int)count,
+   HYPRE_Int  ierr;
+   HYPRE_Real t0 = hypre_TraceEnabled() ? MPI_Wtime() : 0.0;
+
+   ierr = (HYPRE_Int) MPI_Waitall((hypre_int)count,
                                   array_of_requests, array_of_statuses);
+
+   hypre_TraceCounter(HYPRE_TRACE_MPI_WAIT, MPI_Wtime() - t0);
+
+   return ierr;
 }
 
 HYPRE_Int
@@ -1251,11 +1323,16 @@ hypre_MPI_Waitany( HYPRE_Int          count,
                    HYPRE_Int         *index,
                    hypre_MPI_Status  *status )
 {
-   hypre_int mpi_index;
-   HYPRE_Int ierr;
+   hypre_int  mpi_index;
+   HYPRE_Int  ierr;
+   HYPRE_Real t0 = hypre_TraceEnabled() ? MPI_Wtime() : 0.0;
+
    ierr = (HYPRE_Int) MPI_Waitany((hypre_int)count, array_of_requests,
                                   &mpi_index, status);
    *index = (HYPRE_Int) mpi_index;
+
+   hypre_TraceCounter(HYPRE_TRACE_MPI_WAIT, MPI_Wtime() - t0);
+
    return ierr;
 }
 
@@ -1271,9 +1348,13 @@ hypre_MPI_Allreduce( void              *sendbuf,
    hypre_GpuProfilingPushRange("MPI_Allreduce");
 #endif
 
+   HYPRE_Real t0 = hypre_TraceEnabled() ? MPI_Wtime() : 0.0;
+
    HYPRE_Int result = MPI_Allreduce(sendbuf, recvbuf, (hypre_int)count,
                                     datatype, op, comm);
 
+   hypre_TraceCounter(HYPRE_TRACE_MPI_WAIT, MPI_Wtime() - t0);
+
 #if defined(HYPRE_USING_NVTX)
    hypre_GpuProfilingPopRange();
 #endif
@@ -1281,6 +1362,26 @@ hypre_MPI_Allreduce( void              *sendbuf,
    return result;
 }
 
+HYPRE_Int
+hypre_MPI_Iallreduce( void              *sendbuf,
+                      void              *recvbuf,
+                      HYPRE_Int          count,
+                      hypre_MPI_Datatype datatype,
+                      hypre_MPI_Op       op,
+                      hypre_MPI_Comm     comm,
+                      hypre_MPI_Request *request )
+{
+#if MPI_VERSION >= 3
+   return (HYPRE_Int) MPI_Iallreduce(sendbuf, recvbuf, (hypre_int)count,
+                                     datatype, op, comm, request);
+#else
+   /* No nonblocking collectives before MPI-3; complete the reduction here */
+   *request = hypre_MPI_REQUEST_NULL;
+   return (HYPRE_Int) MPI_Allreduce(sendbuf, recvbuf, (hypre_int)count,
+                                    datatype, op, comm);
+#endif
+}
+
 HYPRE_Int
 hypre_MPI_Reduce( void               *sendbuf,
                   void               *recvbuf,
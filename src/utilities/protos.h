@@ -144,6 +144,10 @@ void hypre_prefix_sum_triple(HYPRE_Int *in_out1, HYPRE_Int *sum1, HYPRE_Int *in_
 void hypre_prefix_sum_multiple(HYPRE_Int *in_out, HYPRE_Int *sum, HYPRE_Int n,
                                HYPRE_Int *workspace);
 
+/* dense_batched.c */
+HYPRE_Int hypre_DenseInverseBatched ( HYPRE_Int n, HYPRE_Int lda, HYPRE_Int stride,
+                                      HYPRE_Int num_blocks, HYPRE_Complex *A );
+
 /* hopscotch_hash.c */
 
 #ifdef HYPRE_USING_OPENMP
@@ -343,6 +347,8 @@ HYPRE_Int hypre_ForceSyncComputeStream(hypre_Handle *hypre_handle);
 /* handle.c */
 HYPRE_Int hypre_SetSpTransUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int hypre_SetSpMVUseVendor( HYPRE_Int use_vendor );
+HYPRE_Int hypre_SetSpMVUseSell( HYPRE_Int use_sell );
+HYPRE_Int hypre_SetDataExchangeAlgorithm( HYPRE_Int value );
 HYPRE_Int hypre_SetSpGemmUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int hypre_SetSpGemmAlgorithm( HYPRE_Int value );
 HYPRE_Int hypre_SetSpGemmRownnzEstimateMethod( HYPRE_Int value );
@@ -354,6 +360,15 @@ HYPRE_Int hypre_SetGaussSeidelMethod( HYPRE_Int gs_method );
 HYPRE_Int hypre_SetUserDeviceMalloc(GPUMallocFunc func);
 HYPRE_Int hypre_SetUserDeviceMfree(GPUMfreeFunc func);
 
+/* trace.c */
+HYPRE_Int hypre_TraceRegionBegin( const char *name, HYPRE_Int level );
+HYPRE_Int hypre_TraceRegionEnd( const char *name );
+HYPRE_Int hypre_TraceAddCounter( HYPRE_Int counter, HYPRE_Real value );
+HYPRE_Int hypre_TraceAddMatvec( HYPRE_Int num_rows, HYPRE_Int num_cols, HYPRE_Int num_nonzeros,
+                                HYPRE_Int num_vectors );
+HYPRE_Int hypre_TraceDestroy( void );
+HYPRE_Int hypre_TracePrint( const char *filename );
+
 /* int_array.c */
 hypre_IntArray* hypre_IntArrayCreate( HYPRE_Int size );
 HYPRE_Int hypre_IntArrayDestroy( hypre_IntArray *array );
@@ -0,0 +1,544 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Hierarchical region tracing (see trace.h)
+ *
+ *****************************************************************************/
+
+#include "_hypre_utilities.h"
+
+#define HYPRE_TRACE_MAX_EVENTS  (1 << 20)
+
+HYPRE_Int hypre__trace_level = 0;
+
+typedef struct
+{
+   char       *name;
+   HYPRE_Int   level;
+   HYPRE_Int   count;
+   HYPRE_Real  incl_time;
+   HYPRE_Real  excl_time;
+   HYPRE_Real  counters[HYPRE_TRACE_NUM_COUNTERS];   /* inclusive */
+
+} hypre_TraceRegion;
+
+typedef struct
+{
+   HYPRE_Int   region;
+   HYPRE_Int   depth;
+   HYPRE_Real  start;
+   HYPRE_Real  duration;
+   HYPRE_Real  counters[HYPRE_TRACE_NUM_COUNTERS];
+
+} hypre_TraceEvent;
+
+typedef struct
+{
+   HYPRE_Int   region;
+   HYPRE_Int   level;
+   HYPRE_Real  start;
+   HYPRE_Real  child_time;
+   HYPRE_Real  counters[HYPRE_TRACE_NUM_COUNTERS];   /* running totals at entry */
+
+} hypre_TraceFrame;
+
+typedef struct
+{
+   /* regions, with an open-addressing hash table on (name, level) */
+   hypre_TraceRegion  *regions;
+   HYPRE_Int           num_regions;
+   HYPRE_Int           max_regions;
+   HYPRE_Int          *table;
+   HYPRE_Int           table_size;
+
+   /* timeline (trace level 2) */
+   hypre_TraceEvent   *events;
+   HYPRE_Int           num_events;
+   HYPRE_Int           max_events;
+   HYPRE_Int           dropped_events;
+
+   /* stack of open regions */
+   hypre_TraceFrame    frames[HYPRE_TRACE_MAX_DEPTH];
+   HYPRE_Int           depth;
+   HYPRE_Int           overflow;
+
+   HYPRE_Real          totals[HYPRE_TRACE_NUM_COUNTERS];
+   HYPRE_Real          origin;
+
+} hypre_TraceData;
+
+static hypre_TraceData hypre__trace;
+
+static const char *hypre__trace_counter_names[HYPRE_TRACE_NUM_COUNTERS] =
+{
+   "bytes", "nnz", "msgs", "msg_bytes", "mpi_wait"
+};
+
+/*--------------------------------------------------------------------------
+ * Only the master thread outside of parallel regions records anything
+ *--------------------------------------------------------------------------*/
+
+static inline HYPRE_Int
+hypre_TraceIsMaster( void )
+{
+#ifdef HYPRE_USING_OPENMP
+   return !omp_in_parallel();
+#else
+   return 1;
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_TraceHash
+ *--------------------------------------------------------------------------*/
+
+static inline HYPRE_Int
+hypre_TraceHash( const char *name,
+                 HYPRE_Int   level,
+                 HYPRE_Int   table_size )
+{
+   hypre_uint h = 2166136261u;
+
+   while (*name)
+   {
+      h = (h ^ (hypre_uint) (unsigned char) *name++) * 16777619u;
+   }
+   h = (h ^ (hypre_uint) (level + 1)) * 16777619u;
+
+   return (HYPRE_Int) (h & (hypre_uint) (table_size - 1));
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_TraceRehash
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_TraceRehash( HYPRE_Int table_size )
+{
+   hypre_TraceData *trace = &hypre__trace;
+   HYPRE_Int        i, h;
+
+   hypre_TFree(trace -> table, HYPRE_MEMORY_HOST);
+   trace -> table      = hypre_TAlloc(HYPRE_Int, table_size, HYPRE_MEMORY_HOST);
+   trace -> table_size = table_size;
+   for (i = 0; i < table_size; i++)
+   {
+      trace -> table[i] = -1;
+   }
+
+   for (i = 0; i < trace -> num_regions; i++)
+   {
+      h = hypre_TraceHash(trace -> regions[i].name, trace -> regions[i].level, table_size);
+      while (trace -> table[h] > -1)
+      {
+         h = (h + 1) & (table_size - 1);
+      }
+      trace -> table[h] = i;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_TraceFindRegion
+ *
+ * Returns the index of region (name, level), creating it if needed.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_TraceFindRegion( const char *name,
+                       HYPRE_Int   level )
+{
+   hypre_TraceData   *trace = &hypre__trace;
+   hypre_TraceRegion *region;
+   HYPRE_Int          h, r, len;
+
+   if (2 * (trace -> num_regions + 1) > trace -> table_size)
+   {
+      hypre_TraceRehash(hypre_max(2 * trace -> table_size, 256));
+   }
+
+   h = hypre_TraceHash(name, level, trace -> table_size);
+   while ((r = trace -> table[h]) > -1)
+   {
+      region = &(trace -> regions[r]);
+      if (region -> level == level && strcmp(region -> name, name) == 0)
+      {
+         return r;
+      }
+      h = (h + 1) & (trace -> table_size - 1);
+   }
+
+   if (trace -> num_regions == trace -> max_regions)
+   {
+      trace -> max_regions = hypre_max(2 * trace -> max_regions, 128);
+      trace -> regions = hypre_TReAlloc(trace -> regions, hypre_TraceRegion,
+                                        trace -> max_regions, HYPRE_MEMORY_HOST);
+   }
+
+   r = trace -> num_regions++;
+   region = &(trace -> regions[r]);
+   memset(region, 0, sizeof(hypre_TraceRegion));
+   len = (HYPRE_Int) strlen(name);
+   region -> name = hypre_TAlloc(char, len + 1, HYPRE_MEMORY_HOST);
+   memcpy(region -> name, name, (size_t) (len + 1));
+   region -> level = level;
+   trace -> table[h] = r;
+
+   return r;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_TraceCloseFrame
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_TraceCloseFrame( HYPRE_Real now )
+{
+   hypre_TraceData   *trace  = &hypre__trace;
+   hypre_TraceFrame  *frame  = &(trace -> frames[trace -> depth - 1]);
+   hypre_TraceRegion *region = &(trace -> regions[frame -> region]);
+   hypre_TraceEvent  *event;
+   HYPRE_Real         duration = now - (frame -> start);
+   HYPRE_Int          c;
+
+   (region -> count)++;
+   region -> incl_time += duration;
+   region -> excl_time += duration - (frame -> child_time);
+   for (c = 0; c < HYPRE_TRACE_NUM_COUNTERS; c++)
+   {
+      region -> counters[c] += trace -> totals[c] - frame -> counters[c];
+   }
+
+   if (hypre__trace_level > 1)
+   {
+      if (trace -> num_events == trace -> max_events &&
+          trace -> max_events < HYPRE_TRACE_MAX_EVENTS)
+      {
+         trace -> max_events = hypre_min(hypre_max(2 * trace -> max_events, 4096),
+                                         HYPRE_TRACE_MAX_EVENTS);
+         trace -> events = hypre_TReAlloc(trace -> events, hypre_TraceEvent,
+                                          trace -> max_events, HYPRE_MEMORY_HOST);
+      }
+
+      if (trace -> num_events < trace -> max_events)
+      {
+         event = &(trace -> events[trace -> num_events++]);
+         event -> region   = frame -> region;
+         event -> depth    = trace -> depth - 1;
+         event -> start    = frame -> start - trace -> origin;
+         event -> duration = duration;
+         for (c = 0; c < HYPRE_TRACE_NUM_COUNTERS; c++)
+         {
+            event -> counters[c] = trace -> totals[c] - frame -> counters[c];
+         }
+      }
+      else
+      {
+         (trace -> dropped_events)++;
+      }
+   }
+
+   (trace -> depth)--;
+   if (trace -> depth > 0)
+   {
+      trace -> frames[trace -> depth - 1].child_time += duration;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_TraceRegionBegin
+ *
+ * Opens region 'name'.  A nonnegative 'level' sets the multigrid level of
+ * this region and everything nested in it; HYPRE_TRACE_LEVEL_INHERIT takes
+ * the level of the enclosing region (-1 outside of any multigrid level).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_TraceRegionBegin( const char *name,
+                        HYPRE_Int   level )
+{
+   hypre_TraceData  *trace = &hypre__trace;
+   hypre_TraceFrame *frame;
+
+   if (!hypre_TraceEnabled() || !hypre_TraceIsMaster())
+   {
+      return hypre_error_flag;
+   }
+
+   if (trace -> depth == HYPRE_TRACE_MAX_DEPTH)
+   {
+      (trace -> overflow)++;
+      return hypre_error_flag;
+   }
+
+   if (level == HYPRE_TRACE_LEVEL_INHERIT)
+   {
+      level = (trace -> depth > 0) ? trace -> frames[trace -> depth - 1].level : -1;
+   }
+
+   frame = &(trace -> frames[trace -> depth]);
+   frame -> region     = hypre_TraceFindRegion(name, level);
+   frame -> level      = level;
+   frame -> child_time = 0.0;
+   memcpy(frame -> counters, trace -> totals, HYPRE_TRACE_NUM_COUNTERS * sizeof(HYPRE_Real));
+   (trace -> depth)++;
+
+   /* Read the clock last so that bookkeeping is not charged to the region */
+   frame -> start = hypre_MPI_Wtime();
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_TraceRegionEnd
+ *
+ * Closes the innermost open region called 'name', along with any regions
+ * left open inside of it (e.g., by an early return).  Unmatched ends are
+ * ignored.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_TraceRegionEnd( const char *name )
+{
+   hypre_TraceData *trace = &hypre__trace;
+   HYPRE_Real       now;
+   HYPRE_Int        d;
+
+   if (!hypre_TraceEnabled() || !hypre_TraceIsMaster())
+   {
+      return hypre_error_flag;
+   }
+
+   now = hypre_MPI_Wtime();
+
+   if (trace -> overflow > 0)
+   {
+      (trace -> overflow)--;
+      return hypre_error_flag;
+   }
+
+   for (d = trace -> depth - 1; d >= 0; d--)
+   {
+      if (strcmp(trace -> regions[trace -> frames[d].region].name, name) == 0)
+      {
+         break;
+      }
+   }
+
+   while (d >= 0 && trace -> depth > d)
+   {
+      hypre_TraceCloseFrame(now);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_TraceAddCounter
+ *
+ * Adds 'value' to a counter; the amount is attributed to every open region.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_TraceAddCounter( HYPRE_Int  counter,
+                       HYPRE_Real value )
+{
+   if (hypre_TraceEnabled() && hypre_TraceIsMaster())
+   {
+      hypre__trace.totals[counter] += value;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_TraceAddMatvec
+ *
+ * Counts one product with a CSR block of 'num_rows' rows and 'num_nonzeros'
+ * nonzeros applied to 'num_vectors' vectors: the matrix is streamed once and
+ * each vector entry is read or written once.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_TraceAddMatvec( HYPRE_Int num_rows,
+                      HYPRE_Int num_cols,
+                      HYPRE_Int num_nonzeros,
+                      HYPRE_Int num_vectors )
+{
+   HYPRE_Real bytes;
+
+   bytes  = (HYPRE_Real) num_nonzeros * (sizeof(HYPRE_Complex) + sizeof(HYPRE_Int));
+   bytes += (HYPRE_Real) (num_rows + 1) * sizeof(HYPRE_Int);
+   bytes += (HYPRE_Real) num_vectors * (2 * num_rows + num_cols) * sizeof(HYPRE_Complex);
+
+   hypre_TraceAddCounter(HYPRE_TRACE_NNZ, (HYPRE_Real) num_nonzeros * num_vectors);
+   hypre_TraceAddCounter(HYPRE_TRACE_BYTES, bytes);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_TraceDestroy
+ *
+ * Frees the trace and turns tracing off.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_TraceDestroy( void )
+{
+   hypre_TraceData *trace = &hypre__trace;
+   HYPRE_Int        i;
+
+   for (i = 0; i < trace -> num_regions; i++)
+   {
+      hypre_TFree(trace -> regions[i].name, HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(trace -> regions, HYPRE_MEMORY_HOST);
+   hypre_TFree(trace -> table, HYPRE_MEMORY_HOST);
+   hypre_TFree(trace -> events, HYPRE_MEMORY_HOST);
+   memset(trace, 0, sizeof(hypre_TraceData));
+   hypre__trace_level = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_TracePrintString
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_TracePrintString( FILE       *file,
+                        const char *s )
+{
+   fputc('"', file);
+   for (; *s; s++)
+   {
+      if (*s == '"' || *s == '\\')
+      {
+         fputc('\\', file);
+      }
+      if ((unsigned char) *s >= 0x20)
+      {
+         fputc(*s, file);
+      }
+   }
+   fputc('"', file);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_TracePrintCounters
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_TracePrintCounters( FILE       *file,
+                          HYPRE_Real *counters )
+{
+   HYPRE_Int c;
+
+   for (c = 0; c < HYPRE_TRACE_NUM_COUNTERS; c++)
+   {
+      hypre_fprintf(file, ", \"%s\": %.17g", hypre__trace_counter_names[c], counters[c]);
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_TracePrint
+ *
+ * Writes the trace of this rank to 'filename.<rank>' in the Chrome trace
+ * event format (load it in chrome://tracing or ui.perfetto.dev).  The
+ * timeline goes into "traceEvents" as complete ("X") events, with times in
+ * microseconds; the per-region aggregates go into "hypreRegions", with times
+ * in seconds.  Regions that are still open are not included.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_TracePrint( const char *filename )
+{
+   hypre_TraceData   *trace = &hypre__trace;
+   hypre_TraceRegion *region;
+   hypre_TraceEvent  *event;
+   char               new_filename[1024];
+   FILE              *file;
+   HYPRE_Int          myid, i;
+
+   hypre_MPI_Comm_rank(hypre_MPI_COMM_WORLD, &myid);
+   hypre_sprintf(new_filename, "%s.%05d", filename, myid);
+   if ((file = fopen(new_filename, "w")) == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open output file\n");
+      return hypre_error_flag;
+   }
+
+   hypre_fprintf(file, "{\n\"displayTimeUnit\": \"ms\",\n\"traceEvents\": [\n");
+   hypre_fprintf(file, "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": %d, "
+                 "\"args\": {\"name\": \"rank %d\"}}", myid, myid);
+   for (i = 0; i < trace -> num_events; i++)
+   {
+      event  = &(trace -> events[i]);
+      region = &(trace -> regions[event -> region]);
+
+      hypre_fprintf(file, ",\n{\"name\": ");
+      hypre_TracePrintString(file, region -> name);
+      hypre_fprintf(file, ", \"cat\": \"hypre\", \"ph\": \"X\", \"pid\": %d, \"tid\": 0, "
+                    "\"ts\": %.3f, \"dur\": %.3f, \"args\": {\"level\": %d, \"depth\": %d",
+                    myid, 1.0e6 * event -> start, 1.0e6 * event -> duration,
+                    region -> level, event -> depth);
+      hypre_TracePrintCounters(file, event -> counters);
+      hypre_fprintf(file, "}}");
+   }
+   hypre_fprintf(file, "\n],\n\"otherData\": {\"rank\": %d, \"droppedEvents\": %d},\n",
+                 myid, trace -> dropped_events);
+
+   hypre_fprintf(file, "\"hypreRegions\": [");
+   for (i = 0; i < trace -> num_regions; i++)
+   {
+      region = &(trace -> regions[i]);
+
+      hypre_fprintf(file, "%s\n{\"name\": ", (i > 0) ? "," : "");
+      hypre_TracePrintString(file, region -> name);
+      hypre_fprintf(file, ", \"level\": %d, \"count\": %d, \"incl\": %.9e, \"excl\": %.9e",
+                    region -> level, region -> count, region -> incl_time, region -> excl_time);
+      hypre_TracePrintCounters(file, region -> counters);
+      hypre_fprintf(file, "}");
+   }
+   hypre_fprintf(file, "\n]\n}\n");
+
+   fclose(file);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetTraceLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SetTraceLevel( HYPRE_Int level )
+{
+   if (level < 0 || level > 2)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_TraceDestroy();
+   hypre__trace_level  = level;
+   hypre__trace.origin = hypre_MPI_Wtime();
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_PrintTrace
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_PrintTrace( const char *filename )
+{
+   return hypre_TracePrint(filename);
+}
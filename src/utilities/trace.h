@@ -0,0 +1,54 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Header file for hierarchical region tracing
+ *
+ * The tracer is always compiled in and switched on at runtime with
+ * HYPRE_SetTraceLevel().  Regions are opened and closed through the
+ * HYPRE_ANNOTATE_* macros (see caliper_instrumentation.h), so everything that
+ * is already annotated for Caliper is traced as well.  Regions are keyed by
+ * name and multigrid level and accumulate call counts, inclusive and
+ * exclusive wall time, and a small set of counters (bytes moved, nonzeros
+ * touched, messages and message bytes sent, and time spent waiting in MPI).
+ *
+ *    level 0 : off (default); every hook reduces to a single branch
+ *    level 1 : per-region aggregates only
+ *    level 2 : aggregates plus a timeline of region instances
+ *
+ * Only the master thread outside of OpenMP parallel regions records data.
+ *
+ *****************************************************************************/
+
+#ifndef hypre_TRACE_HEADER
+#define hypre_TRACE_HEADER
+
+#define HYPRE_TRACE_BYTES            0   /* bytes moved by kernels */
+#define HYPRE_TRACE_NNZ              1   /* matrix nonzeros touched by kernels */
+#define HYPRE_TRACE_MSGS             2   /* point-to-point messages sent */
+#define HYPRE_TRACE_MSG_BYTES        3   /* point-to-point bytes sent */
+#define HYPRE_TRACE_MPI_WAIT         4   /* seconds spent in MPI waits/reductions */
+#define HYPRE_TRACE_NUM_COUNTERS     5
+
+#define HYPRE_TRACE_NAME_MAX       256
+#define HYPRE_TRACE_MAX_DEPTH       64
+#define HYPRE_TRACE_LEVEL_INHERIT   -1
+
+extern HYPRE_Int hypre__trace_level;
+
+#define hypre_TraceEnabled()  (hypre__trace_level > 0)
+
+#define hypre_TraceCounter(counter, value)\
+{\
+   if (hypre_TraceEnabled())\
+   {\
+      hypre_TraceAddCounter(counter, (HYPRE_Real) (value));\
+   }\
+}
+
+#endif